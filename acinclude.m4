@@ -6,6 +6,20 @@ dnl Function to detect if libfvde dependencies are available
 AC_DEFUN([AX_LIBFVDE_CHECK_LOCAL],
   [dnl Check for internationalization functions in libfvde/libfvde_i18n.c
   AC_CHECK_FUNCS([bindtextdomain])
+
+  dnl Headers and functions included in libfvde/libfvde_mapped_file_io_handle.c
+  AC_CHECK_HEADERS([fcntl.h sys/mman.h sys/stat.h unistd.h])
+
+  AC_CHECK_FUNCS([madvise mmap munmap stat])
+
+  dnl Functions included in libfvde/libfvde_direct_file_io_handle.c
+  AC_CHECK_FUNCS([fcntl posix_fadvise posix_memalign pread])
+
+  dnl Headers included in libfvde/libfvde_aes_xts.c
+  AC_CHECK_HEADERS([cpuid.h wmmintrin.h])
+
+  dnl Functions included in libfvde/libfvde_crypto_backend.c
+  AC_CHECK_FUNCS([getenv])
 ])
 
 dnl Function to detect if fvdetools dependencies are available
@@ -372,6 +372,19 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	if( verbose != 0 )
+	{
+		if( info_handle_crypto_backend_fprint(
+		     fvdeinfo_info_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print crypto backend information.\n" );
+
+			goto on_error;
+		}
+	}
 	if( info_handle_close(
 	     fvdeinfo_info_handle,
 	     &error ) != 0 )
@@ -68,13 +68,18 @@ void usage_fprint(
 	}
 	fprintf( stream, "Use fvdemount to mount a FileVault Drive Encrypted (FVDE) volume\n\n" );
 
-	fprintf( stream, "Usage: fvdemount [ -e plist_path ] [ -k key ] [ -o offset ] [ -p password ]\n"
+	fprintf( stream, "Usage: fvdemount [ -b cache_unit_size ] [ -c cache_size ] [ -e plist_path ]\n"
+	                 "                 [ -k key ] [ -o offset ] [ -p password ]\n"
 	                 "                 [ -r recovery_password ] [ -X extended_options ] [ -huvV ]\n"
 	                 "                 sources mount_point\n\n" );
 
 	fprintf( stream, "\tsources:     one or more source files or devices\n\n" );
 	fprintf( stream, "\tmount_point: the directory to serve as mount point\n\n" );
 
+	fprintf( stream, "\t-b:          specify the size of the units that are cached, such as 4KiB\n"
+	                 "\t             (default is the bytes per sector)\n" );
+	fprintf( stream, "\t-c:          specify the maximum cache size per logical volume, such as 64MiB\n"
+	                 "\t             (default is 16MiB)\n" );
 	fprintf( stream, "\t-e:          specify the path of the EncryptedRoot.plist.wipekey file\n" );
 	fprintf( stream, "\t-h:          shows this help\n" );
 	fprintf( stream, "\t-k:          specify the volume master key formatted in base16\n" );
@@ -143,6 +148,8 @@ int main( int argc, char * const argv[] )
 	system_character_t * const *sources                  = NULL;
 	libfvde_error_t *error                               = NULL;
 	system_character_t *mount_point                      = NULL;
+	system_character_t *option_cache_size                = NULL;
+	system_character_t *option_cache_unit_size           = NULL;
 	system_character_t *option_encrypted_root_plist_path = NULL;
 	system_character_t *option_extended_options          = NULL;
 	system_character_t *option_key                       = NULL;
@@ -211,7 +218,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = fvdetools_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "e:hk:o:p:r:uvVX:" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "b:c:e:hk:o:p:r:uvVX:" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -227,6 +234,16 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_FAILURE );
 
+			case (system_integer_t) 'b':
+				option_cache_unit_size = optarg;
+
+				break;
+
+			case (system_integer_t) 'c':
+				option_cache_size = optarg;
+
+				break;
+
 			case (system_integer_t) 'e':
 				option_encrypted_root_plist_path = optarg;
 
@@ -354,6 +371,34 @@ int main( int argc, char * const argv[] )
 			goto on_error;
 		}
 	}
+	if( option_cache_size != NULL )
+	{
+		if( mount_handle_set_maximum_cache_size(
+		     fvdemount_mount_handle,
+		     option_cache_size,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set cache size.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_cache_unit_size != NULL )
+	{
+		if( mount_handle_set_cache_unit_size(
+		     fvdemount_mount_handle,
+		     option_cache_unit_size,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set cache unit size.\n" );
+
+			goto on_error;
+		}
+	}
 	if( option_offset != NULL )
 	{
 		if( mount_handle_set_offset(
@@ -485,6 +530,10 @@ int main( int argc, char * const argv[] )
 	fvdemount_fuse_operations.getattr    = &mount_fuse_getattr;
 	fvdemount_fuse_operations.destroy    = &mount_fuse_destroy;
 
+#if defined( HAVE_MOUNT_FUSE_LSEEK )
+	fvdemount_fuse_operations.lseek      = &mount_fuse_lseek;
+#endif
+
 #if defined( HAVE_LIBFUSE3 )
 	fvdemount_fuse_handle = fuse_new(
 	                         &fvdemount_fuse_arguments,
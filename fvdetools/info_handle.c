@@ -1835,6 +1835,71 @@ on_error:
 	return( -1 );
 }
 
+/* Prints the crypto backend information to a stream
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_crypto_backend_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	const char *crypto_backend_string = NULL;
+	static char *function             = "info_handle_crypto_backend_fprint";
+	int crypto_backend                = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvde_get_crypto_backend(
+	     &crypto_backend,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve crypto backend.",
+		 function );
+
+		return( -1 );
+	}
+	switch( crypto_backend )
+	{
+		case LIBFVDE_CRYPTO_BACKEND_LIBCAES:
+			crypto_backend_string = "libcaes";
+			break;
+
+		case LIBFVDE_CRYPTO_BACKEND_OPENSSL:
+			crypto_backend_string = "OpenSSL EVP";
+			break;
+
+		case LIBFVDE_CRYPTO_BACKEND_AESNI:
+			crypto_backend_string = "AES-NI";
+			break;
+
+		default:
+			crypto_backend_string = "Unknown";
+			break;
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "Crypto backend\t\t\t\t: %s\n",
+	 crypto_backend_string );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\n" );
+
+	return( 1 );
+}
+
 /* Prints the volume information to a stream
  * Returns 1 if successful or -1 on error
  */
@@ -173,6 +173,10 @@ int info_handle_logical_volume_fprint(
      libfvde_logical_volume_t *logical_volume,
      libcerror_error_t **error );
 
+int info_handle_crypto_backend_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
 int info_handle_volume_fprint(
      info_handle_t *info_handle,
      libcerror_error_t **error );
@@ -834,7 +834,7 @@ ssize_t mount_file_entry_read_buffer_at_offset(
 
 		return( -1 );
 	}
-	read_count = libfvde_logical_volume_read_buffer_at_offset(
+	read_count = libfvde_logical_volume_pread_buffer(
 	              logical_volume,
 	              buffer,
 	              buffer_size,
@@ -858,6 +858,67 @@ ssize_t mount_file_entry_read_buffer_at_offset(
 	return( read_count );
 }
 
+/* Seeks a certain offset of the data
+ * This is used to determine the offset of the next data or hole with SEEK_DATA or SEEK_HOLE
+ * Returns the offset if seek is successful or -1 on error
+ */
+off64_t mount_file_entry_seek_offset(
+         mount_file_entry_t *file_entry,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	libfvde_logical_volume_t *logical_volume = NULL;
+	static char *function                     = "mount_file_entry_seek_offset";
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( mount_file_system_get_logical_volume_by_index(
+	     file_entry->file_system,
+	     file_entry->logical_volume_index,
+	     &logical_volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve logical volume: %d from file system.",
+		 function,
+		 file_entry->logical_volume_index );
+
+		return( -1 );
+	}
+	offset = libfvde_logical_volume_seek_offset(
+	          logical_volume,
+	          offset,
+	          whence,
+	          error );
+
+	if( offset == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset in logical volume: %d.",
+		 function,
+		 file_entry->logical_volume_index );
+
+		return( -1 );
+	}
+	return( offset );
+}
+
 /* Retrieves the size
  * Returns 1 if successful or -1 on error
  */
@@ -46,6 +46,30 @@
 #include <osxfuse/fuse.h>
 #endif
 
+/* The lseek operation was added in FUSE 3.8
+ */
+#if defined( HAVE_LIBFUSE3 ) && defined( FUSE_MAKE_VERSION )
+#if FUSE_VERSION >= FUSE_MAKE_VERSION( 3, 8 )
+
+/* glibc only defines the SEEK_DATA and SEEK_HOLE whence values if _GNU_SOURCE
+ * is defined, their values are the same on all Linux platforms
+ */
+#if defined( __linux__ )
+#if !defined( SEEK_DATA )
+#define SEEK_DATA	3
+#endif
+#if !defined( SEEK_HOLE )
+#define SEEK_HOLE	4
+#endif
+#endif /* defined( __linux__ ) */
+
+#if defined( SEEK_DATA ) && defined( SEEK_HOLE )
+#define HAVE_MOUNT_FUSE_LSEEK	1
+#endif
+
+#endif /* FUSE_VERSION >= FUSE_MAKE_VERSION( 3, 8 ) */
+#endif /* defined( HAVE_LIBFUSE3 ) && defined( FUSE_MAKE_VERSION ) */
+
 #endif /* defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 ) || defined( HAVE_LIBOSXFUSE ) */
 
 #include "fvdetools_libcerror.h"
@@ -91,6 +115,14 @@ int mount_fuse_release(
      const char *path,
      struct fuse_file_info *file_info );
 
+#if defined( HAVE_MOUNT_FUSE_LSEEK )
+off_t mount_fuse_lseek(
+       const char *path,
+       off_t offset,
+       int whence,
+       struct fuse_file_info *file_info );
+#endif
+
 int mount_fuse_opendir(
      const char *path,
      struct fuse_file_info *file_info );
@@ -27,6 +27,7 @@
 #include <types.h>
 #include <wide_string.h>
 
+#include "byte_size_string.h"
 #include "fvdetools_input.h"
 #include "fvdetools_libbfio.h"
 #include "fvdetools_libcdata.h"
@@ -549,6 +550,109 @@ int mount_handle_set_offset(
 	return( 1 );
 }
 
+/* Sets the maximum cache size of the logical volumes
+ * Returns 1 if successful or -1 on error
+ */
+int mount_handle_set_maximum_cache_size(
+     mount_handle_t *mount_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_handle_set_maximum_cache_size";
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
+
+	if( mount_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( byte_size_string_convert(
+	     string,
+	     string_length,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to convert byte size string.",
+		 function );
+
+		return( -1 );
+	}
+	mount_handle->maximum_cache_size = (size64_t) value_64bit;
+
+	return( 1 );
+}
+
+/* Sets the cache unit size of the logical volumes
+ * Returns 1 if successful or -1 on error
+ */
+int mount_handle_set_cache_unit_size(
+     mount_handle_t *mount_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_handle_set_cache_unit_size";
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
+
+	if( mount_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( byte_size_string_convert(
+	     string,
+	     string_length,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to convert byte size string.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_64bit > (uint64_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid cache unit size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	mount_handle->cache_unit_size = (uint32_t) value_64bit;
+
+	return( 1 );
+}
+
 /* Sets the password
  * Returns 1 if successful or -1 on error
  */
@@ -805,6 +909,34 @@ int mount_handle_open(
 
 		goto on_error;
 	}
+	if( libfvde_volume_set_maximum_cache_size(
+	     mount_handle->volume,
+	     mount_handle->maximum_cache_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set maximum cache size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfvde_volume_set_cache_unit_size(
+	     mount_handle->volume,
+	     mount_handle->cache_unit_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set cache unit size.",
+		 function );
+
+		goto on_error;
+	}
 	if( mount_handle->encrypted_root_plist_path != NULL )
 	{
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
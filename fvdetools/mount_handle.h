@@ -62,6 +62,14 @@ struct mount_handle
 	 */
 	off64_t volume_offset;
 
+	/* The maximum cache size of the logical volumes
+	 */
+	size64_t maximum_cache_size;
+
+	/* The cache unit size of the logical volumes
+	 */
+	uint32_t cache_unit_size;
+
 	/* The recovery password
 	 */
 	const system_character_t *recovery_password;
@@ -137,6 +145,16 @@ int mount_handle_set_offset(
      const system_character_t *string,
      libcerror_error_t **error );
 
+int mount_handle_set_maximum_cache_size(
+     mount_handle_t *mount_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int mount_handle_set_cache_unit_size(
+     mount_handle_t *mount_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
 int mount_handle_set_password(
      mount_handle_t *mount_handle,
      const system_character_t *string,
@@ -0,0 +1,79 @@
+/*
+ * The metadata snapshot file definition
+ *
+ * Copyright (C) 2011-2024, Omar Choudary <choudary.omar@gmail.com>
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _FVDE_METADATA_SNAPSHOT_H )
+#define _FVDE_METADATA_SNAPSHOT_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct fvde_metadata_snapshot_header fvde_metadata_snapshot_header_t;
+
+struct fvde_metadata_snapshot_header
+{
+	/* The signature
+	 * Consists of 8 bytes
+	 * Contains "fvdesnap"
+	 */
+	uint8_t signature[ 8 ];
+
+	/* The format version
+	 * Consists of 4 bytes
+	 * Contains 1
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* The data size
+	 * Consists of 4 bytes
+	 */
+	uint8_t data_size[ 4 ];
+
+	/* The volume group identifier
+	 * Consists of 16 bytes
+	 */
+	uint8_t volume_group_identifier[ 16 ];
+
+	/* The (metadata) transaction identifier
+	 * Consists of 8 bytes
+	 */
+	uint8_t transaction_identifier[ 8 ];
+
+	/* The checksum of the data
+	 * Consists of 4 bytes
+	 */
+	uint8_t checksum[ 4 ];
+
+	/* Padding
+	 * Consists of 4 bytes
+	 */
+	uint8_t padding[ 4 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _FVDE_METADATA_SNAPSHOT_H ) */
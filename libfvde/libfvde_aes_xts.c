@@ -0,0 +1,511 @@
+/*
+ * AES-XTS sector decryption functions
+ *
+ * Copyright (C) 2011-2024, Omar Choudary <choudary.omar@gmail.com>
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfvde_aes_xts.h"
+#include "libfvde_libcerror.h"
+
+#if defined( HAVE_LIBFVDE_AES_XTS_AESNI_SUPPORT )
+
+#include <cpuid.h>
+#include <emmintrin.h>
+#include <wmmintrin.h>
+
+#define LIBFVDE_AES_XTS_AESNI_TARGET \
+	__attribute__((target("aes,sse2")))
+
+/* The number of XTS blocks that are decrypted in parallel
+ */
+#define LIBFVDE_AES_XTS_AESNI_NUMBER_OF_LANES	8
+
+#define LIBFVDE_AES_XTS_AESNI_EXPAND_KEY( round_keys, round_index, round_constant ) \
+	round_keys[ round_index ] = libfvde_aes_xts_aesni_expand_key( \
+	                             round_keys[ round_index - 1 ], \
+	                             _mm_aeskeygenassist_si128( round_keys[ round_index - 1 ], round_constant ) )
+
+/* Expands an AES-128 round key from the previous round key
+ */
+static LIBFVDE_AES_XTS_AESNI_TARGET __m128i libfvde_aes_xts_aesni_expand_key(
+                                             __m128i round_key,
+                                             __m128i key_assist )
+{
+	key_assist = _mm_shuffle_epi32(
+	              key_assist,
+	              0xff );
+
+	round_key = _mm_xor_si128(
+	             round_key,
+	             _mm_slli_si128(
+	              round_key,
+	              4 ) );
+	round_key = _mm_xor_si128(
+	             round_key,
+	             _mm_slli_si128(
+	              round_key,
+	              4 ) );
+	round_key = _mm_xor_si128(
+	             round_key,
+	             _mm_slli_si128(
+	              round_key,
+	              4 ) );
+
+	return( _mm_xor_si128(
+	         round_key,
+	         key_assist ) );
+}
+
+/* Expands an AES-128 key into the 11 encryption round keys
+ */
+static LIBFVDE_AES_XTS_AESNI_TARGET void libfvde_aes_xts_aesni_expand_key_128(
+                                          const uint8_t *key,
+                                          __m128i *round_keys )
+{
+	round_keys[ 0 ] = _mm_loadu_si128(
+	                   (const __m128i *) key );
+
+	LIBFVDE_AES_XTS_AESNI_EXPAND_KEY( round_keys, 1, 0x01 );
+	LIBFVDE_AES_XTS_AESNI_EXPAND_KEY( round_keys, 2, 0x02 );
+	LIBFVDE_AES_XTS_AESNI_EXPAND_KEY( round_keys, 3, 0x04 );
+	LIBFVDE_AES_XTS_AESNI_EXPAND_KEY( round_keys, 4, 0x08 );
+	LIBFVDE_AES_XTS_AESNI_EXPAND_KEY( round_keys, 5, 0x10 );
+	LIBFVDE_AES_XTS_AESNI_EXPAND_KEY( round_keys, 6, 0x20 );
+	LIBFVDE_AES_XTS_AESNI_EXPAND_KEY( round_keys, 7, 0x40 );
+	LIBFVDE_AES_XTS_AESNI_EXPAND_KEY( round_keys, 8, 0x80 );
+	LIBFVDE_AES_XTS_AESNI_EXPAND_KEY( round_keys, 9, 0x1b );
+	LIBFVDE_AES_XTS_AESNI_EXPAND_KEY( round_keys, 10, 0x36 );
+}
+
+/* Multiplies a tweak value by the primitive element of GF(2^128)
+ */
+static LIBFVDE_AES_XTS_AESNI_TARGET __m128i libfvde_aes_xts_aesni_multiply_tweak(
+                                             __m128i tweak_value )
+{
+	__m128i carry = _mm_srai_epi32(
+	                 tweak_value,
+	                 31 );
+
+	/* Move the carry of every 32-bit lane to the next lane, where the carry
+	 * of the most significant lane is reduced into the least significant lane
+	 */
+	carry = _mm_shuffle_epi32(
+	         carry,
+	         0x93 );
+
+	carry = _mm_and_si128(
+	         carry,
+	         _mm_set_epi32(
+	          1,
+	          1,
+	          1,
+	          0x87 ) );
+
+	return( _mm_xor_si128(
+	         _mm_slli_epi32(
+	          tweak_value,
+	          1 ),
+	         carry ) );
+}
+
+#endif /* defined( HAVE_LIBFVDE_AES_XTS_AESNI_SUPPORT ) */
+
+/* Determines if the CPU supports the AES-NI instructions
+ * Returns 1 if supported or 0 if not
+ */
+int libfvde_aes_xts_aesni_is_supported(
+     void )
+{
+#if defined( HAVE_LIBFVDE_AES_XTS_AESNI_SUPPORT )
+	unsigned int eax = 0;
+	unsigned int ebx = 0;
+	unsigned int ecx = 0;
+	unsigned int edx = 0;
+
+	if( __get_cpuid(
+	     1,
+	     &eax,
+	     &ebx,
+	     &ecx,
+	     &edx ) == 0 )
+	{
+		return( 0 );
+	}
+	if( ( ( ecx & bit_AES ) == 0 )
+	 || ( ( edx & bit_SSE2 ) == 0 ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+#else
+	return( 0 );
+#endif /* defined( HAVE_LIBFVDE_AES_XTS_AESNI_SUPPORT ) */
+}
+
+/* Sets the AES-128 keys
+ * Returns 1 if successful or -1 on error
+ */
+#if defined( HAVE_LIBFVDE_AES_XTS_AESNI_SUPPORT )
+LIBFVDE_AES_XTS_AESNI_TARGET
+#endif
+int libfvde_aes_xts_aesni_set_keys(
+     libfvde_aes_xts_keys_t *keys,
+     const uint8_t *key,
+     const uint8_t *tweak_key,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_aes_xts_aesni_set_keys";
+
+#if defined( HAVE_LIBFVDE_AES_XTS_AESNI_SUPPORT )
+	__m128i round_keys[ 11 ];
+
+	int round_index       = 0;
+#endif
+
+	if( keys == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid keys.",
+		 function );
+
+		return( -1 );
+	}
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( tweak_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tweak key.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFVDE_AES_XTS_AESNI_SUPPORT )
+	/* The decryption round keys are the encryption round keys in reverse order
+	 * with the inverse mix columns transformation applied to the inner round keys
+	 */
+	libfvde_aes_xts_aesni_expand_key_128(
+	 key,
+	 round_keys );
+
+	_mm_storeu_si128(
+	 (__m128i *) keys->decryption_round_keys,
+	 round_keys[ 10 ] );
+
+	for( round_index = 1;
+	     round_index < 10;
+	     round_index++ )
+	{
+		_mm_storeu_si128(
+		 (__m128i *) &( keys->decryption_round_keys[ round_index * 16 ] ),
+		 _mm_aesimc_si128(
+		  round_keys[ 10 - round_index ] ) );
+	}
+	_mm_storeu_si128(
+	 (__m128i *) &( keys->decryption_round_keys[ 160 ] ),
+	 round_keys[ 0 ] );
+
+	libfvde_aes_xts_aesni_expand_key_128(
+	 tweak_key,
+	 round_keys );
+
+	for( round_index = 0;
+	     round_index < 11;
+	     round_index++ )
+	{
+		_mm_storeu_si128(
+		 (__m128i *) &( keys->tweak_round_keys[ round_index * 16 ] ),
+		 round_keys[ round_index ] );
+	}
+	memory_set(
+	 round_keys,
+	 0,
+	 sizeof( __m128i ) * 11 );
+
+	return( 1 );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: AES-NI is not supported.",
+	 function );
+
+	return( -1 );
+#endif /* defined( HAVE_LIBFVDE_AES_XTS_AESNI_SUPPORT ) */
+}
+
+/* Decrypts consecutive sectors using AES-XTS
+ * The tweak value of the first sector is the block number and is incremented per sector
+ * The blocks of a sector are decrypted 8 at a time, with the tweak values of
+ * consecutive blocks derived from the tweak value of the previous block
+ * The sector size must be a multitude of the AES block size
+ * Returns 1 if successful or -1 on error
+ */
+#if defined( HAVE_LIBFVDE_AES_XTS_AESNI_SUPPORT )
+LIBFVDE_AES_XTS_AESNI_TARGET
+#endif
+int libfvde_aes_xts_aesni_decrypt_sectors(
+     libfvde_aes_xts_keys_t *keys,
+     const uint8_t *input_data,
+     uint8_t *output_data,
+     size_t data_size,
+     size_t sector_size,
+     uint64_t block_number,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_aes_xts_aesni_decrypt_sectors";
+
+#if defined( HAVE_LIBFVDE_AES_XTS_AESNI_SUPPORT )
+	__m128i blocks[ LIBFVDE_AES_XTS_AESNI_NUMBER_OF_LANES ];
+	__m128i decryption_round_keys[ 11 ];
+	__m128i tweak_round_keys[ 11 ];
+	__m128i tweak_values[ LIBFVDE_AES_XTS_AESNI_NUMBER_OF_LANES ];
+
+	__m128i tweak_value   = _mm_setzero_si128();
+	size_t data_offset    = 0;
+	size_t sector_end     = 0;
+	int lane_index        = 0;
+	int round_index       = 0;
+#endif
+
+	if( keys == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid keys.",
+		 function );
+
+		return( -1 );
+	}
+	if( input_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input data.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( sector_size == 0 )
+	 || ( ( sector_size % 16 ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported sector size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size > (size_t) SSIZE_MAX )
+	 || ( ( data_size % sector_size ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFVDE_AES_XTS_AESNI_SUPPORT )
+	for( round_index = 0;
+	     round_index < 11;
+	     round_index++ )
+	{
+		decryption_round_keys[ round_index ] = _mm_loadu_si128(
+		                                        (const __m128i *) &( keys->decryption_round_keys[ round_index * 16 ] ) );
+
+		tweak_round_keys[ round_index ] = _mm_loadu_si128(
+		                                   (const __m128i *) &( keys->tweak_round_keys[ round_index * 16 ] ) );
+	}
+	while( data_offset < data_size )
+	{
+		/* The tweak value of a sector is the encrypted 128-bit little-endian block number
+		 */
+		tweak_value = _mm_set_epi64x(
+		               0,
+		               (long long) block_number );
+
+		tweak_value = _mm_xor_si128(
+		               tweak_value,
+		               tweak_round_keys[ 0 ] );
+
+		for( round_index = 1;
+		     round_index < 10;
+		     round_index++ )
+		{
+			tweak_value = _mm_aesenc_si128(
+			               tweak_value,
+			               tweak_round_keys[ round_index ] );
+		}
+		tweak_value = _mm_aesenclast_si128(
+		               tweak_value,
+		               tweak_round_keys[ 10 ] );
+
+		sector_end = data_offset + sector_size;
+
+		while( ( data_offset + ( 16 * LIBFVDE_AES_XTS_AESNI_NUMBER_OF_LANES ) ) <= sector_end )
+		{
+			for( lane_index = 0;
+			     lane_index < LIBFVDE_AES_XTS_AESNI_NUMBER_OF_LANES;
+			     lane_index++ )
+			{
+				tweak_values[ lane_index ] = tweak_value;
+
+				tweak_value = libfvde_aes_xts_aesni_multiply_tweak(
+				               tweak_value );
+
+				blocks[ lane_index ] = _mm_xor_si128(
+				                        _mm_loadu_si128(
+				                         (const __m128i *) &( input_data[ data_offset + ( lane_index * 16 ) ] ) ),
+				                        tweak_values[ lane_index ] );
+
+				blocks[ lane_index ] = _mm_xor_si128(
+				                        blocks[ lane_index ],
+				                        decryption_round_keys[ 0 ] );
+			}
+			/* The blocks are independent, so the rounds of the lanes are interleaved
+			 * to hide the latency of the AES instructions
+			 */
+			for( round_index = 1;
+			     round_index < 10;
+			     round_index++ )
+			{
+				for( lane_index = 0;
+				     lane_index < LIBFVDE_AES_XTS_AESNI_NUMBER_OF_LANES;
+				     lane_index++ )
+				{
+					blocks[ lane_index ] = _mm_aesdec_si128(
+					                        blocks[ lane_index ],
+					                        decryption_round_keys[ round_index ] );
+				}
+			}
+			for( lane_index = 0;
+			     lane_index < LIBFVDE_AES_XTS_AESNI_NUMBER_OF_LANES;
+			     lane_index++ )
+			{
+				blocks[ lane_index ] = _mm_aesdeclast_si128(
+				                        blocks[ lane_index ],
+				                        decryption_round_keys[ 10 ] );
+
+				_mm_storeu_si128(
+				 (__m128i *) &( output_data[ data_offset + ( lane_index * 16 ) ] ),
+				 _mm_xor_si128(
+				  blocks[ lane_index ],
+				  tweak_values[ lane_index ] ) );
+			}
+			data_offset += 16 * LIBFVDE_AES_XTS_AESNI_NUMBER_OF_LANES;
+		}
+		while( data_offset < sector_end )
+		{
+			blocks[ 0 ] = _mm_xor_si128(
+			               _mm_loadu_si128(
+			                (const __m128i *) &( input_data[ data_offset ] ) ),
+			               tweak_value );
+
+			blocks[ 0 ] = _mm_xor_si128(
+			               blocks[ 0 ],
+			               decryption_round_keys[ 0 ] );
+
+			for( round_index = 1;
+			     round_index < 10;
+			     round_index++ )
+			{
+				blocks[ 0 ] = _mm_aesdec_si128(
+				               blocks[ 0 ],
+				               decryption_round_keys[ round_index ] );
+			}
+			blocks[ 0 ] = _mm_aesdeclast_si128(
+			               blocks[ 0 ],
+			               decryption_round_keys[ 10 ] );
+
+			_mm_storeu_si128(
+			 (__m128i *) &( output_data[ data_offset ] ),
+			 _mm_xor_si128(
+			  blocks[ 0 ],
+			  tweak_value ) );
+
+			tweak_value = libfvde_aes_xts_aesni_multiply_tweak(
+			               tweak_value );
+
+			data_offset += 16;
+		}
+		block_number += 1;
+	}
+	memory_set(
+	 decryption_round_keys,
+	 0,
+	 sizeof( __m128i ) * 11 );
+
+	memory_set(
+	 tweak_round_keys,
+	 0,
+	 sizeof( __m128i ) * 11 );
+
+	return( 1 );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: AES-NI is not supported.",
+	 function );
+
+	return( -1 );
+#endif /* defined( HAVE_LIBFVDE_AES_XTS_AESNI_SUPPORT ) */
+}
+
@@ -0,0 +1,82 @@
+/*
+ * AES-XTS sector decryption functions
+ *
+ * Copyright (C) 2011-2024, Omar Choudary <choudary.omar@gmail.com>
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFVDE_AES_XTS_H )
+#define _LIBFVDE_AES_XTS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfvde_libcerror.h"
+
+/* The AES-NI kernel requires the x86 AES instructions, which are enabled per function
+ * so that the library does not require a CPU with AES-NI support
+ */
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) ) && defined( HAVE_CPUID_H ) && defined( HAVE_WMMINTRIN_H )
+#define HAVE_LIBFVDE_AES_XTS_AESNI_SUPPORT
+#endif
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the AES-128 round keys
+ */
+#define LIBFVDE_AES_XTS_ROUND_KEYS_SIZE		176
+
+typedef struct libfvde_aes_xts_keys libfvde_aes_xts_keys_t;
+
+struct libfvde_aes_xts_keys
+{
+	/* The AES-128 decryption round keys of the data key
+	 */
+	uint8_t decryption_round_keys[ LIBFVDE_AES_XTS_ROUND_KEYS_SIZE ];
+
+	/* The AES-128 encryption round keys of the tweak key
+	 */
+	uint8_t tweak_round_keys[ LIBFVDE_AES_XTS_ROUND_KEYS_SIZE ];
+};
+
+int libfvde_aes_xts_aesni_is_supported(
+     void );
+
+int libfvde_aes_xts_aesni_set_keys(
+     libfvde_aes_xts_keys_t *keys,
+     const uint8_t *key,
+     const uint8_t *tweak_key,
+     libcerror_error_t **error );
+
+int libfvde_aes_xts_aesni_decrypt_sectors(
+     libfvde_aes_xts_keys_t *keys,
+     const uint8_t *input_data,
+     uint8_t *output_data,
+     size_t data_size,
+     size_t sector_size,
+     uint64_t block_number,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFVDE_AES_XTS_H ) */
+
@@ -0,0 +1,238 @@
+/*
+ * Crypto backend functions
+ *
+ * Copyright (C) 2011-2024, Omar Choudary <choudary.omar@gmail.com>
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "libfvde_aes_xts.h"
+#include "libfvde_crypto_backend.h"
+#include "libfvde_definitions.h"
+#include "libfvde_libcerror.h"
+
+/* The crypto backend requested by libfvde_set_crypto_backend
+ */
+static int libfvde_crypto_backend_requested = LIBFVDE_CRYPTO_BACKEND_DEFAULT;
+
+/* Determines if a crypto backend is supported by the library and the CPU
+ * Returns 1 if supported or 0 if not
+ */
+int libfvde_crypto_backend_is_supported(
+     int crypto_backend )
+{
+	switch( crypto_backend )
+	{
+		case LIBFVDE_CRYPTO_BACKEND_LIBCAES:
+			return( 1 );
+
+		case LIBFVDE_CRYPTO_BACKEND_OPENSSL:
+#if defined( HAVE_LIBFVDE_OPENSSL_AES_XTS_SUPPORT )
+			return( 1 );
+#else
+			return( 0 );
+#endif
+
+		case LIBFVDE_CRYPTO_BACKEND_AESNI:
+			return( libfvde_aes_xts_aesni_is_supported() );
+
+		default:
+			break;
+	}
+	return( 0 );
+}
+
+/* Retrieves the crypto backend from the LIBFVDE_CRYPTO_BACKEND environment variable
+ * The value is one of: libcaes, openssl or aesni
+ * Returns 1 if successful or 0 if not set or not recognized
+ */
+int libfvde_crypto_backend_get_from_environment(
+     int *crypto_backend )
+{
+#if defined( HAVE_GETENV )
+	const char *value   = NULL;
+	size_t value_length = 0;
+#endif
+
+	if( crypto_backend == NULL )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_GETENV )
+	value = getenv(
+	         LIBFVDE_CRYPTO_BACKEND_ENVIRONMENT_VARIABLE );
+
+	if( value == NULL )
+	{
+		return( 0 );
+	}
+	value_length = narrow_string_length(
+	                value );
+
+	if( value_length == 5 )
+	{
+		if( narrow_string_compare(
+		     value,
+		     "aesni",
+		     5 ) == 0 )
+		{
+			*crypto_backend = LIBFVDE_CRYPTO_BACKEND_AESNI;
+
+			return( 1 );
+		}
+	}
+	else if( value_length == 7 )
+	{
+		if( narrow_string_compare(
+		     value,
+		     "libcaes",
+		     7 ) == 0 )
+		{
+			*crypto_backend = LIBFVDE_CRYPTO_BACKEND_LIBCAES;
+
+			return( 1 );
+		}
+		else if( narrow_string_compare(
+		          value,
+		          "openssl",
+		          7 ) == 0 )
+		{
+			*crypto_backend = LIBFVDE_CRYPTO_BACKEND_OPENSSL;
+
+			return( 1 );
+		}
+	}
+#endif /* defined( HAVE_GETENV ) */
+
+	return( 0 );
+}
+
+/* Retrieves the crypto backend that is used for AES-XTS decryption
+ * The backend is, in order of precedence, the one set by libfvde_set_crypto_backend,
+ * the one set by the LIBFVDE_CRYPTO_BACKEND environment variable if supported or
+ * the fastest supported backend: AES-NI, OpenSSL and libcaes
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_get_crypto_backend(
+     int *crypto_backend,
+     libcerror_error_t **error )
+{
+	static char *function       = "libfvde_get_crypto_backend";
+	int environment_backend     = LIBFVDE_CRYPTO_BACKEND_DEFAULT;
+	int selected_crypto_backend = LIBFVDE_CRYPTO_BACKEND_DEFAULT;
+
+	if( crypto_backend == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid crypto backend.",
+		 function );
+
+		return( -1 );
+	}
+	selected_crypto_backend = libfvde_crypto_backend_requested;
+
+	if( selected_crypto_backend == LIBFVDE_CRYPTO_BACKEND_DEFAULT )
+	{
+		if( libfvde_crypto_backend_get_from_environment(
+		     &environment_backend ) == 1 )
+		{
+			if( libfvde_crypto_backend_is_supported(
+			     environment_backend ) != 0 )
+			{
+				selected_crypto_backend = environment_backend;
+			}
+		}
+	}
+	if( selected_crypto_backend == LIBFVDE_CRYPTO_BACKEND_DEFAULT )
+	{
+		if( libfvde_crypto_backend_is_supported(
+		     LIBFVDE_CRYPTO_BACKEND_AESNI ) != 0 )
+		{
+			selected_crypto_backend = LIBFVDE_CRYPTO_BACKEND_AESNI;
+		}
+		else if( libfvde_crypto_backend_is_supported(
+		          LIBFVDE_CRYPTO_BACKEND_OPENSSL ) != 0 )
+		{
+			selected_crypto_backend = LIBFVDE_CRYPTO_BACKEND_OPENSSL;
+		}
+		else
+		{
+			selected_crypto_backend = LIBFVDE_CRYPTO_BACKEND_LIBCAES;
+		}
+	}
+	*crypto_backend = selected_crypto_backend;
+
+	return( 1 );
+}
+
+/* Sets the crypto backend that is used for AES-XTS decryption
+ * The backend applies to keys that are set after this call, hence it should
+ * be set before a volume is opened. LIBFVDE_CRYPTO_BACKEND_DEFAULT restores
+ * the automatic selection
+ * This function is not multi-thread safe
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_set_crypto_backend(
+     int crypto_backend,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_set_crypto_backend";
+
+	if( ( crypto_backend != LIBFVDE_CRYPTO_BACKEND_DEFAULT )
+	 && ( crypto_backend != LIBFVDE_CRYPTO_BACKEND_LIBCAES )
+	 && ( crypto_backend != LIBFVDE_CRYPTO_BACKEND_OPENSSL )
+	 && ( crypto_backend != LIBFVDE_CRYPTO_BACKEND_AESNI ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported crypto backend.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( crypto_backend != LIBFVDE_CRYPTO_BACKEND_DEFAULT )
+	 && ( libfvde_crypto_backend_is_supported(
+	       crypto_backend ) == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: crypto backend: %d not supported by library or CPU.",
+		 function,
+		 crypto_backend );
+
+		return( -1 );
+	}
+	libfvde_crypto_backend_requested = crypto_backend;
+
+	return( 1 );
+}
+
@@ -0,0 +1,67 @@
+/*
+ * Crypto backend functions
+ *
+ * Copyright (C) 2011-2024, Omar Choudary <choudary.omar@gmail.com>
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFVDE_CRYPTO_BACKEND_H )
+#define _LIBFVDE_CRYPTO_BACKEND_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfvde_extern.h"
+#include "libfvde_libcerror.h"
+
+/* The OpenSSL backend uses the EVP AES-XTS functions of libcrypto directly
+ */
+#if defined( HAVE_LIBCRYPTO ) && defined( HAVE_OPENSSL_EVP_H ) && defined( HAVE_EVP_CRYPTO_AES_XTS )
+#define HAVE_LIBFVDE_OPENSSL_AES_XTS_SUPPORT
+#endif
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The name of the environment variable that overrides the crypto backend
+ */
+#define LIBFVDE_CRYPTO_BACKEND_ENVIRONMENT_VARIABLE	"LIBFVDE_CRYPTO_BACKEND"
+
+int libfvde_crypto_backend_is_supported(
+     int crypto_backend );
+
+int libfvde_crypto_backend_get_from_environment(
+     int *crypto_backend );
+
+LIBFVDE_EXTERN \
+int libfvde_get_crypto_backend(
+     int *crypto_backend,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_set_crypto_backend(
+     int crypto_backend,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFVDE_CRYPTO_BACKEND_H ) */
+
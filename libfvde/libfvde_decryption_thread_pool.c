@@ -0,0 +1,891 @@
+/*
+ * Decryption thread pool functions
+ *
+ * Copyright (C) 2011-2024, Omar Choudary <choudary.omar@gmail.com>
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfvde_decryption_thread_pool.h"
+#include "libfvde_definitions.h"
+#include "libfvde_encryption_context.h"
+#include "libfvde_libcerror.h"
+#include "libfvde_libcnotify.h"
+#include "libfvde_libcthreads.h"
+
+/* Creates a decryption thread pool
+ * Make sure the value decryption_thread_pool is referencing, is set to NULL
+ * Every batch has its own encryption context so that batches can be decrypted concurrently
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_decryption_thread_pool_initialize(
+     libfvde_decryption_thread_pool_t **decryption_thread_pool,
+     int number_of_threads,
+     size_t bytes_per_sector,
+     uint32_t encryption_method,
+     const uint8_t *key,
+     size_t key_size,
+     const uint8_t *tweak_key,
+     size_t tweak_key_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_decryption_thread_pool_initialize";
+	size_t batches_size   = 0;
+	int batch_index       = 0;
+
+	if( decryption_thread_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decryption thread pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *decryption_thread_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid decryption thread pool value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > LIBFVDE_MAXIMUM_NUMBER_OF_DECRYPTION_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( bytes_per_sector == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid bytes per sector value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*decryption_thread_pool = memory_allocate_structure(
+	                           libfvde_decryption_thread_pool_t );
+
+	if( *decryption_thread_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create decryption thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *decryption_thread_pool,
+	     0,
+	     sizeof( libfvde_decryption_thread_pool_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear decryption thread pool.",
+		 function );
+
+		memory_free(
+		 *decryption_thread_pool );
+
+		*decryption_thread_pool = NULL;
+
+		return( -1 );
+	}
+	batches_size = sizeof( libfvde_decryption_batch_t ) * number_of_threads;
+
+	( *decryption_thread_pool )->batches = (libfvde_decryption_batch_t *) memory_allocate(
+	                                                                       batches_size );
+
+	if( ( *decryption_thread_pool )->batches == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create batches.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *decryption_thread_pool )->batches,
+	     0,
+	     batches_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear batches.",
+		 function );
+
+		memory_free(
+		 ( *decryption_thread_pool )->batches );
+
+		( *decryption_thread_pool )->batches = NULL;
+
+		goto on_error;
+	}
+	( *decryption_thread_pool )->number_of_threads = number_of_threads;
+	( *decryption_thread_pool )->bytes_per_sector  = bytes_per_sector;
+
+	for( batch_index = 0;
+	     batch_index < number_of_threads;
+	     batch_index++ )
+	{
+		( *decryption_thread_pool )->batches[ batch_index ].decryption_thread_pool = *decryption_thread_pool;
+
+		if( libfvde_encryption_context_initialize(
+		     &( ( *decryption_thread_pool )->batches[ batch_index ].encryption_context ),
+		     encryption_method,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create encryption context: %d.",
+			 function,
+			 batch_index );
+
+			goto on_error;
+		}
+		if( libfvde_encryption_context_set_keys(
+		     ( *decryption_thread_pool )->batches[ batch_index ].encryption_context,
+		     key,
+		     key_size,
+		     tweak_key,
+		     tweak_key_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set keys in encryption context: %d.",
+			 function,
+			 batch_index );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *decryption_thread_pool )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *decryption_thread_pool )->condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create condition.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_mutex_initialize(
+	     &( ( *decryption_thread_pool )->decrypt_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create decrypt mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_thread_pool_create(
+	     &( ( *decryption_thread_pool )->thread_pool ),
+	     NULL,
+	     number_of_threads,
+	     number_of_threads,
+	     (int (*)(intptr_t *, void *)) &libfvde_decryption_thread_pool_callback_function,
+	     (void *) *decryption_thread_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create thread pool.",
+		 function );
+
+		goto on_error;
+	}
+#endif /* defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT ) */
+
+	return( 1 );
+
+on_error:
+	if( *decryption_thread_pool != NULL )
+	{
+		libfvde_decryption_thread_pool_free(
+		 decryption_thread_pool,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a decryption thread pool
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_decryption_thread_pool_free(
+     libfvde_decryption_thread_pool_t **decryption_thread_pool,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_decryption_thread_pool_free";
+	int batch_index       = 0;
+	int result            = 1;
+
+	if( decryption_thread_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decryption thread pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *decryption_thread_pool != NULL )
+	{
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+		/* The threads are joined first since they reference the batches
+		 */
+		if( ( *decryption_thread_pool )->thread_pool != NULL )
+		{
+			if( libcthreads_thread_pool_join(
+			     &( ( *decryption_thread_pool )->thread_pool ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread pool.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *decryption_thread_pool )->condition != NULL )
+		{
+			if( libcthreads_condition_free(
+			     &( ( *decryption_thread_pool )->condition ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free condition.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *decryption_thread_pool )->mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( ( *decryption_thread_pool )->mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *decryption_thread_pool )->decrypt_mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( ( *decryption_thread_pool )->decrypt_mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free decrypt mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif /* defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT ) */
+
+		if( ( *decryption_thread_pool )->batches != NULL )
+		{
+			for( batch_index = 0;
+			     batch_index < ( *decryption_thread_pool )->number_of_threads;
+			     batch_index++ )
+			{
+				if( ( *decryption_thread_pool )->batches[ batch_index ].encryption_context != NULL )
+				{
+					if( libfvde_encryption_context_free(
+					     &( ( *decryption_thread_pool )->batches[ batch_index ].encryption_context ),
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+						 "%s: unable to free encryption context: %d.",
+						 function,
+						 batch_index );
+
+						result = -1;
+					}
+				}
+			}
+			memory_free(
+			 ( *decryption_thread_pool )->batches );
+		}
+		memory_free(
+		 *decryption_thread_pool );
+
+		*decryption_thread_pool = NULL;
+	}
+	return( result );
+}
+
+/* Decrypts the data of a decryption batch in-place
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_decryption_batch_decrypt(
+     libfvde_decryption_batch_t *decryption_batch,
+     libcerror_error_t **error )
+{
+	static char *function   = "libfvde_decryption_batch_decrypt";
+	size_t bytes_per_sector = 0;
+
+	if( decryption_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decryption batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( decryption_batch->decryption_thread_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid decryption batch - missing decryption thread pool.",
+		 function );
+
+		return( -1 );
+	}
+	bytes_per_sector = decryption_batch->decryption_thread_pool->bytes_per_sector;
+
+	if( ( bytes_per_sector == 0 )
+	 || ( ( decryption_batch->data_size % bytes_per_sector ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid decryption batch - data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvde_encryption_context_crypt_sectors(
+	     decryption_batch->encryption_context,
+	     LIBFVDE_ENCRYPTION_CRYPT_MODE_DECRYPT,
+	     decryption_batch->data,
+	     decryption_batch->data_size,
+	     decryption_batch->data,
+	     decryption_batch->data_size,
+	     decryption_batch->sector_number,
+	     bytes_per_sector,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+		 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+		 "%s: unable to decrypt sectors: %" PRIu64 " data.",
+		 function,
+		 decryption_batch->sector_number );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+
+/* Decrypts a batch on one of the threads of the thread pool
+ * Callback function for the thread pool
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_decryption_thread_pool_callback_function(
+     libfvde_decryption_batch_t *decryption_batch,
+     void *arguments )
+{
+	libcerror_error_t *error                                 = NULL;
+	libfvde_decryption_thread_pool_t *decryption_thread_pool = NULL;
+	int result                                               = 0;
+
+	decryption_thread_pool = (libfvde_decryption_thread_pool_t *) arguments;
+
+	if( decryption_thread_pool == NULL )
+	{
+		return( -1 );
+	}
+	result = libfvde_decryption_batch_decrypt(
+	          decryption_batch,
+	          &error );
+
+	if( result != 1 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+#endif
+		libcerror_error_free(
+		 &error );
+	}
+	/* The pending batches are only changed while holding the mutex
+	 */
+	if( libcthreads_mutex_grab(
+	     decryption_thread_pool->mutex,
+	     NULL ) != 1 )
+	{
+		decryption_thread_pool->synchronization_failed = 1;
+
+		return( -1 );
+	}
+	if( result != 1 )
+	{
+		decryption_thread_pool->decryption_failed = 1;
+	}
+	decryption_thread_pool->number_of_pending_batches -= 1;
+
+	if( decryption_thread_pool->number_of_pending_batches <= 0 )
+	{
+		libcthreads_condition_broadcast(
+		 decryption_thread_pool->condition,
+		 NULL );
+	}
+	libcthreads_mutex_release(
+	 decryption_thread_pool->mutex,
+	 NULL );
+
+	return( result );
+}
+
+#endif /* defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT ) */
+
+/* Decrypts data in-place
+ * The data is split into sector aligned batches of at least LIBFVDE_MINIMUM_DECRYPTION_BATCH_SIZE
+ * that are decrypted concurrently. The function returns after all batches have been decrypted
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_internal_decryption_thread_pool_decrypt(
+     libfvde_decryption_thread_pool_t *decryption_thread_pool,
+     uint8_t *data,
+     size_t data_size,
+     uint64_t sector_number,
+     libcerror_error_t **error )
+{
+	static char *function      = "libfvde_internal_decryption_thread_pool_decrypt";
+	size_t batch_data_size     = 0;
+	size_t data_offset         = 0;
+	uint64_t number_of_sectors = 0;
+	int batch_index            = 0;
+	int number_of_batches      = 0;
+	int result                 = 1;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	int number_of_pushed_batches = 0;
+#endif
+
+	if( decryption_thread_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decryption thread pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size > (size_t) SSIZE_MAX )
+	 || ( ( data_size % decryption_thread_pool->bytes_per_sector ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_sectors = data_size / decryption_thread_pool->bytes_per_sector;
+	number_of_batches = (int) ( data_size / LIBFVDE_MINIMUM_DECRYPTION_BATCH_SIZE );
+
+	if( number_of_batches > decryption_thread_pool->number_of_threads )
+	{
+		number_of_batches = decryption_thread_pool->number_of_threads;
+	}
+	else if( number_of_batches == 0 )
+	{
+		number_of_batches = 1;
+	}
+	for( batch_index = 0;
+	     batch_index < number_of_batches;
+	     batch_index++ )
+	{
+		batch_data_size = (size_t) ( number_of_sectors / number_of_batches );
+
+		if( (uint64_t) batch_index < ( number_of_sectors % number_of_batches ) )
+		{
+			batch_data_size += 1;
+		}
+		batch_data_size *= decryption_thread_pool->bytes_per_sector;
+
+		decryption_thread_pool->batches[ batch_index ].data          = &( data[ data_offset ] );
+		decryption_thread_pool->batches[ batch_index ].data_size     = batch_data_size;
+		decryption_thread_pool->batches[ batch_index ].sector_number = sector_number;
+
+		data_offset   += batch_data_size;
+		sector_number += batch_data_size / decryption_thread_pool->bytes_per_sector;
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( ( number_of_batches > 1 )
+	 && ( decryption_thread_pool->thread_pool != NULL ) )
+	{
+		if( libcthreads_mutex_grab(
+		     decryption_thread_pool->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			return( -1 );
+		}
+		decryption_thread_pool->number_of_pending_batches = number_of_batches;
+		decryption_thread_pool->decryption_failed         = 0;
+
+		if( libcthreads_mutex_release(
+		     decryption_thread_pool->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			return( -1 );
+		}
+		for( batch_index = 0;
+		     batch_index < number_of_batches;
+		     batch_index++ )
+		{
+			if( libcthreads_thread_pool_push(
+			     decryption_thread_pool->thread_pool,
+			     (intptr_t *) &( decryption_thread_pool->batches[ batch_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push batch: %d onto thread pool.",
+				 function,
+				 batch_index );
+
+				result = -1;
+
+				break;
+			}
+			number_of_pushed_batches++;
+		}
+		/* Wait for the batches that were pushed onto the thread pool
+		 */
+		if( libcthreads_mutex_grab(
+		     decryption_thread_pool->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			decryption_thread_pool->number_of_pending_batches -= number_of_batches - number_of_pushed_batches;
+
+			while( ( decryption_thread_pool->number_of_pending_batches > 0 )
+			    && ( decryption_thread_pool->synchronization_failed == 0 ) )
+			{
+				if( libcthreads_condition_wait(
+				     decryption_thread_pool->condition,
+				     decryption_thread_pool->mutex,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to wait for condition.",
+					 function );
+
+					result = -1;
+
+					break;
+				}
+			}
+			/* All pushed batches have completed
+			 */
+			if( decryption_thread_pool->number_of_pending_batches <= 0 )
+			{
+				number_of_pushed_batches = 0;
+			}
+			if( decryption_thread_pool->decryption_failed != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+				 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+				 "%s: unable to decrypt data.",
+				 function );
+
+				result = -1;
+			}
+			if( libcthreads_mutex_release(
+			     decryption_thread_pool->mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+		/* The batches reference the data, so if not all pushed batches could be
+		 * waited for, the thread pool is joined to make sure they have completed
+		 * The remaining decrypt calls no longer use the thread pool
+		 */
+		if( ( number_of_pushed_batches > 0 )
+		 || ( decryption_thread_pool->synchronization_failed != 0 ) )
+		{
+			if( libcthreads_thread_pool_join(
+			     &( decryption_thread_pool->thread_pool ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread pool.",
+				 function );
+			}
+			if( decryption_thread_pool->synchronization_failed != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: invalid decryption thread pool - synchronization failed.",
+				 function );
+			}
+			result = -1;
+		}
+		return( result );
+	}
+#endif /* defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT ) */
+
+	for( batch_index = 0;
+	     batch_index < number_of_batches;
+	     batch_index++ )
+	{
+		if( libfvde_decryption_batch_decrypt(
+		     &( decryption_thread_pool->batches[ batch_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+			 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+			 "%s: unable to decrypt batch: %d.",
+			 function,
+			 batch_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Decrypts data in-place
+ * Concurrent calls are serialized since they share the batches of the thread pool
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_decryption_thread_pool_decrypt(
+     libfvde_decryption_thread_pool_t *decryption_thread_pool,
+     uint8_t *data,
+     size_t data_size,
+     uint64_t sector_number,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_decryption_thread_pool_decrypt";
+	int result            = 1;
+
+	if( decryption_thread_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decryption thread pool.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     decryption_thread_pool->decrypt_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab decrypt mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libfvde_internal_decryption_thread_pool_decrypt(
+	          decryption_thread_pool,
+	          data,
+	          data_size,
+	          sector_number,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+		 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+		 "%s: unable to decrypt data.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     decryption_thread_pool->decrypt_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release decrypt mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
@@ -0,0 +1,156 @@
+/*
+ * Decryption thread pool functions
+ *
+ * Copyright (C) 2011-2024, Omar Choudary <choudary.omar@gmail.com>
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFVDE_DECRYPTION_THREAD_POOL_H )
+#define _LIBFVDE_DECRYPTION_THREAD_POOL_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfvde_encryption_context.h"
+#include "libfvde_libcerror.h"
+#include "libfvde_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfvde_decryption_batch libfvde_decryption_batch_t;
+typedef struct libfvde_decryption_thread_pool libfvde_decryption_thread_pool_t;
+
+struct libfvde_decryption_batch
+{
+	/* The decryption thread pool
+	 */
+	libfvde_decryption_thread_pool_t *decryption_thread_pool;
+
+	/* The encryption context, which is exclusive to the batch
+	 */
+	libfvde_encryption_context_t *encryption_context;
+
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The sector number of the first sector in the data
+	 */
+	uint64_t sector_number;
+};
+
+struct libfvde_decryption_thread_pool
+{
+	/* The number of threads
+	 */
+	int number_of_threads;
+
+	/* The bytes per sector
+	 */
+	size_t bytes_per_sector;
+
+	/* The batches, one per thread
+	 */
+	libfvde_decryption_batch_t *batches;
+
+	/* The number of batches that have not been decrypted yet
+	 */
+	int number_of_pending_batches;
+
+	/* Value to indicate decryption of one of the batches failed
+	 */
+	uint8_t decryption_failed;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	/* The thread pool
+	 */
+	libcthreads_thread_pool_t *thread_pool;
+
+	/* The mutex that protects the pending batches
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The condition that is signalled when all batches have been decrypted
+	 */
+	libcthreads_condition_t *condition;
+
+	/* The mutex that serializes the decrypt calls, since the batches
+	 * and the pending batches are shared by all callers
+	 */
+	libcthreads_mutex_t *decrypt_mutex;
+
+	/* Value to indicate a thread was unable to grab the mutex
+	 * and could not account for its batch
+	 */
+	uint8_t synchronization_failed;
+#endif
+};
+
+int libfvde_decryption_thread_pool_initialize(
+     libfvde_decryption_thread_pool_t **decryption_thread_pool,
+     int number_of_threads,
+     size_t bytes_per_sector,
+     uint32_t encryption_method,
+     const uint8_t *key,
+     size_t key_size,
+     const uint8_t *tweak_key,
+     size_t tweak_key_size,
+     libcerror_error_t **error );
+
+int libfvde_decryption_thread_pool_free(
+     libfvde_decryption_thread_pool_t **decryption_thread_pool,
+     libcerror_error_t **error );
+
+int libfvde_decryption_batch_decrypt(
+     libfvde_decryption_batch_t *decryption_batch,
+     libcerror_error_t **error );
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+
+int libfvde_decryption_thread_pool_callback_function(
+     libfvde_decryption_batch_t *decryption_batch,
+     void *arguments );
+
+#endif /* defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT ) */
+
+int libfvde_internal_decryption_thread_pool_decrypt(
+     libfvde_decryption_thread_pool_t *decryption_thread_pool,
+     uint8_t *data,
+     size_t data_size,
+     uint64_t sector_number,
+     libcerror_error_t **error );
+
+int libfvde_decryption_thread_pool_decrypt(
+     libfvde_decryption_thread_pool_t *decryption_thread_pool,
+     uint8_t *data,
+     size_t data_size,
+     uint64_t sector_number,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFVDE_DECRYPTION_THREAD_POOL_H ) */
+
@@ -0,0 +1,1595 @@
+/*
+ * Direct IO file IO handle functions
+ *
+ * Copyright (C) 2011-2024, Omar Choudary <choudary.omar@gmail.com>
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/* Required for O_DIRECT on Linux
+ */
+#if defined( __linux__ ) && !defined( _GNU_SOURCE )
+#define _GNU_SOURCE 1
+#endif
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#include <errno.h>
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "libfvde_definitions.h"
+#include "libfvde_direct_file_io_handle.h"
+#include "libfvde_libbfio.h"
+#include "libfvde_libcerror.h"
+#include "libfvde_libclocale.h"
+#include "libfvde_libuna.h"
+#include "libfvde_unused.h"
+
+#if !defined( O_CLOEXEC )
+#define O_CLOEXEC	0
+#endif
+
+#if !defined( O_DIRECT )
+#define O_DIRECT	0
+#endif
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE ) && SIZEOF_WCHAR_T != 2 && SIZEOF_WCHAR_T != 4
+#error Unsupported size of wchar_t
+#endif
+
+/* Creates a direct IO file IO handle
+ * Make sure the value handle is referencing, is set to NULL
+ * The file is read with reads that are aligned to alignment, bypassing the page cache
+ * where supported, so that bulk reads do not evict other data from the page cache
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_direct_file_initialize(
+     libbfio_handle_t **handle,
+     const char *name,
+     size_t name_length,
+     size_t alignment,
+     libcerror_error_t **error )
+{
+	libfvde_direct_file_io_handle_t *file_io_handle = NULL;
+	static char *function                           = "libfvde_direct_file_initialize";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvde_direct_file_io_handle_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfvde_direct_file_io_handle_set_name(
+	     file_io_handle,
+	     name,
+	     name_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set name in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfvde_direct_file_io_handle_set_alignment(
+	     file_io_handle,
+	     alignment,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set alignment in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_initialize(
+	     handle,
+	     (intptr_t *) file_io_handle,
+	     (int (*)(intptr_t **, libcerror_error_t **)) libfvde_direct_file_io_handle_free,
+	     (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) libfvde_direct_file_io_handle_clone,
+	     (int (*)(intptr_t *, int, libcerror_error_t **)) libfvde_direct_file_io_handle_open,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libfvde_direct_file_io_handle_close,
+	     (ssize_t (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) libfvde_direct_file_io_handle_read_buffer,
+	     (ssize_t (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) libfvde_direct_file_io_handle_write_buffer,
+	     (off64_t (*)(intptr_t *, off64_t, int, libcerror_error_t **)) libfvde_direct_file_io_handle_seek_offset,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libfvde_direct_file_io_handle_exists,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libfvde_direct_file_io_handle_is_open,
+	     (int (*)(intptr_t *, size64_t *, libcerror_error_t **)) libfvde_direct_file_io_handle_get_size,
+	     LIBBFIO_FLAG_IO_HANDLE_MANAGED | LIBBFIO_FLAG_IO_HANDLE_CLONE_BY_FUNCTION,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libfvde_direct_file_io_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Creates a direct IO file IO handle
+ * Make sure the value handle is referencing, is set to NULL
+ * The name is converted to a narrow string using the codepage of the system
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_direct_file_initialize_wide(
+     libbfio_handle_t **handle,
+     const wchar_t *name,
+     size_t name_length,
+     size_t alignment,
+     libcerror_error_t **error )
+{
+	libfvde_direct_file_io_handle_t *file_io_handle = NULL;
+	static char *function                           = "libfvde_direct_file_initialize_wide";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvde_direct_file_io_handle_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfvde_direct_file_io_handle_set_name_wide(
+	     file_io_handle,
+	     name,
+	     name_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set name in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfvde_direct_file_io_handle_set_alignment(
+	     file_io_handle,
+	     alignment,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set alignment in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_initialize(
+	     handle,
+	     (intptr_t *) file_io_handle,
+	     (int (*)(intptr_t **, libcerror_error_t **)) libfvde_direct_file_io_handle_free,
+	     (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) libfvde_direct_file_io_handle_clone,
+	     (int (*)(intptr_t *, int, libcerror_error_t **)) libfvde_direct_file_io_handle_open,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libfvde_direct_file_io_handle_close,
+	     (ssize_t (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) libfvde_direct_file_io_handle_read_buffer,
+	     (ssize_t (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) libfvde_direct_file_io_handle_write_buffer,
+	     (off64_t (*)(intptr_t *, off64_t, int, libcerror_error_t **)) libfvde_direct_file_io_handle_seek_offset,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libfvde_direct_file_io_handle_exists,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libfvde_direct_file_io_handle_is_open,
+	     (int (*)(intptr_t *, size64_t *, libcerror_error_t **)) libfvde_direct_file_io_handle_get_size,
+	     LIBBFIO_FLAG_IO_HANDLE_MANAGED | LIBBFIO_FLAG_IO_HANDLE_CLONE_BY_FUNCTION,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libfvde_direct_file_io_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Creates a direct IO file IO handle
+ * Make sure the value file_io_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_direct_file_io_handle_initialize(
+     libfvde_direct_file_io_handle_t **file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_direct_file_io_handle_initialize";
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file IO handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*file_io_handle = memory_allocate_structure(
+	                   libfvde_direct_file_io_handle_t );
+
+	if( *file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *file_io_handle,
+	     0,
+	     sizeof( libfvde_direct_file_io_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	( *file_io_handle )->file_descriptor = -1;
+	( *file_io_handle )->alignment       = 512;
+
+	return( 1 );
+
+on_error:
+	if( *file_io_handle != NULL )
+	{
+		memory_free(
+		 *file_io_handle );
+
+		*file_io_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a direct IO file IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_direct_file_io_handle_free(
+     libfvde_direct_file_io_handle_t **file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_direct_file_io_handle_free";
+	int result            = 1;
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_io_handle != NULL )
+	{
+		if( ( *file_io_handle )->file_descriptor != -1 )
+		{
+			if( libfvde_direct_file_io_handle_close(
+			     *file_io_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close file IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *file_io_handle )->name != NULL )
+		{
+			memory_free(
+			 ( *file_io_handle )->name );
+		}
+		memory_free(
+		 *file_io_handle );
+
+		*file_io_handle = NULL;
+	}
+	return( result );
+}
+
+/* Clones (duplicates) the direct IO file IO handle
+ * The clone is not opened
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_direct_file_io_handle_clone(
+     libfvde_direct_file_io_handle_t **destination_file_io_handle,
+     libfvde_direct_file_io_handle_t *source_file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_direct_file_io_handle_clone";
+
+	if( destination_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination file IO handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_file_io_handle == NULL )
+	{
+		*destination_file_io_handle = NULL;
+
+		return( 1 );
+	}
+	if( libfvde_direct_file_io_handle_initialize(
+	     destination_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfvde_direct_file_io_handle_set_alignment(
+	     *destination_file_io_handle,
+	     source_file_io_handle->alignment,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set alignment in destination file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( source_file_io_handle->name != NULL )
+	{
+		if( libfvde_direct_file_io_handle_set_name(
+		     *destination_file_io_handle,
+		     source_file_io_handle->name,
+		     source_file_io_handle->name_size - 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set name in destination file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( *destination_file_io_handle != NULL )
+	{
+		libfvde_direct_file_io_handle_free(
+		 destination_file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Sets the name
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_direct_file_io_handle_set_name(
+     libfvde_direct_file_io_handle_t *file_io_handle,
+     const char *name,
+     size_t name_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_direct_file_io_handle_set_name";
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle->file_descriptor != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file IO handle - already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( name_length == 0 )
+	 || ( name_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle->name != NULL )
+	{
+		memory_free(
+		 file_io_handle->name );
+
+		file_io_handle->name      = NULL;
+		file_io_handle->name_size = 0;
+	}
+	file_io_handle->name = narrow_string_allocate(
+	                        name_length + 1 );
+
+	if( file_io_handle->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name.",
+		 function );
+
+		return( -1 );
+	}
+	if( narrow_string_copy(
+	     file_io_handle->name,
+	     name,
+	     name_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy name.",
+		 function );
+
+		memory_free(
+		 file_io_handle->name );
+
+		file_io_handle->name = NULL;
+
+		return( -1 );
+	}
+	( file_io_handle->name )[ name_length ] = 0;
+
+	file_io_handle->name_size = name_length + 1;
+
+	return( 1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Sets the name
+ * The name does not need to be terminated, the terminator is added by the conversion
+ * The name is converted to a narrow string using the codepage of the system
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_direct_file_io_handle_set_name_wide(
+     libfvde_direct_file_io_handle_t *file_io_handle,
+     const wchar_t *name,
+     size_t name_length,
+     libcerror_error_t **error )
+{
+	static char *function   = "libfvde_direct_file_io_handle_set_name_wide";
+	size_t narrow_name_size = 0;
+	int result              = 0;
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle->file_descriptor != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file IO handle - already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( name_length == 0 )
+	 || ( name_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle->name != NULL )
+	{
+		memory_free(
+		 file_io_handle->name );
+
+		file_io_handle->name      = NULL;
+		file_io_handle->name_size = 0;
+	}
+	if( libclocale_codepage == 0 )
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf8_string_size_from_utf32(
+		          (libuna_utf32_character_t *) name,
+		          name_length,
+		          &narrow_name_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf8_string_size_from_utf16(
+		          (libuna_utf16_character_t *) name,
+		          name_length,
+		          &narrow_name_size,
+		          error );
+#endif
+	}
+	else
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_byte_stream_size_from_utf32(
+		          (libuna_utf32_character_t *) name,
+		          name_length,
+		          libclocale_codepage,
+		          &narrow_name_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_byte_stream_size_from_utf16(
+		          (libuna_utf16_character_t *) name,
+		          name_length,
+		          libclocale_codepage,
+		          &narrow_name_size,
+		          error );
+#endif
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to determine narrow name size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( narrow_name_size == 0 )
+	 || ( narrow_name_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid narrow name size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	file_io_handle->name = narrow_string_allocate(
+	                        narrow_name_size );
+
+	if( file_io_handle->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name.",
+		 function );
+
+		goto on_error;
+	}
+	if( libclocale_codepage == 0 )
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf8_string_copy_from_utf32(
+		          (libuna_utf8_character_t *) file_io_handle->name,
+		          narrow_name_size,
+		          (libuna_utf32_character_t *) name,
+		          name_length,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf8_string_copy_from_utf16(
+		          (libuna_utf8_character_t *) file_io_handle->name,
+		          narrow_name_size,
+		          (libuna_utf16_character_t *) name,
+		          name_length,
+		          error );
+#endif
+	}
+	else
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_byte_stream_copy_from_utf32(
+		          (uint8_t *) file_io_handle->name,
+		          narrow_name_size,
+		          libclocale_codepage,
+		          (libuna_utf32_character_t *) name,
+		          name_length,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_byte_stream_copy_from_utf16(
+		          (uint8_t *) file_io_handle->name,
+		          narrow_name_size,
+		          libclocale_codepage,
+		          (libuna_utf16_character_t *) name,
+		          name_length,
+		          error );
+#endif
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to set narrow name.",
+		 function );
+
+		goto on_error;
+	}
+	( file_io_handle->name )[ narrow_name_size - 1 ] = 0;
+
+	file_io_handle->name_size = narrow_name_size;
+
+	return( 1 );
+
+on_error:
+	if( file_io_handle->name != NULL )
+	{
+		memory_free(
+		 file_io_handle->name );
+
+		file_io_handle->name = NULL;
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Sets the alignment
+ * The alignment must be a power of 2 of at least 512 bytes
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_direct_file_io_handle_set_alignment(
+     libfvde_direct_file_io_handle_t *file_io_handle,
+     size_t alignment,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_direct_file_io_handle_set_alignment";
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle->file_descriptor != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file IO handle - already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( alignment < 512 )
+	 || ( alignment > (size_t) LIBFVDE_DIRECT_IO_BUFFER_SIZE )
+	 || ( ( alignment & ( alignment - 1 ) ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported alignment: %" PRIzd ".",
+		 function,
+		 alignment );
+
+		return( -1 );
+	}
+	file_io_handle->alignment = alignment;
+
+	return( 1 );
+}
+
+/* Opens the file for direct IO
+ * Only read access is supported
+ * If the file system does not support direct IO the file is opened for
+ * buffered IO and the page cache is released after every read instead
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_direct_file_io_handle_open(
+     libfvde_direct_file_io_handle_t *file_io_handle,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	static char *function       = "libfvde_direct_file_io_handle_open";
+
+#if defined( HAVE_PREAD ) && defined( HAVE_POSIX_MEMALIGN )
+	void *aligned_buffer        = NULL;
+	size_t aligned_buffer_size  = 0;
+	off64_t file_size           = 0;
+	uint8_t bypasses_page_cache = 0;
+	int file_descriptor         = -1;
+#endif
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file IO handle - missing name.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle->file_descriptor != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file IO handle - already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBBFIO_ACCESS_FLAG_READ ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBBFIO_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_PREAD ) && defined( HAVE_POSIX_MEMALIGN )
+	if( O_DIRECT != 0 )
+	{
+		file_descriptor = open(
+		                   file_io_handle->name,
+		                   O_RDONLY | O_CLOEXEC | O_DIRECT );
+
+		if( file_descriptor != -1 )
+		{
+			bypasses_page_cache = 1;
+		}
+		/* Some file systems, like tmpfs, do not support direct IO
+		 */
+		else if( errno != EINVAL )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 errno,
+			 "%s: unable to open file: %s.",
+			 function,
+			 file_io_handle->name );
+
+			goto on_error;
+		}
+	}
+	if( file_descriptor == -1 )
+	{
+		file_descriptor = open(
+		                   file_io_handle->name,
+		                   O_RDONLY | O_CLOEXEC );
+
+		if( file_descriptor == -1 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 errno,
+			 "%s: unable to open file: %s.",
+			 function,
+			 file_io_handle->name );
+
+			goto on_error;
+		}
+#if defined( HAVE_FCNTL ) && defined( F_NOCACHE )
+		if( fcntl(
+		     file_descriptor,
+		     F_NOCACHE,
+		     1 ) != -1 )
+		{
+			bypasses_page_cache = 1;
+		}
+#endif
+	}
+	/* Use seek instead of stat to also determine the size of a device
+	 */
+	file_size = lseek(
+	             file_descriptor,
+	             0,
+	             SEEK_END );
+
+	if( file_size < 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 errno,
+		 "%s: unable to determine size of file: %s.",
+		 function,
+		 file_io_handle->name );
+
+		goto on_error;
+	}
+	aligned_buffer_size = (size_t) LIBFVDE_DIRECT_IO_BUFFER_SIZE;
+
+	if( ( aligned_buffer_size % file_io_handle->alignment ) != 0 )
+	{
+		aligned_buffer_size += file_io_handle->alignment - ( aligned_buffer_size % file_io_handle->alignment );
+	}
+	if( posix_memalign(
+	     &aligned_buffer,
+	     file_io_handle->alignment,
+	     aligned_buffer_size ) != 0 )
+	{
+		aligned_buffer = NULL;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create aligned buffer.",
+		 function );
+
+		goto on_error;
+	}
+	file_io_handle->file_descriptor     = file_descriptor;
+	file_io_handle->aligned_buffer      = (uint8_t *) aligned_buffer;
+	file_io_handle->aligned_buffer_size = aligned_buffer_size;
+	file_io_handle->file_size           = (size64_t) file_size;
+	file_io_handle->current_offset      = 0;
+	file_io_handle->access_flags        = access_flags;
+	file_io_handle->bypasses_page_cache = bypasses_page_cache;
+
+	return( 1 );
+
+on_error:
+	if( file_descriptor != -1 )
+	{
+		close(
+		 file_descriptor );
+	}
+	return( -1 );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: direct IO files are not supported.",
+	 function );
+
+	return( -1 );
+#endif /* defined( HAVE_PREAD ) && defined( HAVE_POSIX_MEMALIGN ) */
+}
+
+/* Closes the file and frees the aligned buffer
+ * Returns 0 if successful or -1 on error
+ */
+int libfvde_direct_file_io_handle_close(
+     libfvde_direct_file_io_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_direct_file_io_handle_close";
+	int result            = 0;
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle->file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( close(
+	     file_io_handle->file_descriptor ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 errno,
+		 "%s: unable to close file: %s.",
+		 function,
+		 file_io_handle->name );
+
+		result = -1;
+	}
+	if( file_io_handle->aligned_buffer != NULL )
+	{
+		memory_free(
+		 file_io_handle->aligned_buffer );
+	}
+	file_io_handle->file_descriptor     = -1;
+	file_io_handle->aligned_buffer      = NULL;
+	file_io_handle->aligned_buffer_size = 0;
+	file_io_handle->file_size           = 0;
+	file_io_handle->current_offset      = 0;
+	file_io_handle->access_flags        = 0;
+	file_io_handle->bypasses_page_cache = 0;
+
+	return( result );
+}
+
+/* Reads a buffer from the file
+ * The file is read in whole aligned blocks, directly into the buffer if the
+ * buffer, the current offset and the size are aligned or via the aligned buffer otherwise
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfvde_direct_file_io_handle_read_buffer(
+         libfvde_direct_file_io_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	static char *function  = "libfvde_direct_file_io_handle_read_buffer";
+	size_t block_offset    = 0;
+	size_t buffer_offset   = 0;
+	size_t copy_size       = 0;
+	size_t read_size       = 0;
+	ssize_t read_count     = 0;
+	off64_t aligned_offset = 0;
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle->file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_PREAD )
+	while( buffer_offset < size )
+	{
+		if( (size64_t) file_io_handle->current_offset >= file_io_handle->file_size )
+		{
+			break;
+		}
+		block_offset   = (size_t) ( file_io_handle->current_offset % file_io_handle->alignment );
+		aligned_offset = file_io_handle->current_offset - (off64_t) block_offset;
+		read_size      = size - buffer_offset;
+
+		if( ( block_offset == 0 )
+		 && ( read_size >= file_io_handle->alignment )
+		 && ( ( (intptr_t) &( buffer[ buffer_offset ] ) % file_io_handle->alignment ) == 0 ) )
+		{
+			/* Read the whole blocks directly into the buffer
+			 */
+			read_size -= read_size % file_io_handle->alignment;
+
+			do
+			{
+				read_count = pread(
+				              file_io_handle->file_descriptor,
+				              &( buffer[ buffer_offset ] ),
+				              read_size,
+				              aligned_offset );
+			}
+			while( ( read_count == -1 )
+			    && ( errno == EINTR ) );
+
+			copy_size = (size_t) read_count;
+		}
+		else
+		{
+			read_size += block_offset;
+
+			if( ( read_size % file_io_handle->alignment ) != 0 )
+			{
+				read_size += file_io_handle->alignment - ( read_size % file_io_handle->alignment );
+			}
+			if( read_size > file_io_handle->aligned_buffer_size )
+			{
+				read_size = file_io_handle->aligned_buffer_size;
+			}
+			do
+			{
+				read_count = pread(
+				              file_io_handle->file_descriptor,
+				              file_io_handle->aligned_buffer,
+				              read_size,
+				              aligned_offset );
+			}
+			while( ( read_count == -1 )
+			    && ( errno == EINTR ) );
+
+			if( read_count > (ssize_t) block_offset )
+			{
+				copy_size = (size_t) read_count - block_offset;
+
+				if( copy_size > ( size - buffer_offset ) )
+				{
+					copy_size = size - buffer_offset;
+				}
+				if( memory_copy(
+				     &( buffer[ buffer_offset ] ),
+				     &( file_io_handle->aligned_buffer[ block_offset ] ),
+				     copy_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy aligned buffer to buffer.",
+					 function );
+
+					return( -1 );
+				}
+			}
+		}
+		if( read_count < 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 errno,
+			 "%s: unable to read from file at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 aligned_offset,
+			 aligned_offset );
+
+			return( -1 );
+		}
+#if defined( HAVE_POSIX_FADVISE ) && defined( POSIX_FADV_DONTNEED )
+		if( file_io_handle->bypasses_page_cache == 0 )
+		{
+			/* Release the pages that were read since they are not likely to be read again
+			 */
+			posix_fadvise(
+			 file_io_handle->file_descriptor,
+			 aligned_offset,
+			 (off_t) read_count,
+			 POSIX_FADV_DONTNEED );
+		}
+#endif
+		if( read_count <= (ssize_t) block_offset )
+		{
+			break;
+		}
+		buffer_offset                  += copy_size;
+		file_io_handle->current_offset += (off64_t) copy_size;
+	}
+	return( (ssize_t) buffer_offset );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: direct IO files are not supported.",
+	 function );
+
+	return( -1 );
+#endif /* defined( HAVE_PREAD ) */
+}
+
+/* Writes a buffer to the file
+ * Writing is not supported
+ * Returns the number of bytes written or -1 on error
+ */
+ssize_t libfvde_direct_file_io_handle_write_buffer(
+         libfvde_direct_file_io_handle_t *file_io_handle,
+         const uint8_t *buffer LIBFVDE_ATTRIBUTE_UNUSED,
+         size_t size LIBFVDE_ATTRIBUTE_UNUSED,
+         libcerror_error_t **error )
+{
+	static char *function = "libfvde_direct_file_io_handle_write_buffer";
+
+	LIBFVDE_UNREFERENCED_PARAMETER( buffer )
+	LIBFVDE_UNREFERENCED_PARAMETER( size )
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: write access currently not supported.",
+	 function );
+
+	return( -1 );
+}
+
+/* Seeks a certain offset within the file
+ * Returns the offset if the seek is successful or -1 on error
+ */
+off64_t libfvde_direct_file_io_handle_seek_offset(
+         libfvde_direct_file_io_handle_t *file_io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	static char *function = "libfvde_direct_file_io_handle_seek_offset";
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle->file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( whence != SEEK_CUR )
+	 && ( whence != SEEK_END )
+	 && ( whence != SEEK_SET ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
+	if( whence == SEEK_CUR )
+	{
+		offset += file_io_handle->current_offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		offset += (off64_t) file_io_handle->file_size;
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	file_io_handle->current_offset = offset;
+
+	return( offset );
+}
+
+/* Function to determine if a file exists
+ * Returns 1 if file exists, 0 if not or -1 on error
+ */
+int libfvde_direct_file_io_handle_exists(
+     libfvde_direct_file_io_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_direct_file_io_handle_exists";
+
+#if defined( HAVE_STAT )
+	struct stat file_statistics;
+#endif
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file IO handle - missing name.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_STAT )
+	if( stat(
+	     file_io_handle->name,
+	     &file_statistics ) != 0 )
+	{
+		if( errno == ENOENT )
+		{
+			return( 0 );
+		}
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 errno,
+		 "%s: unable to retrieve file statistics.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: direct IO files are not supported.",
+	 function );
+
+	return( -1 );
+#endif /* defined( HAVE_STAT ) */
+}
+
+/* Check if the file is open
+ * Returns 1 if open, 0 if not or -1 on error
+ */
+int libfvde_direct_file_io_handle_is_open(
+     libfvde_direct_file_io_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_direct_file_io_handle_is_open";
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle->file_descriptor == -1 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the file size
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_direct_file_io_handle_get_size(
+     libfvde_direct_file_io_handle_t *file_io_handle,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_direct_file_io_handle_get_size";
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle->file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	*size = file_io_handle->file_size;
+
+	return( 1 );
+}
+
@@ -30,6 +30,7 @@
 #include "libfvde_checksum.h"
 #include "libfvde_compression.h"
 #include "libfvde_debug.h"
+#include "libfvde_decryption_thread_pool.h"
 #include "libfvde_definitions.h"
 #include "libfvde_encrypted_metadata.h"
 #include "libfvde_encryption_context.h"
@@ -46,6 +47,7 @@
 #include "libfvde_logical_volume_descriptor.h"
 #include "libfvde_metadata_block.h"
 #include "libfvde_password.h"
+#include "libfvde_plist_scanner.h"
 #include "libfvde_segment_descriptor.h"
 
 #include "fvde_metadata.h"
@@ -149,6 +151,20 @@ int libfvde_encrypted_metadata_initialize(
 
 		goto on_error;
 	}
+	if( libcdata_array_initialize(
+	     &( ( *encrypted_metadata )->logical_volume_descriptors_index ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create logical volume descriptors index array.",
+		 function );
+
+		goto on_error;
+	}
 	if( libcdata_array_initialize(
 	     &( ( *encrypted_metadata )->segment_descriptors_0x0304 ),
 	     0,
@@ -168,6 +184,13 @@ int libfvde_encrypted_metadata_initialize(
 on_error:
 	if( *encrypted_metadata != NULL )
 	{
+		if( ( *encrypted_metadata )->logical_volume_descriptors_index != NULL )
+		{
+			libcdata_array_free(
+			 &( ( *encrypted_metadata )->logical_volume_descriptors_index ),
+			 NULL,
+			 NULL );
+		}
 		if( ( *encrypted_metadata )->logical_volume_descriptors != NULL )
 		{
 			libcdata_array_free(
@@ -225,6 +248,22 @@ int libfvde_encrypted_metadata_free(
 
 			result = -1;
 		}
+		/* The logical volume descriptors are freed by the logical volume descriptors array
+		 */
+		if( libcdata_array_free(
+		     &( ( *encrypted_metadata )->logical_volume_descriptors_index ),
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free logical volume descriptors index array.",
+			 function );
+
+			result = -1;
+		}
 		if( libcdata_array_free(
 		     &( ( *encrypted_metadata )->logical_volume_descriptors ),
 		     (int (*)(intptr_t **, libcerror_error_t **)) &libfvde_logical_volume_descriptor_free,
@@ -2479,193 +2518,134 @@ on_error:
 	return( -1 );
 }
 
-/* Reads the encrypted metadata block type 0x001a
+/* Reads the logical volume descriptor from the root element of the (XML) plist
  * Returns 1 if successful or -1 on error
  */
-int libfvde_encrypted_metadata_read_type_0x001a(
-     libfvde_encrypted_metadata_t *encrypted_metadata,
-     const uint8_t *block_data,
-     size_t block_data_size,
+int libfvde_encrypted_metadata_read_logical_volume_root_element(
+     libfvde_logical_volume_descriptor_t *logical_volume_descriptor,
+     libfvde_plist_scanner_element_t *root_element,
      libcerror_error_t **error )
 {
-	libfplist_property_t *root_property                            = NULL;
-	libfplist_property_t *sub_property                             = NULL;
-	libfplist_property_list_t *property_list                       = NULL;
-	libfvde_logical_volume_descriptor_t *logical_volume_descriptor = NULL;
-	const uint8_t *xml_plist_data                                  = NULL;
-	static char *function                                          = "libfvde_encrypted_metadata_read_type_0x001a";
-	size_t block_data_offset                                       = 0;
-	size_t xml_length                                              = 0;
-	uint64_t logical_volume_size                                   = 0;
-	uint64_t object_identifier                                     = 0;
-	uint64_t object_identifier_0x0305                              = 0;
-	uint64_t object_identifier_0x0505                              = 0;
-	uint32_t compressed_data_size                                  = 0;
-	uint32_t uncompressed_data_size                                = 0;
-	uint32_t xml_plist_data_offset                                 = 0;
-	uint32_t xml_plist_data_size                                   = 0;
+	libfvde_plist_scanner_element_t sub_element;
+
+	static char *function        = "libfvde_encrypted_metadata_read_logical_volume_root_element";
+	uint64_t logical_volume_size = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
-	uint8_t *string                                                = NULL;
-	size_t string_size                                             = 0;
-	uint64_t value_64bit                                           = 0;
+	uint8_t *string              = NULL;
+	size_t string_size           = 0;
 #endif
 
-	if( encrypted_metadata == NULL )
+	if( logical_volume_descriptor == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid encrypted metadata.",
+		 "%s: invalid logical volume descriptor.",
 		 function );
 
 		return( -1 );
 	}
-	if( block_data == NULL )
+	if( logical_volume_descriptor->name != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid block data.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid logical volume descriptor - name value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( block_data_size < 72 )
-	 || ( block_data_size > (size_t) SSIZE_MAX ) )
+	if( libfvde_plist_scanner_element_get_sub_element_by_key(
+	     root_element,
+	     (uint8_t *) "com.apple.corestorage.lv.familyUUID",
+	     35,
+	     &sub_element,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid block data size value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve com.apple.corestorage.lv.familyUUID sub element.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	byte_stream_copy_to_uint64_little_endian(
-	 &( block_data[ 0 ] ),
-	 object_identifier );
-
-	byte_stream_copy_to_uint64_little_endian(
-	 &( block_data[ 8 ] ),
-	 object_identifier_0x0305 );
-
-	byte_stream_copy_to_uint64_little_endian(
-	 &( block_data[ 40 ] ),
-	 object_identifier_0x0505 );
-
-	byte_stream_copy_to_uint32_little_endian(
-	 &( block_data[ 56 ] ),
-	 compressed_data_size );
-
-	byte_stream_copy_to_uint32_little_endian(
-	 &( block_data[ 60 ] ),
-	 uncompressed_data_size );
-
-	byte_stream_copy_to_uint32_little_endian(
-	 &( block_data[ 64 ] ),
-	 xml_plist_data_offset );
-
-	byte_stream_copy_to_uint32_little_endian(
-	 &( block_data[ 68 ] ),
-	 xml_plist_data_size );
-
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
-		libcnotify_printf(
-		 "%s: object identifier\t\t\t: %" PRIu64 "\n",
-		 function,
-		 object_identifier );
-
-		libcnotify_printf(
-		 "%s: 0x0305 object identifier\t\t: %" PRIu64 "\n",
-		 function,
-		 object_identifier_0x0305 );
-
-		byte_stream_copy_to_uint64_little_endian(
-		 &( block_data[ 16 ] ),
-		 value_64bit );
-		libcnotify_printf(
-		 "%s: unknown1\t\t\t\t: %" PRIu64 "\n",
-		 function,
-		 value_64bit );
-
-		byte_stream_copy_to_uint64_little_endian(
-		 &( block_data[ 24 ] ),
-		 value_64bit );
-		libcnotify_printf(
-		 "%s: unknown2\t\t\t\t: %" PRIu64 "\n",
-		 function,
-		 value_64bit );
-
-		byte_stream_copy_to_uint64_little_endian(
-		 &( block_data[ 32 ] ),
-		 value_64bit );
-		libcnotify_printf(
-		 "%s: 0x0021 object identifier\t\t: %" PRIu64 "\n",
-		 function,
-		 value_64bit );
-
-		libcnotify_printf(
-		 "%s: 0x0505 object identifier\t\t: %" PRIu64 "\n",
-		 function,
-		 object_identifier_0x0505 );
-
-		byte_stream_copy_to_uint64_little_endian(
-		 &( block_data[ 48 ] ),
-		 value_64bit );
-		libcnotify_printf(
-		 "%s: unknown3\t\t\t\t: %" PRIu64 "\n",
-		 function,
-		 value_64bit );
-
-		libcnotify_printf(
-		 "%s: compressed data size\t\t: %" PRIu32 "\n",
-		 function,
-		 compressed_data_size );
+		if( libfvde_plist_scanner_element_get_value_string(
+		     &sub_element,
+		     &string,
+		     &string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve logical volume family identifier.",
+			 function );
 
+			goto on_error;
+		}
 		libcnotify_printf(
-		 "%s: uncompressed data size\t\t: %" PRIu32 "\n",
+		 "%s: logical volume family identifier\t: %s\n",
 		 function,
-		 uncompressed_data_size );
+		 string );
 
-		libcnotify_printf(
-		 "%s: XML plist data offset\t\t: 0x%08" PRIx32 "\n",
-		 function,
-		 xml_plist_data_offset );
+		memory_free(
+		 string );
 
-		libcnotify_printf(
-		 "%s: XML plist data size\t\t: %" PRIu32 "\n",
-		 function,
-		 xml_plist_data_size );
+		string = NULL;
 	}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
-	block_data_offset = 72;
+	if( libfvde_plist_scanner_element_value_uuid_string_copy_to_byte_stream(
+	     &sub_element,
+	     logical_volume_descriptor->family_identifier,
+	     16,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+		 "%s: unable to copy LVF UUID string to byte stream.",
+		 function );
 
-	if( ( xml_plist_data_offset < ( block_data_offset + 64 ) )
-	 || ( (size_t) xml_plist_data_offset > block_data_size ) )
+		goto on_error;
+	}
+	if( libfvde_plist_scanner_element_get_sub_element_by_key(
+	     root_element,
+	     (uint8_t *) "com.apple.corestorage.lv.name",
+	     29,
+	     &sub_element,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid XML plist data offset value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve com.apple.corestorage.lv.name sub element.",
 		 function );
 
 		goto on_error;
 	}
-	if( xml_plist_data_size > ( block_data_size - ( xml_plist_data_offset - 64 ) ) )
+	if( libfvde_plist_scanner_element_get_value_string(
+	     &sub_element,
+	     &( logical_volume_descriptor->name ),
+	     &( logical_volume_descriptor->name_size ),
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid XML plist data size value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve logical volume name.",
 		 function );
 
 		goto on_error;
@@ -2673,456 +2653,907 @@ int libfvde_encrypted_metadata_read_type_0x001a(
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
-		if( xml_plist_data_offset > ( block_data_offset + 64 ) )
-		{
-			libcnotify_printf(
-			 "%s: unknown4:\n",
-			 function );
-			libcnotify_print_data(
-			 &( block_data[ block_data_offset ] ),
-			 xml_plist_data_offset - ( block_data_offset + 64 ),
-			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
-		}
+		libcnotify_printf(
+		 "%s: logical volume name\t\t: %s\n",
+		 function,
+		 logical_volume_descriptor->name );
 	}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
-	if( libfvde_encrypted_metadata_get_logical_volume_descriptor_by_object_identifier(
-	     encrypted_metadata,
-	     object_identifier,
-	     &logical_volume_descriptor,
+	if( libfvde_plist_scanner_element_get_sub_element_by_key(
+	     root_element,
+	     (uint8_t *) "com.apple.corestorage.lv.size",
+	     29,
+	     &sub_element,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve logical volume descriptor with object identifier: %" PRIu64 ".",
-		 function,
-		 object_identifier );
+		 "%s: unable to retrieve com.apple.corestorage.lv.size sub element.",
+		 function );
 
 		goto on_error;
 	}
-	if( logical_volume_descriptor == NULL )
+	if( libfvde_plist_scanner_element_get_value_integer(
+	     &sub_element,
+	     &logical_volume_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing logical volume descriptor with object identifier: %" PRIu64 ".",
-		 function,
-		 object_identifier );
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve logical volume size.",
+		 function );
 
 		goto on_error;
 	}
-	if( ( object_identifier_0x0305 != 0 )
-	 && ( logical_volume_descriptor->object_identifier_0x0305 != 0 )
-	 && ( logical_volume_descriptor->object_identifier_0x0305 != object_identifier_0x0305 ) )
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: mismatch in object identifier 0x0305 (stored: %" PRIu64 ", expected: %" PRIu64 ").",
+		libcnotify_printf(
+		 "%s: logical volume size\t\t: %" PRIu64 "\n",
 		 function,
-		 object_identifier_0x0305,
-		 logical_volume_descriptor->object_identifier_0x0305 );
-
-		goto on_error;
+		 logical_volume_size );
 	}
-	if( ( object_identifier_0x0505 != 0 )
-	 && ( logical_volume_descriptor->object_identifier_0x0505 != 0 )
-	 && ( logical_volume_descriptor->object_identifier_0x0505 != object_identifier_0x0505 ) )
+#endif
+	logical_volume_descriptor->size = (size64_t) logical_volume_size;
+
+	if( libfvde_plist_scanner_element_get_sub_element_by_key(
+	     root_element,
+	     (uint8_t *) "com.apple.corestorage.lv.uuid",
+	     29,
+	     &sub_element,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: mismatch in object identifier 0x0505 (stored: %" PRIu64 ", expected: %" PRIu64 ").",
-		 function,
-		 object_identifier_0x0505,
-		 logical_volume_descriptor->object_identifier_0x0505 );
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve com.apple.corestorage.lv.uuid sub element.",
+		 function );
 
 		goto on_error;
 	}
-	if( logical_volume_descriptor->name != NULL )
-	{
-		memory_free(
-		 logical_volume_descriptor->name );
-
-		logical_volume_descriptor->name      = NULL;
-		logical_volume_descriptor->name_size = 0;
-	}
-	if( compressed_data_size != uncompressed_data_size )
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported compressed XML plist.",
-		 function );
-
-		goto on_error;
-	}
-	xml_plist_data = &( block_data[ xml_plist_data_offset - 64 ] );
-
-/* TODO handle compressed XML plist data */
-	if( ( xml_plist_data[ 0 ] == (uint8_t) '<' )
-	 && ( xml_plist_data[ 1 ] == (uint8_t) 'd' )
-	 && ( xml_plist_data[ 2 ] == (uint8_t) 'i' )
-	 && ( xml_plist_data[ 3 ] == (uint8_t) 'c' )
-	 && ( xml_plist_data[ 4 ] == (uint8_t) 't' ) )
-	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: XML:\n%s\n",
-			 function,
-			 (char *) xml_plist_data );
-
-			libcnotify_printf(
-			 "\n" );
-		}
-#endif
-/* TODO for now determine the XML string length */
-/* TODO refactor this to a separate function */
-		xml_length = narrow_string_length(
-			      (char *) xml_plist_data );
-
-		if( xml_length > (size_t) ( INT_MAX - 1 ) )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid XML length value out of bounds.",
-			 function );
-
-			goto on_error;
-		}
-		if( libfplist_property_list_initialize(
-		     &property_list,
+		if( libfvde_plist_scanner_element_get_value_string(
+		     &sub_element,
+		     &string,
+		     &string_size,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create property list.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve logical volume identifier.",
 			 function );
 
 			goto on_error;
 		}
-		if( libfplist_property_list_copy_from_byte_stream(
-		     property_list,
-		     xml_plist_data,
-		     xml_length + 1,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-			 "%s: unable to copy property list from byte stream.",
-			 function );
+		libcnotify_printf(
+		 "%s: logical volume identifier\t\t: %s\n",
+		 function,
+		 string );
 
-			goto on_error;
-		}
-		if( libfplist_property_list_get_root_property(
-		     property_list,
-		     &root_property,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve root property.",
-			 function );
+		memory_free(
+		 string );
 
-			goto on_error;
-		}
-		if( libfplist_property_get_sub_property_by_utf8_name(
-		     root_property,
-		     (uint8_t *) "com.apple.corestorage.lv.familyUUID",
-		     35,
-		     &sub_property,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve com.apple.corestorage.lv.familyUUID sub property.",
-			 function );
+		string = NULL;
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
-			goto on_error;
-		}
+	if( libfvde_plist_scanner_element_value_uuid_string_copy_to_byte_stream(
+	     &sub_element,
+	     logical_volume_descriptor->identifier,
+	     16,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+		 "%s: unable to copy LV UUID string to byte stream.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
 #if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			if( libfplist_property_get_value_string(
-			     sub_property,
-			     &string,
-			     &string_size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve logical volume family identifier.",
-				 function );
+	if( string != NULL )
+	{
+		memory_free(
+		 string );
+	}
+#endif
+	return( -1 );
+}
 
-				goto on_error;
-			}
-			libcnotify_printf(
-			 "%s: logical volume family identifier\t: %s\n",
-			 function,
-			 string );
+/* Reads the logical volume descriptor from the (XML) plist using the property list
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_encrypted_metadata_read_logical_volume_property_list(
+     libfvde_logical_volume_descriptor_t *logical_volume_descriptor,
+     const uint8_t *xml_plist_data,
+     size_t xml_plist_data_size,
+     libcerror_error_t **error )
+{
+	libfplist_property_t *root_property      = NULL;
+	libfplist_property_t *sub_property       = NULL;
+	libfplist_property_list_t *property_list = NULL;
+	static char *function                    = "libfvde_encrypted_metadata_read_logical_volume_property_list";
+	uint64_t logical_volume_size             = 0;
 
-			memory_free(
-			 string );
+#if defined( HAVE_DEBUG_OUTPUT )
+	uint8_t *string                          = NULL;
+	size_t string_size                       = 0;
+#endif
 
-			string = NULL;
-		}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+	if( logical_volume_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume descriptor.",
+		 function );
 
-		if( libfplist_property_value_uuid_string_copy_to_byte_stream(
-		     sub_property,
-		     logical_volume_descriptor->family_identifier,
-		     16,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
-			 "%s: unable to copy LVF UUID string to byte stream.",
-			 function );
+		return( -1 );
+	}
+	if( xml_plist_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML plist data.",
+		 function );
 
-			goto on_error;
-		}
-		if( libfplist_property_free(
-		     &sub_property,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free com.apple.corestorage.lv.familyUUID property.",
-			 function );
+		return( -1 );
+	}
+	if( xml_plist_data_size > (size_t) ( INT_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid XML plist data size value out of bounds.",
+		 function );
 
-			goto on_error;
-		}
-		if( libfplist_property_get_sub_property_by_utf8_name(
-		     root_property,
-		     (uint8_t *) "com.apple.corestorage.lv.name",
-		     29,
-		     &sub_property,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve com.apple.corestorage.lv.name sub property.",
-			 function );
+		return( -1 );
+	}
+	if( libfplist_property_list_initialize(
+	     &property_list,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create property list.",
+		 function );
 
-			goto on_error;
-		}
+		goto on_error;
+	}
+	if( libfplist_property_list_copy_from_byte_stream(
+	     property_list,
+	     xml_plist_data,
+	     xml_plist_data_size + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy property list from byte stream.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfplist_property_list_get_root_property(
+	     property_list,
+	     &root_property,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve root property.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfplist_property_get_sub_property_by_utf8_name(
+	     root_property,
+	     (uint8_t *) "com.apple.corestorage.lv.familyUUID",
+	     35,
+	     &sub_property,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve com.apple.corestorage.lv.familyUUID sub property.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
 		if( libfplist_property_get_value_string(
 		     sub_property,
-		     &( logical_volume_descriptor->name ),
-		     &( logical_volume_descriptor->name_size ),
+		     &string,
+		     &string_size,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve logical volume name.",
+			 "%s: unable to retrieve logical volume family identifier.",
 			 function );
 
 			goto on_error;
 		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: logical volume name\t\t: %s\n",
-			 function,
-			 logical_volume_descriptor->name );
-		}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+		libcnotify_printf(
+		 "%s: logical volume family identifier\t: %s\n",
+		 function,
+		 string );
 
-		if( libfplist_property_free(
-		     &sub_property,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free com.apple.corestorage.lv.name property.",
-			 function );
+		memory_free(
+		 string );
 
-			goto on_error;
-		}
-		if( libfplist_property_get_sub_property_by_utf8_name(
-		     root_property,
-		     (uint8_t *) "com.apple.corestorage.lv.size",
-		     29,
-		     &sub_property,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve com.apple.corestorage.lv.size sub property.",
-			 function );
+		string = NULL;
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
-			goto on_error;
-		}
-		if( libfplist_property_get_value_integer(
-		     sub_property,
-		     (uint64_t *) &logical_volume_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve logical volume size.",
-			 function );
+	if( libfplist_property_value_uuid_string_copy_to_byte_stream(
+	     sub_property,
+	     logical_volume_descriptor->family_identifier,
+	     16,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+		 "%s: unable to copy LVF UUID string to byte stream.",
+		 function );
 
-			goto on_error;
-		}
+		goto on_error;
+	}
+	if( libfplist_property_free(
+	     &sub_property,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free com.apple.corestorage.lv.familyUUID property.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfplist_property_get_sub_property_by_utf8_name(
+	     root_property,
+	     (uint8_t *) "com.apple.corestorage.lv.name",
+	     29,
+	     &sub_property,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve com.apple.corestorage.lv.name sub property.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfplist_property_get_value_string(
+	     sub_property,
+	     &( logical_volume_descriptor->name ),
+	     &( logical_volume_descriptor->name_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve logical volume name.",
+		 function );
+
+		goto on_error;
+	}
 #if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: logical volume size\t\t: %" PRIu64 "\n",
-			 function,
-			 logical_volume_size );
-		}
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: logical volume name\t\t: %s\n",
+		 function,
+		 logical_volume_descriptor->name );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	if( libfplist_property_free(
+	     &sub_property,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free com.apple.corestorage.lv.name property.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfplist_property_get_sub_property_by_utf8_name(
+	     root_property,
+	     (uint8_t *) "com.apple.corestorage.lv.size",
+	     29,
+	     &sub_property,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve com.apple.corestorage.lv.size sub property.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfplist_property_get_value_integer(
+	     sub_property,
+	     (uint64_t *) &logical_volume_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve logical volume size.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: logical volume size\t\t: %" PRIu64 "\n",
+		 function,
+		 logical_volume_size );
+	}
 #endif
-		logical_volume_descriptor->size = (size64_t) logical_volume_size;
+	logical_volume_descriptor->size = (size64_t) logical_volume_size;
+
+	if( libfplist_property_free(
+	     &sub_property,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free com.apple.corestorage.lv.size property.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfplist_property_get_sub_property_by_utf8_name(
+	     root_property,
+	     (uint8_t *) "com.apple.corestorage.lv.uuid",
+	     29,
+	     &sub_property,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve com.apple.corestorage.lv.uuid sub property.",
+		 function );
 
-		if( libfplist_property_free(
-		     &sub_property,
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		if( libfplist_property_get_value_string(
+		     sub_property,
+		     &string,
+		     &string_size,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free com.apple.corestorage.lv.size property.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve logical volume identifier.",
 			 function );
 
 			goto on_error;
 		}
-		if( libfplist_property_get_sub_property_by_utf8_name(
-		     root_property,
-		     (uint8_t *) "com.apple.corestorage.lv.uuid",
-		     29,
-		     &sub_property,
-		     error ) != 1 )
+		libcnotify_printf(
+		 "%s: logical volume identifier\t\t: %s\n",
+		 function,
+		 string );
+
+		memory_free(
+		 string );
+
+		string = NULL;
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	if( libfplist_property_value_uuid_string_copy_to_byte_stream(
+	     sub_property,
+	     logical_volume_descriptor->identifier,
+	     16,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+		 "%s: unable to copy LV UUID string to byte stream.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfplist_property_free(
+	     &sub_property,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free com.apple.corestorage.lv.uuid property.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfplist_property_free(
+	     &root_property,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free root property.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfplist_property_list_free(
+	     &property_list,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free property list.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( string != NULL )
+	{
+		memory_free(
+		 string );
+	}
+#endif
+	if( sub_property != NULL )
+	{
+		libfplist_property_free(
+		 &sub_property,
+		 NULL );
+	}
+	if( root_property != NULL )
+	{
+		libfplist_property_free(
+		 &root_property,
+		 NULL );
+	}
+	if( property_list != NULL )
+	{
+		libfplist_property_list_free(
+		 &property_list,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the encrypted metadata block type 0x001a
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_encrypted_metadata_read_type_0x001a(
+     libfvde_encrypted_metadata_t *encrypted_metadata,
+     const uint8_t *block_data,
+     size_t block_data_size,
+     libcerror_error_t **error )
+{
+	libfvde_logical_volume_descriptor_t *logical_volume_descriptor = NULL;
+	libfvde_plist_scanner_element_t root_element;
+	const uint8_t *xml_plist_data                                  = NULL;
+	static char *function                                          = "libfvde_encrypted_metadata_read_type_0x001a";
+	size_t block_data_offset                                       = 0;
+	size_t xml_length                                              = 0;
+	uint64_t object_identifier                                     = 0;
+	uint64_t object_identifier_0x0305                              = 0;
+	uint64_t object_identifier_0x0505                              = 0;
+	uint32_t compressed_data_size                                  = 0;
+	uint32_t uncompressed_data_size                                = 0;
+	uint32_t xml_plist_data_offset                                 = 0;
+	uint32_t xml_plist_data_size                                   = 0;
+	int result                                                     = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	uint64_t value_64bit                                           = 0;
+#endif
+
+	if( encrypted_metadata == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid encrypted metadata.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_data_size < 72 )
+	 || ( block_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 &( block_data[ 0 ] ),
+	 object_identifier );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( block_data[ 8 ] ),
+	 object_identifier_0x0305 );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( block_data[ 40 ] ),
+	 object_identifier_0x0505 );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( block_data[ 56 ] ),
+	 compressed_data_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( block_data[ 60 ] ),
+	 uncompressed_data_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( block_data[ 64 ] ),
+	 xml_plist_data_offset );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( block_data[ 68 ] ),
+	 xml_plist_data_size );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: object identifier\t\t\t: %" PRIu64 "\n",
+		 function,
+		 object_identifier );
+
+		libcnotify_printf(
+		 "%s: 0x0305 object identifier\t\t: %" PRIu64 "\n",
+		 function,
+		 object_identifier_0x0305 );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 &( block_data[ 16 ] ),
+		 value_64bit );
+		libcnotify_printf(
+		 "%s: unknown1\t\t\t\t: %" PRIu64 "\n",
+		 function,
+		 value_64bit );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 &( block_data[ 24 ] ),
+		 value_64bit );
+		libcnotify_printf(
+		 "%s: unknown2\t\t\t\t: %" PRIu64 "\n",
+		 function,
+		 value_64bit );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 &( block_data[ 32 ] ),
+		 value_64bit );
+		libcnotify_printf(
+		 "%s: 0x0021 object identifier\t\t: %" PRIu64 "\n",
+		 function,
+		 value_64bit );
+
+		libcnotify_printf(
+		 "%s: 0x0505 object identifier\t\t: %" PRIu64 "\n",
+		 function,
+		 object_identifier_0x0505 );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 &( block_data[ 48 ] ),
+		 value_64bit );
+		libcnotify_printf(
+		 "%s: unknown3\t\t\t\t: %" PRIu64 "\n",
+		 function,
+		 value_64bit );
+
+		libcnotify_printf(
+		 "%s: compressed data size\t\t: %" PRIu32 "\n",
+		 function,
+		 compressed_data_size );
+
+		libcnotify_printf(
+		 "%s: uncompressed data size\t\t: %" PRIu32 "\n",
+		 function,
+		 uncompressed_data_size );
+
+		libcnotify_printf(
+		 "%s: XML plist data offset\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 xml_plist_data_offset );
+
+		libcnotify_printf(
+		 "%s: XML plist data size\t\t: %" PRIu32 "\n",
+		 function,
+		 xml_plist_data_size );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	block_data_offset = 72;
+
+	if( ( xml_plist_data_offset < ( block_data_offset + 64 ) )
+	 || ( (size_t) xml_plist_data_offset > block_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid XML plist data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( xml_plist_data_size > ( block_data_size - ( xml_plist_data_offset - 64 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid XML plist data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		if( xml_plist_data_offset > ( block_data_offset + 64 ) )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve com.apple.corestorage.lv.uuid sub property.",
+			libcnotify_printf(
+			 "%s: unknown4:\n",
 			 function );
-
-			goto on_error;
+			libcnotify_print_data(
+			 &( block_data[ block_data_offset ] ),
+			 xml_plist_data_offset - ( block_data_offset + 64 ),
+			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
 		}
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	if( libfvde_encrypted_metadata_get_logical_volume_descriptor_by_object_identifier(
+	     encrypted_metadata,
+	     object_identifier,
+	     &logical_volume_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve logical volume descriptor with object identifier: %" PRIu64 ".",
+		 function,
+		 object_identifier );
+
+		return( -1 );
+	}
+	if( logical_volume_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing logical volume descriptor with object identifier: %" PRIu64 ".",
+		 function,
+		 object_identifier );
+
+		return( -1 );
+	}
+	if( ( object_identifier_0x0305 != 0 )
+	 && ( logical_volume_descriptor->object_identifier_0x0305 != 0 )
+	 && ( logical_volume_descriptor->object_identifier_0x0305 != object_identifier_0x0305 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: mismatch in object identifier 0x0305 (stored: %" PRIu64 ", expected: %" PRIu64 ").",
+		 function,
+		 object_identifier_0x0305,
+		 logical_volume_descriptor->object_identifier_0x0305 );
+
+		return( -1 );
+	}
+	if( ( object_identifier_0x0505 != 0 )
+	 && ( logical_volume_descriptor->object_identifier_0x0505 != 0 )
+	 && ( logical_volume_descriptor->object_identifier_0x0505 != object_identifier_0x0505 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: mismatch in object identifier 0x0505 (stored: %" PRIu64 ", expected: %" PRIu64 ").",
+		 function,
+		 object_identifier_0x0505,
+		 logical_volume_descriptor->object_identifier_0x0505 );
+
+		return( -1 );
+	}
+	if( logical_volume_descriptor->name != NULL )
+	{
+		memory_free(
+		 logical_volume_descriptor->name );
+
+		logical_volume_descriptor->name      = NULL;
+		logical_volume_descriptor->name_size = 0;
+	}
+	if( compressed_data_size != uncompressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported compressed XML plist.",
+		 function );
+
+		return( -1 );
+	}
+	xml_plist_data = &( block_data[ xml_plist_data_offset - 64 ] );
+
+/* TODO handle compressed XML plist data */
+	if( ( xml_plist_data[ 0 ] == (uint8_t) '<' )
+	 && ( xml_plist_data[ 1 ] == (uint8_t) 'd' )
+	 && ( xml_plist_data[ 2 ] == (uint8_t) 'i' )
+	 && ( xml_plist_data[ 3 ] == (uint8_t) 'c' )
+	 && ( xml_plist_data[ 4 ] == (uint8_t) 't' ) )
+	{
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
-			if( libfplist_property_get_value_string(
-			     sub_property,
-			     &string,
-			     &string_size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve logical volume identifier.",
-				 function );
-
-				goto on_error;
-			}
 			libcnotify_printf(
-			 "%s: logical volume identifier\t\t: %s\n",
+			 "%s: XML:\n%s\n",
 			 function,
-			 string );
-
-			memory_free(
-			 string );
+			 (char *) xml_plist_data );
 
-			string = NULL;
+			libcnotify_printf(
+			 "\n" );
 		}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+#endif
+/* TODO for now determine the XML string length */
+/* TODO refactor this to a separate function */
+		xml_length = narrow_string_length(
+			      (char *) xml_plist_data );
 
-		if( libfplist_property_value_uuid_string_copy_to_byte_stream(
-		     sub_property,
-		     logical_volume_descriptor->identifier,
-		     16,
-		     error ) != 1 )
+		if( xml_length > (size_t) ( INT_MAX - 1 ) )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
-			 "%s: unable to copy LV UUID string to byte stream.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid XML length value out of bounds.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( libfplist_property_free(
-		     &sub_property,
-		     error ) != 1 )
+		/* Try the streaming scanner first and fall back to the property list
+		 * for XML plist data that the scanner does not support
+		 */
+		result = libfvde_plist_scanner_get_root_element(
+		          xml_plist_data,
+		          xml_length,
+		          &root_element,
+		          error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free com.apple.corestorage.lv.uuid property.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve root element.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( libfplist_property_free(
-		     &root_property,
-		     error ) != 1 )
+		else if( result != 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free root property.",
-			 function );
+			if( libfvde_encrypted_metadata_read_logical_volume_root_element(
+			     logical_volume_descriptor,
+			     &root_element,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read logical volume root element.",
+				 function );
 
-			goto on_error;
+				return( -1 );
+			}
 		}
-		if( libfplist_property_list_free(
-		     &property_list,
-		     error ) != 1 )
+		else
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free property list.",
-			 function );
+			if( libfvde_encrypted_metadata_read_logical_volume_property_list(
+			     logical_volume_descriptor,
+			     xml_plist_data,
+			     xml_length,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read logical volume property list.",
+				 function );
 
-			goto on_error;
+				return( -1 );
+			}
 		}
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -3133,34 +3564,6 @@ int libfvde_encrypted_metadata_read_type_0x001a(
 	}
 #endif
 	return( 1 );
-
-on_error:
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( string != NULL )
-	{
-		memory_free(
-		 string );
-	}
-#endif
-	if( sub_property != NULL )
-	{
-		libfplist_property_free(
-		 &sub_property,
-		 NULL );
-	}
-	if( root_property != NULL )
-	{
-		libfplist_property_free(
-		 &root_property,
-		 NULL );
-	}
-	if( property_list != NULL )
-	{
-		libfplist_property_list_free(
-		 &property_list,
-		 NULL );
-	}
-	return( -1 );
 }
 
 /* Reads the encrypted metadata block type 0x001c
@@ -4074,7 +4477,6 @@ int libfvde_encrypted_metadata_read_type_0x0105(
 	uint64_t object_identifier                                              = 0;
 	uint32_t entry_index                                                    = 0;
 	uint32_t number_of_entries                                              = 0;
-	int logical_volume_descriptor_index                                     = 0;
 	int number_of_logical_volume_descriptors                                = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -4218,22 +4620,20 @@ int libfvde_encrypted_metadata_read_type_0x0105(
 			}
 			logical_volume_descriptor->object_identifier = object_identifier;
 
-			if( libcdata_array_append_entry(
-			     encrypted_metadata->logical_volume_descriptors,
-			     &logical_volume_descriptor_index,
-			     (intptr_t *) logical_volume_descriptor,
+			if( libfvde_encrypted_metadata_append_logical_volume_descriptor(
+			     encrypted_metadata,
+			     &logical_volume_descriptor,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-				 "%s: unable to append logical volume descriptor to array.",
+				 "%s: unable to append logical volume descriptor.",
 				 function );
 
 				goto on_error;
 			}
-			logical_volume_descriptor = NULL;
 		}
 		else
 		{
@@ -4332,7 +4732,6 @@ int libfvde_encrypted_metadata_read_type_0x0304(
 	uint32_t number_of_blocks                        = 0;
 	uint32_t number_of_entries                       = 0;
 	int result                                       = 0;
-	int segment_descriptor_index                     = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
 	uint64_t value_64bit                             = 0;
@@ -4527,12 +4926,9 @@ int libfvde_encrypted_metadata_read_type_0x0304(
 
 		block_data_offset += 40;
 
-		result = libcdata_array_insert_entry(
+		result = libfvde_encrypted_metadata_insert_segment_descriptor(
 		          encrypted_metadata->segment_descriptors_0x0304,
-		          &segment_descriptor_index,
-		          (intptr_t *) segment_descriptor,
-		          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libfvde_segment_descriptor_compare,
-		          LIBCDATA_INSERT_FLAG_UNIQUE_ENTRIES,
+		          segment_descriptor,
 		          error );
 
 		if( result == -1 )
@@ -4597,7 +4993,6 @@ int libfvde_encrypted_metadata_read_type_0x0305(
 	uint32_t number_of_blocks                                      = 0;
 	uint32_t number_of_entries                                     = 0;
 	int result                                                     = 0;
-	int segment_descriptor_index                                   = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
 	uint64_t value_64bit                                           = 0;
@@ -4817,12 +5212,9 @@ int libfvde_encrypted_metadata_read_type_0x0305(
 
 		block_data_offset += 40;
 
-		result = libcdata_array_insert_entry(
+		result = libfvde_encrypted_metadata_insert_segment_descriptor(
 		          logical_volume_descriptor->segment_descriptors,
-		          &segment_descriptor_index,
-		          (intptr_t *) segment_descriptor,
-		          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libfvde_segment_descriptor_compare,
-		          LIBCDATA_INSERT_FLAG_UNIQUE_ENTRIES,
+		          segment_descriptor,
 		          error );
 
 		if( result == -1 )
@@ -5215,32 +5607,208 @@ int libfvde_encrypted_metadata_read_type_0x0405(
 		}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
-		block_data_offset += 48;
+		block_data_offset += 48;
+	}
+	return( 1 );
+}
+
+/* Reads the encrypted metadata block type 0x0505
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_encrypted_metadata_read_type_0x0505(
+     libfvde_encrypted_metadata_t *encrypted_metadata,
+     uint64_t object_identifier,
+     const uint8_t *block_data,
+     size_t block_data_size,
+     libcerror_error_t **error )
+{
+	libfvde_logical_volume_descriptor_t *logical_volume_descriptor = NULL;
+	static char *function                                          = "libfvde_encrypted_metadata_read_type_0x0505";
+	size_t block_data_offset                                       = 0;
+	uint64_t physical_block_number                                 = 0;
+	uint32_t entry_index                                           = 0;
+	uint32_t number_of_entries                                     = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	uint64_t value_64bit                                           = 0;
+	uint32_t value_32bit                                           = 0;
+#endif
+
+	if( encrypted_metadata == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid encrypted metadata.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_data_size < 8 )
+	 || ( block_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvde_encrypted_metadata_get_last_logical_volume_descriptor(
+	     encrypted_metadata,
+	     &logical_volume_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve last logical volume descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( logical_volume_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing logical volume descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( block_data[ 0 ] ),
+	 number_of_entries );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: number of entries\t\t\t: %" PRIu32 "\n",
+		 function,
+		 number_of_entries );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( block_data[ 4 ] ),
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: unknown1\t\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 value_32bit );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	block_data_offset = 8;
+
+	if( number_of_entries > ( ( block_data_size - block_data_offset ) / 16 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( block_data[ block_data_offset + 8 ] ),
+		 physical_block_number );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			byte_stream_copy_to_uint64_little_endian(
+			 &( block_data[ block_data_offset ] ),
+			 value_64bit );
+
+			libcnotify_printf(
+			 "%s: entry: %03d number of blocks\t: %" PRIu64 "\n",
+			 function,
+			 entry_index,
+			 value_64bit );
+
+			libcnotify_printf(
+			 "%s: entry: %03d physical block number\t: %" PRIu64 "\n",
+			 function,
+			 entry_index,
+			 physical_block_number & 0x0000ffffffffffffUL );
+
+			libcnotify_printf(
+			 "%s: entry: %03d physical volume index\t: %" PRIu64 "\n",
+			 function,
+			 entry_index,
+			 physical_block_number >> 48 );
+
+			libcnotify_printf(
+			 "\n" );
+		}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+		block_data_offset += 16;
+	}
+	if( number_of_entries > 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( physical_block_number >> 48 ) > 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported physical block number.",
+		 function );
+
+		return( -1 );
 	}
+	logical_volume_descriptor->object_identifier_0x0505   = object_identifier;
+	logical_volume_descriptor->base_physical_block_number = physical_block_number;
+
 	return( 1 );
 }
 
-/* Reads the encrypted metadata block type 0x0505
+/* Reads the encrypted metadata block type 0x0605
  * Returns 1 if successful or -1 on error
  */
-int libfvde_encrypted_metadata_read_type_0x0505(
+int libfvde_encrypted_metadata_read_type_0x0605(
      libfvde_encrypted_metadata_t *encrypted_metadata,
-     uint64_t object_identifier,
      const uint8_t *block_data,
      size_t block_data_size,
      libcerror_error_t **error )
 {
-	libfvde_logical_volume_descriptor_t *logical_volume_descriptor = NULL;
-	static char *function                                          = "libfvde_encrypted_metadata_read_type_0x0505";
-	size_t block_data_offset                                       = 0;
-	uint64_t physical_block_number                                 = 0;
-	uint32_t entry_index                                           = 0;
-	uint32_t number_of_entries                                     = 0;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-	uint64_t value_64bit                                           = 0;
-	uint32_t value_32bit                                           = 0;
-#endif
+	static char *function = "libfvde_encrypted_metadata_read_type_0x0605";
 
 	if( encrypted_metadata == NULL )
 	{
@@ -5264,7 +5832,7 @@ int libfvde_encrypted_metadata_read_type_0x0505(
 
 		return( -1 );
 	}
-	if( ( block_data_size < 8 )
+	if( ( block_data_size < 54 )
 	 || ( block_data_size > (size_t) SSIZE_MAX ) )
 	{
 		libcerror_error_set(
@@ -5276,183 +5844,345 @@ int libfvde_encrypted_metadata_read_type_0x0505(
 
 		return( -1 );
 	}
-	if( libfvde_encrypted_metadata_get_last_logical_volume_descriptor(
-	     encrypted_metadata,
-	     &logical_volume_descriptor,
-	     error ) != 1 )
+	return( 1 );
+}
+
+/* Decrypts the encrypted metadata blocks in place
+ * The block number is the number of the first block relative to the start of the encrypted metadata
+ * The blocks are spread over the decryption thread pool if one is provided, otherwise they are
+ * decrypted with the encryption context. Both are created once by the caller and reused for every call
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_encrypted_metadata_decrypt_blocks(
+     libfvde_encryption_context_t *encryption_context,
+     libfvde_decryption_thread_pool_t *decryption_thread_pool,
+     uint8_t *data,
+     size_t data_size,
+     uint64_t block_number,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_encrypted_metadata_decrypt_blocks";
+
+	if( encryption_context == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve last logical volume descriptor.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid encryption context.",
 		 function );
 
 		return( -1 );
 	}
-	if( logical_volume_descriptor == NULL )
+	if( data == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing logical volume descriptor.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
 		 function );
 
 		return( -1 );
 	}
-	byte_stream_copy_to_uint32_little_endian(
-	 &( block_data[ 0 ] ),
-	 number_of_entries );
+	if( ( data_size > (size_t) SSIZE_MAX )
+	 || ( ( data_size % 8192 ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+		return( -1 );
+	}
+	if( data_size == 0 )
 	{
-		libcnotify_printf(
-		 "%s: number of entries\t\t\t: %" PRIu32 "\n",
-		 function,
-		 number_of_entries );
+		return( 1 );
+	}
+	if( ( decryption_thread_pool != NULL )
+	 && ( data_size >= ( 2 * LIBFVDE_MINIMUM_DECRYPTION_BATCH_SIZE ) ) )
+	{
+		if( libfvde_decryption_thread_pool_decrypt(
+		     decryption_thread_pool,
+		     data,
+		     data_size,
+		     block_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+			 LIBCERROR_ENCRYPTION_ERROR_DECRYPT_FAILED,
+			 "%s: unable to decrypt metadata blocks.",
+			 function );
 
-		byte_stream_copy_to_uint32_little_endian(
-		 &( block_data[ 4 ] ),
-		 value_32bit );
-		libcnotify_printf(
-		 "%s: unknown1\t\t\t\t: 0x%08" PRIx32 "\n",
-		 function,
-		 value_32bit );
+			return( -1 );
+		}
+	}
+	else
+	{
+		if( libfvde_encryption_context_crypt_sectors(
+		     encryption_context,
+		     LIBFVDE_ENCRYPTION_CRYPT_MODE_DECRYPT,
+		     data,
+		     data_size,
+		     data,
+		     data_size,
+		     block_number,
+		     8192,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+			 LIBCERROR_ENCRYPTION_ERROR_DECRYPT_FAILED,
+			 "%s: unable to decrypt metadata blocks.",
+			 function );
 
-		libcnotify_printf(
-		 "\n" );
+			return( -1 );
+		}
 	}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+	return( 1 );
+}
 
-	block_data_offset = 8;
+/* Reads the transaction identifier from the first encrypted metadata block
+ * Only the first block is read and decrypted
+ * Returns 1 if successful, 0 if the first block is empty or -1 on error
+ */
+int libfvde_encrypted_metadata_read_transaction_identifier_file_io_handle(
+     libfvde_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     const uint8_t *key,
+     size_t key_bit_size,
+     const uint8_t *tweak_key,
+     size_t tweak_key_bit_size,
+     uint64_t *transaction_identifier,
+     libcerror_error_t **error )
+{
+	libfvde_encryption_context_t *encryption_context = NULL;
+	libfvde_metadata_block_t *metadata_block         = NULL;
+	uint8_t *metadata_block_data                     = NULL;
+	static char *function                            = "libfvde_encrypted_metadata_read_transaction_identifier_file_io_handle";
+	ssize_t read_count                               = 0;
+	int result                                       = 0;
 
-	if( number_of_entries > ( ( block_data_size - block_data_offset ) / 16 ) )
+	if( transaction_identifier == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid number of entries value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid transaction identifier.",
 		 function );
 
 		return( -1 );
 	}
-	for( entry_index = 0;
-	     entry_index < number_of_entries;
-	     entry_index++ )
+	metadata_block_data = (uint8_t *) memory_allocate(
+	                                   sizeof( uint8_t ) * 8192 );
+
+	if( metadata_block_data == NULL )
 	{
-		byte_stream_copy_to_uint64_little_endian(
-		 &( block_data[ block_data_offset + 8 ] ),
-		 physical_block_number );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create metadata block data.",
+		 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		goto on_error;
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              metadata_block_data,
+	              8192,
+	              file_offset,
+	              error );
+
+	if( read_count != (ssize_t) 8192 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read encrypted metadata block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		goto on_error;
+	}
+	result = libfvde_metadata_block_check_for_empty_block(
+		  metadata_block_data,
+		  8192,
+		  error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if encrypted medadata block data is empty.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		if( libfvde_encryption_context_initialize(
+		     &encryption_context,
+		     LIBFVDE_ENCRYPTION_METHOD_AES_128_XTS,
+		     error ) != 1 )
 		{
-			byte_stream_copy_to_uint64_little_endian(
-			 &( block_data[ block_data_offset ] ),
-			 value_64bit );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create encryption context.",
+			 function );
 
-			libcnotify_printf(
-			 "%s: entry: %03d number of blocks\t: %" PRIu64 "\n",
-			 function,
-			 entry_index,
-			 value_64bit );
+			goto on_error;
+		}
+		if( libfvde_encryption_context_set_keys(
+		     encryption_context,
+		     key,
+		     key_bit_size,
+		     tweak_key,
+		     tweak_key_bit_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set keys in encryption context.",
+			 function );
 
-			libcnotify_printf(
-			 "%s: entry: %03d physical block number\t: %" PRIu64 "\n",
-			 function,
-			 entry_index,
-			 physical_block_number & 0x0000ffffffffffffUL );
+			goto on_error;
+		}
+		if( libfvde_encrypted_metadata_decrypt_blocks(
+		     encryption_context,
+		     NULL,
+		     metadata_block_data,
+		     8192,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+			 LIBCERROR_ENCRYPTION_ERROR_DECRYPT_FAILED,
+			 "%s: unable to decrypt metadata block.",
+			 function );
 
-			libcnotify_printf(
-			 "%s: entry: %03d physical volume index\t: %" PRIu64 "\n",
-			 function,
-			 entry_index,
-			 physical_block_number >> 48 );
+			goto on_error;
+		}
+		if( libfvde_encryption_context_free(
+		     &encryption_context,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free encryption context.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfvde_metadata_block_initialize(
+		     &metadata_block,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create metadata block.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfvde_metadata_block_read_data(
+		     metadata_block,
+		     metadata_block_data,
+		     8192,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read metadata block.",
+			 function );
+
+			goto on_error;
+		}
+		*transaction_identifier = metadata_block->transaction_identifier;
+
+		if( libfvde_metadata_block_free(
+		     &metadata_block,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free metadata block.",
+			 function );
 
-			libcnotify_printf(
-			 "\n" );
+			goto on_error;
 		}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
-
-		block_data_offset += 16;
 	}
-	if( number_of_entries > 1 )
+	if( memory_set(
+	     metadata_block_data,
+	     0,
+	     8192 ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported number of entries.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear metadata block data.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( ( physical_block_number >> 48 ) > 0 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported physical block number.",
-		 function );
+	memory_free(
+	 metadata_block_data );
 
-		return( -1 );
+	if( result != 0 )
+	{
+		return( 0 );
 	}
-	logical_volume_descriptor->object_identifier_0x0505   = object_identifier;
-	logical_volume_descriptor->base_physical_block_number = physical_block_number;
-
 	return( 1 );
-}
-
-/* Reads the encrypted metadata block type 0x0605
- * Returns 1 if successful or -1 on error
- */
-int libfvde_encrypted_metadata_read_type_0x0605(
-     libfvde_encrypted_metadata_t *encrypted_metadata,
-     const uint8_t *block_data,
-     size_t block_data_size,
-     libcerror_error_t **error )
-{
-	static char *function = "libfvde_encrypted_metadata_read_type_0x0605";
 
-	if( encrypted_metadata == NULL )
+on_error:
+	if( metadata_block != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid encrypted metadata.",
-		 function );
-
-		return( -1 );
+		libfvde_metadata_block_free(
+		 &metadata_block,
+		 NULL );
 	}
-	if( block_data == NULL )
+	if( encryption_context != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid block data.",
-		 function );
-
-		return( -1 );
+		libfvde_encryption_context_free(
+		 &encryption_context,
+		 NULL );
 	}
-	if( ( block_data_size < 54 )
-	 || ( block_data_size > (size_t) SSIZE_MAX ) )
+	if( metadata_block_data != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid block data size value out of bounds.",
-		 function );
-
-		return( -1 );
+		memory_set(
+		 metadata_block_data,
+		 0,
+		 8192 );
+		memory_free(
+		 metadata_block_data );
 	}
-	return( 1 );
+	return( -1 );
 }
 
 /* Reads the encrypted metadata
@@ -5470,16 +6200,20 @@ int libfvde_encrypted_metadata_read_from_file_io_handle(
      size_t tweak_key_bit_size,
      libcerror_error_t **error )
 {
-	libfvde_encryption_context_t *encryption_context = NULL;
-	libfvde_metadata_block_t *metadata_block         = NULL;
-	uint8_t *encrypted_data                          = NULL;
-	uint8_t *metadata_block_data                     = NULL;
-	static char *function                            = "libfvde_encrypted_metadata_read_from_file_io_handle";
-	size_t encrypted_data_offset                     = 0;
-	ssize_t read_count                               = 0;
-	uint64_t calculated_block_number                 = 0;
-	uint8_t empty_block_found                        = 0;
-	int result                                       = 0;
+	libfvde_decryption_thread_pool_t *decryption_thread_pool = NULL;
+	libfvde_encryption_context_t *encryption_context         = NULL;
+	libfvde_metadata_block_t *metadata_block                 = NULL;
+	uint8_t *chunk_data                                      = NULL;
+	static char *function                                    = "libfvde_encrypted_metadata_read_from_file_io_handle";
+	size_t chunk_data_offset                                 = 0;
+	size_t chunk_data_size                                   = 0;
+	size_t decrypted_data_size                               = 0;
+	size_t maximum_chunk_data_size                           = 0;
+	ssize_t read_count                                       = 0;
+	uint64_t calculated_block_number                         = 0;
+	uint64_t metadata_data_offset                            = 0;
+	uint8_t empty_block_found                                = 0;
+	int result                                               = 0;
 
 	if( encrypted_metadata == NULL )
 	{
@@ -5504,7 +6238,7 @@ int libfvde_encrypted_metadata_read_from_file_io_handle(
 		return( -1 );
 	}
 	if( ( encrypted_metadata_size == 0 )
-	 || ( encrypted_metadata_size > (uint64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	 || ( encrypted_metadata_size > (uint64_t) INT64_MAX ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -5515,60 +6249,41 @@ int libfvde_encrypted_metadata_read_from_file_io_handle(
 
 		return( -1 );
 	}
-	encrypted_data = (uint8_t *) memory_allocate(
-	                              sizeof( uint8_t ) * (size_t) encrypted_metadata_size );
+	maximum_chunk_data_size = LIBFVDE_MAXIMUM_ENCRYPTED_METADATA_CHUNK_SIZE;
 
-	if( encrypted_data == NULL )
+	if( encrypted_metadata_size < (uint64_t) maximum_chunk_data_size )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create encrypted metadata.",
-		 function );
-
-		goto on_error;
+		maximum_chunk_data_size = (size_t) encrypted_metadata_size - ( (size_t) encrypted_metadata_size % 8192 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( maximum_chunk_data_size > 0 )
 	{
-		libcnotify_printf(
-		 "%s: reading encrypted metadata at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
-		 function,
-		 file_offset,
-		 file_offset );
-	}
-#endif
-	read_count = libbfio_handle_read_buffer_at_offset(
-	              file_io_handle,
-	              encrypted_data,
-	              (size_t) encrypted_metadata_size,
-	              file_offset,
-	              error );
+		chunk_data = (uint8_t *) memory_allocate(
+		                          sizeof( uint8_t ) * maximum_chunk_data_size );
 
-	if( read_count != (ssize_t) encrypted_metadata_size )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read encrypted metadata at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-		 function,
-		 file_offset,
-		 file_offset );
+		if( chunk_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create encrypted metadata chunk data.",
+			 function );
 
-		goto on_error;
+			goto on_error;
+		}
 	}
+	/* The keys are expanded once for all the chunks
+	 */
 	if( libfvde_encryption_context_initialize(
 	     &encryption_context,
 	     LIBFVDE_ENCRYPTION_METHOD_AES_128_XTS,
-	     error ) == -1 )
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
-		 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
-		 "%s: unable to initialize encryption context.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create encryption context.",
 		 function );
 
 		goto on_error;
@@ -5579,32 +6294,41 @@ int libfvde_encrypted_metadata_read_from_file_io_handle(
 	     key_bit_size,
 	     tweak_key,
 	     tweak_key_bit_size,
-	     error ) == -1 )
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
 		 "%s: unable to set keys in encryption context.",
 		 function );
 
 		goto on_error;
 	}
-	metadata_block_data = (uint8_t *) memory_allocate(
-	                                   sizeof( uint8_t ) * 8192 );
-
-	if( metadata_block_data == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create metadata block data.",
-		 function );
+	if( ( io_handle->number_of_decryption_threads > 1 )
+	 && ( maximum_chunk_data_size >= ( 2 * LIBFVDE_MINIMUM_DECRYPTION_BATCH_SIZE ) ) )
+	{
+		if( libfvde_decryption_thread_pool_initialize(
+		     &decryption_thread_pool,
+		     io_handle->number_of_decryption_threads,
+		     8192,
+		     LIBFVDE_ENCRYPTION_METHOD_AES_128_XTS,
+		     key,
+		     key_bit_size,
+		     tweak_key,
+		     tweak_key_bit_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create decryption thread pool.",
+			 function );
 
-		goto on_error;
+			goto on_error;
+		}
 	}
-/* TODO move data allocation into metadata_block? */
 	if( libfvde_metadata_block_initialize(
 	     &metadata_block,
 	     error ) != 1 )
@@ -5618,80 +6342,118 @@ int libfvde_encrypted_metadata_read_from_file_io_handle(
 
 		goto on_error;
 	}
-	while( encrypted_data_offset < encrypted_metadata_size )
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
 	{
-		result = libfvde_metadata_block_check_for_empty_block(
-			  &( encrypted_data[ encrypted_data_offset ] ),
-			  8192,
-			  error );
+		libcnotify_printf(
+		 "%s: reading encrypted metadata at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+		 function,
+		 file_offset,
+		 file_offset );
+	}
+#endif
+	/* The encrypted metadata is read and decrypted in chunks of metadata blocks
+	 * so that the memory usage does not depend on the encrypted metadata size.
+	 * The state that spans multiple metadata blocks, such as the compressed
+	 * encryption context plist data, is kept in the encrypted metadata.
+	 */
+	while( ( empty_block_found == 0 )
+	    && ( ( encrypted_metadata_size - metadata_data_offset ) >= 8192 ) )
+	{
+		chunk_data_size = maximum_chunk_data_size;
 
-		if( result == -1 )
+		if( ( encrypted_metadata_size - metadata_data_offset ) < (uint64_t) chunk_data_size )
+		{
+			chunk_data_size  = (size_t) ( encrypted_metadata_size - metadata_data_offset );
+			chunk_data_size -= chunk_data_size % 8192;
+		}
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              chunk_data,
+		              chunk_data_size,
+		              file_offset + (off64_t) metadata_data_offset,
+		              error );
+
+		if( read_count != (ssize_t) chunk_data_size )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine if encrypted medadata block data is empty.",
-			 function );
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read encrypted metadata at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 file_offset + (off64_t) metadata_data_offset,
+			 file_offset + (off64_t) metadata_data_offset );
 
-			return( -1 );
-		}
-		else if( result != 0 )
-		{
-			empty_block_found = 1;
-		}
-		if( empty_block_found != 0 )
-		{
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: empty metadata block: %d at offset %" PRIi64 " (0x%08" PRIx64 ").\n",
-				 function,
-				 calculated_block_number,
-				 file_offset + encrypted_data_offset,
-				 file_offset + encrypted_data_offset );
-			}
-#else
-			break;
-#endif
+			goto on_error;
 		}
-		else
+		/* The metadata blocks of the chunk up to the first empty block are decrypted
+		 * in bulk so that the decryption can be spread over multiple threads, the
+		 * blocks are parsed afterwards in order
+		 */
+		decrypted_data_size = 0;
+
+		while( decrypted_data_size < chunk_data_size )
 		{
-			if( libfvde_encryption_context_crypt(
-			     encryption_context,
-			     LIBFVDE_ENCRYPTION_CRYPT_MODE_DECRYPT,
-			     &( encrypted_data[ encrypted_data_offset ] ),
-			     8192,
-			     metadata_block_data,
-			     8192,
-			     calculated_block_number,
-			     error ) == -1 )
+			result = libfvde_metadata_block_check_for_empty_block(
+				  &( chunk_data[ decrypted_data_size ] ),
+				  8192,
+				  error );
+
+			if( result == -1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
-				 LIBCERROR_ENCRYPTION_ERROR_DECRYPT_FAILED,
-				 "%s: unable to decrypt metadata data block: %" PRIu64 " data.",
-				 function,
-				 calculated_block_number );
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine if encrypted medadata block data is empty.",
+				 function );
 
 				goto on_error;
 			}
+			else if( result != 0 )
+			{
+				empty_block_found = 1;
+
+				break;
+			}
+			decrypted_data_size += 8192;
+		}
+		if( libfvde_encrypted_metadata_decrypt_blocks(
+		     encryption_context,
+		     decryption_thread_pool,
+		     chunk_data,
+		     decrypted_data_size,
+		     calculated_block_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+			 LIBCERROR_ENCRYPTION_ERROR_DECRYPT_FAILED,
+			 "%s: unable to decrypt metadata blocks.",
+			 function );
+
+			goto on_error;
+		}
+		for( chunk_data_offset = 0;
+		     chunk_data_offset < decrypted_data_size;
+		     chunk_data_offset += 8192 )
+		{
 #if defined( HAVE_DEBUG_OUTPUT )
 			if( libcnotify_verbose != 0 )
 			{
 				libcnotify_printf(
-				 "%s: reading decrypted metadata block: %d at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+				 "%s: reading decrypted metadata block: %" PRIu64 " at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
 				 function,
 				 calculated_block_number,
-				 file_offset + encrypted_data_offset,
-				 file_offset + encrypted_data_offset );
+				 file_offset + (off64_t) metadata_data_offset,
+				 file_offset + (off64_t) metadata_data_offset );
 			}
 #endif
 			if( libfvde_metadata_block_read_data(
 			     metadata_block,
-			     metadata_block_data,
+			     &( chunk_data[ chunk_data_offset ] ),
 			     8192,
 			     error ) != 1 )
 			{
@@ -5933,10 +6695,36 @@ int libfvde_encrypted_metadata_read_from_file_io_handle(
 					goto on_error;
 				}
 			}
+			metadata_data_offset += 8192;
+
+			calculated_block_number += 1;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( ( libcnotify_verbose != 0 )
+		 && ( empty_block_found != 0 ) )
+		{
+			libcnotify_printf(
+			 "%s: empty metadata block: %" PRIu64 " at offset %" PRIi64 " (0x%08" PRIx64 ").\n",
+			 function,
+			 calculated_block_number,
+			 file_offset + (off64_t) metadata_data_offset,
+			 file_offset + (off64_t) metadata_data_offset );
 		}
-		encrypted_data_offset += 8192;
+#endif
+		if( memory_set(
+		     chunk_data,
+		     0,
+		     chunk_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear encrypted metadata chunk data.",
+			 function );
 
-		calculated_block_number += 1;
+			goto on_error;
+		}
 	}
 	if( libfvde_metadata_block_free(
 	     &metadata_block,
@@ -5945,31 +6733,28 @@ int libfvde_encrypted_metadata_read_from_file_io_handle(
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free metadata block.",
-		 function );
-
-		goto on_error;
-	}
-	if( memory_set(
-	     metadata_block_data,
-	     0,
-	     8192 ) == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear metadata block data.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free metadata block.",
 		 function );
 
 		goto on_error;
 	}
-	memory_free(
-	 metadata_block_data );
-
-	metadata_block_data = NULL;
+	if( decryption_thread_pool != NULL )
+	{
+		if( libfvde_decryption_thread_pool_free(
+		     &decryption_thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free decryption thread pool.",
+			 function );
 
+			goto on_error;
+		}
+	}
 	if( libfvde_encryption_context_free(
 	     &encryption_context,
 	     error ) != 1 )
@@ -5983,11 +6768,13 @@ int libfvde_encrypted_metadata_read_from_file_io_handle(
 
 		goto on_error;
 	}
-	memory_free(
-	 encrypted_data );
-
-	encrypted_data = NULL;
+	if( chunk_data != NULL )
+	{
+		memory_free(
+		 chunk_data );
 
+		chunk_data = NULL;
+	}
 	if( encrypted_metadata->encryption_context_plist_data != NULL )
 	{
 		result = libfvde_encryption_context_plist_set_data(
@@ -6044,14 +6831,11 @@ on_error:
 		 &metadata_block,
 		 NULL );
 	}
-	if( metadata_block_data != NULL )
+	if( decryption_thread_pool != NULL )
 	{
-		memory_set(
-		 metadata_block_data,
-		 0,
-		 8192 );
-		memory_free(
-		 metadata_block_data );
+		libfvde_decryption_thread_pool_free(
+		 &decryption_thread_pool,
+		 NULL );
 	}
 	if( encryption_context != NULL )
 	{
@@ -6059,10 +6843,14 @@ on_error:
 		 &encryption_context,
 		 NULL );
 	}
-	if( encrypted_data != NULL )
+	if( chunk_data != NULL )
 	{
+		memory_set(
+		 chunk_data,
+		 0,
+		 maximum_chunk_data_size );
 		memory_free(
-		 encrypted_data );
+		 chunk_data );
 	}
 	return( -1 );
 }
@@ -6597,6 +7385,282 @@ on_error:
 	return( -1 );
 }
 
+/* Appends a logical volume descriptor
+ * The logical volume descriptor is managed by the encrypted metadata on return
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_encrypted_metadata_append_logical_volume_descriptor(
+     libfvde_encrypted_metadata_t *encrypted_metadata,
+     libfvde_logical_volume_descriptor_t **logical_volume_descriptor,
+     libcerror_error_t **error )
+{
+	libfvde_logical_volume_descriptor_t *existing_logical_volume_descriptor = NULL;
+	libfvde_logical_volume_descriptor_t *safe_logical_volume_descriptor     = NULL;
+	static char *function                                                   = "libfvde_encrypted_metadata_append_logical_volume_descriptor";
+	int entry_index                                                         = 0;
+	int number_of_logical_volume_descriptors                                = 0;
+	int result                                                              = 0;
+	int sorted_index                                                        = 0;
+
+	if( encrypted_metadata == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid encrypted metadata.",
+		 function );
+
+		return( -1 );
+	}
+	if( logical_volume_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *logical_volume_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: missing logical volume descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	safe_logical_volume_descriptor = *logical_volume_descriptor;
+
+	if( libcdata_array_append_entry(
+	     encrypted_metadata->logical_volume_descriptors,
+	     &entry_index,
+	     (intptr_t *) safe_logical_volume_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append logical volume descriptor to array.",
+		 function );
+
+		return( -1 );
+	}
+	*logical_volume_descriptor = NULL;
+
+	result = libfvde_encrypted_metadata_find_logical_volume_descriptor(
+	          encrypted_metadata,
+	          safe_logical_volume_descriptor->object_identifier,
+	          &sorted_index,
+	          &existing_logical_volume_descriptor,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to find logical volume descriptor: %" PRIu64 " in index.",
+		 function,
+		 safe_logical_volume_descriptor->object_identifier );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		/* Replace the existing index entry so that the most recent logical volume descriptor
+		 * with the object identifier is found
+		 */
+		if( libcdata_array_set_entry_by_index(
+		     encrypted_metadata->logical_volume_descriptors_index,
+		     sorted_index,
+		     (intptr_t *) safe_logical_volume_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set logical volume descriptor: %d in index array.",
+			 function,
+			 sorted_index );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     encrypted_metadata->logical_volume_descriptors_index,
+	     &number_of_logical_volume_descriptors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of logical volume descriptors in index.",
+		 function );
+
+		return( -1 );
+	}
+	/* Object identifiers are mostly assigned in ascending order, in which case
+	 * appending avoids scanning the index array
+	 */
+	if( sorted_index == number_of_logical_volume_descriptors )
+	{
+		result = libcdata_array_append_entry(
+		          encrypted_metadata->logical_volume_descriptors_index,
+		          &entry_index,
+		          (intptr_t *) safe_logical_volume_descriptor,
+		          error );
+	}
+	else
+	{
+		result = libcdata_array_insert_entry(
+		          encrypted_metadata->logical_volume_descriptors_index,
+		          &entry_index,
+		          (intptr_t *) safe_logical_volume_descriptor,
+		          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libfvde_logical_volume_descriptor_compare,
+		          LIBCDATA_INSERT_FLAG_UNIQUE_ENTRIES,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert logical volume descriptor: %" PRIu64 " in index array.",
+		 function,
+		 safe_logical_volume_descriptor->object_identifier );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Inserts a segment descriptor into an array sorted by logical block number
+ * Returns 1 if successful, 0 if the segment descriptor overlaps with an existing one or -1 on error
+ */
+int libfvde_encrypted_metadata_insert_segment_descriptor(
+     libcdata_array_t *segment_descriptors,
+     libfvde_segment_descriptor_t *segment_descriptor,
+     libcerror_error_t **error )
+{
+	libfvde_segment_descriptor_t *last_segment_descriptor = NULL;
+	static char *function                                 = "libfvde_encrypted_metadata_insert_segment_descriptor";
+	int entry_index                                       = 0;
+	int number_of_segment_descriptors                     = 0;
+	int result                                            = 0;
+
+	if( segment_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     segment_descriptors,
+	     &number_of_segment_descriptors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of segment descriptors.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_segment_descriptors > 0 )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     segment_descriptors,
+		     number_of_segment_descriptors - 1,
+		     (intptr_t **) &last_segment_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve segment descriptor: %d from array.",
+			 function,
+			 number_of_segment_descriptors - 1 );
+
+			return( -1 );
+		}
+		if( last_segment_descriptor == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing segment descriptor: %d.",
+			 function,
+			 number_of_segment_descriptors - 1 );
+
+			return( -1 );
+		}
+	}
+	/* Segment descriptors are mostly stored in ascending order, in which case
+	 * appending avoids scanning the array for the insert position
+	 */
+	if( ( last_segment_descriptor == NULL )
+	 || ( last_segment_descriptor->logical_block_number < segment_descriptor->logical_block_number ) )
+	{
+		if( libcdata_array_append_entry(
+		     segment_descriptors,
+		     &entry_index,
+		     (intptr_t *) segment_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append segment descriptor to array.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	result = libcdata_array_insert_entry(
+	          segment_descriptors,
+	          &entry_index,
+	          (intptr_t *) segment_descriptor,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libfvde_segment_descriptor_compare,
+	          LIBCDATA_INSERT_FLAG_UNIQUE_ENTRIES,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert segment descriptor in array.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
 /* Retrieves the number of logical volume descriptors
  * Returns 1 if successful or -1 on error
  */
@@ -6676,19 +7740,23 @@ int libfvde_encrypted_metadata_get_logical_volume_descriptor_by_index(
 	return( 1 );
 }
 
-/* Retrieves the logical volume descriptor with a specific object identifier
+/* Searches the index for the logical volume descriptor with a specific object identifier
+ * The sorted index is set to the index of the logical volume descriptor in the index array
+ * or to the index it would be inserted at, if no such logical volume descriptor
  * Returns 1 if successful, 0 if no such volume desciptor or -1 on error
  */
-int libfvde_encrypted_metadata_get_logical_volume_descriptor_by_object_identifier(
+int libfvde_encrypted_metadata_find_logical_volume_descriptor(
      libfvde_encrypted_metadata_t *encrypted_metadata,
      uint64_t object_identifier,
+     int *sorted_index,
      libfvde_logical_volume_descriptor_t **logical_volume_descriptor,
      libcerror_error_t **error )
 {
 	libfvde_logical_volume_descriptor_t *safe_logical_volume_descriptor = NULL;
-	static char *function                                               = "libfvde_encrypted_metadata_get_logical_volume_descriptor_by_object_identifier";
-	int logical_volume_descriptor_index                                 = 0;
-	int number_of_logical_volume_descriptors                            = 0;
+	static char *function                                               = "libfvde_encrypted_metadata_find_logical_volume_descriptor";
+	int lower_index                                                     = 0;
+	int middle_index                                                    = 0;
+	int upper_index                                                     = 0;
 
 	if( encrypted_metadata == NULL )
 	{
@@ -6701,6 +7769,17 @@ int libfvde_encrypted_metadata_get_logical_volume_descriptor_by_object_identifie
 
 		return( -1 );
 	}
+	if( sorted_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sorted index.",
+		 function );
+
+		return( -1 );
+	}
 	if( logical_volume_descriptor == NULL )
 	{
 		libcerror_error_set(
@@ -6713,29 +7792,26 @@ int libfvde_encrypted_metadata_get_logical_volume_descriptor_by_object_identifie
 		return( -1 );
 	}
 	if( libcdata_array_get_number_of_entries(
-	     encrypted_metadata->logical_volume_descriptors,
-	     &number_of_logical_volume_descriptors,
+	     encrypted_metadata->logical_volume_descriptors_index,
+	     &upper_index,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of logical volume descriptors.",
+		 "%s: unable to retrieve number of logical volume descriptors in index.",
 		 function );
 
 		return( -1 );
 	}
-	/* Start with the last logical volume descriptor since most of the time
-	 * we want to find the most recent one
-	 */
-	for( logical_volume_descriptor_index = number_of_logical_volume_descriptors - 1;
-	     logical_volume_descriptor_index >= 0;
-	     logical_volume_descriptor_index-- )
+	while( lower_index < upper_index )
 	{
+		middle_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
 		if( libcdata_array_get_entry_by_index(
-		     encrypted_metadata->logical_volume_descriptors,
-		     logical_volume_descriptor_index,
+		     encrypted_metadata->logical_volume_descriptors_index,
+		     middle_index,
 		     (intptr_t **) &safe_logical_volume_descriptor,
 		     error ) != 1 )
 		{
@@ -6743,9 +7819,9 @@ int libfvde_encrypted_metadata_get_logical_volume_descriptor_by_object_identifie
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve logical volume descriptor: %d from array.",
+			 "%s: unable to retrieve logical volume descriptor: %d from index array.",
 			 function,
-			 logical_volume_descriptor_index );
+			 middle_index );
 
 			return( -1 );
 		}
@@ -6757,20 +7833,66 @@ int libfvde_encrypted_metadata_get_logical_volume_descriptor_by_object_identifie
 			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
 			 "%s: missing logical volume descriptor: %d.",
 			 function,
-			 logical_volume_descriptor_index );
+			 middle_index );
 
 			return( -1 );
 		}
 		if( safe_logical_volume_descriptor->object_identifier == object_identifier )
 		{
+			*sorted_index              = middle_index;
 			*logical_volume_descriptor = safe_logical_volume_descriptor;
 
 			return( 1 );
 		}
+		else if( safe_logical_volume_descriptor->object_identifier < object_identifier )
+		{
+			lower_index = middle_index + 1;
+		}
+		else
+		{
+			upper_index = middle_index;
+		}
 	}
+	*sorted_index = lower_index;
+
 	return( 0 );
 }
 
+/* Retrieves the logical volume descriptor with a specific object identifier
+ * Returns 1 if successful, 0 if no such volume desciptor or -1 on error
+ */
+int libfvde_encrypted_metadata_get_logical_volume_descriptor_by_object_identifier(
+     libfvde_encrypted_metadata_t *encrypted_metadata,
+     uint64_t object_identifier,
+     libfvde_logical_volume_descriptor_t **logical_volume_descriptor,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_encrypted_metadata_get_logical_volume_descriptor_by_object_identifier";
+	int result            = 0;
+	int sorted_index      = 0;
+
+	result = libfvde_encrypted_metadata_find_logical_volume_descriptor(
+	          encrypted_metadata,
+	          object_identifier,
+	          &sorted_index,
+	          logical_volume_descriptor,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to find logical volume descriptor: %" PRIu64 " in index.",
+		 function,
+		 object_identifier );
+
+		return( -1 );
+	}
+	return( result );
+}
+
 /* Retrieves the last logical volume descriptor
  * Returns 1 if successful, 0 if no such volume desciptor or -1 on error
  */
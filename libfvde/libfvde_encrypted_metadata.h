@@ -26,6 +26,8 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfvde_decryption_thread_pool.h"
+#include "libfvde_encryption_context.h"
 #include "libfvde_encryption_context_plist.h"
 #include "libfvde_io_handle.h"
 #include "libfvde_keyring.h"
@@ -33,6 +35,8 @@
 #include "libfvde_libcdata.h"
 #include "libfvde_libcerror.h"
 #include "libfvde_logical_volume_descriptor.h"
+#include "libfvde_plist_scanner.h"
+#include "libfvde_segment_descriptor.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -54,6 +58,10 @@ struct libfvde_encrypted_metadata
 	 */
 	libcdata_array_t *logical_volume_descriptors;
 
+	/* The logical volume descriptors sorted by object identifier
+	 */
+	libcdata_array_t *logical_volume_descriptors_index;
+
 	/* The segment descriptors of metadata block 0x0304
 	 */
 	libcdata_array_t *segment_descriptors_0x0304;
@@ -149,6 +157,17 @@ int libfvde_encrypted_metadata_read_type_0x0019(
      size_t block_data_size,
      libcerror_error_t **error );
 
+int libfvde_encrypted_metadata_read_logical_volume_root_element(
+     libfvde_logical_volume_descriptor_t *logical_volume_descriptor,
+     libfvde_plist_scanner_element_t *root_element,
+     libcerror_error_t **error );
+
+int libfvde_encrypted_metadata_read_logical_volume_property_list(
+     libfvde_logical_volume_descriptor_t *logical_volume_descriptor,
+     const uint8_t *xml_plist_data,
+     size_t xml_plist_data_size,
+     libcerror_error_t **error );
+
 int libfvde_encrypted_metadata_read_type_0x001a(
      libfvde_encrypted_metadata_t *encrypted_metadata,
      const uint8_t *block_data,
@@ -244,6 +263,25 @@ int libfvde_encrypted_metadata_read_type_0x0605(
      size_t block_data_size,
      libcerror_error_t **error );
 
+int libfvde_encrypted_metadata_decrypt_blocks(
+     libfvde_encryption_context_t *encryption_context,
+     libfvde_decryption_thread_pool_t *decryption_thread_pool,
+     uint8_t *data,
+     size_t data_size,
+     uint64_t block_number,
+     libcerror_error_t **error );
+
+int libfvde_encrypted_metadata_read_transaction_identifier_file_io_handle(
+     libfvde_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     const uint8_t *key,
+     size_t key_bit_size,
+     const uint8_t *tweak_key,
+     size_t tweak_key_bit_size,
+     uint64_t *transaction_identifier,
+     libcerror_error_t **error );
+
 int libfvde_encrypted_metadata_read_from_file_io_handle(
      libfvde_encrypted_metadata_t *encrypted_metadata,
      libfvde_io_handle_t *io_handle,
@@ -266,6 +304,16 @@ int libfvde_encrypted_metadata_get_volume_master_key(
      size_t recovery_password_length,
      libcerror_error_t **error );
 
+int libfvde_encrypted_metadata_append_logical_volume_descriptor(
+     libfvde_encrypted_metadata_t *encrypted_metadata,
+     libfvde_logical_volume_descriptor_t **logical_volume_descriptor,
+     libcerror_error_t **error );
+
+int libfvde_encrypted_metadata_insert_segment_descriptor(
+     libcdata_array_t *segment_descriptors,
+     libfvde_segment_descriptor_t *segment_descriptor,
+     libcerror_error_t **error );
+
 int libfvde_encrypted_metadata_get_number_of_logical_volume_descriptors(
      libfvde_encrypted_metadata_t *encrypted_metadata,
      int *number_of_logical_volume_descriptors,
@@ -277,6 +325,13 @@ int libfvde_encrypted_metadata_get_logical_volume_descriptor_by_index(
      libfvde_logical_volume_descriptor_t **logical_volume_descriptor,
      libcerror_error_t **error );
 
+int libfvde_encrypted_metadata_find_logical_volume_descriptor(
+     libfvde_encrypted_metadata_t *encrypted_metadata,
+     uint64_t object_identifier,
+     int *sorted_index,
+     libfvde_logical_volume_descriptor_t **logical_volume_descriptor,
+     libcerror_error_t **error );
+
 int libfvde_encrypted_metadata_get_logical_volume_descriptor_by_object_identifier(
      libfvde_encrypted_metadata_t *encrypted_metadata,
      uint64_t object_identifier,
@@ -25,6 +25,8 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfvde_aes_xts.h"
+#include "libfvde_crypto_backend.h"
 #include "libfvde_definitions.h"
 #include "libfvde_encryption_context.h"
 #include "libfvde_libcaes.h"
@@ -178,6 +180,18 @@ int libfvde_encryption_context_free(
 
 			result = -1;
 		}
+#if defined( HAVE_LIBFVDE_OPENSSL_AES_XTS_SUPPORT )
+		if( ( *context )->evp_cipher_context != NULL )
+		{
+			EVP_CIPHER_CTX_free(
+			 ( *context )->evp_cipher_context );
+		}
+#endif
+		memory_set(
+		 &( ( *context )->aesni_keys ),
+		 0,
+		 sizeof( libfvde_aes_xts_keys_t ) );
+
 		memory_free(
 		 *context );
 
@@ -197,9 +211,14 @@ int libfvde_encryption_context_set_keys(
      size_t tweak_key_size,
      libcerror_error_t **error )
 {
+#if defined( HAVE_LIBFVDE_OPENSSL_AES_XTS_SUPPORT )
+	uint8_t xts_key[ 32 ];
+#endif
+
 	static char *function = "libfvde_encryption_context_set_keys";
 	size_t key_bit_size   = 0;
 	size_t key_byte_size  = 0;
+	int crypto_backend    = 0;
 
 	if( context == NULL )
 	{
@@ -302,7 +321,123 @@ int libfvde_encryption_context_set_keys(
 
 		return( -1 );
 	}
+	if( libfvde_get_crypto_backend(
+	     &crypto_backend,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve crypto backend.",
+		 function );
+
+		return( -1 );
+	}
+	if( crypto_backend == LIBFVDE_CRYPTO_BACKEND_AESNI )
+	{
+		if( libfvde_aes_xts_aesni_set_keys(
+		     &( context->aesni_keys ),
+		     key,
+		     tweak_key,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set AES-NI keys.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#if defined( HAVE_LIBFVDE_OPENSSL_AES_XTS_SUPPORT )
+	else if( crypto_backend == LIBFVDE_CRYPTO_BACKEND_OPENSSL )
+	{
+		if( context->evp_cipher_context == NULL )
+		{
+			context->evp_cipher_context = EVP_CIPHER_CTX_new();
+
+			if( context->evp_cipher_context == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create EVP cipher context.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		/* The EVP AES-XTS key is the key followed by the tweak key
+		 */
+		if( memory_copy(
+		     xts_key,
+		     key,
+		     key_byte_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy key.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     &( xts_key[ key_byte_size ] ),
+		     tweak_key,
+		     key_byte_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy tweak key.",
+			 function );
+
+			goto on_error;
+		}
+		if( EVP_CipherInit_ex(
+		     context->evp_cipher_context,
+		     EVP_aes_128_xts(),
+		     NULL,
+		     xts_key,
+		     NULL,
+		     0 ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set keys in EVP cipher context.",
+			 function );
+
+			goto on_error;
+		}
+		memory_set(
+		 xts_key,
+		 0,
+		 32 );
+	}
+#endif /* defined( HAVE_LIBFVDE_OPENSSL_AES_XTS_SUPPORT ) */
+
+	context->crypto_backend = crypto_backend;
+
 	return( 1 );
+
+#if defined( HAVE_LIBFVDE_OPENSSL_AES_XTS_SUPPORT )
+on_error:
+	memory_set(
+	 xts_key,
+	 0,
+	 32 );
+
+	return( -1 );
+#endif
 }
 
 /* De- or encrypts a block of data
@@ -320,8 +455,12 @@ int libfvde_encryption_context_crypt(
 {
 	uint8_t tweak_value[ 16 ];
 
-	static char *function = "libfvde_encryption_context_crypt";
-	size_t data_offset    = 0;
+	static char *function    = "libfvde_encryption_context_crypt";
+	size_t data_offset       = 0;
+
+#if defined( HAVE_LIBFVDE_OPENSSL_AES_XTS_SUPPORT )
+	int evp_output_data_size = 0;
+#endif
 
 	if( context == NULL )
 	{
@@ -414,10 +553,76 @@ int libfvde_encryption_context_crypt(
 
 		goto on_error;
 	}
+	if( ( context->crypto_backend == LIBFVDE_CRYPTO_BACKEND_AESNI )
+	 && ( input_data_size > 0 )
+	 && ( ( input_data_size % 16 ) == 0 ) )
+	{
+		if( libfvde_aes_xts_aesni_decrypt_sectors(
+		     &( context->aesni_keys ),
+		     input_data,
+		     output_data,
+		     input_data_size,
+		     input_data_size,
+		     block_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+			 LIBCERROR_ENCRYPTION_ERROR_DECRYPT_FAILED,
+			 "%s: unable to decrypt data.",
+			 function );
+
+			goto on_error;
+		}
+		return( 1 );
+	}
 	byte_stream_copy_from_uint64_little_endian(
 	 tweak_value,
 	 block_number );
 
+#if defined( HAVE_LIBFVDE_OPENSSL_AES_XTS_SUPPORT )
+	if( ( context->crypto_backend == LIBFVDE_CRYPTO_BACKEND_OPENSSL )
+	 && ( input_data_size >= 16 )
+	 && ( input_data_size <= (size_t) INT_MAX ) )
+	{
+		if( EVP_CipherInit_ex(
+		     context->evp_cipher_context,
+		     NULL,
+		     NULL,
+		     NULL,
+		     tweak_value,
+		     0 ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set tweak value in EVP cipher context.",
+			 function );
+
+			goto on_error;
+		}
+		if( EVP_CipherUpdate(
+		     context->evp_cipher_context,
+		     output_data,
+		     &evp_output_data_size,
+		     input_data,
+		     (int) input_data_size ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+			 LIBCERROR_ENCRYPTION_ERROR_DECRYPT_FAILED,
+			 "%s: unable to decrypt data.",
+			 function );
+
+			goto on_error;
+		}
+		return( 1 );
+	}
+#endif /* defined( HAVE_LIBFVDE_OPENSSL_AES_XTS_SUPPORT ) */
+
 	if( libcaes_crypt_xts(
 	     context->decryption_context,
 	     LIBCAES_CRYPT_MODE_DECRYPT,
@@ -449,6 +654,168 @@ on_error:
 	return( -1 );
 }
 
+/* De- or encrypts the data of consecutive sectors
+ * The block number of the first sector is used as tweak value and is incremented per sector
+ * The input data size must be a multitude of the sector size
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_encryption_context_crypt_sectors(
+     libfvde_encryption_context_t *context,
+     int mode,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     uint64_t first_block_number,
+     size_t sector_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_encryption_context_crypt_sectors";
+	size_t data_offset    = 0;
+	uint64_t block_number = 0;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( mode != LIBFVDE_ENCRYPTION_CRYPT_MODE_DECRYPT )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported mode.",
+		 function );
+
+		return( -1 );
+	}
+	if( input_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input data.",
+		 function );
+
+		return( -1 );
+	}
+	if( input_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid input data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output data.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid output data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_data_size < input_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid output data size value smaller than input data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( sector_size == 0 )
+	 || ( ( input_data_size % sector_size ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sector size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( context->crypto_backend == LIBFVDE_CRYPTO_BACKEND_AESNI )
+	 && ( ( sector_size % 16 ) == 0 ) )
+	{
+		if( libfvde_aes_xts_aesni_decrypt_sectors(
+		     &( context->aesni_keys ),
+		     input_data,
+		     output_data,
+		     input_data_size,
+		     sector_size,
+		     first_block_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+			 LIBCERROR_ENCRYPTION_ERROR_DECRYPT_FAILED,
+			 "%s: unable to decrypt data.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	block_number = first_block_number;
+
+	while( data_offset < input_data_size )
+	{
+		if( libfvde_encryption_context_crypt(
+		     context,
+		     mode,
+		     &( input_data[ data_offset ] ),
+		     sector_size,
+		     &( output_data[ data_offset ] ),
+		     sector_size,
+		     block_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+			 LIBCERROR_ENCRYPTION_ERROR_DECRYPT_FAILED,
+			 "%s: unable to decrypt sector: %" PRIu64 " data.",
+			 function,
+			 block_number );
+
+			return( -1 );
+		}
+		data_offset  += sector_size;
+		block_number += 1;
+	}
+	return( 1 );
+}
+
 /* Unwrap data using AES Key Wrap (RFC3394)
  * Returns 1 if successful or -1 on error
  */
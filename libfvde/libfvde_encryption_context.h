@@ -26,9 +26,15 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfvde_aes_xts.h"
+#include "libfvde_crypto_backend.h"
 #include "libfvde_libcaes.h"
 #include "libfvde_libcerror.h"
 
+#if defined( HAVE_LIBFVDE_OPENSSL_AES_XTS_SUPPORT )
+#include <openssl/evp.h>
+#endif
+
 #if defined( __cplusplus )
 extern "C" {
 #endif
@@ -44,6 +50,20 @@ struct libfvde_encryption_context
 	/* The AES-XTS decryption context
 	 */
 	libcaes_tweaked_context_t *decryption_context;
+
+	/* The crypto backend used for decryption
+	 */
+	int crypto_backend;
+
+	/* The AES-NI round keys
+	 */
+	libfvde_aes_xts_keys_t aesni_keys;
+
+#if defined( HAVE_LIBFVDE_OPENSSL_AES_XTS_SUPPORT )
+	/* The OpenSSL EVP cipher context
+	 */
+	EVP_CIPHER_CTX *evp_cipher_context;
+#endif
 };
 
 int libfvde_encryption_context_initialize(
@@ -73,6 +93,17 @@ int libfvde_encryption_context_crypt(
      uint64_t block_number,
      libcerror_error_t **error );
 
+int libfvde_encryption_context_crypt_sectors(
+     libfvde_encryption_context_t *context,
+     int mode,
+     const uint8_t *input_data,
+     size_t input_data_size,
+     uint8_t *output_data,
+     size_t output_data_size,
+     uint64_t first_block_number,
+     size_t sector_size,
+     libcerror_error_t **error );
+
 int libfvde_encryption_aes_key_unwrap(
      const uint8_t *key,
      size_t key_size_bits,
@@ -32,6 +32,7 @@
 #include "libfvde_libfplist.h"
 #include "libfvde_libhmac.h"
 #include "libfvde_libuna.h"
+#include "libfvde_plist_scanner.h"
 #include "libfvde_types.h"
 
 /* Creates an encryption context plist
@@ -942,7 +943,8 @@ int libfvde_encryption_context_plist_read_xml(
 
 		return( -1 );
 	}
-	if( internal_plist->property_list != NULL )
+	if( ( internal_plist->property_list != NULL )
+	 || ( internal_plist->is_scanned != 0 ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -973,6 +975,33 @@ int libfvde_encryption_context_plist_read_xml(
 
 		goto on_error;
 	}
+	if( data == internal_plist->data_decrypted )
+	{
+		/* Try the streaming scanner first and fall back to the property list
+		 * for XML plist data that the scanner does not support
+		 */
+		result = libfvde_encryption_context_plist_read_xml_elements(
+		          internal_plist,
+		          data,
+		          data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to read XML elements.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			return( 1 );
+		}
+	}
 	if( libfplist_property_list_initialize(
 	     &( internal_plist->property_list ),
 	     error ) != 1 )
@@ -1135,14 +1164,511 @@ int libfvde_encryption_context_plist_read_xml(
 			 "%s: unable to retrieve number of CryptoUsers entries.",
 			 function );
 
-			goto on_error;
-		}
+			goto on_error;
+		}
+	}
+	result = libfplist_property_get_sub_property_by_utf8_name(
+	          encryption_context_property,
+	          (uint8_t *) "WrappedVolumeKeys",
+	          17,
+	          &( internal_plist->wrapped_volume_keys_property ),
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve WrappedVolumeKeys sub property.",
+		 function );
+
+		goto on_error;
+	}
+	if( encryption_context_property != root_property )
+	{
+		if( libfplist_property_free(
+		     &encryption_context_property,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free encryption context property.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libfplist_property_free(
+	     &root_property,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free root property.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( internal_plist->wrapped_volume_keys_property != NULL )
+	{
+		libfplist_property_free(
+		 &( internal_plist->wrapped_volume_keys_property ),
+		 NULL );
+	}
+	if( internal_plist->crypto_users_property != NULL )
+	{
+		libfplist_property_free(
+		 &( internal_plist->crypto_users_property ),
+		 NULL );
+	}
+	if( internal_plist->conversion_info_property != NULL )
+	{
+		libfplist_property_free(
+		 &( internal_plist->conversion_info_property ),
+		 NULL );
+	}
+	if( ( encryption_context_property != NULL )
+	 && ( encryption_context_property != root_property ) )
+	{
+		libfplist_property_free(
+		 &encryption_context_property,
+		 NULL );
+	}
+	if( root_property != NULL )
+	{
+		libfplist_property_free(
+		 &root_property,
+		 NULL );
+	}
+	if( internal_plist->property_list != NULL )
+	{
+		libfplist_property_list_free(
+		 &( internal_plist->property_list ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the plist XML data using the streaming scanner
+ * The elements reference the data, hence the data must remain valid while the plist is used
+ * Returns 1 if successful, 0 if the XML data is not supported by the scanner or -1 on error
+ */
+int libfvde_encryption_context_plist_read_xml_elements(
+     libfvde_internal_encryption_context_plist_t *internal_plist,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libfvde_plist_scanner_element_t encryption_context_element;
+	libfvde_plist_scanner_element_t root_element;
+	libfvde_plist_scanner_element_t sub_element;
+
+	static char *function      = "libfvde_encryption_context_plist_read_xml_elements";
+	int number_of_sub_elements = 0;
+	int result                 = 0;
+
+	if( internal_plist == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid plist.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_plist->is_scanned != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid plist - XML plist already set.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfvde_plist_scanner_get_root_element(
+	          data,
+	          data_size,
+	          &root_element,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve root element.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	result = libfvde_plist_scanner_element_get_sub_element_by_key(
+	          &root_element,
+	          (uint8_t *) "com.apple.corestorage.lvf.encryption.context",
+	          44,
+	          &encryption_context_element,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve encryption context element.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		encryption_context_element = root_element;
+	}
+	else
+	{
+		/* An encryption context in a plist root element is left to
+		 * libfvde_encryption_context_plist_read_xml to reject
+		 */
+		result = libfvde_plist_scanner_has_plist_root_element(
+		          data,
+		          data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if XML plist has plist root element.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			return( 0 );
+		}
+	}
+	result = libfvde_plist_scanner_element_get_sub_element_by_key(
+	          &encryption_context_element,
+	          (uint8_t *) "ConversionInfo",
+	          14,
+	          &sub_element,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve ConversionInfo element.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		internal_plist->conversion_info_element = sub_element;
+	}
+	result = libfvde_plist_scanner_element_get_sub_element_by_key(
+	          &encryption_context_element,
+	          (uint8_t *) "CryptoUsers",
+	          11,
+	          &sub_element,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve CryptoUsers element.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( libfvde_plist_scanner_element_get_number_of_sub_elements(
+		     &sub_element,
+		     &number_of_sub_elements,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of CryptoUsers entries.",
+			 function );
+
+			goto on_error;
+		}
+		internal_plist->crypto_users_element           = sub_element;
+		internal_plist->number_of_crypto_users_entries = number_of_sub_elements;
+	}
+	result = libfvde_plist_scanner_element_get_sub_element_by_key(
+	          &encryption_context_element,
+	          (uint8_t *) "WrappedVolumeKeys",
+	          17,
+	          &sub_element,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve WrappedVolumeKeys element.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		internal_plist->wrapped_volume_keys_element = sub_element;
+	}
+	internal_plist->is_scanned = 1;
+
+	return( 1 );
+
+on_error:
+	memory_set(
+	 &( internal_plist->conversion_info_element ),
+	 0,
+	 sizeof( libfvde_plist_scanner_element_t ) );
+
+	memory_set(
+	 &( internal_plist->crypto_users_element ),
+	 0,
+	 sizeof( libfvde_plist_scanner_element_t ) );
+
+	internal_plist->number_of_crypto_users_entries = 0;
+
+	return( -1 );
+}
+
+/* Retrieves the conversion status from the XML plist elements
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfvde_internal_encryption_context_plist_get_scanned_conversion_status(
+     libfvde_internal_encryption_context_plist_t *internal_plist,
+     uint8_t **conversion_status,
+     size_t *conversion_status_size,
+     libcerror_error_t **error )
+{
+	libfvde_plist_scanner_element_t sub_element;
+
+	static char *function = "libfvde_internal_encryption_context_plist_get_scanned_conversion_status";
+
+	if( internal_plist == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid plist.",
+		 function );
+
+		return( -1 );
+	}
+	if( conversion_status == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid conversion status.",
+		 function );
+
+		return( -1 );
+	}
+	if( *conversion_status != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid conversion status value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( conversion_status_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid conversion status size.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_plist->conversion_info_element.name == NULL )
+	{
+		return( 0 );
+	}
+	if( libfvde_plist_scanner_element_get_sub_element_by_key(
+	     &( internal_plist->conversion_info_element ),
+	     (uint8_t *) "ConversionStatus",
+	     16,
+	     &sub_element,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve ConversionStatus sub element.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvde_plist_scanner_element_get_value_string(
+	     &sub_element,
+	     conversion_status,
+	     conversion_status_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve conversation status.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the index-specified passphrase wrapped kek from the XML plist elements
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libfvde_internal_encryption_context_plist_get_scanned_passphrase_wrapped_kek(
+     libfvde_internal_encryption_context_plist_t *internal_plist,
+     int passphrase_wrapped_kek_index,
+     uint8_t **passphrase_wrapped_kek,
+     size_t *passphrase_wrapped_kek_size,
+     libcerror_error_t **error )
+{
+	libfvde_plist_scanner_element_t array_entry_element;
+	libfvde_plist_scanner_element_t sub_element;
+
+	static char *function = "libfvde_internal_encryption_context_plist_get_scanned_passphrase_wrapped_kek";
+	int result            = 0;
+
+	if( internal_plist == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid plist.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_plist->crypto_users_element.name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid plist - missing XML plist crypto users element.",
+		 function );
+
+		return( -1 );
+	}
+	if( passphrase_wrapped_kek_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid passphrase wrapped KEK index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( passphrase_wrapped_kek == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid passphrase wrapped KEK.",
+		 function );
+
+		return( -1 );
+	}
+	if( *passphrase_wrapped_kek != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid passphrase wrapped KEK value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( passphrase_wrapped_kek_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid passphrase wrapped KEK size.",
+		 function );
+
+		return( -1 );
+	}
+	if( passphrase_wrapped_kek_index >= internal_plist->number_of_crypto_users_entries )
+	{
+		return( 0 );
+	}
+	if( libfvde_plist_scanner_element_get_sub_element_by_index(
+	     &( internal_plist->crypto_users_element ),
+	     passphrase_wrapped_kek_index,
+	     &array_entry_element,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve crypto users array entry: %d.",
+		 function,
+		 passphrase_wrapped_kek_index );
+
+		return( -1 );
 	}
-	result = libfplist_property_get_sub_property_by_utf8_name(
-	          encryption_context_property,
-	          (uint8_t *) "WrappedVolumeKeys",
-	          17,
-	          &( internal_plist->wrapped_volume_keys_property ),
+	result = libfvde_plist_scanner_element_get_sub_element_by_key(
+	          &array_entry_element,
+	          (uint8_t *) "PassphraseWrappedKEKStruct",
+	          26,
+	          &sub_element,
 	          error );
 
 	if( result == -1 )
@@ -1151,81 +1677,148 @@ int libfvde_encryption_context_plist_read_xml(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve WrappedVolumeKeys sub property.",
+		 "%s: unable to retrieve PassphraseWrappedKEKStruct sub element.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( encryption_context_property != root_property )
+	else if( result != 0 )
 	{
-		if( libfplist_property_free(
-		     &encryption_context_property,
+		if( libfvde_encryption_context_plist_get_element_value_data(
+		     &sub_element,
+		     passphrase_wrapped_kek,
+		     passphrase_wrapped_kek_size,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free encryption context property.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve passphrase wrapped kek data.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 	}
-	if( libfplist_property_free(
-	     &root_property,
-	     error ) != 1 )
+	return( result );
+}
+
+/* Retrieves the KEK wrapped volume key structure from the XML plist elements
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_internal_encryption_context_plist_get_scanned_kek_wrapped_volume_key(
+     libfvde_internal_encryption_context_plist_t *internal_plist,
+     uint8_t **kek_wrapped_volume_key,
+     size_t *kek_wrapped_volume_key_size,
+     libcerror_error_t **error )
+{
+	libfvde_plist_scanner_element_t array_entry_element;
+	libfvde_plist_scanner_element_t sub_element;
+
+	static char *function = "libfvde_internal_encryption_context_plist_get_scanned_kek_wrapped_volume_key";
+
+	if( internal_plist == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free root property.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid plist.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	return( 1 );
+	if( internal_plist->wrapped_volume_keys_element.name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid plist - missing XML plist wrapped volume keys element.",
+		 function );
 
-on_error:
-	if( internal_plist->wrapped_volume_keys_property != NULL )
+		return( -1 );
+	}
+	if( kek_wrapped_volume_key == NULL )
 	{
-		libfplist_property_free(
-		 &( internal_plist->wrapped_volume_keys_property ),
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid KEK wrapped volume key.",
+		 function );
+
+		return( -1 );
 	}
-	if( internal_plist->crypto_users_property != NULL )
+	if( *kek_wrapped_volume_key != NULL )
 	{
-		libfplist_property_free(
-		 &( internal_plist->crypto_users_property ),
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid KEK wrapped volume key value already set.",
+		 function );
+
+		return( -1 );
 	}
-	if( internal_plist->conversion_info_property != NULL )
+	if( kek_wrapped_volume_key_size == NULL )
 	{
-		libfplist_property_free(
-		 &( internal_plist->conversion_info_property ),
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid KEK wrapped volume key size.",
+		 function );
+
+		return( -1 );
 	}
-	if( ( encryption_context_property != NULL )
-	 && ( encryption_context_property != root_property ) )
+	if( libfvde_plist_scanner_element_get_sub_element_by_index(
+	     &( internal_plist->wrapped_volume_keys_element ),
+	     1,
+	     &array_entry_element,
+	     error ) != 1 )
 	{
-		libfplist_property_free(
-		 &encryption_context_property,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve wrapped volume keys array entry: 1.",
+		 function );
+
+		return( -1 );
 	}
-	if( root_property != NULL )
+	if( libfvde_plist_scanner_element_get_sub_element_by_key(
+	     &array_entry_element,
+	     (uint8_t *) "KEKWrappedVolumeKeyStruct",
+	     25,
+	     &sub_element,
+	     error ) != 1 )
 	{
-		libfplist_property_free(
-		 &root_property,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve KEKWrappedVolumeKeyStruct sub element.",
+		 function );
+
+		return( -1 );
 	}
-	if( internal_plist->property_list != NULL )
+	if( libfvde_encryption_context_plist_get_element_value_data(
+	     &sub_element,
+	     kek_wrapped_volume_key,
+	     kek_wrapped_volume_key_size,
+	     error ) != 1 )
 	{
-		libfplist_property_list_free(
-		 &( internal_plist->property_list ),
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve kek wrapped volume key data.",
+		 function );
+
+		return( -1 );
 	}
-	return( -1 );
+	return( 1 );
 }
 
 /* Retrieves the conversion status from the given plist data.
@@ -1255,6 +1848,26 @@ int libfvde_encryption_context_plist_get_conversion_status(
 	}
 	internal_plist = (libfvde_internal_encryption_context_plist_t *) plist;
 
+	if( internal_plist->is_scanned != 0 )
+	{
+		result = libfvde_internal_encryption_context_plist_get_scanned_conversion_status(
+		          internal_plist,
+		          conversion_status,
+		          conversion_status_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve conversion status from XML plist elements.",
+			 function );
+		}
+		return( result );
+	}
+
 	if( conversion_status == NULL )
 	{
 		libcerror_error_set(
@@ -1400,6 +2013,27 @@ int libfvde_encryption_context_plist_get_passphrase_wrapped_kek(
 	}
 	internal_plist = (libfvde_internal_encryption_context_plist_t *) plist;
 
+	if( internal_plist->is_scanned != 0 )
+	{
+		result = libfvde_internal_encryption_context_plist_get_scanned_passphrase_wrapped_kek(
+		          internal_plist,
+		          passphrase_wrapped_kek_index,
+		          passphrase_wrapped_kek,
+		          passphrase_wrapped_kek_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve passphrase wrapped KEK from XML plist elements.",
+			 function );
+		}
+		return( result );
+	}
+
 	if( internal_plist->crypto_users_property == NULL )
 	{
 		libcerror_error_set(
@@ -1634,6 +2268,7 @@ int libfvde_encryption_context_plist_get_kek_wrapped_volume_key(
 	uint8_t *safe_kek_wrapped_volume_key                        = NULL;
 	static char *function                                       = "libfvde_encryption_context_plist_get_kek_wrapped_volume_key";
 	size_t safe_kek_wrapped_volume_key_size                     = 0;
+	int result                                                  = 0;
 
 	if( plist == NULL )
 	{
@@ -1648,6 +2283,26 @@ int libfvde_encryption_context_plist_get_kek_wrapped_volume_key(
 	}
 	internal_plist = (libfvde_internal_encryption_context_plist_t *) plist;
 
+	if( internal_plist->is_scanned != 0 )
+	{
+		result = libfvde_internal_encryption_context_plist_get_scanned_kek_wrapped_volume_key(
+		          internal_plist,
+		          kek_wrapped_volume_key,
+		          kek_wrapped_volume_key_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve KEK wrapped volume key from XML plist elements.",
+			 function );
+		}
+		return( result );
+	}
+
 	if( internal_plist->wrapped_volume_keys_property == NULL )
 	{
 		libcerror_error_set(
@@ -1843,3 +2498,107 @@ on_error:
 	return( -1 );
 }
 
+/* Retrieves the base64 decoded data value of a data element
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_encryption_context_plist_get_element_value_data(
+     libfvde_plist_scanner_element_t *element,
+     uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *safe_data    = NULL;
+	static char *function = "libfvde_encryption_context_plist_get_element_value_data";
+	size_t safe_data_size = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvde_plist_scanner_element_get_value_data_size(
+	     element,
+	     &safe_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( safe_data_size == 0 )
+	 || ( safe_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	safe_data = (uint8_t *) memory_allocate(
+	                         sizeof( uint8_t ) * safe_data_size );
+
+	if( safe_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfvde_plist_scanner_element_get_value_data(
+	     element,
+	     safe_data,
+	     safe_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data.",
+		 function );
+
+		goto on_error;
+	}
+	*data      = safe_data;
+	*data_size = safe_data_size;
+
+	return( 1 );
+
+on_error:
+	if( safe_data != NULL )
+	{
+		memory_free(
+		 safe_data );
+	}
+	return( -1 );
+}
+
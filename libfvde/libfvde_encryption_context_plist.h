@@ -30,6 +30,7 @@
 #include "libfvde_libbfio.h"
 #include "libfvde_libcerror.h"
 #include "libfvde_libfplist.h"
+#include "libfvde_plist_scanner.h"
 #include "libfvde_types.h"
 
 #if defined( __cplusplus )
@@ -71,6 +72,22 @@ struct libfvde_internal_encryption_context_plist
         /* The XML plist wrapped volume keys property
 	 */
 	libfplist_property_t *wrapped_volume_keys_property;
+
+	/* Value to indicate the XML plist was read by the streaming scanner
+	 */
+	uint8_t is_scanned;
+
+	/* The XML plist conversion info element
+	 */
+	libfvde_plist_scanner_element_t conversion_info_element;
+
+	/* The XML plist crypto users element
+	 */
+	libfvde_plist_scanner_element_t crypto_users_element;
+
+	/* The XML plist wrapped volume keys element
+	 */
+	libfvde_plist_scanner_element_t wrapped_volume_keys_element;
 };
 
 LIBFVDE_EXTERN \
@@ -121,6 +138,31 @@ int libfvde_encryption_context_plist_read_xml(
      size_t data_size,
      libcerror_error_t **error );
 
+int libfvde_encryption_context_plist_read_xml_elements(
+     libfvde_internal_encryption_context_plist_t *internal_plist,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libfvde_internal_encryption_context_plist_get_scanned_conversion_status(
+     libfvde_internal_encryption_context_plist_t *internal_plist,
+     uint8_t **conversion_status,
+     size_t *conversion_status_size,
+     libcerror_error_t **error );
+
+int libfvde_internal_encryption_context_plist_get_scanned_passphrase_wrapped_kek(
+     libfvde_internal_encryption_context_plist_t *internal_plist,
+     int passphrase_wrapped_kek_index,
+     uint8_t **passphrase_wrapped_kek,
+     size_t *passphrase_wrapped_kek_size,
+     libcerror_error_t **error );
+
+int libfvde_internal_encryption_context_plist_get_scanned_kek_wrapped_volume_key(
+     libfvde_internal_encryption_context_plist_t *internal_plist,
+     uint8_t **kek_wrapped_volume_key,
+     size_t *kek_wrapped_volume_key_size,
+     libcerror_error_t **error );
+
 int libfvde_encryption_context_plist_get_conversion_status(
      libfvde_encryption_context_plist_t *plist,
      uint8_t **conversion_status,
@@ -140,6 +182,12 @@ int libfvde_encryption_context_plist_get_kek_wrapped_volume_key(
      size_t *kek_wrapped_volume_key_size,
      libcerror_error_t **error );
 
+int libfvde_encryption_context_plist_get_element_value_data(
+     libfvde_plist_scanner_element_t *element,
+     uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,681 @@
+/*
+ * Extent table functions
+ *
+ * Copyright (C) 2011-2024, Omar Choudary <choudary.omar@gmail.com>
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfvde_definitions.h"
+#include "libfvde_extent_table.h"
+#include "libfvde_libcerror.h"
+#include "libfvde_libfdata.h"
+
+/* Creates an extent table
+ * Make sure the value extent_table is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_extent_table_initialize(
+     libfvde_extent_table_t **extent_table,
+     size_t block_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_extent_table_initialize";
+
+	if( extent_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *extent_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid extent table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_size == 0 )
+	 || ( block_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*extent_table = memory_allocate_structure(
+	                 libfvde_extent_table_t );
+
+	if( *extent_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create extent table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *extent_table,
+	     0,
+	     sizeof( libfvde_extent_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear extent table.",
+		 function );
+
+		goto on_error;
+	}
+	( *extent_table )->block_size = block_size;
+
+	return( 1 );
+
+on_error:
+	if( *extent_table != NULL )
+	{
+		memory_free(
+		 *extent_table );
+
+		*extent_table = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an extent table
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_extent_table_free(
+     libfvde_extent_table_t **extent_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_extent_table_free";
+
+	if( extent_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *extent_table != NULL )
+	{
+		if( ( *extent_table )->extents != NULL )
+		{
+			memory_free(
+			 ( *extent_table )->extents );
+		}
+		memory_free(
+		 *extent_table );
+
+		*extent_table = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends an extent
+ * Extents must be appended in increasing logical block number order and must not overlap.
+ * An extent that continues the last extent both logically and physically, on the same
+ * physical volume with the same range flags, is coalesced into the last extent.
+ * Sparse extents only need to be logically adjacent to be coalesced.
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_extent_table_append_extent(
+     libfvde_extent_table_t *extent_table,
+     uint64_t logical_block_number,
+     uint64_t physical_block_number,
+     uint64_t number_of_blocks,
+     uint16_t physical_volume_index,
+     uint32_t range_flags,
+     libcerror_error_t **error )
+{
+	libfvde_extent_t *extent        = NULL;
+	libfvde_extent_t *last_extent   = NULL;
+	static char *function           = "libfvde_extent_table_append_extent";
+	size_t extents_size             = 0;
+	uint64_t last_logical_block     = 0;
+	int number_of_allocated_extents = 0;
+
+	if( extent_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_blocks == 0 )
+	 || ( number_of_blocks > ( (uint64_t) INT64_MAX / extent_table->block_size ) )
+	 || ( logical_block_number > ( ( (uint64_t) INT64_MAX / extent_table->block_size ) - number_of_blocks ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid extent value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( range_flags & LIBFVDE_RANGE_FLAG_IS_SPARSE ) != 0 )
+	{
+		physical_block_number = 0;
+		physical_volume_index = 0;
+	}
+	if( extent_table->number_of_extents > 0 )
+	{
+		last_extent        = &( extent_table->extents[ extent_table->number_of_extents - 1 ] );
+		last_logical_block = last_extent->logical_block_number + last_extent->number_of_blocks;
+
+		if( logical_block_number < last_logical_block )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid logical block number value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( logical_block_number == last_logical_block )
+		 && ( range_flags == last_extent->range_flags ) )
+		{
+			if( ( range_flags & LIBFVDE_RANGE_FLAG_IS_SPARSE ) != 0 )
+			{
+				last_extent->number_of_blocks += number_of_blocks;
+
+				return( 1 );
+			}
+			if( ( physical_volume_index == last_extent->physical_volume_index )
+			 && ( physical_block_number == ( last_extent->physical_block_number + last_extent->number_of_blocks ) ) )
+			{
+				last_extent->number_of_blocks += number_of_blocks;
+
+				return( 1 );
+			}
+		}
+	}
+	if( extent_table->number_of_extents >= extent_table->number_of_allocated_extents )
+	{
+		if( extent_table->number_of_allocated_extents == 0 )
+		{
+			number_of_allocated_extents = 16;
+		}
+		else if( extent_table->number_of_allocated_extents > ( INT_MAX / 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of extents value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		else
+		{
+			number_of_allocated_extents = extent_table->number_of_allocated_extents * 2;
+		}
+		if( (size_t) number_of_allocated_extents > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfvde_extent_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of extents value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		extents_size = sizeof( libfvde_extent_t ) * number_of_allocated_extents;
+
+		extent = (libfvde_extent_t *) memory_reallocate(
+		                               extent_table->extents,
+		                               extents_size );
+
+		if( extent == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize extents.",
+			 function );
+
+			return( -1 );
+		}
+		extent_table->extents                     = extent;
+		extent_table->number_of_allocated_extents = number_of_allocated_extents;
+	}
+	extent = &( extent_table->extents[ extent_table->number_of_extents ] );
+
+	extent->logical_block_number  = logical_block_number;
+	extent->physical_block_number = physical_block_number;
+	extent->number_of_blocks      = number_of_blocks;
+	extent->range_flags           = range_flags;
+	extent->physical_volume_index = physical_volume_index;
+
+	extent_table->number_of_extents += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the number of extents
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_extent_table_get_number_of_extents(
+     libfvde_extent_table_t *extent_table,
+     int *number_of_extents,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_extent_table_get_number_of_extents";
+
+	if( extent_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent table.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_extents == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of extents.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_extents = extent_table->number_of_extents;
+
+	return( 1 );
+}
+
+/* Retrieves a specific extent
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_extent_table_get_extent_by_index(
+     libfvde_extent_table_t *extent_table,
+     int extent_index,
+     libfvde_extent_t **extent,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_extent_table_get_extent_by_index";
+
+	if( extent_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( extent_index < 0 )
+	 || ( extent_index >= extent_table->number_of_extents ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid extent index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent.",
+		 function );
+
+		return( -1 );
+	}
+	*extent = &( extent_table->extents[ extent_index ] );
+
+	return( 1 );
+}
+
+/* Determines the index of the first extent that starts after a specific block
+ * The extents are sorted by logical block number so the index is determined
+ * with a binary search, independent of the number of extents
+ * The extent index is set to the number of extents if there is no such extent
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_extent_table_get_index_after_block(
+     libfvde_extent_table_t *extent_table,
+     uint64_t block_number,
+     int *extent_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_extent_table_get_index_after_block";
+	int lower_index       = 0;
+	int middle_index      = 0;
+	int upper_index       = 0;
+
+	if( extent_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent table.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent index.",
+		 function );
+
+		return( -1 );
+	}
+	upper_index = extent_table->number_of_extents;
+
+	while( lower_index < upper_index )
+	{
+		middle_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		if( extent_table->extents[ middle_index ].logical_block_number <= block_number )
+		{
+			lower_index = middle_index + 1;
+		}
+		else
+		{
+			upper_index = middle_index;
+		}
+	}
+	*extent_index = lower_index;
+
+	return( 1 );
+}
+
+/* Retrieves the extent that contains a specific offset
+ * Returns 1 if successful, 0 if no such extent or -1 on error
+ */
+int libfvde_extent_table_get_extent_at_offset(
+     libfvde_extent_table_t *extent_table,
+     off64_t offset,
+     int *extent_index,
+     libfvde_extent_t **extent,
+     libcerror_error_t **error )
+{
+	libfvde_extent_t *safe_extent = NULL;
+	static char *function         = "libfvde_extent_table_get_extent_at_offset";
+	uint64_t block_number         = 0;
+	int safe_extent_index         = 0;
+
+	if( extent_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent table.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent index.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent.",
+		 function );
+
+		return( -1 );
+	}
+	block_number = (uint64_t) offset / extent_table->block_size;
+
+	if( libfvde_extent_table_get_index_after_block(
+	     extent_table,
+	     block_number,
+	     &safe_extent_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine extent index after block: %" PRIu64 ".",
+		 function,
+		 block_number );
+
+		return( -1 );
+	}
+	if( safe_extent_index == 0 )
+	{
+		return( 0 );
+	}
+	safe_extent = &( extent_table->extents[ safe_extent_index - 1 ] );
+
+	if( ( block_number - safe_extent->logical_block_number ) >= safe_extent->number_of_blocks )
+	{
+		return( 0 );
+	}
+	*extent_index = safe_extent_index - 1;
+	*extent       = safe_extent;
+
+	return( 1 );
+}
+
+/* Retrieves the offset of the first data or sparse range at or after a specific offset
+ * Ranges that are not part of an extent are considered sparse, including the range
+ * after the last extent
+ * Returns 1 if successful, 0 if no such range or -1 on error
+ */
+int libfvde_extent_table_get_next_range_offset(
+     libfvde_extent_table_t *extent_table,
+     off64_t offset,
+     uint8_t is_sparse,
+     off64_t *range_offset,
+     libcerror_error_t **error )
+{
+	libfvde_extent_t *extent = NULL;
+	static char *function    = "libfvde_extent_table_get_next_range_offset";
+	off64_t extent_offset    = 0;
+	off64_t search_offset    = 0;
+	uint8_t extent_is_sparse = 0;
+	int extent_index         = 0;
+	int result               = 0;
+
+	if( extent_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent table.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range offset.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfvde_extent_table_get_extent_at_offset(
+	          extent_table,
+	          offset,
+	          &extent_index,
+	          &extent,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve extent at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		if( libfvde_extent_table_get_index_after_block(
+		     extent_table,
+		     (uint64_t) offset / extent_table->block_size,
+		     &extent_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine extent index after offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+
+			return( -1 );
+		}
+	}
+	search_offset = offset;
+
+	while( extent_index < extent_table->number_of_extents )
+	{
+		extent        = &( extent_table->extents[ extent_index ] );
+		extent_offset = (off64_t) extent->logical_block_number * extent_table->block_size;
+
+		if( search_offset < extent_offset )
+		{
+			if( is_sparse != 0 )
+			{
+				*range_offset = search_offset;
+
+				return( 1 );
+			}
+			search_offset = extent_offset;
+		}
+		if( ( extent->range_flags & LIBFVDE_RANGE_FLAG_IS_SPARSE ) != 0 )
+		{
+			extent_is_sparse = 1;
+		}
+		else
+		{
+			extent_is_sparse = 0;
+		}
+		if( extent_is_sparse == is_sparse )
+		{
+			*range_offset = search_offset;
+
+			return( 1 );
+		}
+		search_offset = extent_offset + ( (off64_t) extent->number_of_blocks * extent_table->block_size );
+
+		extent_index++;
+	}
+	if( is_sparse != 0 )
+	{
+		*range_offset = search_offset;
+
+		return( 1 );
+	}
+	return( 0 );
+}
+
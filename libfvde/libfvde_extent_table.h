@@ -0,0 +1,134 @@
+/*
+ * Extent table functions
+ *
+ * Copyright (C) 2011-2024, Omar Choudary <choudary.omar@gmail.com>
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFVDE_EXTENT_TABLE_H )
+#define _LIBFVDE_EXTENT_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfvde_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfvde_extent libfvde_extent_t;
+typedef struct libfvde_extent_table libfvde_extent_table_t;
+
+struct libfvde_extent
+{
+	/* The logical block number
+	 */
+	uint64_t logical_block_number;
+
+	/* The physical block number, which is relative to the start of the physical volume
+	 */
+	uint64_t physical_block_number;
+
+	/* The number of blocks
+	 */
+	uint64_t number_of_blocks;
+
+	/* The range flags
+	 */
+	uint32_t range_flags;
+
+	/* The physical volume index
+	 */
+	uint16_t physical_volume_index;
+};
+
+struct libfvde_extent_table
+{
+	/* The block size
+	 */
+	size_t block_size;
+
+	/* The extents, sorted by logical block number
+	 */
+	libfvde_extent_t *extents;
+
+	/* The number of extents
+	 */
+	int number_of_extents;
+
+	/* The number of allocated extents
+	 */
+	int number_of_allocated_extents;
+};
+
+int libfvde_extent_table_initialize(
+     libfvde_extent_table_t **extent_table,
+     size_t block_size,
+     libcerror_error_t **error );
+
+int libfvde_extent_table_free(
+     libfvde_extent_table_t **extent_table,
+     libcerror_error_t **error );
+
+int libfvde_extent_table_append_extent(
+     libfvde_extent_table_t *extent_table,
+     uint64_t logical_block_number,
+     uint64_t physical_block_number,
+     uint64_t number_of_blocks,
+     uint16_t physical_volume_index,
+     uint32_t range_flags,
+     libcerror_error_t **error );
+
+int libfvde_extent_table_get_number_of_extents(
+     libfvde_extent_table_t *extent_table,
+     int *number_of_extents,
+     libcerror_error_t **error );
+
+int libfvde_extent_table_get_extent_by_index(
+     libfvde_extent_table_t *extent_table,
+     int extent_index,
+     libfvde_extent_t **extent,
+     libcerror_error_t **error );
+
+int libfvde_extent_table_get_index_after_block(
+     libfvde_extent_table_t *extent_table,
+     uint64_t block_number,
+     int *extent_index,
+     libcerror_error_t **error );
+
+int libfvde_extent_table_get_extent_at_offset(
+     libfvde_extent_table_t *extent_table,
+     off64_t offset,
+     int *extent_index,
+     libfvde_extent_t **extent,
+     libcerror_error_t **error );
+
+int libfvde_extent_table_get_next_range_offset(
+     libfvde_extent_table_t *extent_table,
+     off64_t offset,
+     uint8_t is_sparse,
+     off64_t *range_offset,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFVDE_EXTENT_TABLE_H ) */
+
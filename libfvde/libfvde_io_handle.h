@@ -52,6 +52,18 @@ struct libfvde_io_handle
 	 */
 	uint32_t metadata_size;
 
+	/* The maximum cache size of a logical volume, where 0 represents the default
+	 */
+	size64_t maximum_cache_size;
+
+	/* The cache unit size of a logical volume, where 0 represents the bytes per sector
+	 */
+	uint32_t cache_unit_size;
+
+	/* The number of decryption threads of a logical volume, where 0 represents decryption on the calling thread
+	 */
+	int number_of_decryption_threads;
+
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
@@ -24,10 +24,12 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfvde_decryption_thread_pool.h"
 #include "libfvde_definitions.h"
 #include "libfvde_encrypted_metadata.h"
 #include "libfvde_encryption_context.h"
 #include "libfvde_encryption_context_plist.h"
+#include "libfvde_extent_table.h"
 #include "libfvde_io_handle.h"
 #include "libfvde_libbfio.h"
 #include "libfvde_libcerror.h"
@@ -38,7 +40,9 @@
 #include "libfvde_logical_volume.h"
 #include "libfvde_logical_volume_descriptor.h"
 #include "libfvde_password.h"
+#include "libfvde_sector_cache.h"
 #include "libfvde_sector_data.h"
+#include "libfvde_sector_data_pool.h"
 #include "libfvde_segment_descriptor.h"
 #include "libfvde_types.h"
 #include "libfvde_volume_data_handle.h"
@@ -170,6 +174,9 @@ int libfvde_logical_volume_initialize(
 	internal_logical_volume->logical_volume_descriptor = logical_volume_descriptor;
 	internal_logical_volume->encrypted_metadata        = encrypted_metadata;
 	internal_logical_volume->encrypted_root_plist      = encrypted_root_plist;
+	internal_logical_volume->maximum_cache_size        = io_handle->maximum_cache_size;
+	internal_logical_volume->cache_unit_size           = io_handle->cache_unit_size;
+	internal_logical_volume->read_ahead_offset         = -1;
 	internal_logical_volume->is_locked                 = 1;
 
 	*logical_volume = (libfvde_logical_volume_t *) internal_logical_volume;
@@ -268,6 +275,8 @@ int libfvde_logical_volume_free(
 }
 
 /* Opens a logical volume for reading
+ * Only the logical volume descriptor is used, the volume header, keys and sectors cache
+ * are read and set up on demand by libfvde_internal_logical_volume_open_read_data
  * Returns 1 if successful or -1 on error
  */
 int libfvde_internal_logical_volume_open_read(
@@ -275,21 +284,7 @@ int libfvde_internal_logical_volume_open_read(
      libbfio_pool_t *file_io_pool,
      libcerror_error_t **error )
 {
-	uint8_t volume_header_data[ 512 ];
-
-	libfvde_segment_descriptor_t *segment_descriptor = NULL;
-	static char *function                            = "libfvde_internal_logical_volume_open_read";
-	size64_t segment_size                            = 0;
-	ssize_t read_count                               = 0;
-	off64_t segment_offset                           = 0;
-	off64_t volume_offset                            = 0;
-	uint64_t expected_logical_block_number           = 0;
-	uint32_t segment_flags                           = 0;
-	int file_io_pool_entry                           = 0;
-	int number_of_segment_descriptors                = 0;
-	int result                                       = 0;
-	int segment_descriptor_index                     = 0;
-	int segment_index                                = 0;
+	static char *function = "libfvde_internal_logical_volume_open_read";
 
 	if( internal_logical_volume == NULL )
 	{
@@ -302,6 +297,17 @@ int libfvde_internal_logical_volume_open_read(
 
 		return( -1 );
 	}
+	if( file_io_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO pool.",
+		 function );
+
+		return( -1 );
+	}
 	if( internal_logical_volume->io_handle == NULL )
 	{
 		libcerror_error_set(
@@ -346,23 +352,6 @@ int libfvde_internal_logical_volume_open_read(
 
 		return( -1 );
 	}
-	if( libfvde_logical_volume_descriptor_get_first_block_number(
-	     internal_logical_volume->logical_volume_descriptor,
-	     (uint16_t *) &file_io_pool_entry,
-	     (uint64_t *) &volume_offset,
-	     error ) == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve first block number from logical volume descriptor.",
-		 function );
-
-		goto on_error;
-	}
-	volume_offset *= internal_logical_volume->io_handle->block_size;
-
 	if( libfvde_logical_volume_descriptor_get_size(
 	     internal_logical_volume->logical_volume_descriptor,
 	     &( internal_logical_volume->volume_size ),
@@ -375,7 +364,7 @@ int libfvde_internal_logical_volume_open_read(
 		 "%s: unable to retrieve logical volume size from descriptor.",
 		 function );
 
-		result = -1;
+		return( -1 );
 	}
 /* TODO remove after debugging unsupported format variants
 	if( internal_logical_volume->volume_size == 0 )
@@ -393,11 +382,79 @@ int libfvde_internal_logical_volume_open_read(
 			 "%s: unable to retrieve last block number from logical volume descriptor.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 		internal_logical_volume->volume_size *= internal_logical_volume->io_handle->block_size;
 	}
 */
+	internal_logical_volume->file_io_pool = file_io_pool;
+	internal_logical_volume->is_open      = 1;
+
+	return( 1 );
+}
+
+/* Reads the logical volume header and sets up the volume data handle, keys and sectors cache
+ * This function does nothing if the logical volume data was already set up
+ * The caller must hold the read/write lock for writing
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_internal_logical_volume_open_read_data(
+     libfvde_internal_logical_volume_t *internal_logical_volume,
+     libbfio_pool_t *file_io_pool,
+     libcerror_error_t **error )
+{
+	uint8_t volume_header_data[ 512 ];
+
+	static char *function    = "libfvde_internal_logical_volume_open_read_data";
+	ssize_t read_count       = 0;
+	off64_t volume_offset    = 0;
+	uint32_t cache_unit_size = 0;
+	int file_io_pool_entry   = 0;
+	int result               = 0;
+
+	if( internal_logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_logical_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid logical volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_logical_volume->volume_data_handle != NULL )
+	{
+		return( 1 );
+	}
+	if( libfvde_logical_volume_descriptor_get_first_block_number(
+	     internal_logical_volume->logical_volume_descriptor,
+	     (uint16_t *) &file_io_pool_entry,
+	     (uint64_t *) &volume_offset,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first block number from logical volume descriptor.",
+		 function );
+
+		goto on_error;
+	}
+	volume_offset *= internal_logical_volume->io_handle->block_size;
+
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -493,180 +550,43 @@ int libfvde_internal_logical_volume_open_read(
 			goto on_error;
 		}
 	}
-	if( libfdata_vector_initialize(
-	     &( internal_logical_volume->sectors_vector ),
-	     (size64_t) internal_logical_volume->io_handle->bytes_per_sector,
-	     (intptr_t *) internal_logical_volume->volume_data_handle,
-	     NULL,
-	     NULL,
-	     (int (*)(intptr_t *, intptr_t *, libfdata_vector_t *, libfdata_cache_t *, int, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libfvde_volume_data_handle_read_sector,
-	     NULL,
-	     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create sectors vector.",
-		 function );
+	cache_unit_size = internal_logical_volume->cache_unit_size;
 
-		goto on_error;
-	}
-	if( libfvde_logical_volume_descriptor_get_number_of_segment_descriptors(
-	     internal_logical_volume->logical_volume_descriptor,
-	     &number_of_segment_descriptors,
-	     error ) == -1 )
+	if( cache_unit_size == 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of segment descriptors from logical volume descriptor.",
-		 function );
-
-		goto on_error;
+		cache_unit_size = internal_logical_volume->io_handle->bytes_per_sector;
 	}
-	expected_logical_block_number = 0;
+	result = libfvde_internal_logical_volume_initialize_sectors_cache(
+	          internal_logical_volume,
+	          cache_unit_size,
+	          internal_logical_volume->maximum_cache_size,
+	          error );
 
-	for( segment_descriptor_index = 0;
-	     segment_descriptor_index < number_of_segment_descriptors;
-	     segment_descriptor_index++ )
+	if( ( result == 0 )
+	 && ( cache_unit_size != internal_logical_volume->io_handle->bytes_per_sector ) )
 	{
-		if( libfvde_logical_volume_descriptor_get_segment_descriptor_by_index(
-		     internal_logical_volume->logical_volume_descriptor,
-		     segment_descriptor_index,
-		     &segment_descriptor,
-		     error ) == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve segment descriptor: %d from logical volume descriptor.",
-			 function,
-			 segment_descriptor_index );
-
-			goto on_error;
-		}
-		if( segment_descriptor == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing segment descriptor: %d.",
-			 function,
-			 segment_descriptor_index );
-
-			goto on_error;
-		}
-		if( segment_descriptor->logical_block_number < expected_logical_block_number )
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-			 "%s: unsupported logical block number of segment descriptor: %d.",
+			libcnotify_printf(
+			 "%s: cache unit size: %" PRIu32 " not supported by segments falling back to bytes per sector.\n",
 			 function,
-			 segment_descriptor_index );
-
-			goto on_error;
-		}
-		else if( segment_descriptor->logical_block_number > expected_logical_block_number )
-		{
-			segment_size  = segment_descriptor->logical_block_number - expected_logical_block_number;
-			segment_size *= internal_logical_volume->io_handle->block_size;
-
-			if( libfdata_vector_append_segment(
-			     internal_logical_volume->sectors_vector,
-			     &segment_index,
-			     0,
-			     0,
-			     segment_size,
-			     LIBFVDE_RANGE_FLAG_IS_SPARSE,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-				 "%s: unable to append sparse segment to sectors vector.",
-				 function );
-
-				goto on_error;
-			}
-			expected_logical_block_number = segment_descriptor->logical_block_number;
-		}
-		segment_offset  = internal_logical_volume->logical_volume_descriptor->base_physical_block_number;
-		segment_offset += segment_descriptor->physical_block_number;
-		segment_offset *= internal_logical_volume->io_handle->block_size;
-		segment_size    = segment_descriptor->number_of_blocks;
-		segment_size   *= internal_logical_volume->io_handle->block_size;
-
-		if( internal_logical_volume->volume_data_handle->is_encrypted != 0 )
-		{
-			segment_flags = LIBFVDE_RANGE_FLAG_IS_ENCRYPTED;
-		}
-		else
-		{
-			segment_flags = 0;
-		}
-		if( libfdata_vector_append_segment(
-		     internal_logical_volume->sectors_vector,
-		     &segment_index,
-		     (int) segment_descriptor->physical_volume_index,
-		     segment_offset,
-		     segment_size,
-		     segment_flags,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to append segment to sectors vector.",
-			 function );
-
-			goto on_error;
-		}
-		expected_logical_block_number += segment_descriptor->number_of_blocks;
-	}
-	segment_size = (size64_t) expected_logical_block_number * internal_logical_volume->io_handle->block_size;
-
-	if( segment_size < internal_logical_volume->volume_size )
-	{
-		segment_size = internal_logical_volume->volume_size - segment_size;
-
-		if( libfdata_vector_append_segment(
-		     internal_logical_volume->sectors_vector,
-		     &segment_index,
-		     0,
-		     0,
-		     segment_size,
-		     LIBFVDE_RANGE_FLAG_IS_SPARSE,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to append sparse segment to sectors vector.",
-			 function );
-
-			goto on_error;
+			 cache_unit_size );
 		}
+#endif
+		result = libfvde_internal_logical_volume_initialize_sectors_cache(
+		          internal_logical_volume,
+		          internal_logical_volume->io_handle->bytes_per_sector,
+		          internal_logical_volume->maximum_cache_size,
+		          error );
 	}
-	if( libfcache_cache_initialize(
-	     &( internal_logical_volume->sectors_cache ),
-	     LIBFVDE_MAXIMUM_CACHE_ENTRIES_SECTORS,
-	     error ) != 1 )
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create sectors cache.",
+		 "%s: unable to initialize sectors cache.",
 		 function );
 
 		goto on_error;
@@ -674,6 +594,18 @@ int libfvde_internal_logical_volume_open_read(
 	return( 1 );
 
 on_error:
+	if( internal_logical_volume->sharded_sectors_cache != NULL )
+	{
+		libfvde_sector_cache_free(
+		 &( internal_logical_volume->sharded_sectors_cache ),
+		 NULL );
+	}
+	if( internal_logical_volume->extent_table != NULL )
+	{
+		libfvde_extent_table_free(
+		 &( internal_logical_volume->extent_table ),
+		 NULL );
+	}
 	if( internal_logical_volume->sectors_cache != NULL )
 	{
 		libfcache_cache_free(
@@ -695,17 +627,32 @@ on_error:
 	return( -1 );
 }
 
-/* Reads the keys from when unlocking the volume
- * Returns 1 if successful, 0 if not or -1 on error
+/* Reads the logical volume header and sets up the volume data handle, keys and sectors cache
+ * if the logical volume was opened and this was not done before
+ *
+ * The logical volume data is set up on demand by the following functions, which therefore
+ * report errors reading the volume header or unlocking the logical volume:
+ * - libfvde_logical_volume_unlock
+ * - libfvde_logical_volume_read_buffer
+ * - libfvde_logical_volume_read_buffer_at_offset
+ * - libfvde_logical_volume_pread_buffer
+ * - libfvde_logical_volume_read_buffers_at_offsets
+ * - libfvde_logical_volume_seek_offset
+ * - libfvde_logical_volume_get_number_of_extents
+ * - libfvde_logical_volume_get_extent_by_index
+ * - libfvde_logical_volume_is_locked
+ *
+ * This function grabs the read/write lock and must be called without holding it
+ * Returns 1 if the logical volume data was set up, 0 if it was set up before or
+ * the logical volume was not opened or -1 on error
  */
-int libfvde_internal_logical_volume_open_read_keys(
+int libfvde_internal_logical_volume_open_read_data_on_demand(
      libfvde_internal_logical_volume_t *internal_logical_volume,
      libcerror_error_t **error )
 {
-	uint8_t tweak_key_data[ 32 ];
-
-	static char *function = "libfvde_internal_logical_volume_open_read_keys";
-	int result            = 0;
+	static char *function = "libfvde_internal_logical_volume_open_read_data_on_demand";
+	uint8_t read_data     = 0;
+	int result            = 1;
 
 	if( internal_logical_volume == NULL )
 	{
@@ -718,35 +665,153 @@ int libfvde_internal_logical_volume_open_read_keys(
 
 		return( -1 );
 	}
-	if( internal_logical_volume->logical_volume_descriptor == NULL )
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid logical volume - missing logical volume descriptor.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_logical_volume->encrypted_metadata == NULL )
+#endif
+	read_data = (uint8_t) ( ( internal_logical_volume->is_open != 0 )
+	                     && ( internal_logical_volume->volume_data_handle == NULL ) );
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( read_data == 0 )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* Another thread could have set up the logical volume data in the meantime
+	 * in which case libfvde_internal_logical_volume_open_read_data does nothing
+	 */
+	if( libfvde_internal_logical_volume_open_read_data(
+	     internal_logical_volume,
+	     internal_logical_volume->file_io_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read logical volume data.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Initializes the sectors vector and cache
+ * The cache unit size must be a multitude of the bytes per sector. If the cache unit size
+ * differs from the bytes per sector the segments must be aligned to the cache unit size.
+ * The sharded sectors cache, used by positional reads, uses the same cache unit size.
+ * Existing sectors vector and caches are replaced on success
+ * Returns 1 if successful, 0 if the cache unit size is not supported or -1 on error
+ */
+int libfvde_internal_logical_volume_initialize_sectors_cache(
+     libfvde_internal_logical_volume_t *internal_logical_volume,
+     uint32_t cache_unit_size,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error )
+{
+	libfcache_cache_t *sectors_cache                 = NULL;
+	libfdata_vector_t *sectors_vector                = NULL;
+	libfvde_extent_t *extent                         = NULL;
+	libfvde_extent_table_t *extent_table             = NULL;
+	libfvde_sector_cache_t *sharded_sectors_cache    = NULL;
+	libfvde_segment_descriptor_t *segment_descriptor = NULL;
+	static char *function                            = "libfvde_internal_logical_volume_initialize_sectors_cache";
+	size64_t maximum_read_ahead_size                 = 0;
+	size64_t number_of_cache_entries                 = 0;
+	size64_t segment_size                            = 0;
+	off64_t segment_offset                           = 0;
+	uint64_t expected_logical_block_number           = 0;
+	uint32_t segment_flags                           = 0;
+	int extent_index                                 = 0;
+	int number_of_segment_descriptors                = 0;
+	int segment_descriptor_index                     = 0;
+	int segment_index                                = 0;
+
+	if( internal_logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_logical_volume->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid logical volume - missing encrypted metadata.",
+		 "%s: invalid logical volume - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_logical_volume->keyring == NULL )
+	if( internal_logical_volume->io_handle->bytes_per_sector == 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid logical volume - missing keyring handle.",
+		 "%s: invalid logical volume - invalid IO handle - missing bytes per sector.",
 		 function );
 
 		return( -1 );
@@ -762,214 +827,2306 @@ int libfvde_internal_logical_volume_open_read_keys(
 
 		return( -1 );
 	}
-	if( internal_logical_volume->volume_master_key_is_set == 0 )
+	if( ( cache_unit_size == 0 )
+	 || ( cache_unit_size > LIBFVDE_MAXIMUM_CACHE_UNIT_SIZE ) )
 	{
-		if( internal_logical_volume->encrypted_metadata->encryption_context_plist_file_is_set != 0 )
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid cache unit size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( cache_unit_size % internal_logical_volume->io_handle->bytes_per_sector ) != 0 )
+	{
+		return( 0 );
+	}
+	if( cache_unit_size != internal_logical_volume->io_handle->bytes_per_sector )
+	{
+		if( ( internal_logical_volume->volume_size % cache_unit_size ) != 0 )
 		{
-			result = libfvde_encrypted_metadata_get_volume_master_key(
-				  internal_logical_volume->encrypted_metadata,
-				  internal_logical_volume->encrypted_metadata->encryption_context_plist,
-				  internal_logical_volume->keyring,
-			          internal_logical_volume->user_password,
-			          internal_logical_volume->user_password_size - 1,
-			          internal_logical_volume->recovery_password,
-			          internal_logical_volume->recovery_password_size - 1,
-				  error );
+			return( 0 );
+		}
+	}
+	if( libfvde_extent_table_initialize(
+	     &extent_table,
+	     (size_t) internal_logical_volume->io_handle->block_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create extent table.",
+		 function );
 
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve volume master key from encrypted metadata.",
-				 function );
+		goto on_error;
+	}
+	if( libfvde_logical_volume_descriptor_get_number_of_segment_descriptors(
+	     internal_logical_volume->logical_volume_descriptor,
+	     &number_of_segment_descriptors,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of segment descriptors from logical volume descriptor.",
+		 function );
 
-				goto on_error;
-			}
-			else if( result != 0 )
-			{
-				internal_logical_volume->volume_master_key_is_set = 1;
-			}
+		goto on_error;
+	}
+	if( internal_logical_volume->volume_data_handle->is_encrypted != 0 )
+	{
+		segment_flags = LIBFVDE_RANGE_FLAG_IS_ENCRYPTED;
+	}
+	for( segment_descriptor_index = 0;
+	     segment_descriptor_index < number_of_segment_descriptors;
+	     segment_descriptor_index++ )
+	{
+		if( libfvde_logical_volume_descriptor_get_segment_descriptor_by_index(
+		     internal_logical_volume->logical_volume_descriptor,
+		     segment_descriptor_index,
+		     &segment_descriptor,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve segment descriptor: %d from logical volume descriptor.",
+			 function,
+			 segment_descriptor_index );
+
+			goto on_error;
 		}
-		else if( internal_logical_volume->encrypted_root_plist != NULL )
+		if( segment_descriptor == NULL )
 		{
-			result = libfvde_encrypted_metadata_get_volume_master_key(
-				  internal_logical_volume->encrypted_metadata,
-				  internal_logical_volume->encrypted_root_plist,
-				  internal_logical_volume->keyring,
-			          internal_logical_volume->user_password,
-			          internal_logical_volume->user_password_size - 1,
-			          internal_logical_volume->recovery_password,
-			          internal_logical_volume->recovery_password_size - 1,
-				  error );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing segment descriptor: %d.",
+			 function,
+			 segment_descriptor_index );
 
-			if( result == -1 )
+			goto on_error;
+		}
+		if( segment_descriptor->logical_block_number < expected_logical_block_number )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported logical block number of segment descriptor: %d.",
+			 function,
+			 segment_descriptor_index );
+
+			goto on_error;
+		}
+		/* A cache unit must not span multiple segments
+		 */
+		if( ( ( ( segment_descriptor->logical_block_number * internal_logical_volume->io_handle->block_size ) % cache_unit_size ) != 0 )
+		 || ( ( ( segment_descriptor->number_of_blocks * internal_logical_volume->io_handle->block_size ) % cache_unit_size ) != 0 ) )
+		{
+			libfvde_extent_table_free(
+			 &extent_table,
+			 NULL );
+
+			return( 0 );
+		}
+		if( segment_descriptor->logical_block_number > expected_logical_block_number )
+		{
+			if( libfvde_extent_table_append_extent(
+			     extent_table,
+			     expected_logical_block_number,
+			     0,
+			     segment_descriptor->logical_block_number - expected_logical_block_number,
+			     0,
+			     LIBFVDE_RANGE_FLAG_IS_SPARSE,
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve volume master key from encrypted metadata.",
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append sparse extent to extent table.",
 				 function );
 
 				goto on_error;
 			}
-			else if( result != 0 )
-			{
-				internal_logical_volume->volume_master_key_is_set = 1;
-			}
+			expected_logical_block_number = segment_descriptor->logical_block_number;
+		}
+		/* Physically adjacent segment descriptors are coalesced into a single extent
+		 */
+		if( libfvde_extent_table_append_extent(
+		     extent_table,
+		     segment_descriptor->logical_block_number,
+		     internal_logical_volume->logical_volume_descriptor->base_physical_block_number + segment_descriptor->physical_block_number,
+		     segment_descriptor->number_of_blocks,
+		     segment_descriptor->physical_volume_index,
+		     segment_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append extent of segment descriptor: %d to extent table.",
+			 function,
+			 segment_descriptor_index );
+
+			goto on_error;
 		}
+		expected_logical_block_number += segment_descriptor->number_of_blocks;
 	}
-	if( ( internal_logical_volume->volume_master_key_is_set != 0 )
-	 && ( internal_logical_volume->volume_data_handle->encryption_context == NULL ) )
+	segment_size = (size64_t) expected_logical_block_number * internal_logical_volume->io_handle->block_size;
+
+	if( segment_size < internal_logical_volume->volume_size )
 	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		segment_size = internal_logical_volume->volume_size - segment_size;
+
+		/* The volume size is not necessarily a multitude of the block size
+		 */
+		if( libfvde_extent_table_append_extent(
+		     extent_table,
+		     expected_logical_block_number,
+		     0,
+		     ( segment_size + internal_logical_volume->io_handle->block_size - 1 ) / internal_logical_volume->io_handle->block_size,
+		     0,
+		     LIBFVDE_RANGE_FLAG_IS_SPARSE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append sparse extent to extent table.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libfdata_vector_initialize(
+	     &sectors_vector,
+	     (size64_t) cache_unit_size,
+	     (intptr_t *) internal_logical_volume->volume_data_handle,
+	     NULL,
+	     NULL,
+	     (int (*)(intptr_t *, intptr_t *, libfdata_vector_t *, libfdata_cache_t *, int, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libfvde_volume_data_handle_read_sector,
+	     NULL,
+	     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create sectors vector.",
+		 function );
+
+		goto on_error;
+	}
+	/* The sectors vector segments are derived from the coalesced extents
+	 */
+	for( extent_index = 0;
+	     extent_index < extent_table->number_of_extents;
+	     extent_index++ )
+	{
+		extent = &( extent_table->extents[ extent_index ] );
+
+		segment_offset = (off64_t) extent->physical_block_number * internal_logical_volume->io_handle->block_size;
+		segment_size   = (size64_t) extent->number_of_blocks * internal_logical_volume->io_handle->block_size;
+
+		/* The trailing sparse extent is trimmed to the volume size
+		 */
+		if( ( ( extent->range_flags & LIBFVDE_RANGE_FLAG_IS_SPARSE ) != 0 )
+		 && ( ( extent_index + 1 ) == extent_table->number_of_extents ) )
+		{
+			segment_size = internal_logical_volume->volume_size - ( (size64_t) extent->logical_block_number * internal_logical_volume->io_handle->block_size );
+		}
+		if( libfdata_vector_append_segment(
+		     sectors_vector,
+		     &segment_index,
+		     (int) extent->physical_volume_index,
+		     segment_offset,
+		     segment_size,
+		     extent->range_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append segment: %d to sectors vector.",
+			 function,
+			 extent_index );
+
+			goto on_error;
+		}
+	}
+	if( maximum_cache_size == 0 )
+	{
+		maximum_cache_size = LIBFVDE_DEFAULT_CACHE_SIZE;
+	}
+	number_of_cache_entries = maximum_cache_size / cache_unit_size;
+
+	if( number_of_cache_entries == 0 )
+	{
+		number_of_cache_entries = 1;
+	}
+	else if( number_of_cache_entries > LIBFVDE_MAXIMUM_NUMBER_OF_CACHE_ENTRIES )
+	{
+		number_of_cache_entries = LIBFVDE_MAXIMUM_NUMBER_OF_CACHE_ENTRIES;
+	}
+	/* The read-ahead window is limited to half of the sectors cache so that
+	 * reading ahead does not evict the data of the previous window
+	 */
+	maximum_read_ahead_size = ( number_of_cache_entries * cache_unit_size ) / 2;
+
+	if( maximum_read_ahead_size > LIBFVDE_MAXIMUM_READ_AHEAD_SIZE )
+	{
+		maximum_read_ahead_size = LIBFVDE_MAXIMUM_READ_AHEAD_SIZE;
+	}
+	maximum_read_ahead_size -= maximum_read_ahead_size % cache_unit_size;
+
+	if( libfcache_cache_initialize(
+	     &sectors_cache,
+	     (int) number_of_cache_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create sectors cache.",
+		 function );
+
+		goto on_error;
+	}
+	/* The entries of the sharded sectors cache are only allocated on use by positional reads
+	 */
+	if( libfvde_sector_cache_initialize(
+	     &sharded_sectors_cache,
+	     LIBFVDE_NUMBER_OF_SECTOR_CACHE_SHARDS,
+	     (int) number_of_cache_entries,
+	     (size_t) cache_unit_size,
+	     (size_t) internal_logical_volume->io_handle->bytes_per_sector,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create sharded sectors cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( internal_logical_volume->volume_data_handle->is_encrypted != 0 )
+	 && ( internal_logical_volume->keyring != NULL ) )
+	{
+		if( libfvde_sector_cache_set_keys(
+		     sharded_sectors_cache,
+		     LIBFVDE_ENCRYPTION_METHOD_AES_128_XTS,
+		     internal_logical_volume->keyring->volume_master_key,
+		     128,
+		     internal_logical_volume->keyring->volume_tweak_key,
+		     128,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set keys in sharded sectors cache.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( internal_logical_volume->sharded_sectors_cache != NULL )
+	{
+		if( libfvde_sector_cache_free(
+		     &( internal_logical_volume->sharded_sectors_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sharded sectors cache.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* The cached sector data is released into the sector data pool
+	 * so the cache is freed before the pool
+	 */
+	if( internal_logical_volume->sectors_cache != NULL )
+	{
+		if( libfcache_cache_free(
+		     &( internal_logical_volume->sectors_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sectors cache.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( internal_logical_volume->sectors_vector != NULL )
+	{
+		if( libfdata_vector_free(
+		     &( internal_logical_volume->sectors_vector ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sectors vector.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( internal_logical_volume->extent_table != NULL )
+	{
+		if( libfvde_extent_table_free(
+		     &( internal_logical_volume->extent_table ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free extent table.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* The sector data pool is sized to the number of entries of the sectors cache
+	 */
+	if( internal_logical_volume->volume_data_handle->sector_data_pool != NULL )
+	{
+		if( ( internal_logical_volume->volume_data_handle->sector_data_pool->data_size != (size_t) cache_unit_size )
+		 || ( internal_logical_volume->volume_data_handle->sector_data_pool->maximum_number_of_free_sector_data != (int) number_of_cache_entries ) )
+		{
+			if( libfvde_sector_data_pool_free(
+			     &( internal_logical_volume->volume_data_handle->sector_data_pool ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free sector data pool.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	if( internal_logical_volume->read_ahead_buffer != NULL )
+	{
+		memory_free(
+		 internal_logical_volume->read_ahead_buffer );
+
+		internal_logical_volume->read_ahead_buffer = NULL;
+	}
+	internal_logical_volume->volume_data_handle->maximum_number_of_sector_data = (int) number_of_cache_entries;
+
+	internal_logical_volume->extent_table            = extent_table;
+	internal_logical_volume->sectors_vector          = sectors_vector;
+	internal_logical_volume->sectors_cache           = sectors_cache;
+	internal_logical_volume->sharded_sectors_cache   = sharded_sectors_cache;
+	internal_logical_volume->sector_data_size        = cache_unit_size;
+	internal_logical_volume->read_ahead_offset       = -1;
+	internal_logical_volume->read_ahead_end_offset   = 0;
+	internal_logical_volume->read_ahead_size         = 0;
+	internal_logical_volume->maximum_read_ahead_size = (size_t) maximum_read_ahead_size;
+
+	return( 1 );
+
+on_error:
+	if( sharded_sectors_cache != NULL )
+	{
+		libfvde_sector_cache_free(
+		 &sharded_sectors_cache,
+		 NULL );
+	}
+	if( sectors_cache != NULL )
+	{
+		libfcache_cache_free(
+		 &sectors_cache,
+		 NULL );
+	}
+	if( sectors_vector != NULL )
+	{
+		libfdata_vector_free(
+		 &sectors_vector,
+		 NULL );
+	}
+	if( extent_table != NULL )
+	{
+		libfvde_extent_table_free(
+		 &extent_table,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the keys from when unlocking the volume
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int libfvde_internal_logical_volume_open_read_keys(
+     libfvde_internal_logical_volume_t *internal_logical_volume,
+     libcerror_error_t **error )
+{
+	uint8_t tweak_key_data[ 32 ];
+
+	static char *function = "libfvde_internal_logical_volume_open_read_keys";
+	int result            = 0;
+
+	if( internal_logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_logical_volume->logical_volume_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid logical volume - missing logical volume descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_logical_volume->encrypted_metadata == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid logical volume - missing encrypted metadata.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_logical_volume->keyring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid logical volume - missing keyring handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_logical_volume->volume_data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid logical volume - missing volume data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_logical_volume->volume_master_key_is_set == 0 )
+	{
+		if( internal_logical_volume->encrypted_metadata->encryption_context_plist_file_is_set != 0 )
+		{
+			result = libfvde_encrypted_metadata_get_volume_master_key(
+				  internal_logical_volume->encrypted_metadata,
+				  internal_logical_volume->encrypted_metadata->encryption_context_plist,
+				  internal_logical_volume->keyring,
+			          internal_logical_volume->user_password,
+			          internal_logical_volume->user_password_size - 1,
+			          internal_logical_volume->recovery_password,
+			          internal_logical_volume->recovery_password_size - 1,
+				  error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve volume master key from encrypted metadata.",
+				 function );
+
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				internal_logical_volume->volume_master_key_is_set = 1;
+			}
+		}
+		else if( internal_logical_volume->encrypted_root_plist != NULL )
+		{
+			result = libfvde_encrypted_metadata_get_volume_master_key(
+				  internal_logical_volume->encrypted_metadata,
+				  internal_logical_volume->encrypted_root_plist,
+				  internal_logical_volume->keyring,
+			          internal_logical_volume->user_password,
+			          internal_logical_volume->user_password_size - 1,
+			          internal_logical_volume->recovery_password,
+			          internal_logical_volume->recovery_password_size - 1,
+				  error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve volume master key from encrypted metadata.",
+				 function );
+
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				internal_logical_volume->volume_master_key_is_set = 1;
+			}
+		}
+	}
+	if( ( internal_logical_volume->volume_master_key_is_set != 0 )
+	 && ( internal_logical_volume->volume_data_handle->encryption_context == NULL ) )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: volume master key:\n",
+			 function );
+			libcnotify_print_data(
+			 internal_logical_volume->keyring->volume_master_key,
+			 16,
+			 0 );
+		}
+#endif
+		if( memory_copy(
+		     &( tweak_key_data[ 0 ] ),
+		     internal_logical_volume->keyring->volume_master_key,
+		     16 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy volume master key to tweak key data.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     &( tweak_key_data[ 16 ] ),
+		     internal_logical_volume->logical_volume_descriptor->family_identifier,
+		     16 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy logical volume family identifier to tweak key data.",
+			 function );
+
+			goto on_error;
+		}
+		if( libhmac_sha256_calculate(
+		     tweak_key_data,
+		     32,
+		     internal_logical_volume->keyring->volume_tweak_key,
+		     32,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to calculate SHA-256 of tweak key data.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: volume tweak key:\n",
+			 function );
+			libcnotify_print_data(
+			 internal_logical_volume->keyring->volume_tweak_key,
+			 16,
+			 0 );
+		}
+#endif
+		if( libfvde_encryption_context_initialize(
+		     &( internal_logical_volume->volume_data_handle->encryption_context ),
+		     LIBFVDE_ENCRYPTION_METHOD_AES_128_XTS,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create encryption context.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfvde_encryption_context_set_keys(
+		     internal_logical_volume->volume_data_handle->encryption_context,
+		     internal_logical_volume->keyring->volume_master_key,
+		     128,
+		     internal_logical_volume->keyring->volume_tweak_key,
+		     128,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set keys in encryption context.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( internal_logical_volume->io_handle->number_of_decryption_threads > 1 )
+		 && ( internal_logical_volume->volume_data_handle->decryption_thread_pool == NULL ) )
+		{
+			if( libfvde_decryption_thread_pool_initialize(
+			     &( internal_logical_volume->volume_data_handle->decryption_thread_pool ),
+			     internal_logical_volume->io_handle->number_of_decryption_threads,
+			     (size_t) internal_logical_volume->io_handle->bytes_per_sector,
+			     LIBFVDE_ENCRYPTION_METHOD_AES_128_XTS,
+			     internal_logical_volume->keyring->volume_master_key,
+			     128,
+			     internal_logical_volume->keyring->volume_tweak_key,
+			     128,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create decryption thread pool.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( internal_logical_volume->sharded_sectors_cache != NULL )
+		{
+			if( libfvde_sector_cache_set_keys(
+			     internal_logical_volume->sharded_sectors_cache,
+			     LIBFVDE_ENCRYPTION_METHOD_AES_128_XTS,
+			     internal_logical_volume->keyring->volume_master_key,
+			     128,
+			     internal_logical_volume->keyring->volume_tweak_key,
+			     128,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set keys in sharded sectors cache.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( memory_set(
+		     tweak_key_data,
+		     0,
+		     32 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear tweak key data.",
+			 function );
+
+			goto on_error;
+		}
+		internal_logical_volume->volume_data_handle->is_encrypted = 1;
+	}
+	if( internal_logical_volume->volume_data_handle->encryption_context != NULL )
+	{
+		return( 1 );
+	}
+	return( 0 );
+
+on_error:
+	memory_set(
+	 tweak_key_data,
+	 0,
+	 32 );
+
+	return( -1 );
+}
+
+/* Reads the logical volume header
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int libfvde_internal_logical_volume_open_read_volume_header_data(
+     libfvde_internal_logical_volume_t *internal_logical_volume,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "libfvde_internal_logical_volume_open_read_volume_header_data";
+	uint32_t block_size       = 0;
+	uint32_t number_of_blocks = 0;
+	uint16_t volume_signature = 0;
+	int result                = 0;
+
+	if( internal_logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < 512 )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint16_big_endian(
+	 data,
+	 volume_signature );
+
+	if( ( volume_signature == 0x482b )
+	 || ( volume_signature == 0x4858 ) )
+	{
+		byte_stream_copy_to_uint32_big_endian(
+		 &( data[ 40 ] ),
+		 block_size );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 &( data[ 44 ] ),
+		 number_of_blocks );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: block size\t\t: %" PRIu32 "\n",
+			 function,
+			 block_size );
+
+			libcnotify_printf(
+			 "%s: number of blocks\t\t: %" PRIu32 "\n",
+			 function,
+			 number_of_blocks );
+
+			libcnotify_printf(
+			 "\n" );
+		}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+		result = 1;
+	}
+	return( result );
+}
+
+/* Reads the logical volume header
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int libfvde_internal_logical_volume_open_read_volume_header(
+     libfvde_internal_logical_volume_t *internal_logical_volume,
+     libbfio_pool_t *file_io_pool,
+     int file_io_pool_entry,
+     off64_t file_offset,
+     libcerror_error_t **error )
+{
+	libfvde_sector_data_t *sector_data = NULL;
+	static char *function              = "libfvde_internal_logical_volume_open_read_volume_header";
+	uint64_t block_number              = 0;
+	int result                         = 0;
+
+	if( internal_logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_logical_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid logical volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_logical_volume->volume_data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid logical volume - missing volume data handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: reading logical volume header at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+		 function,
+		 file_offset,
+		 file_offset );
+	}
+#endif
+	if( libfvde_sector_data_initialize(
+	     &sector_data,
+	     (size_t) internal_logical_volume->io_handle->bytes_per_sector,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create sector data.",
+		 function );
+
+		goto on_error;
+	}
+	block_number = (uint64_t) ( file_offset - internal_logical_volume->volume_data_handle->logical_volume_offset ) / internal_logical_volume->io_handle->bytes_per_sector;
+
+	if( libfvde_sector_data_read(
+	     sector_data,
+	     internal_logical_volume->volume_data_handle->encryption_context,
+	     file_io_pool,
+	     file_io_pool_entry,
+	     file_offset,
+	     block_number,
+	     internal_logical_volume->volume_data_handle->is_encrypted,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read volume header sector data.",
+		 function );
+
+		goto on_error;
+	}
+	result = libfvde_internal_logical_volume_open_read_volume_header_data(
+	          internal_logical_volume,
+	          sector_data->data,
+	          sector_data->data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read volume header.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfvde_sector_data_free(
+	     &sector_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free sector data.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( sector_data != NULL )
+	{
+		libfvde_sector_data_free(
+		 &sector_data,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes a logical volume
+ * Returns 0 if successful or -1 on error
+ */
+int libfvde_internal_logical_volume_close(
+     libfvde_internal_logical_volume_t *internal_logical_volume,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_internal_logical_volume_close";
+	int result            = 0;
+
+	if( internal_logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_logical_volume->current_offset          = 0;
+	internal_logical_volume->read_ahead_offset       = -1;
+	internal_logical_volume->read_ahead_end_offset   = 0;
+	internal_logical_volume->read_ahead_size         = 0;
+	internal_logical_volume->maximum_read_ahead_size = 0;
+	internal_logical_volume->is_open                 = 0;
+	internal_logical_volume->is_locked               = 1;
+
+	if( internal_logical_volume->user_password != NULL )
+	{
+		if( memory_set(
+		     internal_logical_volume->user_password,
+		     0,
+		     internal_logical_volume->user_password_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear user password.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_logical_volume->user_password );
+
+		internal_logical_volume->user_password      = NULL;
+		internal_logical_volume->user_password_size = 0;
+	}
+	if( internal_logical_volume->recovery_password != NULL )
+	{
+		if( memory_set(
+		     internal_logical_volume->recovery_password,
+		     0,
+		     internal_logical_volume->recovery_password_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear recovery password.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_logical_volume->recovery_password );
+
+		internal_logical_volume->recovery_password      = NULL;
+		internal_logical_volume->recovery_password_size = 0;
+	}
+	if( internal_logical_volume->sectors_vector != NULL )
+	{
+		if( libfdata_vector_free(
+		     &( internal_logical_volume->sectors_vector ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sectors vector.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_logical_volume->sectors_cache != NULL )
+	{
+		if( libfcache_cache_free(
+		     &( internal_logical_volume->sectors_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sectors cache.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_logical_volume->sharded_sectors_cache != NULL )
+	{
+		if( libfvde_sector_cache_free(
+		     &( internal_logical_volume->sharded_sectors_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sharded sectors cache.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_logical_volume->extent_table != NULL )
+	{
+		if( libfvde_extent_table_free(
+		     &( internal_logical_volume->extent_table ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free extent table.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_logical_volume->read_ahead_buffer != NULL )
+	{
+		memory_free(
+		 internal_logical_volume->read_ahead_buffer );
+
+		internal_logical_volume->read_ahead_buffer = NULL;
+	}
+	/* The volume data handle is freed last since it owns the sector data pool
+	 * the cached sector data is released into
+	 */
+	if( internal_logical_volume->volume_data_handle != NULL )
+	{
+		if( libfvde_volume_data_handle_free(
+		     &( internal_logical_volume->volume_data_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free volume data handle.",
+			 function );
+
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Unlocks the logical volume
+ * Returns 1 if the volume is unlocked, 0 if not or -1 on error
+ */
+int libfvde_internal_logical_volume_unlock(
+     libfvde_internal_logical_volume_t *internal_logical_volume,
+     libbfio_pool_t *file_io_pool,
+     libcerror_error_t **error )
+{
+	static char *function  = "libfvde_internal_logical_volume_unlock";
+	off64_t volume_offset  = 0;
+	int file_io_pool_entry = 0;
+	int result             = 0;
+
+	if( internal_logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_logical_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid logical volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfvde_internal_logical_volume_open_read_keys(
+		  internal_logical_volume,
+		  error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read keys.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( libfvde_logical_volume_descriptor_get_first_block_number(
+		     internal_logical_volume->logical_volume_descriptor,
+		     (uint16_t *) &file_io_pool_entry,
+		     (uint64_t *) &volume_offset,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve first block number from logical volume descriptor.",
+			 function );
+
+			return( -1 );
+		}
+		volume_offset *= internal_logical_volume->io_handle->block_size;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "Reading logical volume header at offset: %" PRIi64 " (0x%08" PRIx64 "):\n",
+			 volume_offset + 1024,
+			 volume_offset + 1024 );
+		}
+#endif
+		result = libfvde_internal_logical_volume_open_read_volume_header(
+			  internal_logical_volume,
+			  file_io_pool,
+			  file_io_pool_entry,
+			  volume_offset + 1024,
+			  error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read logical volume header.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			internal_logical_volume->is_locked = 0;
+		}
+	}
+	return( result );
+}
+
+/* Unlocks the logical volume
+ * Returns 1 if the volume is unlocked, 0 if not or -1 on error
+ */
+int libfvde_logical_volume_unlock(
+     libfvde_logical_volume_t *logical_volume,
+     libcerror_error_t **error )
+{
+	libfvde_internal_logical_volume_t *internal_logical_volume = NULL;
+	static char *function                                      = "libfvde_logical_volume_unlock";
+	int data_was_read                                          = 0;
+	int result                                                 = 1;
+
+	if( logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_logical_volume = (libfvde_internal_logical_volume_t *) logical_volume;
+
+	/* Setting up the logical volume data tries to unlock the logical volume
+	 */
+	data_was_read = libfvde_internal_logical_volume_open_read_data_on_demand(
+	                 internal_logical_volume,
+	                 error );
+
+	if( data_was_read == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read logical volume data.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_logical_volume->is_locked != 0 )
+	{
+		if( data_was_read != 0 )
+		{
+			result = 0;
+		}
+		else
+		{
+			result = libfvde_internal_logical_volume_unlock(
+			          internal_logical_volume,
+			          internal_logical_volume->file_io_pool,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to unlock logical volume.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the segment of the sectors vector that contains a specific offset
+ * The file offset is the offset in the file IO pool entry that corresponds with the offset
+ * and the remaining segment size the size of the segment from the offset onwards
+ * The segment is looked up in the extent table, which does not depend on the number of segments
+ * Returns 1 if successful, 0 if no such segment or -1 on error
+ */
+int libfvde_internal_logical_volume_get_segment_at_offset(
+     libfvde_internal_logical_volume_t *internal_logical_volume,
+     off64_t offset,
+     int *file_io_pool_entry,
+     off64_t *file_offset,
+     size64_t *remaining_segment_size,
+     uint32_t *segment_flags,
+     libcerror_error_t **error )
+{
+	libfvde_extent_t *extent  = NULL;
+	static char *function     = "libfvde_internal_logical_volume_get_segment_at_offset";
+	off64_t extent_end_offset = 0;
+	off64_t extent_offset     = 0;
+	int extent_index          = 0;
+	int result                = 0;
+
+	if( internal_logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_pool_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO pool entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( remaining_segment_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid remaining segment size.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_logical_volume->extent_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid logical volume - missing extent table.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfvde_extent_table_get_extent_at_offset(
+	          internal_logical_volume->extent_table,
+	          offset,
+	          &extent_index,
+	          &extent,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve extent at offset: %" PRIi64 " (0x%08" PRIx64 ") from extent table.",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	extent_offset     = (off64_t) extent->logical_block_number * internal_logical_volume->extent_table->block_size;
+	extent_end_offset = extent_offset + ( (off64_t) extent->number_of_blocks * internal_logical_volume->extent_table->block_size );
+
+	/* The trailing sparse extent is trimmed to the volume size
+	 */
+	if( ( ( extent->range_flags & LIBFVDE_RANGE_FLAG_IS_SPARSE ) != 0 )
+	 && ( ( extent_index + 1 ) == internal_logical_volume->extent_table->number_of_extents )
+	 && ( extent_end_offset > (off64_t) internal_logical_volume->volume_size ) )
+	{
+		extent_end_offset = (off64_t) internal_logical_volume->volume_size;
+	}
+	if( offset >= extent_end_offset )
+	{
+		return( 0 );
+	}
+	*file_io_pool_entry     = (int) extent->physical_volume_index;
+	*file_offset            = ( (off64_t) extent->physical_block_number * internal_logical_volume->extent_table->block_size ) + ( offset - extent_offset );
+	*remaining_segment_size = (size64_t) ( extent_end_offset - offset );
+	*segment_flags          = extent->range_flags;
+
+	return( 1 );
+}
+
+/* Reads the data of whole sectors at a specific offset directly into a buffer
+ * The sector data is read per physically consecutive segment and is not stored in the sectors cache
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfvde_internal_logical_volume_read_sectors_at_offset(
+         libfvde_internal_logical_volume_t *internal_logical_volume,
+         libbfio_pool_t *file_io_pool,
+         off64_t offset,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	static char *function           = "libfvde_internal_logical_volume_read_sectors_at_offset";
+	size64_t remaining_segment_size = 0;
+	size_t buffer_offset            = 0;
+	size_t read_size                = 0;
+	ssize_t read_count              = 0;
+	off64_t file_offset             = 0;
+	uint32_t segment_flags          = 0;
+	int file_io_pool_entry          = 0;
+	int result                      = 0;
+
+	if( internal_logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_logical_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid logical volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_logical_volume->io_handle->bytes_per_sector == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid logical volume - invalid IO handle - bytes per sector value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( offset < 0 )
+	 || ( ( offset % internal_logical_volume->io_handle->bytes_per_sector ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( buffer_offset < buffer_size )
+	{
+		result = libfvde_internal_logical_volume_get_segment_at_offset(
+		          internal_logical_volume,
+		          offset,
+		          &file_io_pool_entry,
+		          &file_offset,
+		          &remaining_segment_size,
+		          &segment_flags,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve segment at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+
+			return( -1 );
+		}
+		read_size = buffer_size - buffer_offset;
+
+		if( (size64_t) read_size > remaining_segment_size )
+		{
+			read_size = (size_t) remaining_segment_size;
+		}
+		read_count = libfvde_volume_data_handle_read_buffer(
+		              internal_logical_volume->volume_data_handle,
+		              file_io_pool,
+		              file_io_pool_entry,
+		              file_offset,
+		              (uint64_t) offset / internal_logical_volume->io_handle->bytes_per_sector,
+		              segment_flags,
+		              &( buffer[ buffer_offset ] ),
+		              read_size,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read sector data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+
+			return( -1 );
+		}
+		buffer_offset += read_size;
+		offset        += (off64_t) read_size;
+	}
+	return( (ssize_t) buffer_offset );
+}
+
+/* Reads ahead the sector data of the read-ahead window at a specific offset into the sectors cache
+ * The sector data of the window is read with a single read per physically consecutive segment,
+ * after which the window is grown up to the maximum read-ahead size. Sparse segments are skipped
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_internal_logical_volume_read_ahead_at_offset(
+     libfvde_internal_logical_volume_t *internal_logical_volume,
+     libbfio_pool_t *file_io_pool,
+     off64_t offset,
+     libcerror_error_t **error )
+{
+	libfvde_sector_data_t *sector_data = NULL;
+	static char *function              = "libfvde_internal_logical_volume_read_ahead_at_offset";
+	size64_t remaining_segment_size    = 0;
+	size_t buffer_offset               = 0;
+	size_t data_offset                 = 0;
+	size_t read_size                   = 0;
+	size_t segment_read_size           = 0;
+	ssize_t read_count                 = 0;
+	off64_t file_offset                = 0;
+	uint32_t segment_flags             = 0;
+	int element_index                  = 0;
+	int file_io_pool_entry             = 0;
+	int result                         = 0;
+
+	if( internal_logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_logical_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid logical volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_logical_volume->io_handle->bytes_per_sector == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid logical volume - invalid IO handle - bytes per sector value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_logical_volume->sector_data_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid logical volume - sector data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_logical_volume->maximum_read_ahead_size == 0 )
+	 || ( internal_logical_volume->maximum_read_ahead_size > (size_t) LIBFVDE_MAXIMUM_READ_AHEAD_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid logical volume - maximum read-ahead size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	offset -= offset % internal_logical_volume->sector_data_size;
+
+	if( (size64_t) offset >= internal_logical_volume->volume_size )
+	{
+		return( 1 );
+	}
+	if( internal_logical_volume->read_ahead_size == 0 )
+	{
+		internal_logical_volume->read_ahead_size = LIBFVDE_MINIMUM_READ_AHEAD_SIZE;
+	}
+	else
+	{
+		internal_logical_volume->read_ahead_size *= 2;
+	}
+	if( internal_logical_volume->read_ahead_size > internal_logical_volume->maximum_read_ahead_size )
+	{
+		internal_logical_volume->read_ahead_size = internal_logical_volume->maximum_read_ahead_size;
+	}
+	read_size = internal_logical_volume->read_ahead_size;
+
+	if( (size64_t) read_size > ( internal_logical_volume->volume_size - offset ) )
+	{
+		read_size = (size_t) ( internal_logical_volume->volume_size - offset );
+	}
+	read_size -= read_size % internal_logical_volume->sector_data_size;
+
+	if( read_size == 0 )
+	{
+		return( 1 );
+	}
+	if( internal_logical_volume->read_ahead_buffer == NULL )
+	{
+		internal_logical_volume->read_ahead_buffer = (uint8_t *) memory_allocate(
+		                                                          sizeof( uint8_t ) * internal_logical_volume->maximum_read_ahead_size );
+
+		if( internal_logical_volume->read_ahead_buffer == NULL )
 		{
-			libcnotify_printf(
-			 "%s: volume master key:\n",
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create read-ahead buffer.",
 			 function );
-			libcnotify_print_data(
-			 internal_logical_volume->keyring->volume_master_key,
-			 16,
-			 0 );
+
+			return( -1 );
 		}
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: reading ahead %" PRIzd " bytes at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+		 function,
+		 read_size,
+		 offset,
+		 offset );
+	}
 #endif
-		if( memory_copy(
-		     &( tweak_key_data[ 0 ] ),
-		     internal_logical_volume->keyring->volume_master_key,
-		     16 ) == NULL )
+	while( buffer_offset < read_size )
+	{
+		result = libfvde_internal_logical_volume_get_segment_at_offset(
+		          internal_logical_volume,
+		          offset + (off64_t) buffer_offset,
+		          &file_io_pool_entry,
+		          &file_offset,
+		          &remaining_segment_size,
+		          &segment_flags,
+		          error );
+
+		if( result != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy volume master key to tweak key data.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve segment at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset + (off64_t) buffer_offset,
+			 offset + (off64_t) buffer_offset );
+
+			goto on_error;
+		}
+		segment_read_size = read_size - buffer_offset;
+
+		if( (size64_t) segment_read_size > remaining_segment_size )
+		{
+			segment_read_size = (size_t) remaining_segment_size;
+		}
+		if( ( segment_read_size % internal_logical_volume->sector_data_size ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported segment size not a multitude of the sector data size.",
 			 function );
 
-			goto on_error;
+			goto on_error;
+		}
+		/* Sparse ranges are not read and not stored in the sectors cache
+		 */
+		if( ( segment_flags & LIBFVDE_RANGE_FLAG_IS_SPARSE ) == 0 )
+		{
+			read_count = libfvde_volume_data_handle_read_buffer(
+			              internal_logical_volume->volume_data_handle,
+			              file_io_pool,
+			              file_io_pool_entry,
+			              file_offset,
+			              (uint64_t) ( offset + buffer_offset ) / internal_logical_volume->io_handle->bytes_per_sector,
+			              segment_flags,
+			              &( internal_logical_volume->read_ahead_buffer[ buffer_offset ] ),
+			              segment_read_size,
+			              error );
+
+			if( read_count != (ssize_t) segment_read_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read sector data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 offset + (off64_t) buffer_offset,
+				 offset + (off64_t) buffer_offset );
+
+				goto on_error;
+			}
+			element_index = (int) ( ( offset + buffer_offset ) / internal_logical_volume->sector_data_size );
+
+			for( data_offset = buffer_offset;
+			     data_offset < ( buffer_offset + segment_read_size );
+			     data_offset += internal_logical_volume->sector_data_size )
+			{
+				if( libfvde_volume_data_handle_get_sector_data(
+				     internal_logical_volume->volume_data_handle,
+				     (size_t) internal_logical_volume->sector_data_size,
+				     &sector_data,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve sector data.",
+					 function );
+
+					goto on_error;
+				}
+				if( memory_copy(
+				     sector_data->data,
+				     &( internal_logical_volume->read_ahead_buffer[ data_offset ] ),
+				     sector_data->data_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy sector data.",
+					 function );
+
+					goto on_error;
+				}
+				if( libfdata_vector_set_element_value_by_index(
+				     internal_logical_volume->sectors_vector,
+				     (intptr_t *) file_io_pool,
+				     (libfdata_cache_t *) internal_logical_volume->sectors_cache,
+				     element_index,
+				     (intptr_t *) sector_data,
+				     (int (*)(intptr_t **, libcerror_error_t **)) &libfvde_sector_data_free,
+				     LIBFDATA_LIST_ELEMENT_VALUE_FLAG_MANAGED,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set sector data: %d as element value.",
+					 function,
+					 element_index );
+
+					goto on_error;
+				}
+				sector_data = NULL;
+
+				element_index += 1;
+			}
+		}
+		buffer_offset += segment_read_size;
+	}
+	internal_logical_volume->read_ahead_end_offset = offset + (off64_t) read_size;
+
+	return( 1 );
+
+on_error:
+	if( sector_data != NULL )
+	{
+		libfvde_sector_data_free(
+		 &sector_data,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads data from the last current into a buffer using a Basic File IO (bfio) pool
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfvde_internal_logical_volume_read_buffer_from_file_io_pool(
+         libfvde_internal_logical_volume_t *internal_logical_volume,
+         libbfio_pool_t *file_io_pool,
+         void *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	libfvde_sector_data_t *sector_data = NULL;
+	static char *function              = "libfvde_internal_logical_volume_read_buffer_from_file_io_pool";
+	size64_t remaining_segment_size    = 0;
+	off64_t element_data_offset        = 0;
+	off64_t file_offset                = 0;
+	size_t buffer_offset               = 0;
+	size_t read_size                   = 0;
+	size_t sector_data_offset          = 0;
+	ssize_t read_count                 = 0;
+	uint32_t segment_flags             = 0;
+	uint8_t is_sequential              = 0;
+	int file_io_pool_entry             = 0;
+	int result                         = 0;
+
+	if( internal_logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_logical_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid logical volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_logical_volume->logical_volume_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid logical volume - missing logical volume descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_logical_volume->current_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid logical volume - current offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_logical_volume->is_locked != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid logical volume - volume is locked.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	internal_logical_volume->io_handle->abort = 0;
+
+	if( (size64_t) internal_logical_volume->current_offset >= internal_logical_volume->logical_volume_descriptor->size )
+	{
+		return( 0 );
+	}
+	if( (size64_t) buffer_size > ( internal_logical_volume->logical_volume_descriptor->size - internal_logical_volume->current_offset ) )
+	{
+		buffer_size = (size_t) ( internal_logical_volume->logical_volume_descriptor->size - internal_logical_volume->current_offset );
+	}
+	/* A read that continues where the previous read ended is considered sequential
+	 */
+	if( internal_logical_volume->current_offset == internal_logical_volume->read_ahead_offset )
+	{
+		is_sequential = 1;
+	}
+	else
+	{
+		internal_logical_volume->read_ahead_end_offset = 0;
+		internal_logical_volume->read_ahead_size       = 0;
+	}
+	while( buffer_offset < buffer_size )
+	{
+		read_size          = buffer_size - buffer_offset;
+		sector_data_offset = (size_t) ( internal_logical_volume->current_offset % internal_logical_volume->io_handle->bytes_per_sector );
+
+		if( ( buffer_size >= LIBFVDE_MINIMUM_EXTENT_READ_SIZE )
+		 && ( sector_data_offset == 0 )
+		 && ( read_size >= (size_t) internal_logical_volume->io_handle->bytes_per_sector ) )
+		{
+			read_size -= read_size % internal_logical_volume->io_handle->bytes_per_sector;
+
+			read_count = libfvde_internal_logical_volume_read_sectors_at_offset(
+			              internal_logical_volume,
+			              file_io_pool,
+			              internal_logical_volume->current_offset,
+			              &( ( (uint8_t *) buffer )[ buffer_offset ] ),
+			              read_size,
+			              error );
+
+			if( read_count != (ssize_t) read_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read sectors at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 internal_logical_volume->current_offset,
+				 internal_logical_volume->current_offset );
+
+				return( -1 );
+			}
+			buffer_offset += read_size;
+
+			internal_logical_volume->current_offset += (off64_t) read_size;
+
+			if( (size64_t) internal_logical_volume->current_offset >= internal_logical_volume->logical_volume_descriptor->size )
+			{
+				break;
+			}
+			if( internal_logical_volume->io_handle->abort != 0 )
+			{
+				break;
+			}
+			continue;
+		}
+		result = libfvde_internal_logical_volume_get_segment_at_offset(
+		          internal_logical_volume,
+		          internal_logical_volume->current_offset,
+		          &file_io_pool_entry,
+		          &file_offset,
+		          &remaining_segment_size,
+		          &segment_flags,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve segment at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 internal_logical_volume->current_offset,
+			 internal_logical_volume->current_offset );
+
+			return( -1 );
+		}
+		/* Sparse ranges are zero filled directly and not stored in the sectors cache
+		 */
+		if( ( segment_flags & LIBFVDE_RANGE_FLAG_IS_SPARSE ) != 0 )
+		{
+			if( (size64_t) read_size > remaining_segment_size )
+			{
+				read_size = (size_t) remaining_segment_size;
+			}
+			if( memory_set(
+			     &( ( (uint8_t *) buffer )[ buffer_offset ] ),
+			     0,
+			     read_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear buffer.",
+				 function );
+
+				return( -1 );
+			}
+			buffer_offset += read_size;
+
+			internal_logical_volume->current_offset += (off64_t) read_size;
+
+			if( (size64_t) internal_logical_volume->current_offset >= internal_logical_volume->logical_volume_descriptor->size )
+			{
+				break;
+			}
+			if( internal_logical_volume->io_handle->abort != 0 )
+			{
+				break;
+			}
+			continue;
 		}
-		if( memory_copy(
-		     &( tweak_key_data[ 16 ] ),
-		     internal_logical_volume->logical_volume_descriptor->family_identifier,
-		     16 ) == NULL )
+		if( ( is_sequential != 0 )
+		 && ( internal_logical_volume->maximum_read_ahead_size != 0 )
+		 && ( internal_logical_volume->current_offset >= internal_logical_volume->read_ahead_end_offset ) )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy logical volume family identifier to tweak key data.",
-			 function );
-
-			goto on_error;
+			if( libfvde_internal_logical_volume_read_ahead_at_offset(
+			     internal_logical_volume,
+			     file_io_pool,
+			     internal_logical_volume->current_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read ahead at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 internal_logical_volume->current_offset,
+				 internal_logical_volume->current_offset );
+
+				return( -1 );
+			}
 		}
-		if( libhmac_sha256_calculate(
-		     tweak_key_data,
-		     32,
-		     internal_logical_volume->keyring->volume_tweak_key,
-		     32,
+		if( libfdata_vector_get_element_value_at_offset(
+		     internal_logical_volume->sectors_vector,
+		     (intptr_t *) file_io_pool,
+		     (libfdata_cache_t *) internal_logical_volume->sectors_cache,
+		     internal_logical_volume->current_offset,
+		     &element_data_offset,
+		     (intptr_t **) &sector_data,
+		     0,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to calculate SHA-256 of tweak key data.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sector data at offset: %" PRIi64 " (0x%08 " PRIx64 ").",
+			 function,
+			 internal_logical_volume->current_offset,
+			 internal_logical_volume->current_offset );
 
-			goto on_error;
-		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: volume tweak key:\n",
-			 function );
-			libcnotify_print_data(
-			 internal_logical_volume->keyring->volume_tweak_key,
-			 16,
-			 0 );
+			return( -1 );
 		}
-#endif
-		if( libfvde_encryption_context_initialize(
-		     &( internal_logical_volume->volume_data_handle->encryption_context ),
-		     LIBFVDE_ENCRYPTION_METHOD_AES_128_XTS,
-		     error ) != 1 )
+		if( sector_data == NULL )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create encryption context.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing sector data at offset: %" PRIi64 " (0x%08 " PRIx64 ").",
+			 function,
+			 internal_logical_volume->current_offset,
+			 internal_logical_volume->current_offset );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( libfvde_encryption_context_set_keys(
-		     internal_logical_volume->volume_data_handle->encryption_context,
-		     internal_logical_volume->keyring->volume_master_key,
-		     128,
-		     internal_logical_volume->keyring->volume_tweak_key,
-		     128,
-		     error ) != 1 )
+		if( ( element_data_offset < 0 )
+		 || ( (size64_t) element_data_offset >= (size64_t) sector_data->data_size ) )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set keys in encryption context.",
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid element data offset value out of bounds.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( memory_set(
-		     tweak_key_data,
-		     0,
-		     32 ) == NULL )
+		sector_data_offset = (size_t) element_data_offset;
+
+		read_size = sector_data->data_size - sector_data_offset;
+
+		if( read_size > ( buffer_size - buffer_offset ) )
+		{
+			read_size = buffer_size - buffer_offset;
+		}
+		if( read_size == 0 )
+		{
+			break;
+		}
+		if( memory_copy(
+		     &( ( (uint8_t *) buffer )[ buffer_offset ] ),
+		     &( ( sector_data->data )[ sector_data_offset ] ),
+		     read_size ) == NULL )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-			 "%s: unable to clear tweak key data.",
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy sector data to buffer.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		internal_logical_volume->volume_data_handle->is_encrypted = 1;
-	}
-	if( internal_logical_volume->volume_data_handle->encryption_context != NULL )
-	{
-		return( 1 );
-	}
-	return( 0 );
+		buffer_offset += read_size;
 
-on_error:
-	memory_set(
-	 tweak_key_data,
-	 0,
-	 32 );
+		internal_logical_volume->current_offset += (off64_t) read_size;
 
-	return( -1 );
+		if( (size64_t) internal_logical_volume->current_offset >= internal_logical_volume->logical_volume_descriptor->size )
+		{
+			break;
+		}
+		if( internal_logical_volume->io_handle->abort != 0 )
+		{
+			break;
+		}
+	}
+	internal_logical_volume->read_ahead_offset = internal_logical_volume->current_offset;
+
+	return( (ssize_t) buffer_offset );
 }
 
-/* Reads the logical volume header
- * Returns 1 if successful, 0 if not or -1 on error
+/* Reads data at the current offset into a buffer
+ * Returns the number of bytes read or -1 on error
  */
-int libfvde_internal_logical_volume_open_read_volume_header_data(
-     libfvde_internal_logical_volume_t *internal_logical_volume,
-     const uint8_t *data,
-     size_t data_size,
-     libcerror_error_t **error )
+ssize_t libfvde_logical_volume_read_buffer(
+         libfvde_logical_volume_t *logical_volume,
+         void *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
 {
-	static char *function     = "libfvde_internal_logical_volume_open_read_volume_header_data";
-	uint32_t block_size       = 0;
-	uint32_t number_of_blocks = 0;
-	uint16_t volume_signature = 0;
-	int result                = 0;
+	libfvde_internal_logical_volume_t *internal_logical_volume = NULL;
+	static char *function                                      = "libfvde_logical_volume_read_buffer";
+	ssize_t read_count                                         = 0;
 
-	if( internal_logical_volume == NULL )
+	if( logical_volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -980,83 +3137,87 @@ int libfvde_internal_logical_volume_open_read_volume_header_data(
 
 		return( -1 );
 	}
-	if( data == NULL )
+	internal_logical_volume = (libfvde_internal_logical_volume_t *) logical_volume;
+
+	if( libfvde_internal_logical_volume_open_read_data_on_demand(
+	     internal_logical_volume,
+	     error ) == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid data.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read logical volume data.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( data_size < 512 )
-	 || ( data_size > (size_t) SSIZE_MAX ) )
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid data size value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	byte_stream_copy_to_uint16_big_endian(
-	 data,
-	 volume_signature );
+#endif
+	read_count = libfvde_internal_logical_volume_read_buffer_from_file_io_pool(
+		      internal_logical_volume,
+		      internal_logical_volume->file_io_pool,
+		      buffer,
+		      buffer_size,
+		      error );
 
-	if( ( volume_signature == 0x482b )
-	 || ( volume_signature == 0x4858 ) )
+	if( read_count == -1 )
 	{
-		byte_stream_copy_to_uint32_big_endian(
-		 &( data[ 40 ] ),
-		 block_size );
-
-		byte_stream_copy_to_uint32_big_endian(
-		 &( data[ 44 ] ),
-		 number_of_blocks );
-
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: block size\t\t: %" PRIu32 "\n",
-			 function,
-			 block_size );
-
-			libcnotify_printf(
-			 "%s: number of blocks\t\t: %" PRIu32 "\n",
-			 function,
-			 number_of_blocks );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer.",
+		 function );
 
-			libcnotify_printf(
-			 "\n" );
-		}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+		read_count = -1;
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
 
-		result = 1;
+		return( -1 );
 	}
-	return( result );
+#endif
+	return( read_count );
 }
 
-/* Reads the logical volume header
- * Returns 1 if successful, 0 if not or -1 on error
+/* Reads data at a specific offset
+ * Returns the number of bytes read or -1 on error
  */
-int libfvde_internal_logical_volume_open_read_volume_header(
-     libfvde_internal_logical_volume_t *internal_logical_volume,
-     libbfio_pool_t *file_io_pool,
-     int file_io_pool_entry,
-     off64_t file_offset,
-     libcerror_error_t **error )
+ssize_t libfvde_logical_volume_read_buffer_at_offset(
+         libfvde_logical_volume_t *logical_volume,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
 {
-	libfvde_sector_data_t *sector_data = NULL;
-	static char *function              = "libfvde_internal_logical_volume_open_read_volume_header";
-	uint64_t block_number              = 0;
-	int result                         = 0;
+	libfvde_internal_logical_volume_t *internal_logical_volume = NULL;
+	static char *function                                      = "libfvde_logical_volume_read_buffer_at_offset";
+	ssize_t read_count                                         = 0;
 
-	if( internal_logical_volume == NULL )
+	if( logical_volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1067,124 +3228,118 @@ int libfvde_internal_logical_volume_open_read_volume_header(
 
 		return( -1 );
 	}
-	if( internal_logical_volume->io_handle == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid logical volume - missing IO handle.",
-		 function );
+	internal_logical_volume = (libfvde_internal_logical_volume_t *) logical_volume;
 
-		return( -1 );
-	}
-	if( internal_logical_volume->volume_data_handle == NULL )
+	if( libfvde_internal_logical_volume_open_read_data_on_demand(
+	     internal_logical_volume,
+	     error ) == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid logical volume - missing volume data handle.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read logical volume data.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: reading logical volume header at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
-		 function,
-		 file_offset,
-		 file_offset );
-	}
-#endif
-	if( libfvde_sector_data_initialize(
-	     &sector_data,
-	     (size_t) internal_logical_volume->io_handle->bytes_per_sector,
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_logical_volume->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create sector data.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	block_number = (uint64_t) ( file_offset - internal_logical_volume->volume_data_handle->logical_volume_offset ) / internal_logical_volume->io_handle->bytes_per_sector;
-
-	if( libfvde_sector_data_read(
-	     sector_data,
-	     internal_logical_volume->volume_data_handle->encryption_context,
-	     file_io_pool,
-	     file_io_pool_entry,
-	     file_offset,
-	     block_number,
-	     internal_logical_volume->volume_data_handle->is_encrypted,
-	     error ) != 1 )
+#endif
+	if( libfvde_internal_logical_volume_seek_offset(
+	     internal_logical_volume,
+	     offset,
+	     SEEK_SET,
+	     error ) == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read volume header sector data.",
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset.",
 		 function );
 
-		goto on_error;
+		read_count = -1;
 	}
-	result = libfvde_internal_logical_volume_open_read_volume_header_data(
-	          internal_logical_volume,
-	          sector_data->data,
-	          sector_data->data_size,
-	          error );
-
-	if( result == -1 )
+	else
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read volume header.",
-		 function );
+		read_count = libfvde_internal_logical_volume_read_buffer_from_file_io_pool(
+			      internal_logical_volume,
+			      internal_logical_volume->file_io_pool,
+			      buffer,
+			      buffer_size,
+			      error );
 
-		goto on_error;
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer.",
+			 function );
+
+			read_count = -1;
+		}
 	}
-	if( libfvde_sector_data_free(
-	     &sector_data,
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_logical_volume->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free sector data.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
-		goto on_error;
-	}
-	return( result );
-
-on_error:
-	if( sector_data != NULL )
-	{
-		libfvde_sector_data_free(
-		 &sector_data,
-		 NULL );
+		return( -1 );
 	}
-	return( -1 );
+#endif
+	return( read_count );
 }
 
-/* Closes a logical volume
- * Returns 0 if successful or -1 on error
+/* Reads data at a specific offset into a buffer without changing the current offset
+ * Small and unaligned reads are read through the sharded sectors cache and large sector
+ * aligned reads are read directly into the buffer. The sector data of a small read that is not
+ * cached yet is read at once per segment instead of per sector data. The current offset and
+ * read-ahead state are not used, so this function only requires the read/write lock to be held
+ * for reading
+ * Returns the number of bytes read or -1 on error
  */
-int libfvde_internal_logical_volume_close(
-     libfvde_internal_logical_volume_t *internal_logical_volume,
-     libcerror_error_t **error )
+ssize_t libfvde_internal_logical_volume_pread_buffer_from_file_io_pool(
+         libfvde_internal_logical_volume_t *internal_logical_volume,
+         libbfio_pool_t *file_io_pool,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
 {
-	static char *function = "libfvde_internal_logical_volume_close";
-	int result            = 0;
+	static char *function           = "libfvde_internal_logical_volume_pread_buffer_from_file_io_pool";
+	size64_t remaining_segment_size = 0;
+	off64_t file_offset             = 0;
+	off64_t filled_offset           = 0;
+	size_t buffer_offset            = 0;
+	size_t bytes_per_sector         = 0;
+	size_t read_size                = 0;
+	size_t sector_data_size         = 0;
+	ssize_t read_count              = 0;
+	uint32_t segment_flags          = 0;
+	int file_io_pool_entry          = 0;
+	int result                      = 0;
 
 	if( internal_logical_volume == NULL )
 	{
@@ -1197,218 +3352,282 @@ int libfvde_internal_logical_volume_close(
 
 		return( -1 );
 	}
-	internal_logical_volume->current_offset = 0;
-	internal_logical_volume->is_locked      = 1;
-
-	if( internal_logical_volume->user_password != NULL )
+	if( internal_logical_volume->io_handle == NULL )
 	{
-		if( memory_set(
-		     internal_logical_volume->user_password,
-		     0,
-		     internal_logical_volume->user_password_size ) == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-			 "%s: unable to clear user password.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid logical volume - missing IO handle.",
+		 function );
 
-			result = -1;
-		}
-		memory_free(
-		 internal_logical_volume->user_password );
+		return( -1 );
+	}
+	bytes_per_sector = (size_t) internal_logical_volume->io_handle->bytes_per_sector;
 
-		internal_logical_volume->user_password      = NULL;
-		internal_logical_volume->user_password_size = 0;
+	if( bytes_per_sector == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid logical volume - invalid IO handle - bytes per sector value out of bounds.",
+		 function );
+
+		return( -1 );
 	}
-	if( internal_logical_volume->recovery_password != NULL )
+	if( internal_logical_volume->logical_volume_descriptor == NULL )
 	{
-		if( memory_set(
-		     internal_logical_volume->recovery_password,
-		     0,
-		     internal_logical_volume->recovery_password_size ) == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-			 "%s: unable to clear recovery password.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid logical volume - missing logical volume descriptor.",
+		 function );
 
-			result = -1;
-		}
-		memory_free(
-		 internal_logical_volume->recovery_password );
+		return( -1 );
+	}
+	if( internal_logical_volume->volume_data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid logical volume - missing volume data handle.",
+		 function );
 
-		internal_logical_volume->recovery_password      = NULL;
-		internal_logical_volume->recovery_password_size = 0;
+		return( -1 );
 	}
-	if( internal_logical_volume->volume_data_handle != NULL )
+	if( internal_logical_volume->sharded_sectors_cache == NULL )
 	{
-		if( libfvde_volume_data_handle_free(
-		     &( internal_logical_volume->volume_data_handle ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free volume data handle.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid logical volume - missing sharded sectors cache.",
+		 function );
 
-			result = -1;
-		}
+		return( -1 );
 	}
-	if( internal_logical_volume->sectors_vector != NULL )
+	sector_data_size = internal_logical_volume->sharded_sectors_cache->sector_data_size;
+
+	if( sector_data_size == 0 )
 	{
-		if( libfdata_vector_free(
-		     &( internal_logical_volume->sectors_vector ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free sectors vector.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid logical volume - invalid sharded sectors cache - sector data size value out of bounds.",
+		 function );
 
-			result = -1;
-		}
+		return( -1 );
 	}
-	if( internal_logical_volume->sectors_cache != NULL )
+	if( internal_logical_volume->is_locked != 0 )
 	{
-		if( libfcache_cache_free(
-		     &( internal_logical_volume->sectors_cache ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free sectors cache.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid logical volume - volume is locked.",
+		 function );
 
-			result = -1;
-		}
+		return( -1 );
 	}
-	return( result );
-}
-
-/* Unlocks the logical volume
- * Returns 1 if the volume is unlocked, 0 if not or -1 on error
- */
-int libfvde_internal_logical_volume_unlock(
-     libfvde_internal_logical_volume_t *internal_logical_volume,
-     libbfio_pool_t *file_io_pool,
-     libcerror_error_t **error )
-{
-	static char *function  = "libfvde_internal_logical_volume_unlock";
-	off64_t volume_offset  = 0;
-	int file_io_pool_entry = 0;
-	int result             = 0;
-
-	if( internal_logical_volume == NULL )
+	if( buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid logical volume.",
+		 "%s: invalid buffer.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_logical_volume->io_handle == NULL )
+	if( buffer_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid logical volume - missing IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	result = libfvde_internal_logical_volume_open_read_keys(
-		  internal_logical_volume,
-		  error );
-
-	if( result == -1 )
+	if( offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read keys.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	else if( result != 0 )
+	if( (size64_t) offset >= internal_logical_volume->logical_volume_descriptor->size )
 	{
-		if( libfvde_logical_volume_descriptor_get_first_block_number(
-		     internal_logical_volume->logical_volume_descriptor,
-		     (uint16_t *) &file_io_pool_entry,
-		     (uint64_t *) &volume_offset,
-		     error ) == -1 )
+		return( 0 );
+	}
+	if( (size64_t) buffer_size > ( internal_logical_volume->logical_volume_descriptor->size - offset ) )
+	{
+		buffer_size = (size_t) ( internal_logical_volume->logical_volume_descriptor->size - offset );
+	}
+	while( buffer_offset < buffer_size )
+	{
+		result = libfvde_internal_logical_volume_get_segment_at_offset(
+		          internal_logical_volume,
+		          offset,
+		          &file_io_pool_entry,
+		          &file_offset,
+		          &remaining_segment_size,
+		          &segment_flags,
+		          error );
+
+		if( result != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve first block number from logical volume descriptor.",
-			 function );
+			 "%s: unable to retrieve segment at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
 
-			return( -1 );
+			goto on_error;
 		}
-		volume_offset *= internal_logical_volume->io_handle->block_size;
+		read_size = buffer_size - buffer_offset;
 
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		if( (size64_t) read_size > remaining_segment_size )
 		{
-			libcnotify_printf(
-			 "Reading logical volume header at offset: %" PRIi64 " (0x%08" PRIx64 "):\n",
-			 volume_offset + 1024,
-			 volume_offset + 1024 );
+			read_size = (size_t) remaining_segment_size;
 		}
-#endif
-		result = libfvde_internal_logical_volume_open_read_volume_header(
-			  internal_logical_volume,
-			  file_io_pool,
-			  file_io_pool_entry,
-			  volume_offset + 1024,
-			  error );
+		if( ( segment_flags & LIBFVDE_RANGE_FLAG_IS_SPARSE ) != 0 )
+		{
+			if( memory_set(
+			     &( ( (uint8_t *) buffer )[ buffer_offset ] ),
+			     0,
+			     read_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear buffer.",
+				 function );
 
-		if( result == -1 )
+				goto on_error;
+			}
+			read_count = (ssize_t) read_size;
+		}
+		else if( ( buffer_size >= LIBFVDE_MINIMUM_EXTENT_READ_SIZE )
+		      && ( ( offset % bytes_per_sector ) == 0 )
+		      && ( read_size >= bytes_per_sector ) )
+		{
+			read_size -= read_size % bytes_per_sector;
+
+			/* The data is read directly into the buffer, the encryption context
+			 * of a shard of the sharded sectors cache is used to decrypt it
+			 */
+			read_count = libfvde_sector_cache_read_buffer_direct(
+			              internal_logical_volume->sharded_sectors_cache,
+			              internal_logical_volume->volume_data_handle,
+			              file_io_pool,
+			              file_io_pool_entry,
+			              file_offset,
+			              segment_flags,
+			              offset,
+			              &( ( (uint8_t *) buffer )[ buffer_offset ] ),
+			              read_size,
+			              error );
+		}
+		else
+		{
+			/* Only fill the cache if the read spans multiple sector data
+			 */
+			if( ( offset >= filled_offset )
+			 && ( ( (size_t) ( offset % sector_data_size ) + read_size ) > sector_data_size ) )
+			{
+				if( libfvde_sector_cache_fill(
+				     internal_logical_volume->sharded_sectors_cache,
+				     internal_logical_volume->volume_data_handle,
+				     file_io_pool,
+				     file_io_pool_entry,
+				     file_offset,
+				     segment_flags,
+				     offset,
+				     read_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to fill sharded sectors cache at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+					 function,
+					 offset,
+					 offset );
+
+					goto on_error;
+				}
+				filled_offset = offset + (off64_t) read_size;
+			}
+			read_count = libfvde_sector_cache_read_buffer_at_offset(
+			              internal_logical_volume->sharded_sectors_cache,
+			              internal_logical_volume->volume_data_handle,
+			              file_io_pool,
+			              file_io_pool_entry,
+			              file_offset,
+			              segment_flags,
+			              offset,
+			              &( ( (uint8_t *) buffer )[ buffer_offset ] ),
+			              read_size,
+			              error );
+		}
+		if( read_count <= 0 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
 			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read logical volume header.",
-			 function );
+			 "%s: unable to read sector data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
 
-			return( -1 );
+			goto on_error;
 		}
-		else if( result != 0 )
+		buffer_offset += (size_t) read_count;
+		offset        += (off64_t) read_count;
+
+		if( internal_logical_volume->io_handle->abort != 0 )
 		{
-			internal_logical_volume->is_locked = 0;
+			break;
 		}
 	}
-	return( result );
+	return( (ssize_t) buffer_offset );
+
+on_error:
+	return( -1 );
 }
 
-/* Unlocks the logical volume
- * Returns 1 if the volume is unlocked, 0 if not or -1 on error
+/* Reads data at a specific offset without changing the current offset
+ * Unlike libfvde_logical_volume_read_buffer_at_offset this function only holds
+ * the read/write lock for reading, so multiple threads can read concurrently
+ * Returns the number of bytes read or -1 on error
  */
-int libfvde_logical_volume_unlock(
-     libfvde_logical_volume_t *logical_volume,
-     libcerror_error_t **error )
+ssize_t libfvde_logical_volume_pread_buffer(
+         libfvde_logical_volume_t *logical_volume,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
 {
 	libfvde_internal_logical_volume_t *internal_logical_volume = NULL;
-	static char *function                                      = "libfvde_logical_volume_unlock";
-	int result                                                 = 1;
+	static char *function                                      = "libfvde_logical_volume_pread_buffer";
+	ssize_t read_count                                         = 0;
 
 	if( logical_volume == NULL )
 	{
@@ -1423,8 +3642,21 @@ int libfvde_logical_volume_unlock(
 	}
 	internal_logical_volume = (libfvde_internal_logical_volume_t *) logical_volume;
 
+	if( libfvde_internal_logical_volume_open_read_data_on_demand(
+	     internal_logical_volume,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read logical volume data.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_logical_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1432,33 +3664,35 @@ int libfvde_logical_volume_unlock(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( internal_logical_volume->is_locked != 0 )
-	{
-		result = libfvde_internal_logical_volume_unlock(
-		          internal_logical_volume,
-		          internal_logical_volume->file_io_pool,
-		          error );
+	read_count = libfvde_internal_logical_volume_pread_buffer_from_file_io_pool(
+		      internal_logical_volume,
+		      internal_logical_volume->file_io_pool,
+		      buffer,
+		      buffer_size,
+		      offset,
+		      error );
 
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to unlock logical volume.",
-			 function );
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
 
-			result = -1;
-		}
+		read_count = -1;
 	}
 #if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_logical_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1466,32 +3700,73 @@ int libfvde_logical_volume_unlock(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	return( result );
+	return( read_count );
 }
 
-/* Reads data from the last current into a buffer using a Basic File IO (bfio) pool
- * This function is not multi-thread safe acquire write lock before call
- * Returns the number of bytes read or -1 on error
+/* Compares two read ranges by offset
+ * Returns -1 if the first is less than the second, 0 if equal or 1 if greater
  */
-ssize_t libfvde_internal_logical_volume_read_buffer_from_file_io_pool(
-         libfvde_internal_logical_volume_t *internal_logical_volume,
-         libbfio_pool_t *file_io_pool,
-         void *buffer,
-         size_t buffer_size,
-         libcerror_error_t **error )
+int libfvde_read_range_compare(
+     const void *first_read_range,
+     const void *second_read_range )
 {
-	libfvde_sector_data_t *sector_data = NULL;
-	static char *function              = "libfvde_internal_logical_volume_read_buffer_from_file_io_pool";
-	off64_t element_data_offset        = 0;
-	size_t buffer_offset               = 0;
-	size_t read_size                   = 0;
-	size_t sector_data_offset          = 0;
+	off64_t first_offset  = 0;
+	off64_t second_offset = 0;
+
+	first_offset  = ( (libfvde_read_range_t *) first_read_range )->offset;
+	second_offset = ( (libfvde_read_range_t *) second_read_range )->offset;
+
+	if( first_offset < second_offset )
+	{
+		return( -1 );
+	}
+	else if( first_offset > second_offset )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Reads multiple buffers at specific offsets without changing the current offset
+ * The reads are sorted by offset and reads that overlap or are separated by a small gap
+ * are merged into a single sector aligned read, of which the data is copied into the
+ * individual buffers. Like libfvde_internal_logical_volume_pread_buffer_from_file_io_pool
+ * this function only requires the read/write lock to be held for reading
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_internal_logical_volume_read_buffers_at_offsets_from_file_io_pool(
+     libfvde_internal_logical_volume_t *internal_logical_volume,
+     libbfio_pool_t *file_io_pool,
+     void **buffers,
+     size_t *buffer_sizes,
+     off64_t *offsets,
+     ssize_t *read_counts,
+     int number_of_buffers,
+     libcerror_error_t **error )
+{
+	libfvde_read_range_t *read_ranges = NULL;
+	uint8_t *merged_buffer            = NULL;
+	uint8_t *reallocation             = NULL;
+	static char *function             = "libfvde_internal_logical_volume_read_buffers_at_offsets_from_file_io_pool";
+	size64_t volume_size              = 0;
+	size_t bytes_per_sector           = 0;
+	size_t merged_buffer_size         = 0;
+	size_t merged_read_size           = 0;
+	size_t range_data_offset          = 0;
+	ssize_t read_count                = 0;
+	off64_t merged_end_offset         = 0;
+	off64_t merged_start_offset       = 0;
+	off64_t range_end_offset          = 0;
+	int buffer_index                  = 0;
+	int first_range_index             = 0;
+	int number_of_read_ranges         = 0;
+	int range_index                   = 0;
 
 	if( internal_logical_volume == NULL )
 	{
@@ -1510,167 +3785,373 @@ ssize_t libfvde_internal_logical_volume_read_buffer_from_file_io_pool(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid logical volume - missing IO handle.",
+		 "%s: invalid logical volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	bytes_per_sector = (size_t) internal_logical_volume->io_handle->bytes_per_sector;
+
+	if( bytes_per_sector == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid logical volume - invalid IO handle - bytes per sector value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_logical_volume->logical_volume_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid logical volume - missing logical volume descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_logical_volume->is_locked != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid logical volume - volume is locked.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_logical_volume->logical_volume_descriptor == NULL )
+	if( buffers == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid logical volume - missing logical volume descriptor.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffers.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_logical_volume->current_offset < 0 )
+	if( buffer_sizes == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid logical volume - current offset value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer sizes.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_logical_volume->is_locked != 0 )
+	if( offsets == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid logical volume - volume is locked.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offsets.",
 		 function );
 
 		return( -1 );
 	}
-	if( buffer == NULL )
+	if( read_counts == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid buffer.",
+		 "%s: invalid read counts.",
 		 function );
 
 		return( -1 );
 	}
-	if( buffer_size > (size_t) SSIZE_MAX )
+	if( ( number_of_buffers < 0 )
+	 || ( (size_t) number_of_buffers > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfvde_read_range_t ) ) ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid buffer size value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of buffers value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	internal_logical_volume->io_handle->abort = 0;
-
-	if( (size64_t) internal_logical_volume->current_offset >= internal_logical_volume->logical_volume_descriptor->size )
+	if( number_of_buffers == 0 )
 	{
-		return( 0 );
+		return( 1 );
 	}
-	if( (size64_t) buffer_size > ( internal_logical_volume->logical_volume_descriptor->size - internal_logical_volume->current_offset ) )
+	volume_size = internal_logical_volume->logical_volume_descriptor->size;
+
+	read_ranges = (libfvde_read_range_t *) memory_allocate(
+	                                        sizeof( libfvde_read_range_t ) * number_of_buffers );
+
+	if( read_ranges == NULL )
 	{
-		buffer_size = (size_t) ( internal_logical_volume->logical_volume_descriptor->size - internal_logical_volume->current_offset );
-	}
-	sector_data_offset = (size_t) ( internal_logical_volume->current_offset % internal_logical_volume->io_handle->bytes_per_sector );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read ranges.",
+		 function );
 
-	while( buffer_offset < buffer_size )
+		goto on_error;
+	}
+	/* Validate the buffers and clamp the reads to the end of the volume
+	 * reads of which no data is available are not added to the read ranges
+	 */
+	for( buffer_index = 0;
+	     buffer_index < number_of_buffers;
+	     buffer_index++ )
 	{
-		if( libfdata_vector_get_element_value_at_offset(
-		     internal_logical_volume->sectors_vector,
-		     (intptr_t *) file_io_pool,
-		     (libfdata_cache_t *) internal_logical_volume->sectors_cache,
-		     internal_logical_volume->current_offset,
-		     &element_data_offset,
-		     (intptr_t **) &sector_data,
-		     0,
-		     error ) != 1 )
+		if( buffers[ buffer_index ] == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve sector data at offset: %" PRIi64 " (0x%08 " PRIx64 ").",
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid buffer: %d.",
 			 function,
-			 internal_logical_volume->current_offset,
-			 internal_logical_volume->current_offset );
+			 buffer_index );
 
-			return( -1 );
+			goto on_error;
 		}
-		if( sector_data == NULL )
+		if( buffer_sizes[ buffer_index ] > (size_t) SSIZE_MAX )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing sector data at offset: %" PRIi64 " (0x%08 " PRIx64 ").",
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid buffer: %d size value exceeds maximum.",
 			 function,
-			 internal_logical_volume->current_offset,
-			 internal_logical_volume->current_offset );
+			 buffer_index );
 
-			return( -1 );
+			goto on_error;
 		}
-		read_size = sector_data->data_size - sector_data_offset;
+		if( offsets[ buffer_index ] < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid buffer: %d offset value out of bounds.",
+			 function,
+			 buffer_index );
 
-		if( read_size > ( buffer_size - buffer_offset ) )
+			goto on_error;
+		}
+		read_counts[ buffer_index ] = 0;
+
+		if( ( (size64_t) offsets[ buffer_index ] >= volume_size )
+		 || ( buffer_sizes[ buffer_index ] == 0 ) )
 		{
-			read_size = buffer_size - buffer_offset;
+			continue;
 		}
-		if( read_size == 0 )
+		read_ranges[ number_of_read_ranges ].offset       = offsets[ buffer_index ];
+		read_ranges[ number_of_read_ranges ].size         = buffer_sizes[ buffer_index ];
+		read_ranges[ number_of_read_ranges ].buffer_index = buffer_index;
+
+		if( (size64_t) read_ranges[ number_of_read_ranges ].size > ( volume_size - offsets[ buffer_index ] ) )
 		{
-			break;
+			read_ranges[ number_of_read_ranges ].size = (size_t) ( volume_size - offsets[ buffer_index ] );
 		}
-		if( memory_copy(
-		     &( ( (uint8_t *) buffer )[ buffer_offset ] ),
-		     &( ( sector_data->data )[ sector_data_offset ] ),
-		     read_size ) == NULL )
+		number_of_read_ranges++;
+	}
+	qsort(
+	 read_ranges,
+	 (size_t) number_of_read_ranges,
+	 sizeof( libfvde_read_range_t ),
+	 &libfvde_read_range_compare );
+
+	range_index = 0;
+
+	while( range_index < number_of_read_ranges )
+	{
+		/* Merge the following reads that overlap or are close to the current merged read
+		 */
+		first_range_index   = range_index;
+		merged_start_offset = read_ranges[ range_index ].offset;
+		merged_end_offset   = merged_start_offset + (off64_t) read_ranges[ range_index ].size;
+
+		merged_start_offset -= merged_start_offset % bytes_per_sector;
+
+		range_index++;
+
+		while( range_index < number_of_read_ranges )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy sector data to buffer.",
-			 function );
+			if( read_ranges[ range_index ].offset > ( merged_end_offset + LIBFVDE_MAXIMUM_MERGED_READ_GAP_SIZE ) )
+			{
+				break;
+			}
+			range_end_offset = read_ranges[ range_index ].offset + (off64_t) read_ranges[ range_index ].size;
 
-			return( -1 );
+			if( range_end_offset > merged_end_offset )
+			{
+				if( ( range_end_offset - merged_start_offset ) > (off64_t) LIBFVDE_MAXIMUM_MERGED_READ_SIZE )
+				{
+					break;
+				}
+				merged_end_offset = range_end_offset;
+			}
+			range_index++;
 		}
-		buffer_offset     += read_size;
-		sector_data_offset = 0;
-
-		internal_logical_volume->current_offset += (off64_t) read_size;
+		if( ( range_index - first_range_index ) == 1 )
+		{
+			/* A read that was not merged is read directly into its buffer
+			 */
+			buffer_index = read_ranges[ first_range_index ].buffer_index;
+
+			read_count = libfvde_internal_logical_volume_pread_buffer_from_file_io_pool(
+			              internal_logical_volume,
+			              file_io_pool,
+			              buffers[ buffer_index ],
+			              read_ranges[ first_range_index ].size,
+			              read_ranges[ first_range_index ].offset,
+			              error );
+
+			if( read_count != (ssize_t) read_ranges[ first_range_index ].size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read buffer: %d at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 buffer_index,
+				 read_ranges[ first_range_index ].offset,
+				 read_ranges[ first_range_index ].offset );
 
-		if( (size64_t) internal_logical_volume->current_offset >= internal_logical_volume->logical_volume_descriptor->size )
+				goto on_error;
+			}
+			read_counts[ buffer_index ] = read_count;
+		}
+		else
 		{
-			break;
+			if( ( merged_end_offset % bytes_per_sector ) != 0 )
+			{
+				merged_end_offset += bytes_per_sector - ( merged_end_offset % bytes_per_sector );
+			}
+			if( (size64_t) merged_end_offset > volume_size )
+			{
+				merged_end_offset = (off64_t) volume_size;
+			}
+			merged_read_size = (size_t) ( merged_end_offset - merged_start_offset );
+
+			if( merged_read_size > merged_buffer_size )
+			{
+				reallocation = (uint8_t *) memory_reallocate(
+				                            merged_buffer,
+				                            sizeof( uint8_t ) * merged_read_size );
+
+				if( reallocation == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to resize merged buffer.",
+					 function );
+
+					goto on_error;
+				}
+				merged_buffer      = reallocation;
+				merged_buffer_size = merged_read_size;
+			}
+			read_count = libfvde_internal_logical_volume_pread_buffer_from_file_io_pool(
+			              internal_logical_volume,
+			              file_io_pool,
+			              merged_buffer,
+			              merged_read_size,
+			              merged_start_offset,
+			              error );
+
+			if( read_count != (ssize_t) merged_read_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read merged buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 merged_start_offset,
+				 merged_start_offset );
+
+				goto on_error;
+			}
+			while( first_range_index < range_index )
+			{
+				buffer_index      = read_ranges[ first_range_index ].buffer_index;
+				range_data_offset = (size_t) ( read_ranges[ first_range_index ].offset - merged_start_offset );
+
+				if( memory_copy(
+				     buffers[ buffer_index ],
+				     &( merged_buffer[ range_data_offset ] ),
+				     read_ranges[ first_range_index ].size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy merged buffer data to buffer: %d.",
+					 function,
+					 buffer_index );
+
+					goto on_error;
+				}
+				read_counts[ buffer_index ] = (ssize_t) read_ranges[ first_range_index ].size;
+
+				first_range_index++;
+			}
 		}
 		if( internal_logical_volume->io_handle->abort != 0 )
 		{
 			break;
 		}
 	}
-	return( (ssize_t) buffer_offset );
+	if( merged_buffer != NULL )
+	{
+		memory_free(
+		 merged_buffer );
+	}
+	memory_free(
+	 read_ranges );
+
+	return( 1 );
+
+on_error:
+	if( merged_buffer != NULL )
+	{
+		memory_free(
+		 merged_buffer );
+	}
+	if( read_ranges != NULL )
+	{
+		memory_free(
+		 read_ranges );
+	}
+	return( -1 );
 }
 
-/* Reads data at the current offset into a buffer
- * Returns the number of bytes read or -1 on error
+/* Reads multiple buffers at specific offsets without changing the current offset
+ * The read/write lock is held for reading once for all the buffers
+ * Returns 1 if successful or -1 on error
  */
-ssize_t libfvde_logical_volume_read_buffer(
-         libfvde_logical_volume_t *logical_volume,
-         void *buffer,
-         size_t buffer_size,
-         libcerror_error_t **error )
+int libfvde_logical_volume_read_buffers_at_offsets(
+     libfvde_logical_volume_t *logical_volume,
+     void **buffers,
+     size_t *buffer_sizes,
+     off64_t *offsets,
+     ssize_t *read_counts,
+     int number_of_buffers,
+     libcerror_error_t **error )
 {
 	libfvde_internal_logical_volume_t *internal_logical_volume = NULL;
-	static char *function                                      = "libfvde_logical_volume_read_buffer";
-	ssize_t read_count                                         = 0;
+	static char *function                                      = "libfvde_logical_volume_read_buffers_at_offsets";
+	int result                                                 = 1;
 
 	if( logical_volume == NULL )
 	{
@@ -1685,8 +4166,21 @@ ssize_t libfvde_logical_volume_read_buffer(
 	}
 	internal_logical_volume = (libfvde_internal_logical_volume_t *) logical_volume;
 
+	if( libfvde_internal_logical_volume_open_read_data_on_demand(
+	     internal_logical_volume,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read logical volume data.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_logical_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1694,32 +4188,33 @@ ssize_t libfvde_logical_volume_read_buffer(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	read_count = libfvde_internal_logical_volume_read_buffer_from_file_io_pool(
-		      internal_logical_volume,
-		      internal_logical_volume->file_io_pool,
-		      buffer,
-		      buffer_size,
-		      error );
-
-	if( read_count == -1 )
+	if( libfvde_internal_logical_volume_read_buffers_at_offsets_from_file_io_pool(
+	     internal_logical_volume,
+	     internal_logical_volume->file_io_pool,
+	     buffers,
+	     buffer_sizes,
+	     offsets,
+	     read_counts,
+	     number_of_buffers,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read buffer.",
+		 "%s: unable to read buffers at offsets.",
 		 function );
 
-		read_count = -1;
+		result = -1;
 	}
 #if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_logical_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1727,30 +4222,31 @@ ssize_t libfvde_logical_volume_read_buffer(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	return( read_count );
+	return( result );
 }
 
-/* Reads data at a specific offset
- * Returns the number of bytes read or -1 on error
+/* Retrieves the offset of the first data or sparse range at or after a specific offset
+ * The end of the volume is considered the start of a sparse range
+ * Returns 1 if successful, 0 if no such range or -1 on error
  */
-ssize_t libfvde_logical_volume_read_buffer_at_offset(
-         libfvde_logical_volume_t *logical_volume,
-         void *buffer,
-         size_t buffer_size,
-         off64_t offset,
-         libcerror_error_t **error )
+int libfvde_internal_logical_volume_get_next_range_offset(
+     libfvde_internal_logical_volume_t *internal_logical_volume,
+     off64_t offset,
+     uint8_t is_sparse,
+     off64_t *range_offset,
+     libcerror_error_t **error )
 {
-	libfvde_internal_logical_volume_t *internal_logical_volume = NULL;
-	static char *function                                      = "libfvde_logical_volume_read_buffer_at_offset";
-	ssize_t read_count                                         = 0;
+	static char *function     = "libfvde_internal_logical_volume_get_next_range_offset";
+	off64_t safe_range_offset = 0;
+	int result                = 0;
 
-	if( logical_volume == NULL )
+	if( internal_logical_volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1761,78 +4257,70 @@ ssize_t libfvde_logical_volume_read_buffer_at_offset(
 
 		return( -1 );
 	}
-	internal_logical_volume = (libfvde_internal_logical_volume_t *) logical_volume;
-
-#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_logical_volume->read_write_lock,
-	     error ) != 1 )
+	if( internal_logical_volume->extent_table == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid logical volume - missing extent table.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	if( libfvde_internal_logical_volume_seek_offset(
-	     internal_logical_volume,
-	     offset,
-	     SEEK_SET,
-	     error ) == -1 )
+	if( range_offset == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek offset.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range offset.",
 		 function );
 
-		read_count = -1;
+		return( -1 );
 	}
-	else
+	if( ( offset < 0 )
+	 || ( (size64_t) offset >= internal_logical_volume->volume_size ) )
 	{
-		read_count = libfvde_internal_logical_volume_read_buffer_from_file_io_pool(
-			      internal_logical_volume,
-			      internal_logical_volume->file_io_pool,
-			      buffer,
-			      buffer_size,
-			      error );
-
-		if( read_count == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read buffer.",
-			 function );
-
-			read_count = -1;
-		}
+		return( 0 );
 	}
-#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_logical_volume->read_write_lock,
-	     error ) != 1 )
+	result = libfvde_extent_table_get_next_range_offset(
+	          internal_logical_volume->extent_table,
+	          offset,
+	          is_sparse,
+	          &safe_range_offset,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve next range offset from extent table.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	return( read_count );
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( (size64_t) safe_range_offset >= internal_logical_volume->volume_size )
+	{
+		if( is_sparse == 0 )
+		{
+			return( 0 );
+		}
+		safe_range_offset = (off64_t) internal_logical_volume->volume_size;
+	}
+	*range_offset = safe_range_offset;
+
+	return( 1 );
 }
 
 /* Seeks a certain offset of the data
+ * SEEK_DATA and SEEK_HOLE are supported if defined by the platform
  * This function is not multi-thread safe acquire write lock before call
  * Returns the offset if seek is successful or -1 on error
  */
@@ -1844,6 +4332,11 @@ off64_t libfvde_internal_logical_volume_seek_offset(
 {
 	static char *function = "libfvde_internal_logical_volume_seek_offset";
 
+#if defined( SEEK_DATA ) && defined( SEEK_HOLE )
+	uint8_t is_sparse     = 0;
+	int result            = 0;
+#endif
+
 	if( internal_logical_volume == NULL )
 	{
 		libcerror_error_set(
@@ -1879,7 +4372,12 @@ off64_t libfvde_internal_logical_volume_seek_offset(
 	}
 	if( ( whence != SEEK_CUR )
 	 && ( whence != SEEK_END )
-	 && ( whence != SEEK_SET ) )
+	 && ( whence != SEEK_SET )
+#if defined( SEEK_DATA ) && defined( SEEK_HOLE )
+	 && ( whence != SEEK_DATA )
+	 && ( whence != SEEK_HOLE )
+#endif
+	 )
 	{
 		libcerror_error_set(
 		 error,
@@ -1898,6 +4396,45 @@ off64_t libfvde_internal_logical_volume_seek_offset(
 	{	
 		offset += (off64_t) internal_logical_volume->logical_volume_descriptor->size;
 	}
+#if defined( SEEK_DATA ) && defined( SEEK_HOLE )
+	else if( ( whence == SEEK_DATA )
+	      || ( whence == SEEK_HOLE ) )
+	{
+		if( whence == SEEK_HOLE )
+		{
+			is_sparse = 1;
+		}
+		result = libfvde_internal_logical_volume_get_next_range_offset(
+		          internal_logical_volume,
+		          offset,
+		          is_sparse,
+		          &offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine next range offset.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid offset value out of bounds - no data or hole at or after offset.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif /* defined( SEEK_DATA ) && defined( SEEK_HOLE ) */
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -1924,6 +4461,9 @@ off64_t libfvde_internal_logical_volume_seek_offset(
 }
 
 /* Seeks a certain offset of the data
+ * SEEK_DATA and SEEK_HOLE are supported if defined by the platform, where SEEK_DATA
+ * fails if there is no data at or after the offset and the end of the volume is
+ * considered a hole
  * Returns the offset if seek is successful or -1 on error
  */
 off64_t libfvde_logical_volume_seek_offset(
@@ -1948,6 +4488,19 @@ off64_t libfvde_logical_volume_seek_offset(
 	}
 	internal_logical_volume = (libfvde_internal_logical_volume_t *) logical_volume;
 
+	if( libfvde_internal_logical_volume_open_read_data_on_demand(
+	     internal_logical_volume,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read logical volume data.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_logical_volume->read_write_lock,
@@ -2464,24 +5017,263 @@ int libfvde_logical_volume_get_size(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid logical volume.",
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	internal_logical_volume = (libfvde_internal_logical_volume_t *) logical_volume;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*size = internal_logical_volume->volume_size;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the number of extents
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_logical_volume_get_number_of_extents(
+     libfvde_logical_volume_t *logical_volume,
+     int *number_of_extents,
+     libcerror_error_t **error )
+{
+	libfvde_internal_logical_volume_t *internal_logical_volume = NULL;
+	static char *function                                      = "libfvde_logical_volume_get_number_of_extents";
+	int result                                                 = 1;
+
+	if( logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_extents == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of extents.",
+		 function );
+
+		return( -1 );
+	}
+	internal_logical_volume = (libfvde_internal_logical_volume_t *) logical_volume;
+
+	if( libfvde_internal_logical_volume_open_read_data_on_demand(
+	     internal_logical_volume,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read logical volume data.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_logical_volume->extent_table == NULL )
+	{
+		*number_of_extents = 0;
+	}
+	else if( libfvde_extent_table_get_number_of_extents(
+	          internal_logical_volume->extent_table,
+	          number_of_extents,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of extents from extent table.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves a specific extent
+ * The extent maps a range of the logical volume onto a physical volume
+ * The physical volume index and offset are 0 for sparse extents
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_logical_volume_get_extent_by_index(
+     libfvde_logical_volume_t *logical_volume,
+     int extent_index,
+     off64_t *extent_offset,
+     size64_t *extent_size,
+     int *physical_volume_index,
+     off64_t *physical_volume_offset,
+     uint32_t *extent_flags,
+     libcerror_error_t **error )
+{
+	libfvde_extent_t *extent                                   = NULL;
+	libfvde_internal_logical_volume_t *internal_logical_volume = NULL;
+	static char *function                                      = "libfvde_logical_volume_get_extent_by_index";
+	size64_t safe_extent_size                                  = 0;
+	off64_t safe_extent_offset                                 = 0;
+	uint32_t safe_extent_flags                                 = 0;
+	int result                                                 = 1;
+
+	if( logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent size.",
+		 function );
+
+		return( -1 );
+	}
+	if( physical_volume_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid physical volume index.",
+		 function );
+
+		return( -1 );
+	}
+	if( physical_volume_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid physical volume offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent flags.",
 		 function );
 
 		return( -1 );
 	}
-	if( size == NULL )
+	internal_logical_volume = (libfvde_internal_logical_volume_t *) logical_volume;
+
+	if( libfvde_internal_logical_volume_open_read_data_on_demand(
+	     internal_logical_volume,
+	     error ) == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid size.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read logical volume data.",
 		 function );
 
 		return( -1 );
 	}
-	internal_logical_volume = (libfvde_internal_logical_volume_t *) logical_volume;
-
 #if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_logical_volume->read_write_lock,
@@ -2497,8 +5289,60 @@ int libfvde_logical_volume_get_size(
 		return( -1 );
 	}
 #endif
-	*size = internal_logical_volume->volume_size;
+	if( internal_logical_volume->extent_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid logical volume - missing extent table.",
+		 function );
+
+		result = -1;
+	}
+	else if( libfvde_extent_table_get_extent_by_index(
+	          internal_logical_volume->extent_table,
+	          extent_index,
+	          &extent,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve extent: %d from extent table.",
+		 function,
+		 extent_index );
+
+		result = -1;
+	}
+	else
+	{
+		safe_extent_offset = (off64_t) extent->logical_block_number * internal_logical_volume->extent_table->block_size;
+		safe_extent_size   = (size64_t) extent->number_of_blocks * internal_logical_volume->extent_table->block_size;
 
+		/* The trailing sparse extent is trimmed to the volume size
+		 */
+		if( ( ( extent->range_flags & LIBFVDE_RANGE_FLAG_IS_SPARSE ) != 0 )
+		 && ( (size64_t) safe_extent_offset < internal_logical_volume->volume_size )
+		 && ( safe_extent_size > ( internal_logical_volume->volume_size - (size64_t) safe_extent_offset ) ) )
+		{
+			safe_extent_size = internal_logical_volume->volume_size - (size64_t) safe_extent_offset;
+		}
+		if( ( extent->range_flags & LIBFVDE_RANGE_FLAG_IS_SPARSE ) != 0 )
+		{
+			safe_extent_flags |= LIBFVDE_EXTENT_FLAG_IS_SPARSE;
+		}
+		if( ( extent->range_flags & LIBFVDE_RANGE_FLAG_IS_ENCRYPTED ) != 0 )
+		{
+			safe_extent_flags |= LIBFVDE_EXTENT_FLAG_IS_ENCRYPTED;
+		}
+		*extent_offset          = safe_extent_offset;
+		*extent_size            = safe_extent_size;
+		*physical_volume_index  = (int) extent->physical_volume_index;
+		*physical_volume_offset = (off64_t) extent->physical_block_number * internal_logical_volume->extent_table->block_size;
+		*extent_flags           = safe_extent_flags;
+	}
 #if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
 	     internal_logical_volume->read_write_lock,
@@ -2514,7 +5358,7 @@ int libfvde_logical_volume_get_size(
 		return( -1 );
 	}
 #endif
-	return( 1 );
+	return( result );
 }
 
 /* Determines if the logical volume is locked
@@ -2541,6 +5385,19 @@ int libfvde_logical_volume_is_locked(
 	}
 	internal_logical_volume = (libfvde_internal_logical_volume_t *) logical_volume;
 
+	if( libfvde_internal_logical_volume_open_read_data_on_demand(
+	     internal_logical_volume,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read logical volume data.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_logical_volume->read_write_lock,
@@ -3127,3 +5984,257 @@ int libfvde_logical_volume_set_utf16_recovery_password(
 	return( result );
 }
 
+/* Sets the maximum cache size in bytes
+ * A value of 0 represents the default cache size
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_logical_volume_set_cache_size(
+     libfvde_logical_volume_t *logical_volume,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error )
+{
+	libfvde_internal_logical_volume_t *internal_logical_volume = NULL;
+	static char *function                                      = "libfvde_logical_volume_set_cache_size";
+	size64_t previous_maximum_cache_size                       = 0;
+	uint32_t cache_unit_size_value                             = 0;
+	int result                                                 = 1;
+
+	if( logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_logical_volume = (libfvde_internal_logical_volume_t *) logical_volume;
+
+	if( internal_logical_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid logical volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_logical_volume->sectors_vector != NULL )
+	{
+		previous_maximum_cache_size = internal_logical_volume->maximum_cache_size;
+
+		internal_logical_volume->maximum_cache_size = maximum_cache_size;
+
+		cache_unit_size_value = internal_logical_volume->cache_unit_size;
+
+		if( cache_unit_size_value == 0 )
+		{
+			cache_unit_size_value = internal_logical_volume->io_handle->bytes_per_sector;
+		}
+		result = libfvde_internal_logical_volume_initialize_sectors_cache(
+		          internal_logical_volume,
+		          cache_unit_size_value,
+		          internal_logical_volume->maximum_cache_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize sectors cache.",
+			 function );
+		}
+		else if( result == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: cache unit size not supported by segments of logical volume.",
+			 function );
+
+			result = -1;
+		}
+		if( result != 1 )
+		{
+			internal_logical_volume->maximum_cache_size = previous_maximum_cache_size;
+		}
+	}
+	else
+	{
+		internal_logical_volume->maximum_cache_size = maximum_cache_size;
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Sets the cache unit size in bytes
+ * The cache unit size must be a power of 2 and a multitude of the bytes per sector,
+ * where a value of 0 represents the number of bytes per sector. A cache unit size
+ * larger than the bytes per sector requires the segments to be aligned to it
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_logical_volume_set_cache_unit_size(
+     libfvde_logical_volume_t *logical_volume,
+     uint32_t cache_unit_size,
+     libcerror_error_t **error )
+{
+	libfvde_internal_logical_volume_t *internal_logical_volume = NULL;
+	static char *function                                      = "libfvde_logical_volume_set_cache_unit_size";
+	uint32_t cache_unit_size_value                             = 0;
+	uint32_t previous_cache_unit_size                          = 0;
+	int result                                                 = 1;
+
+	if( logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_logical_volume = (libfvde_internal_logical_volume_t *) logical_volume;
+
+	if( internal_logical_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid logical volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( cache_unit_size != 0 )
+	 && ( ( cache_unit_size < internal_logical_volume->io_handle->bytes_per_sector )
+	  ||  ( cache_unit_size > LIBFVDE_MAXIMUM_CACHE_UNIT_SIZE )
+	  ||  ( ( cache_unit_size & ( cache_unit_size - 1 ) ) != 0 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported cache unit size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_logical_volume->sectors_vector != NULL )
+	{
+		previous_cache_unit_size = internal_logical_volume->cache_unit_size;
+
+		internal_logical_volume->cache_unit_size = cache_unit_size;
+
+		cache_unit_size_value = internal_logical_volume->cache_unit_size;
+
+		if( cache_unit_size_value == 0 )
+		{
+			cache_unit_size_value = internal_logical_volume->io_handle->bytes_per_sector;
+		}
+		result = libfvde_internal_logical_volume_initialize_sectors_cache(
+		          internal_logical_volume,
+		          cache_unit_size_value,
+		          internal_logical_volume->maximum_cache_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize sectors cache.",
+			 function );
+		}
+		else if( result == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: cache unit size not supported by segments of logical volume.",
+			 function );
+
+			result = -1;
+		}
+		if( result != 1 )
+		{
+			internal_logical_volume->cache_unit_size = previous_cache_unit_size;
+		}
+	}
+	else
+	{
+		internal_logical_volume->cache_unit_size = cache_unit_size;
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
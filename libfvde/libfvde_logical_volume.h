@@ -28,6 +28,7 @@
 
 #include "libfvde_encrypted_metadata.h"
 #include "libfvde_encryption_context_plist.h"
+#include "libfvde_extent_table.h"
 #include "libfvde_extern.h"
 #include "libfvde_io_handle.h"
 #include "libfvde_keyring.h"
@@ -37,6 +38,7 @@
 #include "libfvde_libfcache.h"
 #include "libfvde_libfdata.h"
 #include "libfvde_logical_volume_descriptor.h"
+#include "libfvde_sector_cache.h"
 #include "libfvde_types.h"
 #include "libfvde_volume_data_handle.h"
 
@@ -45,6 +47,22 @@ extern "C" {
 #endif
 
 typedef struct libfvde_internal_logical_volume libfvde_internal_logical_volume_t;
+typedef struct libfvde_read_range libfvde_read_range_t;
+
+struct libfvde_read_range
+{
+	/* The offset
+	 */
+	off64_t offset;
+
+	/* The size
+	 */
+	size_t size;
+
+	/* The index of the corresponding buffer
+	 */
+	int buffer_index;
+};
 
 struct libfvde_internal_logical_volume
 {
@@ -80,6 +98,10 @@ struct libfvde_internal_logical_volume
 	 */
 	libfvde_volume_data_handle_t *volume_data_handle;
 
+	/* The extent table
+	 */
+	libfvde_extent_table_t *extent_table;
+
 	/* The sectors vector
 	 */
 	libfdata_vector_t *sectors_vector;
@@ -88,6 +110,46 @@ struct libfvde_internal_logical_volume
 	 */
 	libfcache_cache_t *sectors_cache;
 
+	/* The sharded sectors cache, which is used by positional reads
+	 */
+	libfvde_sector_cache_t *sharded_sectors_cache;
+
+	/* The maximum cache size, where 0 represents the default
+	 */
+	size64_t maximum_cache_size;
+
+	/* The cache unit size, where 0 represents the bytes per sector
+	 */
+	uint32_t cache_unit_size;
+
+	/* The sector data size, which is the cache unit size in use by the sectors vector
+	 */
+	uint32_t sector_data_size;
+
+	/* The offset at which a sequential read is expected to continue
+	 */
+	off64_t read_ahead_offset;
+
+	/* The end offset of the data that was read ahead
+	 */
+	off64_t read_ahead_end_offset;
+
+	/* The read-ahead window size
+	 */
+	size_t read_ahead_size;
+
+	/* The maximum read-ahead window size, where 0 represents read-ahead is disabled
+	 */
+	size_t maximum_read_ahead_size;
+
+	/* The read-ahead buffer
+	 */
+	uint8_t *read_ahead_buffer;
+
+	/* Value to indicate if the logical volume was opened
+	 */
+	uint8_t is_open;
+
 	/* Value to indicate if the logical volume is locked
 	 */
 	uint8_t is_locked;
@@ -142,6 +204,21 @@ int libfvde_internal_logical_volume_open_read(
      libbfio_pool_t *file_io_pool,
      libcerror_error_t **error );
 
+int libfvde_internal_logical_volume_open_read_data(
+     libfvde_internal_logical_volume_t *internal_logical_volume,
+     libbfio_pool_t *file_io_pool,
+     libcerror_error_t **error );
+
+int libfvde_internal_logical_volume_open_read_data_on_demand(
+     libfvde_internal_logical_volume_t *internal_logical_volume,
+     libcerror_error_t **error );
+
+int libfvde_internal_logical_volume_initialize_sectors_cache(
+     libfvde_internal_logical_volume_t *internal_logical_volume,
+     uint32_t cache_unit_size,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error );
+
 int libfvde_internal_logical_volume_open_read_keys(
      libfvde_internal_logical_volume_t *internal_logical_volume,
      libcerror_error_t **error );
@@ -173,6 +250,29 @@ int libfvde_logical_volume_unlock(
      libfvde_logical_volume_t *logical_volume,
      libcerror_error_t **error );
 
+int libfvde_internal_logical_volume_get_segment_at_offset(
+     libfvde_internal_logical_volume_t *internal_logical_volume,
+     off64_t offset,
+     int *file_io_pool_entry,
+     off64_t *file_offset,
+     size64_t *remaining_segment_size,
+     uint32_t *segment_flags,
+     libcerror_error_t **error );
+
+ssize_t libfvde_internal_logical_volume_read_sectors_at_offset(
+         libfvde_internal_logical_volume_t *internal_logical_volume,
+         libbfio_pool_t *file_io_pool,
+         off64_t offset,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
+int libfvde_internal_logical_volume_read_ahead_at_offset(
+     libfvde_internal_logical_volume_t *internal_logical_volume,
+     libbfio_pool_t *file_io_pool,
+     off64_t offset,
+     libcerror_error_t **error );
+
 ssize_t libfvde_internal_logical_volume_read_buffer_from_file_io_pool(
          libfvde_internal_logical_volume_t *internal_logical_volume,
          libbfio_pool_t *file_io_pool,
@@ -195,6 +295,53 @@ ssize_t libfvde_logical_volume_read_buffer_at_offset(
          off64_t offset,
          libcerror_error_t **error );
 
+ssize_t libfvde_internal_logical_volume_pread_buffer_from_file_io_pool(
+         libfvde_internal_logical_volume_t *internal_logical_volume,
+         libbfio_pool_t *file_io_pool,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+ssize_t libfvde_logical_volume_pread_buffer(
+         libfvde_logical_volume_t *logical_volume,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+int libfvde_read_range_compare(
+     const void *first_read_range,
+     const void *second_read_range );
+
+int libfvde_internal_logical_volume_read_buffers_at_offsets_from_file_io_pool(
+     libfvde_internal_logical_volume_t *internal_logical_volume,
+     libbfio_pool_t *file_io_pool,
+     void **buffers,
+     size_t *buffer_sizes,
+     off64_t *offsets,
+     ssize_t *read_counts,
+     int number_of_buffers,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_logical_volume_read_buffers_at_offsets(
+     libfvde_logical_volume_t *logical_volume,
+     void **buffers,
+     size_t *buffer_sizes,
+     off64_t *offsets,
+     ssize_t *read_counts,
+     int number_of_buffers,
+     libcerror_error_t **error );
+
+int libfvde_internal_logical_volume_get_next_range_offset(
+     libfvde_internal_logical_volume_t *internal_logical_volume,
+     off64_t offset,
+     uint8_t is_sparse,
+     off64_t *range_offset,
+     libcerror_error_t **error );
+
 off64_t libfvde_internal_logical_volume_seek_offset(
          libfvde_internal_logical_volume_t *internal_logical_volume,
          off64_t offset,
@@ -253,6 +400,23 @@ int libfvde_logical_volume_get_size(
      size64_t *size,
      libcerror_error_t **error );
 
+LIBFVDE_EXTERN \
+int libfvde_logical_volume_get_number_of_extents(
+     libfvde_logical_volume_t *logical_volume,
+     int *number_of_extents,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_logical_volume_get_extent_by_index(
+     libfvde_logical_volume_t *logical_volume,
+     int extent_index,
+     off64_t *extent_offset,
+     size64_t *extent_size,
+     int *physical_volume_index,
+     off64_t *physical_volume_offset,
+     uint32_t *extent_flags,
+     libcerror_error_t **error );
+
 LIBFVDE_EXTERN \
 int libfvde_logical_volume_is_locked(
      libfvde_logical_volume_t *logical_volume,
@@ -293,6 +457,18 @@ int libfvde_logical_volume_set_utf16_recovery_password(
      size_t utf16_string_length,
      libcerror_error_t **error );
 
+LIBFVDE_EXTERN \
+int libfvde_logical_volume_set_cache_size(
+     libfvde_logical_volume_t *logical_volume,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_logical_volume_set_cache_unit_size(
+     libfvde_logical_volume_t *logical_volume,
+     uint32_t cache_unit_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
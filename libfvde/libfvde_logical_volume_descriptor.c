@@ -172,6 +172,49 @@ int libfvde_logical_volume_descriptor_free(
 	return( result );
 }
 
+/* Compares two logical volume descriptors by their object identifier
+ * Returns LIBCDATA_COMPARE_LESS, LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
+ */
+int libfvde_logical_volume_descriptor_compare(
+     libfvde_logical_volume_descriptor_t *first_logical_volume_descriptor,
+     libfvde_logical_volume_descriptor_t *second_logical_volume_descriptor,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_logical_volume_descriptor_compare";
+
+	if( first_logical_volume_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first logical volume descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( second_logical_volume_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second logical volume descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_logical_volume_descriptor->object_identifier < second_logical_volume_descriptor->object_identifier )
+	{
+		return( LIBCDATA_COMPARE_LESS );
+	}
+	else if( first_logical_volume_descriptor->object_identifier > second_logical_volume_descriptor->object_identifier )
+	{
+		return( LIBCDATA_COMPARE_GREATER );
+	}
+	return( LIBCDATA_COMPARE_EQUAL );
+}
+
 /* Retrieves the identifier
  * The identifier is a UUID and is 16 bytes of size
  * Returns 1 if successful or -1 on error
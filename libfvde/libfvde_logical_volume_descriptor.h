@@ -87,6 +87,11 @@ int libfvde_logical_volume_descriptor_free(
      libfvde_logical_volume_descriptor_t **logical_volume_descriptor,
      libcerror_error_t **error );
 
+int libfvde_logical_volume_descriptor_compare(
+     libfvde_logical_volume_descriptor_t *first_logical_volume_descriptor,
+     libfvde_logical_volume_descriptor_t *second_logical_volume_descriptor,
+     libcerror_error_t **error );
+
 int libfvde_logical_volume_descriptor_get_identifier(
      libfvde_logical_volume_descriptor_t *logical_volume_descriptor,
      uint8_t *uuid_data,
@@ -0,0 +1,1098 @@
+/*
+ * Memory-mapped file IO handle functions
+ *
+ * Copyright (C) 2011-2024, Omar Choudary <choudary.omar@gmail.com>
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include <errno.h>
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_SYS_MMAN_H )
+#include <sys/mman.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "libfvde_libbfio.h"
+#include "libfvde_libcerror.h"
+#include "libfvde_mapped_file_io_handle.h"
+#include "libfvde_unused.h"
+
+#if !defined( O_CLOEXEC )
+#define O_CLOEXEC	0
+#endif
+
+/* Creates a memory-mapped file IO handle
+ * Make sure the value handle is referencing, is set to NULL
+ * The file is mapped into memory when the handle is opened, so that reads are
+ * served from the page cache without a system call per read
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_mapped_file_initialize(
+     libbfio_handle_t **handle,
+     const char *name,
+     size_t name_length,
+     libcerror_error_t **error )
+{
+	libfvde_mapped_file_io_handle_t *file_io_handle = NULL;
+	static char *function                           = "libfvde_mapped_file_initialize";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvde_mapped_file_io_handle_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfvde_mapped_file_io_handle_set_name(
+	     file_io_handle,
+	     name,
+	     name_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set name in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_initialize(
+	     handle,
+	     (intptr_t *) file_io_handle,
+	     (int (*)(intptr_t **, libcerror_error_t **)) libfvde_mapped_file_io_handle_free,
+	     (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) libfvde_mapped_file_io_handle_clone,
+	     (int (*)(intptr_t *, int, libcerror_error_t **)) libfvde_mapped_file_io_handle_open,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libfvde_mapped_file_io_handle_close,
+	     (ssize_t (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) libfvde_mapped_file_io_handle_read_buffer,
+	     (ssize_t (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) libfvde_mapped_file_io_handle_write_buffer,
+	     (off64_t (*)(intptr_t *, off64_t, int, libcerror_error_t **)) libfvde_mapped_file_io_handle_seek_offset,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libfvde_mapped_file_io_handle_exists,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libfvde_mapped_file_io_handle_is_open,
+	     (int (*)(intptr_t *, size64_t *, libcerror_error_t **)) libfvde_mapped_file_io_handle_get_size,
+	     LIBBFIO_FLAG_IO_HANDLE_MANAGED | LIBBFIO_FLAG_IO_HANDLE_CLONE_BY_FUNCTION,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libfvde_mapped_file_io_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Creates a memory-mapped file IO handle
+ * Make sure the value file_io_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_mapped_file_io_handle_initialize(
+     libfvde_mapped_file_io_handle_t **file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_mapped_file_io_handle_initialize";
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file IO handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*file_io_handle = memory_allocate_structure(
+	                   libfvde_mapped_file_io_handle_t );
+
+	if( *file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *file_io_handle,
+	     0,
+	     sizeof( libfvde_mapped_file_io_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *file_io_handle != NULL )
+	{
+		memory_free(
+		 *file_io_handle );
+
+		*file_io_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a memory-mapped file IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_mapped_file_io_handle_free(
+     libfvde_mapped_file_io_handle_t **file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_mapped_file_io_handle_free";
+	int result            = 1;
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_io_handle != NULL )
+	{
+		if( ( *file_io_handle )->is_open != 0 )
+		{
+			if( libfvde_mapped_file_io_handle_close(
+			     *file_io_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close file IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *file_io_handle )->name != NULL )
+		{
+			memory_free(
+			 ( *file_io_handle )->name );
+		}
+		memory_free(
+		 *file_io_handle );
+
+		*file_io_handle = NULL;
+	}
+	return( result );
+}
+
+/* Clones (duplicates) the memory-mapped file IO handle
+ * The clone is not opened
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_mapped_file_io_handle_clone(
+     libfvde_mapped_file_io_handle_t **destination_file_io_handle,
+     libfvde_mapped_file_io_handle_t *source_file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_mapped_file_io_handle_clone";
+
+	if( destination_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination file IO handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_file_io_handle == NULL )
+	{
+		*destination_file_io_handle = NULL;
+
+		return( 1 );
+	}
+	if( libfvde_mapped_file_io_handle_initialize(
+	     destination_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( source_file_io_handle->name != NULL )
+	{
+		if( libfvde_mapped_file_io_handle_set_name(
+		     *destination_file_io_handle,
+		     source_file_io_handle->name,
+		     source_file_io_handle->name_size - 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set name in destination file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( *destination_file_io_handle != NULL )
+	{
+		libfvde_mapped_file_io_handle_free(
+		 destination_file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Sets the name
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_mapped_file_io_handle_set_name(
+     libfvde_mapped_file_io_handle_t *file_io_handle,
+     const char *name,
+     size_t name_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_mapped_file_io_handle_set_name";
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle->is_open != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file IO handle - already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( name_length == 0 )
+	 || ( name_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle->name != NULL )
+	{
+		memory_free(
+		 file_io_handle->name );
+
+		file_io_handle->name      = NULL;
+		file_io_handle->name_size = 0;
+	}
+	file_io_handle->name = narrow_string_allocate(
+	                        name_length + 1 );
+
+	if( file_io_handle->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name.",
+		 function );
+
+		return( -1 );
+	}
+	if( narrow_string_copy(
+	     file_io_handle->name,
+	     name,
+	     name_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy name.",
+		 function );
+
+		memory_free(
+		 file_io_handle->name );
+
+		file_io_handle->name = NULL;
+
+		return( -1 );
+	}
+	( file_io_handle->name )[ name_length ] = 0;
+
+	file_io_handle->name_size = name_length + 1;
+
+	return( 1 );
+}
+
+/* Opens the file and maps it into memory
+ * Only read access is supported
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_mapped_file_io_handle_open(
+     libfvde_mapped_file_io_handle_t *file_io_handle,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_mapped_file_io_handle_open";
+
+#if defined( HAVE_MMAP ) && defined( HAVE_MUNMAP )
+	struct stat file_statistics;
+
+	void *data            = NULL;
+	off_t file_size       = 0;
+	int file_descriptor   = -1;
+#endif
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file IO handle - missing name.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle->is_open != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file IO handle - already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBBFIO_ACCESS_FLAG_READ ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBBFIO_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MMAP ) && defined( HAVE_MUNMAP )
+	file_descriptor = open(
+	                   file_io_handle->name,
+	                   O_RDONLY | O_CLOEXEC );
+
+	if( file_descriptor == -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to open file: %s.",
+		 function,
+		 file_io_handle->name );
+
+		goto on_error;
+	}
+	if( fstat(
+	     file_descriptor,
+	     &file_statistics ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 errno,
+		 "%s: unable to retrieve file statistics.",
+		 function );
+
+		goto on_error;
+	}
+	if( !S_ISREG( file_statistics.st_mode )
+	 && !S_ISBLK( file_statistics.st_mode ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported file type - only regular files and block devices can be mapped: %s.",
+		 function,
+		 file_io_handle->name );
+
+		goto on_error;
+	}
+	/* Use seek instead of stat to also determine the size of a device
+	 */
+	file_size = lseek(
+	             file_descriptor,
+	             0,
+	             SEEK_END );
+
+	if( file_size < 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 errno,
+		 "%s: unable to determine size of file: %s.",
+		 function,
+		 file_io_handle->name );
+
+		goto on_error;
+	}
+	if( (size64_t) file_size > (size64_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	/* An empty file cannot be mapped
+	 */
+	if( file_size > 0 )
+	{
+		data = mmap(
+		        NULL,
+		        (size_t) file_size,
+		        PROT_READ,
+		        MAP_SHARED,
+		        file_descriptor,
+		        0 );
+
+		if( data == MAP_FAILED )
+		{
+			data = NULL;
+
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 errno,
+			 "%s: unable to map file: %s.",
+			 function,
+			 file_io_handle->name );
+
+			goto on_error;
+		}
+#if defined( HAVE_MADVISE ) && defined( MADV_RANDOM )
+		/* Sectors are read in the order in which they miss the sector cache,
+		 * so the kernel should not read ahead around every page fault
+		 */
+		madvise(
+		 data,
+		 (size_t) file_size,
+		 MADV_RANDOM );
+#endif
+	}
+	/* The mapping remains valid after the file descriptor is closed
+	 */
+	if( close(
+	     file_descriptor ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 errno,
+		 "%s: unable to close file: %s.",
+		 function,
+		 file_io_handle->name );
+
+		file_descriptor = -1;
+
+		goto on_error;
+	}
+	file_io_handle->data           = (uint8_t *) data;
+	file_io_handle->data_size      = (size64_t) file_size;
+	file_io_handle->current_offset = 0;
+	file_io_handle->access_flags   = access_flags;
+	file_io_handle->is_open        = 1;
+
+	return( 1 );
+
+on_error:
+	if( data != NULL )
+	{
+		munmap(
+		 data,
+		 (size_t) file_size );
+	}
+	if( file_descriptor != -1 )
+	{
+		close(
+		 file_descriptor );
+	}
+	return( -1 );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: memory-mapped files are not supported.",
+	 function );
+
+	return( -1 );
+#endif /* defined( HAVE_MMAP ) && defined( HAVE_MUNMAP ) */
+}
+
+/* Closes the file and unmaps it from memory
+ * Returns 0 if successful or -1 on error
+ */
+int libfvde_mapped_file_io_handle_close(
+     libfvde_mapped_file_io_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_mapped_file_io_handle_close";
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MMAP ) && defined( HAVE_MUNMAP )
+	if( file_io_handle->data != NULL )
+	{
+		if( munmap(
+		     file_io_handle->data,
+		     (size_t) file_io_handle->data_size ) != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 errno,
+			 "%s: unable to unmap file: %s.",
+			 function,
+			 file_io_handle->name );
+
+			return( -1 );
+		}
+	}
+#endif
+	file_io_handle->data           = NULL;
+	file_io_handle->data_size      = 0;
+	file_io_handle->current_offset = 0;
+	file_io_handle->access_flags   = 0;
+	file_io_handle->is_open        = 0;
+
+	return( 0 );
+}
+
+/* Reads a buffer from the mapped file
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfvde_mapped_file_io_handle_read_buffer(
+         libfvde_mapped_file_io_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	static char *function = "libfvde_mapped_file_io_handle_read_buffer";
+	size_t read_size      = 0;
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) file_io_handle->current_offset >= file_io_handle->data_size )
+	{
+		return( 0 );
+	}
+	read_size = size;
+
+	if( (size64_t) read_size > ( file_io_handle->data_size - file_io_handle->current_offset ) )
+	{
+		read_size = (size_t) ( file_io_handle->data_size - file_io_handle->current_offset );
+	}
+	if( memory_copy(
+	     buffer,
+	     &( ( file_io_handle->data )[ file_io_handle->current_offset ] ),
+	     read_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy mapped data to buffer.",
+		 function );
+
+		return( -1 );
+	}
+	file_io_handle->current_offset += (off64_t) read_size;
+
+	return( (ssize_t) read_size );
+}
+
+/* Writes a buffer to the mapped file
+ * Writing is not supported
+ * Returns the number of bytes written or -1 on error
+ */
+ssize_t libfvde_mapped_file_io_handle_write_buffer(
+         libfvde_mapped_file_io_handle_t *file_io_handle,
+         const uint8_t *buffer LIBFVDE_ATTRIBUTE_UNUSED,
+         size_t size LIBFVDE_ATTRIBUTE_UNUSED,
+         libcerror_error_t **error )
+{
+	static char *function = "libfvde_mapped_file_io_handle_write_buffer";
+
+	LIBFVDE_UNREFERENCED_PARAMETER( buffer )
+	LIBFVDE_UNREFERENCED_PARAMETER( size )
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: write access currently not supported.",
+	 function );
+
+	return( -1 );
+}
+
+/* Seeks a certain offset within the mapped file
+ * Returns the offset if the seek is successful or -1 on error
+ */
+off64_t libfvde_mapped_file_io_handle_seek_offset(
+         libfvde_mapped_file_io_handle_t *file_io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	static char *function = "libfvde_mapped_file_io_handle_seek_offset";
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( whence != SEEK_CUR )
+	 && ( whence != SEEK_END )
+	 && ( whence != SEEK_SET ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
+	if( whence == SEEK_CUR )
+	{
+		offset += file_io_handle->current_offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		offset += (off64_t) file_io_handle->data_size;
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	file_io_handle->current_offset = offset;
+
+	return( offset );
+}
+
+/* Function to determine if a file exists
+ * Returns 1 if file exists, 0 if not or -1 on error
+ */
+int libfvde_mapped_file_io_handle_exists(
+     libfvde_mapped_file_io_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_mapped_file_io_handle_exists";
+
+#if defined( HAVE_STAT )
+	struct stat file_statistics;
+#endif
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file IO handle - missing name.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_STAT )
+	if( stat(
+	     file_io_handle->name,
+	     &file_statistics ) != 0 )
+	{
+		if( errno == ENOENT )
+		{
+			return( 0 );
+		}
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 errno,
+		 "%s: unable to retrieve file statistics.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: memory-mapped files are not supported.",
+	 function );
+
+	return( -1 );
+#endif /* defined( HAVE_STAT ) */
+}
+
+/* Check if the file is open
+ * Returns 1 if open, 0 if not or -1 on error
+ */
+int libfvde_mapped_file_io_handle_is_open(
+     libfvde_mapped_file_io_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_mapped_file_io_handle_is_open";
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle->is_open == 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the file size
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_mapped_file_io_handle_get_size(
+     libfvde_mapped_file_io_handle_t *file_io_handle,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_mapped_file_io_handle_get_size";
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file IO handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	*size = file_io_handle->data_size;
+
+	return( 1 );
+}
+
@@ -0,0 +1,139 @@
+/*
+ * Memory-mapped file IO handle functions
+ *
+ * Copyright (C) 2011-2024, Omar Choudary <choudary.omar@gmail.com>
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFVDE_MAPPED_FILE_IO_HANDLE_H )
+#define _LIBFVDE_MAPPED_FILE_IO_HANDLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfvde_libbfio.h"
+#include "libfvde_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfvde_mapped_file_io_handle libfvde_mapped_file_io_handle_t;
+
+struct libfvde_mapped_file_io_handle
+{
+	/* The name
+	 */
+	char *name;
+
+	/* The name size
+	 */
+	size_t name_size;
+
+	/* The mapped data
+	 */
+	uint8_t *data;
+
+	/* The mapped data size
+	 */
+	size64_t data_size;
+
+	/* The current offset
+	 */
+	off64_t current_offset;
+
+	/* The access flags
+	 */
+	int access_flags;
+
+	/* Value to indicate the file is open
+	 */
+	uint8_t is_open;
+};
+
+int libfvde_mapped_file_initialize(
+     libbfio_handle_t **handle,
+     const char *name,
+     size_t name_length,
+     libcerror_error_t **error );
+
+int libfvde_mapped_file_io_handle_initialize(
+     libfvde_mapped_file_io_handle_t **file_io_handle,
+     libcerror_error_t **error );
+
+int libfvde_mapped_file_io_handle_free(
+     libfvde_mapped_file_io_handle_t **file_io_handle,
+     libcerror_error_t **error );
+
+int libfvde_mapped_file_io_handle_clone(
+     libfvde_mapped_file_io_handle_t **destination_file_io_handle,
+     libfvde_mapped_file_io_handle_t *source_file_io_handle,
+     libcerror_error_t **error );
+
+int libfvde_mapped_file_io_handle_set_name(
+     libfvde_mapped_file_io_handle_t *file_io_handle,
+     const char *name,
+     size_t name_length,
+     libcerror_error_t **error );
+
+int libfvde_mapped_file_io_handle_open(
+     libfvde_mapped_file_io_handle_t *file_io_handle,
+     int access_flags,
+     libcerror_error_t **error );
+
+int libfvde_mapped_file_io_handle_close(
+     libfvde_mapped_file_io_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+ssize_t libfvde_mapped_file_io_handle_read_buffer(
+         libfvde_mapped_file_io_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+ssize_t libfvde_mapped_file_io_handle_write_buffer(
+         libfvde_mapped_file_io_handle_t *file_io_handle,
+         const uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+off64_t libfvde_mapped_file_io_handle_seek_offset(
+         libfvde_mapped_file_io_handle_t *file_io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error );
+
+int libfvde_mapped_file_io_handle_exists(
+     libfvde_mapped_file_io_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libfvde_mapped_file_io_handle_is_open(
+     libfvde_mapped_file_io_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libfvde_mapped_file_io_handle_get_size(
+     libfvde_mapped_file_io_handle_t *file_io_handle,
+     size64_t *size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFVDE_MAPPED_FILE_IO_HANDLE_H ) */
+
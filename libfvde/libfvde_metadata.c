@@ -37,6 +37,7 @@
 #include "libfvde_metadata.h"
 #include "libfvde_metadata_block.h"
 #include "libfvde_physical_volume_descriptor.h"
+#include "libfvde_plist_scanner.h"
 
 #include "fvde_metadata.h"
 
@@ -733,10 +734,10 @@ int libfvde_metadata_read_type_0x0011(
 	return( 1 );
 }
 
-/* Reads the volume group (XML) plist
+/* Reads the volume group (XML) plist using the property list
  * Returns 1 if successful or -1 on error
  */
-int libfvde_metadata_read_volume_group_plist(
+int libfvde_metadata_read_volume_group_property_list(
      libfvde_metadata_t *metadata,
      const uint8_t *xml_plist_data,
      size_t xml_plist_data_size,
@@ -747,7 +748,7 @@ int libfvde_metadata_read_volume_group_plist(
 	libfplist_property_t *sub_property                               = NULL;
 	libfplist_property_list_t *property_list                         = NULL;
 	libfvde_physical_volume_descriptor_t *physical_volume_descriptor = NULL;
-	static char *function                                            = "libfvde_metadata_read_volume_group_plist";
+	static char *function                                            = "libfvde_metadata_read_volume_group_property_list";
 	size_t xml_length                                                = 0;
 	int entry_index                                                  = 0;
 	int number_of_entries                                            = 0;
@@ -1224,6 +1225,431 @@ on_error:
 	return( -1 );
 }
 
+/* Reads the volume group from the root element of the (XML) plist
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_metadata_read_volume_group_root_element(
+     libfvde_metadata_t *metadata,
+     libfvde_plist_scanner_element_t *root_element,
+     libcerror_error_t **error )
+{
+	libfvde_physical_volume_descriptor_t *physical_volume_descriptor = NULL;
+	libfvde_plist_scanner_element_t array_entry_element;
+	libfvde_plist_scanner_element_t sub_element;
+	static char *function                                            = "libfvde_metadata_read_volume_group_root_element";
+	int entry_index                                                  = 0;
+	int number_of_entries                                            = 0;
+	int physical_volume_descriptor_index                             = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	uint8_t *string                                                  = NULL;
+	size_t string_size                                               = 0;
+#endif
+
+	if( metadata == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata.",
+		 function );
+
+		return( -1 );
+	}
+	if( metadata->volume_group_name != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid metadata - volume group name value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvde_plist_scanner_element_get_sub_element_by_key(
+	     root_element,
+	     (uint8_t *) "com.apple.corestorage.lvg.uuid",
+	     30,
+	     &sub_element,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve com.apple.corestorage.lvg.uuid sub element.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		if( libfvde_plist_scanner_element_get_value_string(
+		     &sub_element,
+		     &string,
+		     &string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve logical volume group identifier.",
+			 function );
+
+			goto on_error;
+		}
+		libcnotify_printf(
+		 "%s: logical volume group identifier\t: %s\n",
+		 function,
+		 string );
+
+		memory_free(
+		 string );
+
+		string = NULL;
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	if( libfvde_plist_scanner_element_get_sub_element_by_key(
+	     root_element,
+	     (uint8_t *) "com.apple.corestorage.lvg.name",
+	     30,
+	     &sub_element,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve com.apple.corestorage.lvg.name sub element.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfvde_plist_scanner_element_get_value_string(
+	     &sub_element,
+	     &( metadata->volume_group_name ),
+	     &( metadata->volume_group_name_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve logical volume group name.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: logical volume group name\t\t: %s\n",
+		 function,
+		 metadata->volume_group_name );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	if( libfvde_plist_scanner_element_get_sub_element_by_key(
+	     root_element,
+	     (uint8_t *) "com.apple.corestorage.lvg.physicalVolumes",
+	     41,
+	     &sub_element,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve com.apple.corestorage.lvg.physicalVolumes sub element.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfvde_plist_scanner_element_get_number_of_sub_elements(
+	     &sub_element,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of physical volumes array entries.",
+		 function );
+
+		goto on_error;
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( libfvde_plist_scanner_element_get_sub_element_by_index(
+		     &sub_element,
+		     entry_index,
+		     &array_entry_element,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve physical volumes array entry: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			if( libfvde_plist_scanner_element_get_value_string(
+			     &array_entry_element,
+			     &string,
+			     &string_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve physical volume: %d identifier.",
+				 function,
+				 entry_index );
+
+				goto on_error;
+			}
+			libcnotify_printf(
+			 "%s: physical volume: %d identifier\t\t: %s\n",
+			 function,
+			 entry_index + 1,
+			 string );
+
+			memory_free(
+			 string );
+
+			string = NULL;
+		}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+		if( libfvde_physical_volume_descriptor_initialize(
+		     &physical_volume_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create physical volume: %d descriptor.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( libfvde_plist_scanner_element_value_uuid_string_copy_to_byte_stream(
+		     &array_entry_element,
+		     physical_volume_descriptor->identifier,
+		     16,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unable to copy physical volume: %d identifier string to byte stream.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( libcdata_array_append_entry(
+		     metadata->physical_volume_descriptors,
+		     &physical_volume_descriptor_index,
+		     (intptr_t *) physical_volume_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append physical volume: %d descriptor to array.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		physical_volume_descriptor = NULL;
+	}
+	return( 1 );
+
+on_error:
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( string != NULL )
+	{
+		memory_free(
+		 string );
+	}
+#endif
+	if( physical_volume_descriptor != NULL )
+	{
+		libfvde_physical_volume_descriptor_free(
+		 &physical_volume_descriptor,
+		 NULL );
+	}
+	if( metadata->volume_group_name != NULL )
+	{
+		memory_free(
+		 metadata->volume_group_name );
+
+		metadata->volume_group_name = NULL;
+	}
+	metadata->volume_group_name_size = 0;
+
+	return( -1 );
+}
+
+/* Reads the volume group (XML) plist
+ * The streaming scanner is tried first and XML plist data that the scanner
+ * does not support is read using the property list
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_metadata_read_volume_group_plist(
+     libfvde_metadata_t *metadata,
+     const uint8_t *xml_plist_data,
+     size_t xml_plist_data_size,
+     libcerror_error_t **error )
+{
+	libfvde_plist_scanner_element_t root_element;
+
+	static char *function = "libfvde_metadata_read_volume_group_plist";
+	size_t xml_length     = 0;
+	int result            = 0;
+
+	if( metadata == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata.",
+		 function );
+
+		return( -1 );
+	}
+	if( metadata->volume_group_name != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid metadata - volume group name value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( xml_plist_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML plist data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( xml_plist_data_size < 5 )
+	 || ( xml_plist_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid XML plist data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( xml_plist_data[ 0 ] == (uint8_t) '<' )
+	 && ( xml_plist_data[ 1 ] == (uint8_t) 'd' )
+	 && ( xml_plist_data[ 2 ] == (uint8_t) 'i' )
+	 && ( xml_plist_data[ 3 ] == (uint8_t) 'c' )
+	 && ( xml_plist_data[ 4 ] == (uint8_t) 't' ) )
+	{
+		xml_length = strnlen(
+			      (char *) xml_plist_data,
+		              xml_plist_data_size );
+
+		result = libfvde_plist_scanner_get_root_element(
+		          xml_plist_data,
+		          xml_length,
+		          &root_element,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve root element.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( result != 0 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: XML:\n%s\n",
+			 function,
+			 (char *) xml_plist_data );
+		}
+#endif
+		if( libfvde_metadata_read_volume_group_root_element(
+		     metadata,
+		     &root_element,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read volume group root element.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		if( libfvde_metadata_read_volume_group_property_list(
+		     metadata,
+		     xml_plist_data,
+		     xml_plist_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read volume group property list.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
 /* Reads the metadata
  * Returns 1 if successful or -1 on error
  */
@@ -1436,6 +1862,74 @@ on_error:
 	return( -1 );
 }
 
+/* Reads the transaction identifier from the metadata block header
+ * Only the block header is read, the block data is not validated
+ * Returns 1 if successful, 0 if the block is not a metadata block or -1 on error
+ */
+int libfvde_metadata_read_transaction_identifier_file_io_handle(
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     uint64_t *transaction_identifier,
+     libcerror_error_t **error )
+{
+	uint8_t block_header_data[ sizeof( fvde_metadata_block_header_t ) ];
+
+	static char *function = "libfvde_metadata_read_transaction_identifier_file_io_handle";
+	ssize_t read_count    = 0;
+	uint32_t block_size   = 0;
+	uint16_t block_type   = 0;
+
+	if( transaction_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid transaction identifier.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              block_header_data,
+	              sizeof( fvde_metadata_block_header_t ),
+	              file_offset,
+	              error );
+
+	if( read_count != (ssize_t) sizeof( fvde_metadata_block_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read metadata block header data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 ( (fvde_metadata_block_header_t *) block_header_data )->type,
+	 block_type );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (fvde_metadata_block_header_t *) block_header_data )->block_size,
+	 block_size );
+
+	if( ( block_type != 0x0011 )
+	 || ( block_size != 8192 ) )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (fvde_metadata_block_header_t *) block_header_data )->transaction_identifier,
+	 *transaction_identifier );
+
+	return( 1 );
+}
+
 /* Retrieves the size of the UTF-8 encoded volume group name
  * The returned size includes the end of string character
  * Returns 1 if successful, 0 if not available or -1 on error
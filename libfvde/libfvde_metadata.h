@@ -31,6 +31,7 @@
 #include "libfvde_libcdata.h"
 #include "libfvde_libcerror.h"
 #include "libfvde_physical_volume_descriptor.h"
+#include "libfvde_plist_scanner.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -97,6 +98,17 @@ int libfvde_metadata_read_type_0x0011(
      size_t block_data_size,
      libcerror_error_t **error );
 
+int libfvde_metadata_read_volume_group_property_list(
+     libfvde_metadata_t *metadata,
+     const uint8_t *xml_plist_data,
+     size_t xml_plist_data_size,
+     libcerror_error_t **error );
+
+int libfvde_metadata_read_volume_group_root_element(
+     libfvde_metadata_t *metadata,
+     libfvde_plist_scanner_element_t *root_element,
+     libcerror_error_t **error );
+
 int libfvde_metadata_read_volume_group_plist(
      libfvde_metadata_t *metadata,
      const uint8_t *xml_plist_data,
@@ -110,6 +122,12 @@ int libfvde_metadata_read_file_io_handle(
      off64_t file_offset,
      libcerror_error_t **error );
 
+int libfvde_metadata_read_transaction_identifier_file_io_handle(
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     uint64_t *transaction_identifier,
+     libcerror_error_t **error );
+
 int libfvde_metadata_get_utf8_volume_group_name_size(
      libfvde_metadata_t *metadata,
      size_t *utf8_string_size,
@@ -0,0 +1,1532 @@
+/*
+ * Metadata snapshot functions
+ *
+ * Copyright (C) 2011-2024, Omar Choudary <choudary.omar@gmail.com>
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfvde_checksum.h"
+#include "libfvde_encrypted_metadata.h"
+#include "libfvde_libbfio.h"
+#include "libfvde_libcdata.h"
+#include "libfvde_libcerror.h"
+#include "libfvde_logical_volume_descriptor.h"
+#include "libfvde_metadata.h"
+#include "libfvde_metadata_snapshot.h"
+#include "libfvde_physical_volume_descriptor.h"
+#include "libfvde_segment_descriptor.h"
+
+#include "fvde_metadata_snapshot.h"
+
+/* The metadata snapshot consists of the metadata snapshot header followed by:
+ *   the metadata values (46 bytes), the volume group name, the physical volume identifiers
+ *   (16 bytes each) and the encryption context plist data
+ *   for every logical volume descriptor the logical volume descriptor values (80 bytes),
+ *   the name and the segment descriptors (26 bytes each)
+ */
+
+/* Writes the metadata and encrypted metadata to metadata snapshot data
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_metadata_snapshot_write_data(
+     libfvde_metadata_t *metadata,
+     libfvde_encrypted_metadata_t *encrypted_metadata,
+     const uint8_t *volume_group_identifier,
+     uint8_t **snapshot_data,
+     size_t *snapshot_data_size,
+     libcerror_error_t **error )
+{
+	libfvde_logical_volume_descriptor_t *logical_volume_descriptor   = NULL;
+	libfvde_physical_volume_descriptor_t *physical_volume_descriptor = NULL;
+	libfvde_segment_descriptor_t *segment_descriptor                 = NULL;
+	uint8_t *safe_snapshot_data                                      = NULL;
+	static char *function                                            = "libfvde_metadata_snapshot_write_data";
+	size_t data_offset                                               = 0;
+	size_t data_size                                                 = 0;
+	uint32_t checksum                                                = 0;
+	int logical_volume_descriptor_index                              = 0;
+	int number_of_logical_volume_descriptors                         = 0;
+	int number_of_physical_volume_descriptors                        = 0;
+	int number_of_segment_descriptors                                = 0;
+	int physical_volume_descriptor_index                             = 0;
+	int segment_descriptor_index                                     = 0;
+
+	if( metadata == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata.",
+		 function );
+
+		return( -1 );
+	}
+	if( encrypted_metadata == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid encrypted metadata.",
+		 function );
+
+		return( -1 );
+	}
+	if( volume_group_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume group identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( snapshot_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid snapshot data.",
+		 function );
+
+		return( -1 );
+	}
+	if( *snapshot_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid snapshot data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( snapshot_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid snapshot data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     metadata->physical_volume_descriptors,
+	     &number_of_physical_volume_descriptors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of physical volume descriptors.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_get_number_of_entries(
+	     encrypted_metadata->logical_volume_descriptors,
+	     &number_of_logical_volume_descriptors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of logical volume descriptors.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( metadata->volume_group_name_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	 || ( encrypted_metadata->encryption_context_plist_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid metadata - data size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	data_size = 46
+	          + metadata->volume_group_name_size
+	          + ( (size_t) number_of_physical_volume_descriptors * 16 )
+	          + encrypted_metadata->encryption_context_plist_data_size;
+
+	for( logical_volume_descriptor_index = 0;
+	     logical_volume_descriptor_index < number_of_logical_volume_descriptors;
+	     logical_volume_descriptor_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     encrypted_metadata->logical_volume_descriptors,
+		     logical_volume_descriptor_index,
+		     (intptr_t **) &logical_volume_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve logical volume descriptor: %d.",
+			 function,
+			 logical_volume_descriptor_index );
+
+			goto on_error;
+		}
+		if( logical_volume_descriptor == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing logical volume descriptor: %d.",
+			 function,
+			 logical_volume_descriptor_index );
+
+			goto on_error;
+		}
+		if( libcdata_array_get_number_of_entries(
+		     logical_volume_descriptor->segment_descriptors,
+		     &number_of_segment_descriptors,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of segment descriptors of logical volume descriptor: %d.",
+			 function,
+			 logical_volume_descriptor_index );
+
+			goto on_error;
+		}
+		if( logical_volume_descriptor->name_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid logical volume descriptor: %d - name size value out of bounds.",
+			 function,
+			 logical_volume_descriptor_index );
+
+			goto on_error;
+		}
+		data_size += 80
+		           + logical_volume_descriptor->name_size
+		           + ( (size_t) number_of_segment_descriptors * 26 );
+	}
+	if( data_size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE - sizeof( fvde_metadata_snapshot_header_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid snapshot data size value exceeds maximum allocation size.",
+		 function );
+
+		goto on_error;
+	}
+	safe_snapshot_data = (uint8_t *) memory_allocate(
+	                                  sizeof( fvde_metadata_snapshot_header_t ) + data_size );
+
+	if( safe_snapshot_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create snapshot data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     safe_snapshot_data,
+	     0,
+	     sizeof( fvde_metadata_snapshot_header_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear snapshot header.",
+		 function );
+
+		goto on_error;
+	}
+	data_offset = sizeof( fvde_metadata_snapshot_header_t );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( safe_snapshot_data[ data_offset ] ),
+	 metadata->physical_volume_index );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( safe_snapshot_data[ data_offset + 2 ] ),
+	 metadata->encrypted_metadata_size );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( safe_snapshot_data[ data_offset + 10 ] ),
+	 metadata->encrypted_metadata1_offset );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( safe_snapshot_data[ data_offset + 18 ] ),
+	 metadata->encrypted_metadata1_volume_index );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( safe_snapshot_data[ data_offset + 20 ] ),
+	 metadata->encrypted_metadata2_offset );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( safe_snapshot_data[ data_offset + 28 ] ),
+	 metadata->encrypted_metadata2_volume_index );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( safe_snapshot_data[ data_offset + 30 ] ),
+	 (uint32_t) metadata->volume_group_name_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( safe_snapshot_data[ data_offset + 34 ] ),
+	 (uint32_t) number_of_physical_volume_descriptors );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( safe_snapshot_data[ data_offset + 38 ] ),
+	 (uint32_t) encrypted_metadata->encryption_context_plist_data_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( safe_snapshot_data[ data_offset + 42 ] ),
+	 (uint32_t) number_of_logical_volume_descriptors );
+
+	data_offset += 46;
+
+	if( metadata->volume_group_name_size > 0 )
+	{
+		if( memory_copy(
+		     &( safe_snapshot_data[ data_offset ] ),
+		     metadata->volume_group_name,
+		     metadata->volume_group_name_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy volume group name.",
+			 function );
+
+			goto on_error;
+		}
+		data_offset += metadata->volume_group_name_size;
+	}
+	for( physical_volume_descriptor_index = 0;
+	     physical_volume_descriptor_index < number_of_physical_volume_descriptors;
+	     physical_volume_descriptor_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     metadata->physical_volume_descriptors,
+		     physical_volume_descriptor_index,
+		     (intptr_t **) &physical_volume_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve physical volume descriptor: %d.",
+			 function,
+			 physical_volume_descriptor_index );
+
+			goto on_error;
+		}
+		if( physical_volume_descriptor == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing physical volume descriptor: %d.",
+			 function,
+			 physical_volume_descriptor_index );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     &( safe_snapshot_data[ data_offset ] ),
+		     physical_volume_descriptor->identifier,
+		     16 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy physical volume descriptor: %d identifier.",
+			 function,
+			 physical_volume_descriptor_index );
+
+			goto on_error;
+		}
+		data_offset += 16;
+	}
+	if( encrypted_metadata->encryption_context_plist_data_size > 0 )
+	{
+		if( memory_copy(
+		     &( safe_snapshot_data[ data_offset ] ),
+		     encrypted_metadata->encryption_context_plist_data,
+		     encrypted_metadata->encryption_context_plist_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy encryption context plist data.",
+			 function );
+
+			goto on_error;
+		}
+		data_offset += encrypted_metadata->encryption_context_plist_data_size;
+	}
+	for( logical_volume_descriptor_index = 0;
+	     logical_volume_descriptor_index < number_of_logical_volume_descriptors;
+	     logical_volume_descriptor_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     encrypted_metadata->logical_volume_descriptors,
+		     logical_volume_descriptor_index,
+		     (intptr_t **) &logical_volume_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve logical volume descriptor: %d.",
+			 function,
+			 logical_volume_descriptor_index );
+
+			goto on_error;
+		}
+		if( libcdata_array_get_number_of_entries(
+		     logical_volume_descriptor->segment_descriptors,
+		     &number_of_segment_descriptors,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of segment descriptors of logical volume descriptor: %d.",
+			 function,
+			 logical_volume_descriptor_index );
+
+			goto on_error;
+		}
+		byte_stream_copy_from_uint64_little_endian(
+		 &( safe_snapshot_data[ data_offset ] ),
+		 logical_volume_descriptor->object_identifier );
+
+		if( memory_copy(
+		     &( safe_snapshot_data[ data_offset + 8 ] ),
+		     logical_volume_descriptor->identifier,
+		     16 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy logical volume descriptor: %d identifier.",
+			 function,
+			 logical_volume_descriptor_index );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     &( safe_snapshot_data[ data_offset + 24 ] ),
+		     logical_volume_descriptor->family_identifier,
+		     16 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy logical volume descriptor: %d family identifier.",
+			 function,
+			 logical_volume_descriptor_index );
+
+			goto on_error;
+		}
+		byte_stream_copy_from_uint64_little_endian(
+		 &( safe_snapshot_data[ data_offset + 40 ] ),
+		 logical_volume_descriptor->size );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( safe_snapshot_data[ data_offset + 48 ] ),
+		 logical_volume_descriptor->object_identifier_0x0305 );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( safe_snapshot_data[ data_offset + 56 ] ),
+		 logical_volume_descriptor->object_identifier_0x0505 );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( safe_snapshot_data[ data_offset + 64 ] ),
+		 logical_volume_descriptor->base_physical_block_number );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( safe_snapshot_data[ data_offset + 72 ] ),
+		 (uint32_t) logical_volume_descriptor->name_size );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( safe_snapshot_data[ data_offset + 76 ] ),
+		 (uint32_t) number_of_segment_descriptors );
+
+		data_offset += 80;
+
+		if( logical_volume_descriptor->name_size > 0 )
+		{
+			if( memory_copy(
+			     &( safe_snapshot_data[ data_offset ] ),
+			     logical_volume_descriptor->name,
+			     logical_volume_descriptor->name_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy logical volume descriptor: %d name.",
+				 function,
+				 logical_volume_descriptor_index );
+
+				goto on_error;
+			}
+			data_offset += logical_volume_descriptor->name_size;
+		}
+		for( segment_descriptor_index = 0;
+		     segment_descriptor_index < number_of_segment_descriptors;
+		     segment_descriptor_index++ )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     logical_volume_descriptor->segment_descriptors,
+			     segment_descriptor_index,
+			     (intptr_t **) &segment_descriptor,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve segment descriptor: %d of logical volume descriptor: %d.",
+				 function,
+				 segment_descriptor_index,
+				 logical_volume_descriptor_index );
+
+				goto on_error;
+			}
+			if( segment_descriptor == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing segment descriptor: %d of logical volume descriptor: %d.",
+				 function,
+				 segment_descriptor_index,
+				 logical_volume_descriptor_index );
+
+				goto on_error;
+			}
+			byte_stream_copy_from_uint64_little_endian(
+			 &( safe_snapshot_data[ data_offset ] ),
+			 segment_descriptor->logical_block_number );
+
+			byte_stream_copy_from_uint64_little_endian(
+			 &( safe_snapshot_data[ data_offset + 8 ] ),
+			 segment_descriptor->number_of_blocks );
+
+			byte_stream_copy_from_uint64_little_endian(
+			 &( safe_snapshot_data[ data_offset + 16 ] ),
+			 segment_descriptor->physical_block_number );
+
+			byte_stream_copy_from_uint16_little_endian(
+			 &( safe_snapshot_data[ data_offset + 24 ] ),
+			 segment_descriptor->physical_volume_index );
+
+			data_offset += 26;
+		}
+	}
+	if( libfvde_checksum_calculate_weak_crc32(
+	     &checksum,
+	     &( safe_snapshot_data[ sizeof( fvde_metadata_snapshot_header_t ) ] ),
+	     data_size,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate checksum.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     ( (fvde_metadata_snapshot_header_t *) safe_snapshot_data )->signature,
+	     "fvdesnap",
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (fvde_metadata_snapshot_header_t *) safe_snapshot_data )->format_version,
+	 1 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (fvde_metadata_snapshot_header_t *) safe_snapshot_data )->data_size,
+	 (uint32_t) data_size );
+
+	if( memory_copy(
+	     ( (fvde_metadata_snapshot_header_t *) safe_snapshot_data )->volume_group_identifier,
+	     volume_group_identifier,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy volume group identifier.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (fvde_metadata_snapshot_header_t *) safe_snapshot_data )->transaction_identifier,
+	 metadata->transaction_identifier );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (fvde_metadata_snapshot_header_t *) safe_snapshot_data )->checksum,
+	 checksum );
+
+	*snapshot_data      = safe_snapshot_data;
+	*snapshot_data_size = sizeof( fvde_metadata_snapshot_header_t ) + data_size;
+
+	return( 1 );
+
+on_error:
+	if( safe_snapshot_data != NULL )
+	{
+		memory_free(
+		 safe_snapshot_data );
+	}
+	return( -1 );
+}
+
+/* Reads the metadata and encrypted metadata from metadata snapshot data
+ * The snapshot is only used if it matches the volume group identifier, the physical volume
+ * identifier and the (metadata) transaction identifier, otherwise 0 is returned
+ * The metadata and encrypted metadata values are only valid if 1 is returned
+ * Returns 1 if successful, 0 if the snapshot does not match or -1 on error
+ */
+int libfvde_metadata_snapshot_read_data(
+     libfvde_metadata_t *metadata,
+     libfvde_encrypted_metadata_t *encrypted_metadata,
+     const uint8_t *volume_group_identifier,
+     const uint8_t *physical_volume_identifier,
+     uint64_t transaction_identifier,
+     const uint8_t *snapshot_data,
+     size_t snapshot_data_size,
+     libcerror_error_t **error )
+{
+	libfvde_logical_volume_descriptor_t *logical_volume_descriptor   = NULL;
+	libfvde_physical_volume_descriptor_t *physical_volume_descriptor = NULL;
+	libfvde_segment_descriptor_t *segment_descriptor                 = NULL;
+	static char *function                                            = "libfvde_metadata_snapshot_read_data";
+	size_t data_offset                                               = 0;
+	size_t data_size                                                 = 0;
+	size_t encryption_context_plist_data_size                        = 0;
+	uint64_t snapshot_transaction_identifier                         = 0;
+	uint32_t calculated_checksum                                     = 0;
+	uint32_t format_version                                          = 0;
+	uint32_t number_of_logical_volume_descriptors                    = 0;
+	uint32_t number_of_physical_volume_descriptors                   = 0;
+	uint32_t number_of_segment_descriptors                           = 0;
+	uint32_t stored_checksum                                         = 0;
+	uint32_t value_32bit                                             = 0;
+	uint32_t logical_volume_descriptor_index                         = 0;
+	uint32_t physical_volume_descriptor_index                        = 0;
+	uint32_t segment_descriptor_index                                = 0;
+	int entry_index                                                  = 0;
+	int physical_volume_identifier_found                             = 0;
+
+	if( metadata == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata.",
+		 function );
+
+		return( -1 );
+	}
+	if( metadata->volume_group_name != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid metadata - volume group name value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( encrypted_metadata == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid encrypted metadata.",
+		 function );
+
+		return( -1 );
+	}
+	if( encrypted_metadata->encryption_context_plist_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid encrypted metadata - encryption context plist data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( volume_group_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume group identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( physical_volume_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid physical volume identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( snapshot_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid snapshot data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( snapshot_data_size < sizeof( fvde_metadata_snapshot_header_t ) )
+	 || ( snapshot_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid snapshot data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_compare(
+	     ( (fvde_metadata_snapshot_header_t *) snapshot_data )->signature,
+	     "fvdesnap",
+	     8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (fvde_metadata_snapshot_header_t *) snapshot_data )->format_version,
+	 format_version );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (fvde_metadata_snapshot_header_t *) snapshot_data )->data_size,
+	 value_32bit );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (fvde_metadata_snapshot_header_t *) snapshot_data )->transaction_identifier,
+	 snapshot_transaction_identifier );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (fvde_metadata_snapshot_header_t *) snapshot_data )->checksum,
+	 stored_checksum );
+
+	if( format_version != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format version: %" PRIu32 ".",
+		 function,
+		 format_version );
+
+		return( -1 );
+	}
+	data_size = (size_t) value_32bit;
+
+	if( data_size != ( snapshot_data_size - sizeof( fvde_metadata_snapshot_header_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The key is validated before the data is parsed
+	 */
+	if( memory_compare(
+	     ( (fvde_metadata_snapshot_header_t *) snapshot_data )->volume_group_identifier,
+	     volume_group_identifier,
+	     16 ) != 0 )
+	{
+		return( 0 );
+	}
+	if( snapshot_transaction_identifier != transaction_identifier )
+	{
+		return( 0 );
+	}
+	if( libfvde_checksum_calculate_weak_crc32(
+	     &calculated_checksum,
+	     &( snapshot_data[ sizeof( fvde_metadata_snapshot_header_t ) ] ),
+	     data_size,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( stored_checksum != calculated_checksum )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+		 "%s: mismatch in checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).",
+		 function,
+		 stored_checksum,
+		 calculated_checksum );
+
+		return( -1 );
+	}
+	data_offset = sizeof( fvde_metadata_snapshot_header_t );
+
+	if( ( snapshot_data_size - data_offset ) < 46 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid snapshot data size value too small.",
+		 function );
+
+		goto on_error;
+	}
+	metadata->transaction_identifier = snapshot_transaction_identifier;
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( snapshot_data[ data_offset ] ),
+	 metadata->physical_volume_index );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( snapshot_data[ data_offset + 2 ] ),
+	 metadata->encrypted_metadata_size );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( snapshot_data[ data_offset + 10 ] ),
+	 metadata->encrypted_metadata1_offset );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( snapshot_data[ data_offset + 18 ] ),
+	 metadata->encrypted_metadata1_volume_index );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( snapshot_data[ data_offset + 20 ] ),
+	 metadata->encrypted_metadata2_offset );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( snapshot_data[ data_offset + 28 ] ),
+	 metadata->encrypted_metadata2_volume_index );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( snapshot_data[ data_offset + 30 ] ),
+	 value_32bit );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( snapshot_data[ data_offset + 34 ] ),
+	 number_of_physical_volume_descriptors );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( snapshot_data[ data_offset + 38 ] ),
+	 encryption_context_plist_data_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( snapshot_data[ data_offset + 42 ] ),
+	 number_of_logical_volume_descriptors );
+
+	data_offset += 46;
+
+	if( (size_t) value_32bit > ( snapshot_data_size - data_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid volume group name size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( value_32bit > 0 )
+	{
+		metadata->volume_group_name = (uint8_t *) memory_allocate(
+		                                           sizeof( uint8_t ) * value_32bit );
+
+		if( metadata->volume_group_name == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create volume group name.",
+			 function );
+
+			goto on_error;
+		}
+		metadata->volume_group_name_size = (size_t) value_32bit;
+
+		if( memory_copy(
+		     metadata->volume_group_name,
+		     &( snapshot_data[ data_offset ] ),
+		     metadata->volume_group_name_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy volume group name.",
+			 function );
+
+			goto on_error;
+		}
+		data_offset += metadata->volume_group_name_size;
+	}
+	if( (size_t) number_of_physical_volume_descriptors > ( ( snapshot_data_size - data_offset ) / 16 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of physical volume descriptors value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	for( physical_volume_descriptor_index = 0;
+	     physical_volume_descriptor_index < number_of_physical_volume_descriptors;
+	     physical_volume_descriptor_index++ )
+	{
+		if( libfvde_physical_volume_descriptor_initialize(
+		     &physical_volume_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create physical volume: %" PRIu32 " descriptor.",
+			 function,
+			 physical_volume_descriptor_index );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     physical_volume_descriptor->identifier,
+		     &( snapshot_data[ data_offset ] ),
+		     16 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy physical volume: %" PRIu32 " identifier.",
+			 function,
+			 physical_volume_descriptor_index );
+
+			goto on_error;
+		}
+		if( memory_compare(
+		     physical_volume_descriptor->identifier,
+		     physical_volume_identifier,
+		     16 ) == 0 )
+		{
+			physical_volume_identifier_found = 1;
+		}
+		if( libcdata_array_append_entry(
+		     metadata->physical_volume_descriptors,
+		     &entry_index,
+		     (intptr_t *) physical_volume_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append physical volume: %" PRIu32 " descriptor to array.",
+			 function,
+			 physical_volume_descriptor_index );
+
+			goto on_error;
+		}
+		physical_volume_descriptor = NULL;
+
+		data_offset += 16;
+	}
+	if( physical_volume_identifier_found == 0 )
+	{
+		return( 0 );
+	}
+	if( encryption_context_plist_data_size > ( snapshot_data_size - data_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid encryption context plist data size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( encryption_context_plist_data_size > 0 )
+	{
+		encrypted_metadata->encryption_context_plist_data = (uint8_t *) memory_allocate(
+		                                                                 sizeof( uint8_t ) * encryption_context_plist_data_size );
+
+		if( encrypted_metadata->encryption_context_plist_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create encryption context plist data.",
+			 function );
+
+			goto on_error;
+		}
+		encrypted_metadata->encryption_context_plist_data_size = encryption_context_plist_data_size;
+
+		if( memory_copy(
+		     encrypted_metadata->encryption_context_plist_data,
+		     &( snapshot_data[ data_offset ] ),
+		     encryption_context_plist_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy encryption context plist data.",
+			 function );
+
+			goto on_error;
+		}
+		data_offset += encryption_context_plist_data_size;
+	}
+	for( logical_volume_descriptor_index = 0;
+	     logical_volume_descriptor_index < number_of_logical_volume_descriptors;
+	     logical_volume_descriptor_index++ )
+	{
+		if( ( snapshot_data_size - data_offset ) < 80 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid logical volume descriptor: %" PRIu32 " data size value out of bounds.",
+			 function,
+			 logical_volume_descriptor_index );
+
+			goto on_error;
+		}
+		if( libfvde_logical_volume_descriptor_initialize(
+		     &logical_volume_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create logical volume descriptor: %" PRIu32 ".",
+			 function,
+			 logical_volume_descriptor_index );
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint64_little_endian(
+		 &( snapshot_data[ data_offset ] ),
+		 logical_volume_descriptor->object_identifier );
+
+		if( memory_copy(
+		     logical_volume_descriptor->identifier,
+		     &( snapshot_data[ data_offset + 8 ] ),
+		     16 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy logical volume descriptor: %" PRIu32 " identifier.",
+			 function,
+			 logical_volume_descriptor_index );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     logical_volume_descriptor->family_identifier,
+		     &( snapshot_data[ data_offset + 24 ] ),
+		     16 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy logical volume descriptor: %" PRIu32 " family identifier.",
+			 function,
+			 logical_volume_descriptor_index );
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint64_little_endian(
+		 &( snapshot_data[ data_offset + 40 ] ),
+		 logical_volume_descriptor->size );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 &( snapshot_data[ data_offset + 48 ] ),
+		 logical_volume_descriptor->object_identifier_0x0305 );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 &( snapshot_data[ data_offset + 56 ] ),
+		 logical_volume_descriptor->object_identifier_0x0505 );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 &( snapshot_data[ data_offset + 64 ] ),
+		 logical_volume_descriptor->base_physical_block_number );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( snapshot_data[ data_offset + 72 ] ),
+		 value_32bit );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( snapshot_data[ data_offset + 76 ] ),
+		 number_of_segment_descriptors );
+
+		data_offset += 80;
+
+		if( (size_t) value_32bit > ( snapshot_data_size - data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid logical volume descriptor: %" PRIu32 " name size value out of bounds.",
+			 function,
+			 logical_volume_descriptor_index );
+
+			goto on_error;
+		}
+		if( value_32bit > 0 )
+		{
+			logical_volume_descriptor->name = (uint8_t *) memory_allocate(
+			                                               sizeof( uint8_t ) * value_32bit );
+
+			if( logical_volume_descriptor->name == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create logical volume descriptor: %" PRIu32 " name.",
+				 function,
+				 logical_volume_descriptor_index );
+
+				goto on_error;
+			}
+			logical_volume_descriptor->name_size = (size_t) value_32bit;
+
+			if( memory_copy(
+			     logical_volume_descriptor->name,
+			     &( snapshot_data[ data_offset ] ),
+			     logical_volume_descriptor->name_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy logical volume descriptor: %" PRIu32 " name.",
+				 function,
+				 logical_volume_descriptor_index );
+
+				goto on_error;
+			}
+			data_offset += logical_volume_descriptor->name_size;
+		}
+		if( (size_t) number_of_segment_descriptors > ( ( snapshot_data_size - data_offset ) / 26 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid logical volume descriptor: %" PRIu32 " number of segment descriptors value out of bounds.",
+			 function,
+			 logical_volume_descriptor_index );
+
+			goto on_error;
+		}
+		for( segment_descriptor_index = 0;
+		     segment_descriptor_index < number_of_segment_descriptors;
+		     segment_descriptor_index++ )
+		{
+			if( libfvde_segment_descriptor_initialize(
+			     &segment_descriptor,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create segment descriptor: %" PRIu32 ".",
+				 function,
+				 segment_descriptor_index );
+
+				goto on_error;
+			}
+			byte_stream_copy_to_uint64_little_endian(
+			 &( snapshot_data[ data_offset ] ),
+			 segment_descriptor->logical_block_number );
+
+			byte_stream_copy_to_uint64_little_endian(
+			 &( snapshot_data[ data_offset + 8 ] ),
+			 segment_descriptor->number_of_blocks );
+
+			byte_stream_copy_to_uint64_little_endian(
+			 &( snapshot_data[ data_offset + 16 ] ),
+			 segment_descriptor->physical_block_number );
+
+			byte_stream_copy_to_uint16_little_endian(
+			 &( snapshot_data[ data_offset + 24 ] ),
+			 segment_descriptor->physical_volume_index );
+
+			if( libcdata_array_append_entry(
+			     logical_volume_descriptor->segment_descriptors,
+			     &entry_index,
+			     (intptr_t *) segment_descriptor,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append segment descriptor: %" PRIu32 " to array.",
+				 function,
+				 segment_descriptor_index );
+
+				goto on_error;
+			}
+			segment_descriptor = NULL;
+
+			data_offset += 26;
+		}
+		if( libfvde_encrypted_metadata_append_logical_volume_descriptor(
+		     encrypted_metadata,
+		     &logical_volume_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append logical volume descriptor: %" PRIu32 ".",
+			 function,
+			 logical_volume_descriptor_index );
+
+			goto on_error;
+		}
+	}
+	if( data_offset != snapshot_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid snapshot data size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( segment_descriptor != NULL )
+	{
+		libfvde_segment_descriptor_free(
+		 &segment_descriptor,
+		 NULL );
+	}
+	if( logical_volume_descriptor != NULL )
+	{
+		libfvde_logical_volume_descriptor_free(
+		 &logical_volume_descriptor,
+		 NULL );
+	}
+	if( physical_volume_descriptor != NULL )
+	{
+		libfvde_physical_volume_descriptor_free(
+		 &physical_volume_descriptor,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Writes the metadata and encrypted metadata to a metadata snapshot file
+ * The file IO handle must be opened for writing
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_metadata_snapshot_write_file_io_handle(
+     libfvde_metadata_t *metadata,
+     libfvde_encrypted_metadata_t *encrypted_metadata,
+     const uint8_t *volume_group_identifier,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	uint8_t *snapshot_data    = NULL;
+	static char *function     = "libfvde_metadata_snapshot_write_file_io_handle";
+	size_t snapshot_data_size = 0;
+	ssize_t write_count       = 0;
+
+	if( libfvde_metadata_snapshot_write_data(
+	     metadata,
+	     encrypted_metadata,
+	     volume_group_identifier,
+	     &snapshot_data,
+	     &snapshot_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write metadata snapshot data.",
+		 function );
+
+		goto on_error;
+	}
+	write_count = libbfio_handle_write_buffer_at_offset(
+	               file_io_handle,
+	               snapshot_data,
+	               snapshot_data_size,
+	               0,
+	               error );
+
+	if( write_count != (ssize_t) snapshot_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write metadata snapshot data.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 snapshot_data );
+
+	return( 1 );
+
+on_error:
+	if( snapshot_data != NULL )
+	{
+		memory_free(
+		 snapshot_data );
+	}
+	return( -1 );
+}
+
+/* Reads the metadata and encrypted metadata from a metadata snapshot file
+ * The metadata and encrypted metadata values are only valid if 1 is returned
+ * Returns 1 if successful, 0 if the snapshot does not match or -1 on error
+ */
+int libfvde_metadata_snapshot_read_file_io_handle(
+     libfvde_metadata_t *metadata,
+     libfvde_encrypted_metadata_t *encrypted_metadata,
+     const uint8_t *volume_group_identifier,
+     const uint8_t *physical_volume_identifier,
+     uint64_t transaction_identifier,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	uint8_t *snapshot_data = NULL;
+	static char *function  = "libfvde_metadata_snapshot_read_file_io_handle";
+	size64_t file_size     = 0;
+	ssize_t read_count     = 0;
+	int result             = 0;
+
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( file_size < (size64_t) sizeof( fvde_metadata_snapshot_header_t ) )
+	 || ( file_size > (size64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	snapshot_data = (uint8_t *) memory_allocate(
+	                             sizeof( uint8_t ) * (size_t) file_size );
+
+	if( snapshot_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create snapshot data.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              snapshot_data,
+	              (size_t) file_size,
+	              0,
+	              error );
+
+	if( read_count != (ssize_t) file_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read metadata snapshot data.",
+		 function );
+
+		goto on_error;
+	}
+	result = libfvde_metadata_snapshot_read_data(
+	          metadata,
+	          encrypted_metadata,
+	          volume_group_identifier,
+	          physical_volume_identifier,
+	          transaction_identifier,
+	          snapshot_data,
+	          (size_t) file_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read metadata snapshot data.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 snapshot_data );
+
+	return( result );
+
+on_error:
+	if( snapshot_data != NULL )
+	{
+		memory_free(
+		 snapshot_data );
+	}
+	return( -1 );
+}
@@ -0,0 +1,76 @@
+/*
+ * Metadata snapshot functions
+ *
+ * Copyright (C) 2011-2024, Omar Choudary <choudary.omar@gmail.com>
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFVDE_METADATA_SNAPSHOT_H )
+#define _LIBFVDE_METADATA_SNAPSHOT_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfvde_encrypted_metadata.h"
+#include "libfvde_libbfio.h"
+#include "libfvde_libcerror.h"
+#include "libfvde_metadata.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+int libfvde_metadata_snapshot_write_data(
+     libfvde_metadata_t *metadata,
+     libfvde_encrypted_metadata_t *encrypted_metadata,
+     const uint8_t *volume_group_identifier,
+     uint8_t **snapshot_data,
+     size_t *snapshot_data_size,
+     libcerror_error_t **error );
+
+int libfvde_metadata_snapshot_read_data(
+     libfvde_metadata_t *metadata,
+     libfvde_encrypted_metadata_t *encrypted_metadata,
+     const uint8_t *volume_group_identifier,
+     const uint8_t *physical_volume_identifier,
+     uint64_t transaction_identifier,
+     const uint8_t *snapshot_data,
+     size_t snapshot_data_size,
+     libcerror_error_t **error );
+
+int libfvde_metadata_snapshot_write_file_io_handle(
+     libfvde_metadata_t *metadata,
+     libfvde_encrypted_metadata_t *encrypted_metadata,
+     const uint8_t *volume_group_identifier,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libfvde_metadata_snapshot_read_file_io_handle(
+     libfvde_metadata_t *metadata,
+     libfvde_encrypted_metadata_t *encrypted_metadata,
+     const uint8_t *volume_group_identifier,
+     const uint8_t *physical_volume_identifier,
+     uint64_t transaction_identifier,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFVDE_METADATA_SNAPSHOT_H ) */
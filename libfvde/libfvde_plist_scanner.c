@@ -0,0 +1,1622 @@
+/*
+ * Streaming XML plist scanner functions
+ *
+ * Copyright (C) 2011-2024, Omar Choudary <choudary.omar@gmail.com>
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfvde_libcerror.h"
+#include "libfvde_libuna.h"
+#include "libfvde_plist_scanner.h"
+
+#define libfvde_plist_scanner_is_whitespace( character ) \
+	( ( character == (uint8_t) ' ' ) \
+	 || ( character == (uint8_t) '\t' ) \
+	 || ( character == (uint8_t) '\n' ) \
+	 || ( character == (uint8_t) '\r' ) )
+
+/* Reads a tag
+ * The data offset must point to the start of the tag and is set to the offset after the tag
+ * Returns 1 if successful, 0 if the tag is not supported or -1 on error
+ */
+int libfvde_plist_scanner_read_tag(
+     const uint8_t *data,
+     size_t data_size,
+     size_t *data_offset,
+     uint8_t *tag_type,
+     size_t *name_offset,
+     size_t *name_length,
+     libcerror_error_t **error )
+{
+	static char *function    = "libfvde_plist_scanner_read_tag";
+	size_t safe_data_offset  = 0;
+	size_t safe_name_offset  = 0;
+	uint8_t character        = 0;
+	uint8_t quote_character  = 0;
+	uint8_t safe_tag_type    = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( *data_offset >= data_size )
+	 || ( data[ *data_offset ] != (uint8_t) '<' ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( tag_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tag type.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name length.",
+		 function );
+
+		return( -1 );
+	}
+	safe_data_offset = *data_offset + 1;
+
+	if( safe_data_offset >= data_size )
+	{
+		return( 0 );
+	}
+	character = data[ safe_data_offset ];
+
+	/* Comments, CDATA sections and processing instructions are left to the DOM parser
+	 */
+	if( ( character == (uint8_t) '!' )
+	 || ( character == (uint8_t) '?' ) )
+	{
+		return( 0 );
+	}
+	if( character == (uint8_t) '/' )
+	{
+		safe_tag_type     = LIBFVDE_PLIST_SCANNER_TAG_TYPE_END;
+		safe_data_offset += 1;
+	}
+	else
+	{
+		safe_tag_type = LIBFVDE_PLIST_SCANNER_TAG_TYPE_START;
+	}
+	safe_name_offset = safe_data_offset;
+
+	while( safe_data_offset < data_size )
+	{
+		character = data[ safe_data_offset ];
+
+		if( ( character == (uint8_t) '>' )
+		 || ( character == (uint8_t) '/' )
+		 || libfvde_plist_scanner_is_whitespace( character ) )
+		{
+			break;
+		}
+		if( ( character == 0 )
+		 || ( character == (uint8_t) '<' ) )
+		{
+			return( 0 );
+		}
+		safe_data_offset++;
+	}
+	if( safe_data_offset == safe_name_offset )
+	{
+		return( 0 );
+	}
+	*name_length = safe_data_offset - safe_name_offset;
+
+	while( safe_data_offset < data_size )
+	{
+		character = data[ safe_data_offset ];
+
+		if( ( character == 0 )
+		 || ( character == (uint8_t) '<' ) )
+		{
+			return( 0 );
+		}
+		if( quote_character != 0 )
+		{
+			if( character == quote_character )
+			{
+				quote_character = 0;
+			}
+		}
+		else if( character == (uint8_t) '>' )
+		{
+			break;
+		}
+		else if( safe_tag_type == LIBFVDE_PLIST_SCANNER_TAG_TYPE_END )
+		{
+			if( !libfvde_plist_scanner_is_whitespace( character ) )
+			{
+				return( 0 );
+			}
+		}
+		else if( ( character == (uint8_t) '"' )
+		      || ( character == (uint8_t) '\'' ) )
+		{
+			quote_character = character;
+		}
+		else if( character == (uint8_t) '/' )
+		{
+			if( ( ( safe_data_offset + 1 ) >= data_size )
+			 || ( data[ safe_data_offset + 1 ] != (uint8_t) '>' ) )
+			{
+				return( 0 );
+			}
+			safe_tag_type     = LIBFVDE_PLIST_SCANNER_TAG_TYPE_EMPTY;
+			safe_data_offset += 1;
+
+			break;
+		}
+		/* References to other values (IDREF) are left to the DOM parser
+		 */
+		else if( ( character == (uint8_t) 'I' )
+		      && ( ( data_size - safe_data_offset ) >= 5 )
+		      && ( memory_compare(
+		            &( data[ safe_data_offset ] ),
+		            "IDREF",
+		            5 ) == 0 ) )
+		{
+			return( 0 );
+		}
+		safe_data_offset++;
+	}
+	if( safe_data_offset >= data_size )
+	{
+		return( 0 );
+	}
+	*data_offset = safe_data_offset + 1;
+	*tag_type    = safe_tag_type;
+	*name_offset = safe_name_offset;
+
+	return( 1 );
+}
+
+/* Reads an element
+ * The data offset is set to the offset after the end tag of the element
+ * The nesting of the sub elements is validated but the sub elements are not stored
+ * Returns 1 if successful, 0 if no supported element is available or -1 on error
+ */
+int libfvde_plist_scanner_read_element(
+     const uint8_t *data,
+     size_t data_size,
+     size_t *data_offset,
+     libfvde_plist_scanner_element_t *element,
+     libcerror_error_t **error )
+{
+	size_t name_lengths[ LIBFVDE_PLIST_SCANNER_MAXIMUM_DEPTH ];
+	size_t name_offsets[ LIBFVDE_PLIST_SCANNER_MAXIMUM_DEPTH ];
+
+	static char *function    = "libfvde_plist_scanner_read_element";
+	size_t content_offset    = 0;
+	size_t end_tag_offset    = 0;
+	size_t name_length       = 0;
+	size_t name_offset       = 0;
+	size_t safe_data_offset  = 0;
+	uint8_t character        = 0;
+	uint8_t tag_type         = 0;
+	int depth                = 0;
+	int result               = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data_offset > data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( element == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid element.",
+		 function );
+
+		return( -1 );
+	}
+	safe_data_offset = *data_offset;
+
+	while( safe_data_offset < data_size )
+	{
+		if( !libfvde_plist_scanner_is_whitespace( data[ safe_data_offset ] ) )
+		{
+			break;
+		}
+		safe_data_offset++;
+	}
+	if( ( safe_data_offset >= data_size )
+	 || ( data[ safe_data_offset ] != (uint8_t) '<' ) )
+	{
+		return( 0 );
+	}
+	result = libfvde_plist_scanner_read_tag(
+	          data,
+	          data_size,
+	          &safe_data_offset,
+	          &tag_type,
+	          &name_offset,
+	          &name_length,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read start tag.",
+		 function );
+
+		return( -1 );
+	}
+	else if( ( result == 0 )
+	      || ( tag_type == LIBFVDE_PLIST_SCANNER_TAG_TYPE_END ) )
+	{
+		return( 0 );
+	}
+	element->name              = &( data[ name_offset ] );
+	element->name_length       = name_length;
+	element->content_data      = &( data[ safe_data_offset ] );
+	element->content_data_size = 0;
+
+	if( tag_type == LIBFVDE_PLIST_SCANNER_TAG_TYPE_EMPTY )
+	{
+		*data_offset = safe_data_offset;
+
+		return( 1 );
+	}
+	name_offsets[ 0 ] = name_offset;
+	name_lengths[ 0 ] = name_length;
+
+	content_offset = safe_data_offset;
+	depth          = 1;
+
+	while( safe_data_offset < data_size )
+	{
+		character = data[ safe_data_offset ];
+
+		/* Entity and character references are left to the DOM parser
+		 */
+		if( ( character == 0 )
+		 || ( character == (uint8_t) '&' ) )
+		{
+			return( 0 );
+		}
+		if( character != (uint8_t) '<' )
+		{
+			safe_data_offset++;
+
+			continue;
+		}
+		end_tag_offset = safe_data_offset;
+
+		result = libfvde_plist_scanner_read_tag(
+		          data,
+		          data_size,
+		          &safe_data_offset,
+		          &tag_type,
+		          &name_offset,
+		          &name_length,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to read tag.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+		if( tag_type == LIBFVDE_PLIST_SCANNER_TAG_TYPE_START )
+		{
+			if( depth >= LIBFVDE_PLIST_SCANNER_MAXIMUM_DEPTH )
+			{
+				return( 0 );
+			}
+			name_offsets[ depth ] = name_offset;
+			name_lengths[ depth ] = name_length;
+
+			depth++;
+		}
+		else if( tag_type == LIBFVDE_PLIST_SCANNER_TAG_TYPE_END )
+		{
+			depth--;
+
+			if( ( name_lengths[ depth ] != name_length )
+			 || ( memory_compare(
+			       &( data[ name_offsets[ depth ] ] ),
+			       &( data[ name_offset ] ),
+			       name_length ) != 0 ) )
+			{
+				return( 0 );
+			}
+			if( depth == 0 )
+			{
+				element->content_data_size = end_tag_offset - content_offset;
+
+				*data_offset = safe_data_offset;
+
+				return( 1 );
+			}
+		}
+	}
+	return( 0 );
+}
+
+/* Reads the prolog
+ * The prolog consists of the XML declaration, document type declaration, comments
+ * and the plist start tag that precede the root element
+ * The data offset is set to the offset of the root element
+ * Returns 1 if successful, 0 if the prolog is not supported or -1 on error
+ */
+int libfvde_plist_scanner_read_prolog(
+     const uint8_t *data,
+     size_t data_size,
+     size_t *data_offset,
+     uint8_t *has_plist_root_element,
+     libcerror_error_t **error )
+{
+	static char *function    = "libfvde_plist_scanner_read_prolog";
+	size_t name_length       = 0;
+	size_t name_offset       = 0;
+	size_t safe_data_offset  = 0;
+	uint8_t character        = 0;
+	uint8_t safe_has_plist   = 0;
+	uint8_t tag_type         = 0;
+	int result               = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( has_plist_root_element == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid has plist root element.",
+		 function );
+
+		return( -1 );
+	}
+	while( safe_data_offset < data_size )
+	{
+		character = data[ safe_data_offset ];
+
+		if( libfvde_plist_scanner_is_whitespace( character ) )
+		{
+			safe_data_offset++;
+
+			continue;
+		}
+		if( ( character != (uint8_t) '<' )
+		 || ( ( data_size - safe_data_offset ) < 2 ) )
+		{
+			return( 0 );
+		}
+		character = data[ safe_data_offset + 1 ];
+
+		if( character == (uint8_t) '?' )
+		{
+			/* Skip the XML declaration
+			 */
+			safe_data_offset += 2;
+
+			while( ( data_size - safe_data_offset ) >= 2 )
+			{
+				if( ( data[ safe_data_offset ] == (uint8_t) '?' )
+				 && ( data[ safe_data_offset + 1 ] == (uint8_t) '>' ) )
+				{
+					break;
+				}
+				safe_data_offset++;
+			}
+			if( ( data_size - safe_data_offset ) < 2 )
+			{
+				return( 0 );
+			}
+			safe_data_offset += 2;
+		}
+		else if( character == (uint8_t) '!' )
+		{
+			if( ( ( data_size - safe_data_offset ) >= 4 )
+			 && ( data[ safe_data_offset + 2 ] == (uint8_t) '-' )
+			 && ( data[ safe_data_offset + 3 ] == (uint8_t) '-' ) )
+			{
+				/* Skip the comment
+				 */
+				safe_data_offset += 4;
+
+				while( ( data_size - safe_data_offset ) >= 3 )
+				{
+					if( ( data[ safe_data_offset ] == (uint8_t) '-' )
+					 && ( data[ safe_data_offset + 1 ] == (uint8_t) '-' )
+					 && ( data[ safe_data_offset + 2 ] == (uint8_t) '>' ) )
+					{
+						break;
+					}
+					safe_data_offset++;
+				}
+				if( ( data_size - safe_data_offset ) < 3 )
+				{
+					return( 0 );
+				}
+				safe_data_offset += 3;
+			}
+			else
+			{
+				/* Skip the document type declaration, an internal subset is left to the DOM parser
+				 */
+				safe_data_offset += 2;
+
+				while( safe_data_offset < data_size )
+				{
+					character = data[ safe_data_offset ];
+
+					if( ( character == 0 )
+					 || ( character == (uint8_t) '[' ) )
+					{
+						return( 0 );
+					}
+					if( character == (uint8_t) '>' )
+					{
+						break;
+					}
+					safe_data_offset++;
+				}
+				if( safe_data_offset >= data_size )
+				{
+					return( 0 );
+				}
+				safe_data_offset += 1;
+			}
+		}
+		else if( ( safe_has_plist == 0 )
+		      && ( ( data_size - safe_data_offset ) >= 6 )
+		      && ( memory_compare(
+		            &( data[ safe_data_offset + 1 ] ),
+		            "plist",
+		            5 ) == 0 ) )
+		{
+			result = libfvde_plist_scanner_read_tag(
+			          data,
+			          data_size,
+			          &safe_data_offset,
+			          &tag_type,
+			          &name_offset,
+			          &name_length,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to read plist start tag.",
+				 function );
+
+				return( -1 );
+			}
+			else if( ( result == 0 )
+			      || ( tag_type != LIBFVDE_PLIST_SCANNER_TAG_TYPE_START )
+			      || ( name_length != 5 ) )
+			{
+				return( 0 );
+			}
+			safe_has_plist = 1;
+		}
+		else
+		{
+			break;
+		}
+	}
+	*data_offset            = safe_data_offset;
+	*has_plist_root_element = safe_has_plist;
+
+	return( 1 );
+}
+
+/* Retrieves the root element
+ * The root element is validated in a single pass and must be a dict element
+ * Returns 1 if successful, 0 if the XML plist data is not supported or -1 on error
+ */
+int libfvde_plist_scanner_get_root_element(
+     const uint8_t *data,
+     size_t data_size,
+     libfvde_plist_scanner_element_t *element,
+     libcerror_error_t **error )
+{
+	static char *function          = "libfvde_plist_scanner_get_root_element";
+	size_t data_offset             = 0;
+	uint8_t has_plist_root_element = 0;
+	int result                     = 0;
+
+	result = libfvde_plist_scanner_read_prolog(
+	          data,
+	          data_size,
+	          &data_offset,
+	          &has_plist_root_element,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read prolog.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	result = libfvde_plist_scanner_read_element(
+	          data,
+	          data_size,
+	          &data_offset,
+	          element,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read root element.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( ( element->name_length != 4 )
+	 || ( memory_compare(
+	       element->name,
+	       "dict",
+	       4 ) != 0 ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Determines if the XML plist data has a plist root element
+ * Returns 1 if the XML plist data has a plist root element, 0 if not or -1 on error
+ */
+int libfvde_plist_scanner_has_plist_root_element(
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function          = "libfvde_plist_scanner_has_plist_root_element";
+	size_t data_offset             = 0;
+	uint8_t has_plist_root_element = 0;
+	int result                     = 0;
+
+	result = libfvde_plist_scanner_read_prolog(
+	          data,
+	          data_size,
+	          &data_offset,
+	          &has_plist_root_element,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read prolog.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	return( (int) has_plist_root_element );
+}
+
+/* Retrieves the sub element of a dict element with a specific key
+ * Returns 1 if successful, 0 if no such sub element or -1 on error
+ */
+int libfvde_plist_scanner_element_get_sub_element_by_key(
+     libfvde_plist_scanner_element_t *element,
+     const uint8_t *key,
+     size_t key_length,
+     libfvde_plist_scanner_element_t *sub_element,
+     libcerror_error_t **error )
+{
+	libfvde_plist_scanner_element_t key_element;
+
+	static char *function = "libfvde_plist_scanner_element_get_sub_element_by_key";
+	size_t content_offset = 0;
+	int result            = 0;
+
+	if( element == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid element.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( element->name_length != 4 )
+	 || ( memory_compare(
+	       element->name,
+	       "dict",
+	       4 ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid element - unsupported name.",
+		 function );
+
+		return( -1 );
+	}
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_element == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub element.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+		result = libfvde_plist_scanner_read_element(
+		          element->content_data,
+		          element->content_data_size,
+		          &content_offset,
+		          &key_element,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to read key element.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( ( key_element.name_length != 3 )
+		 || ( memory_compare(
+		       key_element.name,
+		       "key",
+		       3 ) != 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: invalid key element - unsupported name.",
+			 function );
+
+			return( -1 );
+		}
+		result = libfvde_plist_scanner_read_element(
+		          element->content_data,
+		          element->content_data_size,
+		          &content_offset,
+		          sub_element,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to read value element.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( key_element.content_data_size == key_length )
+		 && ( memory_compare(
+		       key_element.content_data,
+		       key,
+		       key_length ) == 0 ) )
+		{
+			return( 1 );
+		}
+	}
+	while( result == 1 );
+
+	return( 0 );
+}
+
+/* Retrieves the number of sub elements of an array element
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_plist_scanner_element_get_number_of_sub_elements(
+     libfvde_plist_scanner_element_t *element,
+     int *number_of_sub_elements,
+     libcerror_error_t **error )
+{
+	libfvde_plist_scanner_element_t sub_element;
+
+	static char *function           = "libfvde_plist_scanner_element_get_number_of_sub_elements";
+	size_t content_offset           = 0;
+	int result                      = 0;
+	int safe_number_of_sub_elements = 0;
+
+	if( element == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid element.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( element->name_length != 5 )
+	 || ( memory_compare(
+	       element->name,
+	       "array",
+	       5 ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid element - unsupported name.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_sub_elements == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of sub elements.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+		result = libfvde_plist_scanner_read_element(
+		          element->content_data,
+		          element->content_data_size,
+		          &content_offset,
+		          &sub_element,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to read sub element: %d.",
+			 function,
+			 safe_number_of_sub_elements );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			if( safe_number_of_sub_elements == INT_MAX )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid number of sub elements value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			safe_number_of_sub_elements++;
+		}
+	}
+	while( result == 1 );
+
+	*number_of_sub_elements = safe_number_of_sub_elements;
+
+	return( 1 );
+}
+
+/* Retrieves a specific sub element of an array element
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_plist_scanner_element_get_sub_element_by_index(
+     libfvde_plist_scanner_element_t *element,
+     int sub_element_index,
+     libfvde_plist_scanner_element_t *sub_element,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_plist_scanner_element_get_sub_element_by_index";
+	size_t content_offset = 0;
+	int result            = 0;
+
+	if( element == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid element.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( element->name_length != 5 )
+	 || ( memory_compare(
+	       element->name,
+	       "array",
+	       5 ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid element - unsupported name.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_element_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sub element index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_element == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub element.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+		result = libfvde_plist_scanner_read_element(
+		          element->content_data,
+		          element->content_data_size,
+		          &content_offset,
+		          sub_element,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to read sub element: %d.",
+			 function,
+			 sub_element_index );
+
+			return( -1 );
+		}
+		sub_element_index--;
+	}
+	while( sub_element_index >= 0 );
+
+	return( 1 );
+}
+
+/* Retrieves the string value of a string element
+ * The string is allocated and contains an end-of-string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_plist_scanner_element_get_value_string(
+     libfvde_plist_scanner_element_t *element,
+     uint8_t **string,
+     size_t *string_size,
+     libcerror_error_t **error )
+{
+	uint8_t *safe_string  = NULL;
+	static char *function = "libfvde_plist_scanner_element_get_value_string";
+
+	if( element == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid element.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( element->name_length != 6 )
+	 || ( memory_compare(
+	       element->name,
+	       "string",
+	       6 ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid element - unsupported name.",
+		 function );
+
+		return( -1 );
+	}
+	if( element->content_data_size >= (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid element - content data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( *string != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid string value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string size.",
+		 function );
+
+		return( -1 );
+	}
+	safe_string = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * ( element->content_data_size + 1 ) );
+
+	if( safe_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create string.",
+		 function );
+
+		return( -1 );
+	}
+	if( element->content_data_size > 0 )
+	{
+		if( memory_copy(
+		     safe_string,
+		     element->content_data,
+		     element->content_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy string.",
+			 function );
+
+			memory_free(
+			 safe_string );
+
+			return( -1 );
+		}
+	}
+	safe_string[ element->content_data_size ] = 0;
+
+	*string      = safe_string;
+	*string_size = element->content_data_size + 1;
+
+	return( 1 );
+}
+
+/* Retrieves the integer value of an integer element
+ * The value can be stored in decimal or hexadecimal, prefixed with 0x, notation
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_plist_scanner_element_get_value_integer(
+     libfvde_plist_scanner_element_t *element,
+     uint64_t *value_64bit,
+     libcerror_error_t **error )
+{
+	static char *function     = "libfvde_plist_scanner_element_get_value_integer";
+	size_t content_data_end   = 0;
+	size_t content_offset     = 0;
+	uint64_t safe_value_64bit = 0;
+	uint8_t base              = 10;
+	uint8_t character         = 0;
+	uint8_t digit             = 0;
+
+	if( element == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid element.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( element->name_length != 7 )
+	 || ( memory_compare(
+	       element->name,
+	       "integer",
+	       7 ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid element - unsupported name.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_64bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value 64-bit.",
+		 function );
+
+		return( -1 );
+	}
+	content_data_end = element->content_data_size;
+
+	while( ( content_offset < content_data_end )
+	    && libfvde_plist_scanner_is_whitespace( element->content_data[ content_offset ] ) )
+	{
+		content_offset++;
+	}
+	while( ( content_data_end > content_offset )
+	    && libfvde_plist_scanner_is_whitespace( element->content_data[ content_data_end - 1 ] ) )
+	{
+		content_data_end--;
+	}
+	if( ( ( content_data_end - content_offset ) > 2 )
+	 && ( element->content_data[ content_offset ] == (uint8_t) '0' )
+	 && ( ( element->content_data[ content_offset + 1 ] == (uint8_t) 'x' )
+	  ||  ( element->content_data[ content_offset + 1 ] == (uint8_t) 'X' ) ) )
+	{
+		base            = 16;
+		content_offset += 2;
+	}
+	if( content_offset >= content_data_end )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid element - missing integer value.",
+		 function );
+
+		return( -1 );
+	}
+	while( content_offset < content_data_end )
+	{
+		character = element->content_data[ content_offset ];
+
+		if( ( character >= (uint8_t) '0' )
+		 && ( character <= (uint8_t) '9' ) )
+		{
+			digit = character - (uint8_t) '0';
+		}
+		else if( ( base == 16 )
+		      && ( character >= (uint8_t) 'a' )
+		      && ( character <= (uint8_t) 'f' ) )
+		{
+			digit = character - (uint8_t) 'a' + 10;
+		}
+		else if( ( base == 16 )
+		      && ( character >= (uint8_t) 'A' )
+		      && ( character <= (uint8_t) 'F' ) )
+		{
+			digit = character - (uint8_t) 'A' + 10;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported character: 0x%02" PRIx8 " in integer value.",
+			 function,
+			 character );
+
+			return( -1 );
+		}
+		if( safe_value_64bit > ( ( (uint64_t) UINT64_MAX - digit ) / base ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid integer value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		safe_value_64bit *= base;
+		safe_value_64bit += digit;
+
+		content_offset++;
+	}
+	*value_64bit = safe_value_64bit;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the base64 decoded data value of a data element
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_plist_scanner_element_get_value_data_size(
+     libfvde_plist_scanner_element_t *element,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_plist_scanner_element_get_value_data_size";
+
+	if( element == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid element.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( element->name_length != 4 )
+	 || ( memory_compare(
+	       element->name,
+	       "data",
+	       4 ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid element - unsupported name.",
+		 function );
+
+		return( -1 );
+	}
+	if( libuna_base64_stream_size_to_byte_stream(
+	     element->content_data,
+	     element->content_data_size,
+	     data_size,
+	     LIBUNA_BASE64_VARIANT_ALPHABET_NORMAL | LIBUNA_BASE64_VARIANT_CHARACTER_LIMIT_NONE | LIBUNA_BASE64_VARIANT_PADDING_REQUIRED,
+	     LIBUNA_BASE64_FLAG_STRIP_WHITESPACE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to determine size of base64 encoded data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the base64 decoded data value of a data element
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_plist_scanner_element_get_value_data(
+     libfvde_plist_scanner_element_t *element,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_plist_scanner_element_get_value_data";
+
+	if( element == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid element.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( element->name_length != 4 )
+	 || ( memory_compare(
+	       element->name,
+	       "data",
+	       4 ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid element - unsupported name.",
+		 function );
+
+		return( -1 );
+	}
+	if( libuna_base64_stream_copy_to_byte_stream(
+	     element->content_data,
+	     element->content_data_size,
+	     data,
+	     data_size,
+	     LIBUNA_BASE64_VARIANT_ALPHABET_NORMAL | LIBUNA_BASE64_VARIANT_CHARACTER_LIMIT_NONE | LIBUNA_BASE64_VARIANT_PADDING_REQUIRED,
+	     LIBUNA_BASE64_FLAG_STRIP_WHITESPACE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to copy base64 encoded data to byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Copies an UUID string value of a string element to a byte stream
+ * The UUID string is formatted as: 00000000-0000-0000-0000-000000000000
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_plist_scanner_element_value_uuid_string_copy_to_byte_stream(
+     libfvde_plist_scanner_element_t *element,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_plist_scanner_element_value_uuid_string_copy_to_byte_stream";
+	size_t byte_index     = 0;
+	size_t content_offset = 0;
+	uint8_t byte_value    = 0;
+	uint8_t character     = 0;
+	uint8_t nibble_index  = 0;
+
+	if( element == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid element.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( element->name_length != 6 )
+	 || ( memory_compare(
+	       element->name,
+	       "string",
+	       6 ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid element - unsupported name.",
+		 function );
+
+		return( -1 );
+	}
+	if( element->content_data_size != 36 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported UUID string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( byte_stream_size < 16 )
+	 || ( byte_stream_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid byte stream size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( content_offset = 0;
+	     content_offset < 36;
+	     content_offset++ )
+	{
+		character = element->content_data[ content_offset ];
+
+		if( ( content_offset == 8 )
+		 || ( content_offset == 13 )
+		 || ( content_offset == 18 )
+		 || ( content_offset == 23 ) )
+		{
+			if( character != (uint8_t) '-' )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported character: 0x%02" PRIx8 " in UUID string.",
+				 function,
+				 character );
+
+				return( -1 );
+			}
+			continue;
+		}
+		byte_value <<= 4;
+
+		if( ( character >= (uint8_t) '0' )
+		 && ( character <= (uint8_t) '9' ) )
+		{
+			byte_value |= character - (uint8_t) '0';
+		}
+		else if( ( character >= (uint8_t) 'a' )
+		      && ( character <= (uint8_t) 'f' ) )
+		{
+			byte_value |= character - (uint8_t) 'a' + 10;
+		}
+		else if( ( character >= (uint8_t) 'A' )
+		      && ( character <= (uint8_t) 'F' ) )
+		{
+			byte_value |= character - (uint8_t) 'A' + 10;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported character: 0x%02" PRIx8 " in UUID string.",
+			 function,
+			 character );
+
+			return( -1 );
+		}
+		nibble_index++;
+
+		if( nibble_index == 2 )
+		{
+			byte_stream[ byte_index++ ] = byte_value;
+
+			byte_value   = 0;
+			nibble_index = 0;
+		}
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,156 @@
+/*
+ * Streaming XML plist scanner functions
+ *
+ * Copyright (C) 2011-2024, Omar Choudary <choudary.omar@gmail.com>
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFVDE_PLIST_SCANNER_H )
+#define _LIBFVDE_PLIST_SCANNER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfvde_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum supported element nesting depth
+ */
+#define LIBFVDE_PLIST_SCANNER_MAXIMUM_DEPTH	32
+
+enum LIBFVDE_PLIST_SCANNER_TAG_TYPES
+{
+	LIBFVDE_PLIST_SCANNER_TAG_TYPE_START	= 1,
+	LIBFVDE_PLIST_SCANNER_TAG_TYPE_END	= 2,
+	LIBFVDE_PLIST_SCANNER_TAG_TYPE_EMPTY	= 3
+};
+
+typedef struct libfvde_plist_scanner_element libfvde_plist_scanner_element_t;
+
+/* An element of the XML plist data
+ * The element references the XML plist data and does not allocate memory,
+ * hence the XML plist data must remain valid while the element is used
+ */
+struct libfvde_plist_scanner_element
+{
+	/* The name
+	 */
+	const uint8_t *name;
+
+	/* The name length
+	 */
+	size_t name_length;
+
+	/* The content data
+	 */
+	const uint8_t *content_data;
+
+	/* The content data size
+	 */
+	size_t content_data_size;
+};
+
+int libfvde_plist_scanner_read_tag(
+     const uint8_t *data,
+     size_t data_size,
+     size_t *data_offset,
+     uint8_t *tag_type,
+     size_t *name_offset,
+     size_t *name_length,
+     libcerror_error_t **error );
+
+int libfvde_plist_scanner_read_element(
+     const uint8_t *data,
+     size_t data_size,
+     size_t *data_offset,
+     libfvde_plist_scanner_element_t *element,
+     libcerror_error_t **error );
+
+int libfvde_plist_scanner_read_prolog(
+     const uint8_t *data,
+     size_t data_size,
+     size_t *data_offset,
+     uint8_t *has_plist_root_element,
+     libcerror_error_t **error );
+
+int libfvde_plist_scanner_get_root_element(
+     const uint8_t *data,
+     size_t data_size,
+     libfvde_plist_scanner_element_t *element,
+     libcerror_error_t **error );
+
+int libfvde_plist_scanner_has_plist_root_element(
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libfvde_plist_scanner_element_get_sub_element_by_key(
+     libfvde_plist_scanner_element_t *element,
+     const uint8_t *key,
+     size_t key_length,
+     libfvde_plist_scanner_element_t *sub_element,
+     libcerror_error_t **error );
+
+int libfvde_plist_scanner_element_get_number_of_sub_elements(
+     libfvde_plist_scanner_element_t *element,
+     int *number_of_sub_elements,
+     libcerror_error_t **error );
+
+int libfvde_plist_scanner_element_get_sub_element_by_index(
+     libfvde_plist_scanner_element_t *element,
+     int sub_element_index,
+     libfvde_plist_scanner_element_t *sub_element,
+     libcerror_error_t **error );
+
+int libfvde_plist_scanner_element_get_value_string(
+     libfvde_plist_scanner_element_t *element,
+     uint8_t **string,
+     size_t *string_size,
+     libcerror_error_t **error );
+
+int libfvde_plist_scanner_element_get_value_integer(
+     libfvde_plist_scanner_element_t *element,
+     uint64_t *value_64bit,
+     libcerror_error_t **error );
+
+int libfvde_plist_scanner_element_get_value_data_size(
+     libfvde_plist_scanner_element_t *element,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+int libfvde_plist_scanner_element_get_value_data(
+     libfvde_plist_scanner_element_t *element,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libfvde_plist_scanner_element_value_uuid_string_copy_to_byte_stream(
+     libfvde_plist_scanner_element_t *element,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFVDE_PLIST_SCANNER_H ) */
+
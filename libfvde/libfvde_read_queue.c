@@ -0,0 +1,1176 @@
+/*
+ * Read queue functions
+ *
+ * Copyright (C) 2011-2024, Omar Choudary <choudary.omar@gmail.com>
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfvde_definitions.h"
+#include "libfvde_libcerror.h"
+#include "libfvde_libcnotify.h"
+#include "libfvde_libcthreads.h"
+#include "libfvde_logical_volume.h"
+#include "libfvde_read_queue.h"
+#include "libfvde_types.h"
+
+/* Creates a read queue
+ * Make sure the value read_queue is referencing, is set to NULL
+ * The reads are served by number_of_threads threads, where each thread reads and
+ * decrypts one read at a time, so that the reading of one read overlaps with
+ * the decryption of another
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_read_queue_initialize(
+     libfvde_read_queue_t **read_queue,
+     int number_of_threads,
+     int maximum_number_of_reads,
+     libcerror_error_t **error )
+{
+	libfvde_internal_read_queue_t *internal_read_queue = NULL;
+	static char *function                              = "libfvde_read_queue_initialize";
+
+	if( read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_queue != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid read queue value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > LIBFVDE_MAXIMUM_NUMBER_OF_READ_QUEUE_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_reads <= 0 )
+	 || ( maximum_number_of_reads > LIBFVDE_MAXIMUM_NUMBER_OF_QUEUED_READS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of reads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_read_queue = memory_allocate_structure(
+	                       libfvde_internal_read_queue_t );
+
+	if( internal_read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read queue.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_read_queue,
+	     0,
+	     sizeof( libfvde_internal_read_queue_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear read queue.",
+		 function );
+
+		memory_free(
+		 internal_read_queue );
+
+		return( -1 );
+	}
+	internal_read_queue->maximum_number_of_reads = maximum_number_of_reads;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( internal_read_queue->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( internal_read_queue->condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create condition.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_thread_pool_create(
+	     &( internal_read_queue->thread_pool ),
+	     NULL,
+	     number_of_threads,
+	     maximum_number_of_reads,
+	     (int (*)(intptr_t *, void *)) &libfvde_read_queue_callback_function,
+	     (void *) internal_read_queue,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create thread pool.",
+		 function );
+
+		goto on_error;
+	}
+#endif /* defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT ) */
+
+	*read_queue = (libfvde_read_queue_t *) internal_read_queue;
+
+	return( 1 );
+
+on_error:
+	if( internal_read_queue != NULL )
+	{
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+		if( internal_read_queue->condition != NULL )
+		{
+			libcthreads_condition_free(
+			 &( internal_read_queue->condition ),
+			 NULL );
+		}
+		if( internal_read_queue->mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( internal_read_queue->mutex ),
+			 NULL );
+		}
+#endif
+		memory_free(
+		 internal_read_queue );
+	}
+	return( -1 );
+}
+
+/* Frees a read queue
+ * Waits for the reads that are pending to complete, the completed reads
+ * that were not returned by libfvde_read_queue_poll or libfvde_read_queue_wait
+ * are discarded
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_read_queue_free(
+     libfvde_read_queue_t **read_queue,
+     libcerror_error_t **error )
+{
+	libfvde_internal_read_queue_t *internal_read_queue = NULL;
+	libfvde_read_request_t *read_request               = NULL;
+	static char *function                              = "libfvde_read_queue_free";
+	int result                                         = 1;
+
+	if( read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_queue != NULL )
+	{
+		internal_read_queue = (libfvde_internal_read_queue_t *) *read_queue;
+		*read_queue         = NULL;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+		/* The pending reads reference buffers owned by the caller, hence
+		 * they are completed before the threads are joined
+		 */
+		if( libcthreads_mutex_grab(
+		     internal_read_queue->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			while( ( internal_read_queue->number_of_pending_reads > 0 )
+			    && ( internal_read_queue->synchronization_failed == 0 ) )
+			{
+				if( libcthreads_condition_wait(
+				     internal_read_queue->condition,
+				     internal_read_queue->mutex,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to wait for condition.",
+					 function );
+
+					result = -1;
+
+					break;
+				}
+			}
+			if( internal_read_queue->synchronization_failed != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: invalid read queue - synchronization failed.",
+				 function );
+
+				result = -1;
+			}
+			if( libcthreads_mutex_release(
+			     internal_read_queue->mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+		/* The threads are joined before the mutex and condition are freed
+		 * since they reference the read queue
+		 */
+		if( internal_read_queue->thread_pool != NULL )
+		{
+			if( libcthreads_thread_pool_join(
+			     &( internal_read_queue->thread_pool ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread pool.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( libcthreads_condition_free(
+		     &( internal_read_queue->condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free condition.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_free(
+		     &( internal_read_queue->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif /* defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT ) */
+
+		while( internal_read_queue->first_completed_read_request != NULL )
+		{
+			read_request = internal_read_queue->first_completed_read_request;
+
+			internal_read_queue->first_completed_read_request = read_request->next_read_request;
+
+			memory_free(
+			 read_request );
+		}
+		memory_free(
+		 internal_read_queue );
+	}
+	return( result );
+}
+
+/* Completes a read request
+ * The callback function of the read request is called if set, otherwise the read
+ * request is appended to the completed read requests. The read request is freed
+ * after the callback function was called
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_internal_read_queue_complete_read_request(
+     libfvde_internal_read_queue_t *internal_read_queue,
+     libfvde_read_request_t *read_request,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_internal_read_queue_complete_read_request";
+	int result            = 1;
+
+	if( internal_read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read request.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_request->callback_function != NULL )
+	{
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+		/* The counters are only changed while holding the mutex
+		 */
+		if( libcthreads_mutex_grab(
+		     internal_read_queue->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			internal_read_queue->synchronization_failed = 1;
+
+			result = -1;
+		}
+		else
+		{
+			/* The read is no longer outstanding before the callback function is called
+			 * so that the callback function can submit a new read when the queue is full
+			 */
+			internal_read_queue->number_of_outstanding_reads -= 1;
+
+			if( libcthreads_mutex_release(
+			     internal_read_queue->mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+#else
+		internal_read_queue->number_of_outstanding_reads -= 1;
+#endif
+		/* The callback function is called without holding the mutex so that it can submit new reads
+		 */
+		read_request->callback_function(
+		 read_request->user_data,
+		 read_request->read_count );
+
+		memory_free(
+		 read_request );
+
+		read_request = NULL;
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_read_queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		internal_read_queue->synchronization_failed = 1;
+
+		/* The read request cannot be appended to the completed read requests
+		 * and the counters cannot be changed without holding the mutex
+		 */
+		if( read_request != NULL )
+		{
+			memory_free(
+			 read_request );
+		}
+		return( -1 );
+	}
+#endif
+	if( read_request != NULL )
+	{
+		read_request->next_read_request = NULL;
+
+		if( internal_read_queue->last_completed_read_request == NULL )
+		{
+			internal_read_queue->first_completed_read_request = read_request;
+		}
+		else
+		{
+			internal_read_queue->last_completed_read_request->next_read_request = read_request;
+		}
+		internal_read_queue->last_completed_read_request = read_request;
+	}
+	internal_read_queue->number_of_pending_reads -= 1;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	libcthreads_condition_broadcast(
+	 internal_read_queue->condition,
+	 NULL );
+
+	if( libcthreads_mutex_release(
+	     internal_read_queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	return( result );
+}
+
+/* Reads the data of a read request
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_read_request_read(
+     libfvde_read_request_t *read_request,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_read_request_read";
+
+	if( read_request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read request.",
+		 function );
+
+		return( -1 );
+	}
+	/* The positional read only holds the read/write lock of the logical volume
+	 * for reading, hence multiple reads of the same logical volume are served
+	 * concurrently
+	 */
+	read_request->read_count = libfvde_logical_volume_pread_buffer(
+	                            read_request->logical_volume,
+	                            read_request->buffer,
+	                            read_request->buffer_size,
+	                            read_request->offset,
+	                            error );
+
+	if( read_request->read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 read_request->offset,
+		 read_request->offset );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+
+/* Serves a read request on one of the threads of the thread pool
+ * Callback function for the thread pool
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_read_queue_callback_function(
+     libfvde_read_request_t *read_request,
+     void *arguments )
+{
+	libcerror_error_t *error                           = NULL;
+	libfvde_internal_read_queue_t *internal_read_queue = NULL;
+	int result                                         = 0;
+
+	internal_read_queue = (libfvde_internal_read_queue_t *) arguments;
+
+	if( ( internal_read_queue == NULL )
+	 || ( read_request == NULL ) )
+	{
+		return( -1 );
+	}
+	result = libfvde_read_request_read(
+	          read_request,
+	          &error );
+
+	if( result != 1 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+#endif
+		libcerror_error_free(
+		 &error );
+	}
+	if( libfvde_internal_read_queue_complete_read_request(
+	     internal_read_queue,
+	     read_request,
+	     &error ) != 1 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+#endif
+		libcerror_error_free(
+		 &error );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+#endif /* defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT ) */
+
+/* Submits a read of data at a specific offset of a logical volume
+ * The function returns without waiting for the read to complete. On completion the
+ * callback function is called, from one of the threads of the read queue, with the
+ * user data and the number of bytes read or -1 on error. If no callback function is
+ * provided the user data is returned as completion token by libfvde_read_queue_poll
+ * or libfvde_read_queue_wait. The buffer must remain valid until the read has completed
+ * Returns 1 if successful, 0 if the maximum number of outstanding reads was reached or -1 on error
+ */
+int libfvde_read_queue_submit_read(
+     libfvde_read_queue_t *read_queue,
+     libfvde_logical_volume_t *logical_volume,
+     void *buffer,
+     size_t buffer_size,
+     off64_t offset,
+     void (*callback_function)(
+            intptr_t *user_data,
+            ssize_t read_count ),
+     intptr_t *user_data,
+     libcerror_error_t **error )
+{
+	libfvde_internal_read_queue_t *internal_read_queue = NULL;
+	libfvde_read_request_t *read_request               = NULL;
+	static char *function                              = "libfvde_read_queue_submit_read";
+	int result                                         = 1;
+
+#if !defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	libcerror_error_t *read_error                      = NULL;
+#endif
+
+	if( read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read queue.",
+		 function );
+
+		return( -1 );
+	}
+	internal_read_queue = (libfvde_internal_read_queue_t *) read_queue;
+
+	if( logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	read_request = memory_allocate_structure(
+	                libfvde_read_request_t );
+
+	if( read_request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read request.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     read_request,
+	     0,
+	     sizeof( libfvde_read_request_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear read request.",
+		 function );
+
+		memory_free(
+		 read_request );
+
+		return( -1 );
+	}
+	read_request->logical_volume    = logical_volume;
+	read_request->buffer            = buffer;
+	read_request->buffer_size       = buffer_size;
+	read_request->offset            = offset;
+	read_request->callback_function = callback_function;
+	read_request->user_data         = user_data;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_read_queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		memory_free(
+		 read_request );
+
+		return( -1 );
+	}
+	if( internal_read_queue->synchronization_failed != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: invalid read queue - synchronization failed.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	if( result == 1 )
+	{
+		if( internal_read_queue->number_of_outstanding_reads >= internal_read_queue->maximum_number_of_reads )
+		{
+			result = 0;
+		}
+		else
+		{
+			internal_read_queue->number_of_outstanding_reads += 1;
+			internal_read_queue->number_of_pending_reads     += 1;
+		}
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_read_queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		memory_free(
+		 read_request );
+
+		return( -1 );
+	}
+#endif
+	if( result != 1 )
+	{
+		memory_free(
+		 read_request );
+
+		return( result );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	/* The number of outstanding reads does not exceed the maximum number
+	 * of values of the thread pool, hence pushing does not block
+	 */
+	if( libcthreads_thread_pool_push(
+	     internal_read_queue->thread_pool,
+	     (intptr_t *) read_request,
+	     error ) == 1 )
+	{
+		return( 1 );
+	}
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+	 "%s: unable to push read request onto thread pool.",
+	 function );
+
+	if( libcthreads_mutex_grab(
+	     internal_read_queue->mutex,
+	     NULL ) == 1 )
+	{
+		internal_read_queue->number_of_outstanding_reads -= 1;
+		internal_read_queue->number_of_pending_reads     -= 1;
+
+		libcthreads_mutex_release(
+		 internal_read_queue->mutex,
+		 NULL );
+	}
+	else
+	{
+		internal_read_queue->synchronization_failed = 1;
+	}
+	memory_free(
+	 read_request );
+
+	return( -1 );
+#else
+	/* Without multi-thread support the read is served before the function returns
+	 * a read error is reported by the read count of the completed read
+	 */
+	if( libfvde_read_request_read(
+	     read_request,
+	     &read_error ) != 1 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_error_backtrace(
+			 read_error );
+		}
+#endif
+		libcerror_error_free(
+		 &read_error );
+	}
+	if( libfvde_internal_read_queue_complete_read_request(
+	     internal_read_queue,
+	     read_request,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to complete read request.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+#endif /* defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT ) */
+}
+
+/* Retrieves a completed read from the read queue
+ * If wait_for_completion is set the function waits until a read has completed
+ * Returns 1 if successful, 0 if no completed read is available or -1 on error
+ */
+int libfvde_internal_read_queue_get_completed_read(
+     libfvde_internal_read_queue_t *internal_read_queue,
+     uint8_t wait_for_completion,
+     intptr_t **user_data,
+     ssize_t *read_count,
+     libcerror_error_t **error )
+{
+	libfvde_read_request_t *read_request = NULL;
+	static char *function                = "libfvde_internal_read_queue_get_completed_read";
+
+	if( internal_read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( user_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid user data.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_count == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read count.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_read_queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	/* Reads with a callback function are never added to the completed read requests
+	 * hence there is nothing to wait for once all the outstanding reads are such reads
+	 * and have completed
+	 */
+	while( ( wait_for_completion != 0 )
+	    && ( internal_read_queue->first_completed_read_request == NULL )
+	    && ( internal_read_queue->number_of_pending_reads > 0 )
+	    && ( internal_read_queue->synchronization_failed == 0 ) )
+	{
+		if( libcthreads_condition_wait(
+		     internal_read_queue->condition,
+		     internal_read_queue->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for condition.",
+			 function );
+
+			libcthreads_mutex_release(
+			 internal_read_queue->mutex,
+			 NULL );
+
+			return( -1 );
+		}
+	}
+	if( internal_read_queue->synchronization_failed != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: invalid read queue - synchronization failed.",
+		 function );
+
+		libcthreads_mutex_release(
+		 internal_read_queue->mutex,
+		 NULL );
+
+		return( -1 );
+	}
+#endif /* defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT ) */
+
+	read_request = internal_read_queue->first_completed_read_request;
+
+	if( read_request != NULL )
+	{
+		internal_read_queue->first_completed_read_request = read_request->next_read_request;
+
+		if( internal_read_queue->first_completed_read_request == NULL )
+		{
+			internal_read_queue->last_completed_read_request = NULL;
+		}
+		internal_read_queue->number_of_outstanding_reads -= 1;
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_read_queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		if( read_request != NULL )
+		{
+			memory_free(
+			 read_request );
+		}
+		return( -1 );
+	}
+#endif
+	if( read_request == NULL )
+	{
+		return( 0 );
+	}
+	*user_data  = read_request->user_data;
+	*read_count = read_request->read_count;
+
+	memory_free(
+	 read_request );
+
+	return( 1 );
+}
+
+/* Retrieves a completed read without waiting
+ * The user data is the completion token that was passed to libfvde_read_queue_submit_read
+ * and the read count contains the number of bytes read or -1 if the read failed
+ * Returns 1 if successful, 0 if no completed read is available or -1 on error
+ */
+int libfvde_read_queue_poll(
+     libfvde_read_queue_t *read_queue,
+     intptr_t **user_data,
+     ssize_t *read_count,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_read_queue_poll";
+	int result            = 0;
+
+	result = libfvde_internal_read_queue_get_completed_read(
+	          (libfvde_internal_read_queue_t *) read_queue,
+	          0,
+	          user_data,
+	          read_count,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve completed read.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves a completed read, waiting for a pending read to complete if necessary
+ * The user data is the completion token that was passed to libfvde_read_queue_submit_read
+ * and the read count contains the number of bytes read or -1 if the read failed
+ * Returns 1 if successful, 0 if no reads are pending or -1 on error
+ */
+int libfvde_read_queue_wait(
+     libfvde_read_queue_t *read_queue,
+     intptr_t **user_data,
+     ssize_t *read_count,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_read_queue_wait";
+	int result            = 0;
+
+	result = libfvde_internal_read_queue_get_completed_read(
+	          (libfvde_internal_read_queue_t *) read_queue,
+	          1,
+	          user_data,
+	          read_count,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve completed read.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the number of outstanding reads
+ * These are the reads that were submitted and either have not completed or
+ * have completed but were not yet retrieved
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_read_queue_get_number_of_outstanding_reads(
+     libfvde_read_queue_t *read_queue,
+     int *number_of_outstanding_reads,
+     libcerror_error_t **error )
+{
+	libfvde_internal_read_queue_t *internal_read_queue = NULL;
+	static char *function                              = "libfvde_read_queue_get_number_of_outstanding_reads";
+
+	if( read_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read queue.",
+		 function );
+
+		return( -1 );
+	}
+	internal_read_queue = (libfvde_internal_read_queue_t *) read_queue;
+
+	if( number_of_outstanding_reads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of outstanding reads.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_read_queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_outstanding_reads = internal_read_queue->number_of_outstanding_reads;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_read_queue->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
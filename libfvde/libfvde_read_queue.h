@@ -0,0 +1,196 @@
+/*
+ * Read queue functions
+ *
+ * Copyright (C) 2011-2024, Omar Choudary <choudary.omar@gmail.com>
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFVDE_READ_QUEUE_H )
+#define _LIBFVDE_READ_QUEUE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfvde_extern.h"
+#include "libfvde_libcerror.h"
+#include "libfvde_libcthreads.h"
+#include "libfvde_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfvde_read_request libfvde_read_request_t;
+typedef struct libfvde_internal_read_queue libfvde_internal_read_queue_t;
+
+struct libfvde_read_request
+{
+	/* The logical volume
+	 */
+	libfvde_logical_volume_t *logical_volume;
+
+	/* The buffer
+	 */
+	void *buffer;
+
+	/* The buffer size
+	 */
+	size_t buffer_size;
+
+	/* The offset
+	 */
+	off64_t offset;
+
+	/* The completion callback function
+	 */
+	void (*callback_function)(
+	       intptr_t *user_data,
+	       ssize_t read_count );
+
+	/* The user data, which is passed to the callback function
+	 * or returned as completion token
+	 */
+	intptr_t *user_data;
+
+	/* The number of bytes read or -1 on error
+	 */
+	ssize_t read_count;
+
+	/* The next completed read request
+	 */
+	libfvde_read_request_t *next_read_request;
+};
+
+struct libfvde_internal_read_queue
+{
+	/* The maximum number of reads that can be outstanding
+	 */
+	int maximum_number_of_reads;
+
+	/* The number of reads that were submitted and were not yet returned
+	 * by libfvde_read_queue_poll or libfvde_read_queue_wait
+	 */
+	int number_of_outstanding_reads;
+
+	/* The number of reads that were submitted and were not yet completed
+	 */
+	int number_of_pending_reads;
+
+	/* The first completed read request
+	 */
+	libfvde_read_request_t *first_completed_read_request;
+
+	/* The last completed read request
+	 */
+	libfvde_read_request_t *last_completed_read_request;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	/* The thread pool
+	 */
+	libcthreads_thread_pool_t *thread_pool;
+
+	/* The mutex that protects the completed read requests and the counters
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The condition that is signalled when a read completes
+	 */
+	libcthreads_condition_t *condition;
+
+	/* Value to indicate a thread was unable to grab the mutex
+	 * and could not account for its read
+	 */
+	uint8_t synchronization_failed;
+#endif
+};
+
+LIBFVDE_EXTERN \
+int libfvde_read_queue_initialize(
+     libfvde_read_queue_t **read_queue,
+     int number_of_threads,
+     int maximum_number_of_reads,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_read_queue_free(
+     libfvde_read_queue_t **read_queue,
+     libcerror_error_t **error );
+
+int libfvde_internal_read_queue_complete_read_request(
+     libfvde_internal_read_queue_t *internal_read_queue,
+     libfvde_read_request_t *read_request,
+     libcerror_error_t **error );
+
+int libfvde_read_request_read(
+     libfvde_read_request_t *read_request,
+     libcerror_error_t **error );
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+
+int libfvde_read_queue_callback_function(
+     libfvde_read_request_t *read_request,
+     void *arguments );
+
+#endif /* defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT ) */
+
+LIBFVDE_EXTERN \
+int libfvde_read_queue_submit_read(
+     libfvde_read_queue_t *read_queue,
+     libfvde_logical_volume_t *logical_volume,
+     void *buffer,
+     size_t buffer_size,
+     off64_t offset,
+     void (*callback_function)(
+            intptr_t *user_data,
+            ssize_t read_count ),
+     intptr_t *user_data,
+     libcerror_error_t **error );
+
+int libfvde_internal_read_queue_get_completed_read(
+     libfvde_internal_read_queue_t *internal_read_queue,
+     uint8_t wait_for_completion,
+     intptr_t **user_data,
+     ssize_t *read_count,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_read_queue_poll(
+     libfvde_read_queue_t *read_queue,
+     intptr_t **user_data,
+     ssize_t *read_count,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_read_queue_wait(
+     libfvde_read_queue_t *read_queue,
+     intptr_t **user_data,
+     ssize_t *read_count,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_read_queue_get_number_of_outstanding_reads(
+     libfvde_read_queue_t *read_queue,
+     int *number_of_outstanding_reads,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFVDE_READ_QUEUE_H ) */
+
@@ -0,0 +1,2136 @@
+/*
+ * Sector cache functions
+ *
+ * Copyright (C) 2011-2024, Omar Choudary <choudary.omar@gmail.com>
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfvde_definitions.h"
+#include "libfvde_encryption_context.h"
+#include "libfvde_libbfio.h"
+#include "libfvde_libcerror.h"
+#include "libfvde_libcthreads.h"
+#include "libfvde_libfcache.h"
+#include "libfvde_sector_cache.h"
+#include "libfvde_sector_data.h"
+#include "libfvde_sector_data_pool.h"
+#include "libfvde_volume_data_handle.h"
+
+/* Creates a sector cache
+ * Make sure the value sector_cache is referencing, is set to NULL
+ * The cache entries are divided over the shards, where every shard has its own cache,
+ * sector data pool, encryption context and lock, so that sector data in different
+ * shards can be read concurrently
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_sector_cache_initialize(
+     libfvde_sector_cache_t **sector_cache,
+     int number_of_shards,
+     int number_of_cache_entries,
+     size_t sector_data_size,
+     size_t bytes_per_sector,
+     libcerror_error_t **error )
+{
+	libfvde_sector_cache_shard_t *shard = NULL;
+	static char *function               = "libfvde_sector_cache_initialize";
+	size_t shards_size                  = 0;
+	int number_of_shard_cache_entries   = 0;
+	int shard_index                     = 0;
+
+	if( sector_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sector_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid sector cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_shards <= 0 )
+	 || ( number_of_shards > LIBFVDE_MAXIMUM_NUMBER_OF_SECTOR_CACHE_SHARDS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of shards value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_cache_entries <= 0 )
+	 || ( number_of_cache_entries > LIBFVDE_MAXIMUM_NUMBER_OF_CACHE_ENTRIES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of cache entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( bytes_per_sector == 0 )
+	 || ( sector_data_size == 0 )
+	 || ( sector_data_size > (size_t) LIBFVDE_MAXIMUM_CACHE_UNIT_SIZE )
+	 || ( ( sector_data_size % bytes_per_sector ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sector data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*sector_cache = memory_allocate_structure(
+	                 libfvde_sector_cache_t );
+
+	if( *sector_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sector cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *sector_cache,
+	     0,
+	     sizeof( libfvde_sector_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear sector cache.",
+		 function );
+
+		memory_free(
+		 *sector_cache );
+
+		*sector_cache = NULL;
+
+		return( -1 );
+	}
+	shards_size = sizeof( libfvde_sector_cache_shard_t ) * number_of_shards;
+
+	( *sector_cache )->shards = (libfvde_sector_cache_shard_t *) memory_allocate(
+	                                                              shards_size );
+
+	if( ( *sector_cache )->shards == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create shards.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *sector_cache )->shards,
+	     0,
+	     shards_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear shards.",
+		 function );
+
+		memory_free(
+		 ( *sector_cache )->shards );
+
+		( *sector_cache )->shards = NULL;
+
+		goto on_error;
+	}
+	number_of_shard_cache_entries = number_of_cache_entries / number_of_shards;
+
+	if( number_of_shard_cache_entries == 0 )
+	{
+		number_of_shard_cache_entries = 1;
+	}
+	( *sector_cache )->sector_data_size        = sector_data_size;
+	( *sector_cache )->bytes_per_sector        = bytes_per_sector;
+	( *sector_cache )->number_of_shards        = number_of_shards;
+	( *sector_cache )->number_of_cache_entries = number_of_shard_cache_entries;
+
+	for( shard_index = 0;
+	     shard_index < number_of_shards;
+	     shard_index++ )
+	{
+		shard = &( ( *sector_cache )->shards[ shard_index ] );
+
+		if( libfcache_cache_initialize(
+		     &( shard->cache ),
+		     number_of_shard_cache_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create shard: %d cache.",
+			 function,
+			 shard_index );
+
+			goto on_error;
+		}
+		if( libfvde_sector_data_pool_initialize(
+		     &( shard->sector_data_pool ),
+		     sector_data_size,
+		     number_of_shard_cache_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create shard: %d sector data pool.",
+			 function,
+			 shard_index );
+
+			goto on_error;
+		}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_initialize(
+		     &( shard->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create shard: %d mutex.",
+			 function,
+			 shard_index );
+
+			goto on_error;
+		}
+		if( libcthreads_mutex_initialize(
+		     &( shard->fill_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create shard: %d fill mutex.",
+			 function,
+			 shard_index );
+
+			goto on_error;
+		}
+#endif
+	}
+	return( 1 );
+
+on_error:
+	if( *sector_cache != NULL )
+	{
+		libfvde_sector_cache_free(
+		 sector_cache,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a sector cache
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_sector_cache_free(
+     libfvde_sector_cache_t **sector_cache,
+     libcerror_error_t **error )
+{
+	libfvde_sector_cache_shard_t *shard = NULL;
+	static char *function               = "libfvde_sector_cache_free";
+	int result                          = 1;
+	int shard_index                     = 0;
+
+	if( sector_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sector_cache != NULL )
+	{
+		if( ( *sector_cache )->shards != NULL )
+		{
+			for( shard_index = 0;
+			     shard_index < ( *sector_cache )->number_of_shards;
+			     shard_index++ )
+			{
+				shard = &( ( *sector_cache )->shards[ shard_index ] );
+
+				/* The cached sector data is released into the sector data pool
+				 * so the cache is freed before the pool
+				 */
+				if( shard->cache != NULL )
+				{
+					if( libfcache_cache_free(
+					     &( shard->cache ),
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+						 "%s: unable to free shard: %d cache.",
+						 function,
+						 shard_index );
+
+						result = -1;
+					}
+				}
+				if( shard->sector_data_pool != NULL )
+				{
+					if( libfvde_sector_data_pool_free(
+					     &( shard->sector_data_pool ),
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+						 "%s: unable to free shard: %d sector data pool.",
+						 function,
+						 shard_index );
+
+						result = -1;
+					}
+				}
+				if( shard->encryption_context != NULL )
+				{
+					if( libfvde_encryption_context_free(
+					     &( shard->encryption_context ),
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+						 "%s: unable to free shard: %d encryption context.",
+						 function,
+						 shard_index );
+
+						result = -1;
+					}
+				}
+				if( shard->fill_data != NULL )
+				{
+					memory_free(
+					 shard->fill_data );
+				}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+				if( shard->direct_encryption_context != NULL )
+				{
+					if( libfvde_encryption_context_free(
+					     &( shard->direct_encryption_context ),
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+						 "%s: unable to free shard: %d direct read encryption context.",
+						 function,
+						 shard_index );
+
+						result = -1;
+					}
+				}
+				if( shard->mutex != NULL )
+				{
+					if( libcthreads_mutex_free(
+					     &( shard->mutex ),
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+						 "%s: unable to free shard: %d mutex.",
+						 function,
+						 shard_index );
+
+						result = -1;
+					}
+				}
+				if( shard->fill_mutex != NULL )
+				{
+					if( libcthreads_mutex_free(
+					     &( shard->fill_mutex ),
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+						 "%s: unable to free shard: %d fill mutex.",
+						 function,
+						 shard_index );
+
+						result = -1;
+					}
+				}
+#endif
+			}
+			memory_free(
+			 ( *sector_cache )->shards );
+		}
+		memory_free(
+		 *sector_cache );
+
+		*sector_cache = NULL;
+	}
+	return( result );
+}
+
+/* Sets the keys of the encryption contexts of the shards
+ * This must not be called while a direct read is in progress
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_sector_cache_set_keys(
+     libfvde_sector_cache_t *sector_cache,
+     uint32_t encryption_method,
+     const uint8_t *key,
+     size_t key_size,
+     const uint8_t *tweak_key,
+     size_t tweak_key_size,
+     libcerror_error_t **error )
+{
+	libfvde_sector_cache_shard_t *shard = NULL;
+	static char *function               = "libfvde_sector_cache_set_keys";
+	int result                          = 1;
+	int shard_index                     = 0;
+
+	if( sector_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( sector_cache->shards == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid sector cache - missing shards.",
+		 function );
+
+		return( -1 );
+	}
+	for( shard_index = 0;
+	     shard_index < sector_cache->number_of_shards;
+	     shard_index++ )
+	{
+		shard = &( sector_cache->shards[ shard_index ] );
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_grab(
+		     shard->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab shard: %d mutex.",
+			 function,
+			 shard_index );
+
+			return( -1 );
+		}
+#endif
+		if( shard->encryption_context == NULL )
+		{
+			if( libfvde_encryption_context_initialize(
+			     &( shard->encryption_context ),
+			     encryption_method,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create shard: %d encryption context.",
+				 function,
+				 shard_index );
+
+				result = -1;
+			}
+		}
+		if( result == 1 )
+		{
+			if( libfvde_encryption_context_set_keys(
+			     shard->encryption_context,
+			     key,
+			     key_size,
+			     tweak_key,
+			     tweak_key_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set keys in shard: %d encryption context.",
+				 function,
+				 shard_index );
+
+				result = -1;
+			}
+		}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+		if( ( result == 1 )
+		 && ( shard->direct_encryption_context_is_taken != 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: invalid shard: %d - direct read encryption context is taken.",
+			 function,
+			 shard_index );
+
+			result = -1;
+		}
+		if( ( result == 1 )
+		 && ( shard->direct_encryption_context == NULL ) )
+		{
+			if( libfvde_encryption_context_initialize(
+			     &( shard->direct_encryption_context ),
+			     encryption_method,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create shard: %d direct read encryption context.",
+				 function,
+				 shard_index );
+
+				result = -1;
+			}
+		}
+		if( result == 1 )
+		{
+			if( libfvde_encryption_context_set_keys(
+			     shard->direct_encryption_context,
+			     key,
+			     key_size,
+			     tweak_key,
+			     tweak_key_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set keys in shard: %d direct read encryption context.",
+				 function,
+				 shard_index );
+
+				result = -1;
+			}
+		}
+		if( libcthreads_mutex_release(
+		     shard->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release shard: %d mutex.",
+			 function,
+			 shard_index );
+
+			return( -1 );
+		}
+#endif
+		if( result != 1 )
+		{
+			break;
+		}
+	}
+	return( result );
+}
+
+/* Retrieves the sector data at a specific offset from the cache of a shard
+ * The shard lock must be held by the caller
+ * Returns 1 if successful, 0 if the sector data is not cached or -1 on error
+ */
+int libfvde_sector_cache_shard_get_cached_sector_data(
+     libfvde_sector_cache_shard_t *shard,
+     int cache_entry_index,
+     off64_t sector_data_offset,
+     libfvde_sector_data_t **sector_data,
+     libcerror_error_t **error )
+{
+	libfcache_cache_value_t *cache_value = NULL;
+	static char *function                = "libfvde_sector_cache_shard_get_cached_sector_data";
+	off64_t cache_value_offset           = 0;
+	int64_t cache_value_timestamp        = 0;
+	int cache_value_file_index           = 0;
+
+	if( shard == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shard.",
+		 function );
+
+		return( -1 );
+	}
+	if( sector_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfcache_cache_get_value_by_index(
+	     shard->cache,
+	     cache_entry_index,
+	     &cache_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache value: %d.",
+		 function,
+		 cache_entry_index );
+
+		return( -1 );
+	}
+	if( cache_value == NULL )
+	{
+		return( 0 );
+	}
+	if( libfcache_cache_value_get_identifier(
+	     cache_value,
+	     &cache_value_file_index,
+	     &cache_value_offset,
+	     &cache_value_timestamp,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache value identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( cache_value_file_index != 0 )
+	 || ( cache_value_offset != sector_data_offset ) )
+	{
+		return( 0 );
+	}
+	if( libfcache_cache_value_get_value(
+	     cache_value,
+	     (intptr_t **) sector_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sector data from cache value.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sector_data == NULL )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Reads data at a specific offset from the sector cache
+ * The file IO pool entry, file offset and range flags are those of the segment that contains
+ * the offset and the segment must be aligned to the sector data size. The sector data that
+ * contains the offset is read into the cache of its shard if not cached yet. At most the data
+ * up to the end of the sector data is read. Only the lock of the shard is held during the read
+ * so this function can be called concurrently
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfvde_sector_cache_read_buffer_at_offset(
+         libfvde_sector_cache_t *sector_cache,
+         libfvde_volume_data_handle_t *volume_data_handle,
+         libbfio_pool_t *file_io_pool,
+         int file_io_pool_entry,
+         off64_t file_offset,
+         uint32_t range_flags,
+         off64_t offset,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	libfvde_sector_cache_shard_t *shard = NULL;
+	libfvde_sector_data_t *sector_data  = NULL;
+	static char *function               = "libfvde_sector_cache_read_buffer_at_offset";
+	off64_t sector_data_offset          = 0;
+	uint64_t sector_data_index          = 0;
+	size_t data_offset                  = 0;
+	size_t read_size                    = 0;
+	ssize_t read_count                  = 0;
+	int cache_entry_index               = 0;
+
+	if( sector_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( sector_cache->shards == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid sector cache - missing shards.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( sector_cache->sector_data_size == 0 )
+	 || ( sector_cache->bytes_per_sector == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sector cache - sector data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( volume_data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	data_offset        = (size_t) ( offset % sector_cache->sector_data_size );
+	sector_data_offset = offset - (off64_t) data_offset;
+
+	if( file_offset < (off64_t) data_offset )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	file_offset -= (off64_t) data_offset;
+
+	sector_data_index = (uint64_t) sector_data_offset / sector_cache->sector_data_size;
+	cache_entry_index = (int) ( ( sector_data_index / sector_cache->number_of_shards ) % sector_cache->number_of_cache_entries );
+
+	shard = &( sector_cache->shards[ sector_data_index % sector_cache->number_of_shards ] );
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     shard->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab shard mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfvde_sector_cache_shard_get_cached_sector_data(
+	     shard,
+	     cache_entry_index,
+	     sector_data_offset,
+	     &sector_data,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cached sector data.",
+		 function );
+
+		goto on_error;
+	}
+	if( sector_data == NULL )
+	{
+		if( ( volume_data_handle->is_encrypted != 0 )
+		 && ( shard->encryption_context == NULL ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid sector cache - missing shard encryption context.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfvde_sector_data_pool_get_sector_data(
+		     shard->sector_data_pool,
+		     &sector_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sector data from pool.",
+			 function );
+
+			goto on_error;
+		}
+		read_count = libfvde_volume_data_handle_read_buffer_with_encryption_context(
+		              volume_data_handle,
+		              file_io_pool,
+		              file_io_pool_entry,
+		              file_offset,
+		              (uint64_t) sector_data_offset / sector_cache->bytes_per_sector,
+		              range_flags,
+		              shard->encryption_context,
+		              sector_data->data,
+		              sector_data->data_size,
+		              error );
+
+		if( read_count != (ssize_t) sector_data->data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read sector data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 sector_data_offset,
+			 sector_data_offset );
+
+			goto on_error;
+		}
+		if( libfcache_cache_set_value_by_index(
+		     shard->cache,
+		     cache_entry_index,
+		     0,
+		     sector_data_offset,
+		     0,
+		     (intptr_t *) sector_data,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfvde_sector_data_free,
+		     LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set sector data in cache entry: %d.",
+			 function,
+			 cache_entry_index );
+
+			goto on_error;
+		}
+	}
+	read_size = sector_data->data_size - data_offset;
+
+	if( read_size > buffer_size )
+	{
+		read_size = buffer_size;
+	}
+	if( memory_copy(
+	     buffer,
+	     &( ( sector_data->data )[ data_offset ] ),
+	     read_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy sector data to buffer.",
+		 function );
+
+		/* The sector data is managed by the cache
+		 */
+		sector_data = NULL;
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     shard->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release shard mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( (ssize_t) read_size );
+
+on_error:
+	if( sector_data != NULL )
+	{
+		libfvde_sector_data_free(
+		 &sector_data,
+		 NULL );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	libcthreads_mutex_release(
+	 shard->mutex,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+
+/* Takes a direct read encryption context that is not taken
+ * The shards are searched starting with the shard of a specific index, so that
+ * concurrent direct reads of the same shard each take a context of their own
+ * The shard mutex is only held while the context is taken, the context itself
+ * is used without holding the mutex until it is returned
+ * Returns 1 if successful, 0 if all contexts are taken or -1 on error
+ */
+int libfvde_sector_cache_take_direct_encryption_context(
+     libfvde_sector_cache_t *sector_cache,
+     int shard_index,
+     int *taken_shard_index,
+     libfvde_encryption_context_t **encryption_context,
+     libcerror_error_t **error )
+{
+	libfvde_sector_cache_shard_t *shard = NULL;
+	static char *function               = "libfvde_sector_cache_take_direct_encryption_context";
+	int result                          = 0;
+	int search_index                    = 0;
+
+	if( sector_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( sector_cache->shards == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid sector cache - missing shards.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( shard_index < 0 )
+	 || ( shard_index >= sector_cache->number_of_shards ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid shard index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( taken_shard_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid taken shard index.",
+		 function );
+
+		return( -1 );
+	}
+	if( encryption_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid encryption context.",
+		 function );
+
+		return( -1 );
+	}
+	for( search_index = 0;
+	     search_index < sector_cache->number_of_shards;
+	     search_index++ )
+	{
+		shard = &( sector_cache->shards[ ( shard_index + search_index ) % sector_cache->number_of_shards ] );
+
+		if( libcthreads_mutex_grab(
+		     shard->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab shard mutex.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( shard->direct_encryption_context != NULL )
+		 && ( shard->direct_encryption_context_is_taken == 0 ) )
+		{
+			shard->direct_encryption_context_is_taken = 1;
+
+			*taken_shard_index  = ( shard_index + search_index ) % sector_cache->number_of_shards;
+			*encryption_context = shard->direct_encryption_context;
+
+			result = 1;
+		}
+		if( libcthreads_mutex_release(
+		     shard->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release shard mutex.",
+			 function );
+
+			return( -1 );
+		}
+		if( result != 0 )
+		{
+			break;
+		}
+	}
+	return( result );
+}
+
+/* Returns a direct read encryption context taken by libfvde_sector_cache_take_direct_encryption_context
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_sector_cache_return_direct_encryption_context(
+     libfvde_sector_cache_t *sector_cache,
+     int taken_shard_index,
+     libcerror_error_t **error )
+{
+	libfvde_sector_cache_shard_t *shard = NULL;
+	static char *function               = "libfvde_sector_cache_return_direct_encryption_context";
+
+	if( sector_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( sector_cache->shards == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid sector cache - missing shards.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( taken_shard_index < 0 )
+	 || ( taken_shard_index >= sector_cache->number_of_shards ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid taken shard index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	shard = &( sector_cache->shards[ taken_shard_index ] );
+
+	if( libcthreads_mutex_grab(
+	     shard->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab shard mutex.",
+		 function );
+
+		return( -1 );
+	}
+	shard->direct_encryption_context_is_taken = 0;
+
+	if( libcthreads_mutex_release(
+	     shard->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release shard mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT ) */
+
+/* Reads data at a specific offset directly into the buffer without caching it
+ * The data is decrypted with a direct read encryption context, which is set up once
+ * by libfvde_sector_cache_set_keys and taken for the duration of the read, so that
+ * the shard mutex is not held while reading and decrypting. Only if all direct read
+ * encryption contexts are taken, the data is decrypted with the encryption context
+ * of the shard that contains the offset while holding the shard mutex
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfvde_sector_cache_read_buffer_direct(
+         libfvde_sector_cache_t *sector_cache,
+         libfvde_volume_data_handle_t *volume_data_handle,
+         libbfio_pool_t *file_io_pool,
+         int file_io_pool_entry,
+         off64_t file_offset,
+         uint32_t range_flags,
+         off64_t offset,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	libfvde_encryption_context_t *encryption_context = NULL;
+	libfvde_sector_cache_shard_t *shard              = NULL;
+	static char *function                            = "libfvde_sector_cache_read_buffer_direct";
+	uint64_t sector_data_index                       = 0;
+	ssize_t read_count                               = 0;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	int result                                       = 0;
+	int shard_is_locked                              = 0;
+	int taken_shard_index                            = -1;
+#endif
+
+	if( sector_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( sector_cache->shards == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid sector cache - missing shards.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( sector_cache->sector_data_size == 0 )
+	 || ( sector_cache->bytes_per_sector == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sector cache - sector data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( volume_data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( offset < 0 )
+	 || ( ( offset % sector_cache->bytes_per_sector ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	sector_data_index = (uint64_t) offset / sector_cache->sector_data_size;
+
+	shard = &( sector_cache->shards[ sector_data_index % sector_cache->number_of_shards ] );
+
+	if( volume_data_handle->is_encrypted != 0 )
+	{
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+		result = libfvde_sector_cache_take_direct_encryption_context(
+		          sector_cache,
+		          (int) ( sector_data_index % sector_cache->number_of_shards ),
+		          &taken_shard_index,
+		          &encryption_context,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to take direct read encryption context.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			if( libcthreads_mutex_grab(
+			     shard->mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to grab shard mutex.",
+				 function );
+
+				return( -1 );
+			}
+			shard_is_locked = 1;
+
+			encryption_context = shard->encryption_context;
+		}
+#else
+		encryption_context = shard->encryption_context;
+#endif
+		if( encryption_context == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid sector cache - missing shard encryption context.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	read_count = libfvde_volume_data_handle_read_buffer_with_encryption_context(
+	              volume_data_handle,
+	              file_io_pool,
+	              file_io_pool_entry,
+	              file_offset,
+	              (uint64_t) offset / sector_cache->bytes_per_sector,
+	              range_flags,
+	              encryption_context,
+	              buffer,
+	              buffer_size,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( shard_is_locked != 0 )
+	{
+		shard_is_locked = 0;
+
+		if( libcthreads_mutex_release(
+		     shard->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release shard mutex.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( taken_shard_index != -1 )
+	{
+		if( libfvde_sector_cache_return_direct_encryption_context(
+		     sector_cache,
+		     taken_shard_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to return direct read encryption context.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	return( read_count );
+
+on_error:
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( shard_is_locked != 0 )
+	{
+		libcthreads_mutex_release(
+		 shard->mutex,
+		 NULL );
+	}
+	if( taken_shard_index != -1 )
+	{
+		libfvde_sector_cache_return_direct_encryption_context(
+		 sector_cache,
+		 taken_shard_index,
+		 NULL );
+	}
+#endif
+	return( -1 );
+}
+
+/* Determines if the sector data at a specific offset is cached
+ * Returns 1 if cached, 0 if not or -1 on error
+ */
+int libfvde_sector_cache_has_sector_data(
+     libfvde_sector_cache_t *sector_cache,
+     off64_t sector_data_offset,
+     libcerror_error_t **error )
+{
+	libfvde_sector_cache_shard_t *shard = NULL;
+	libfvde_sector_data_t *sector_data  = NULL;
+	static char *function               = "libfvde_sector_cache_has_sector_data";
+	uint64_t sector_data_index          = 0;
+	int cache_entry_index               = 0;
+	int result                          = 0;
+
+	if( sector_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( sector_cache->shards == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid sector cache - missing shards.",
+		 function );
+
+		return( -1 );
+	}
+	if( sector_cache->sector_data_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sector cache - sector data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( sector_data_offset < 0 )
+	 || ( ( sector_data_offset % sector_cache->sector_data_size ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sector data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	sector_data_index = (uint64_t) sector_data_offset / sector_cache->sector_data_size;
+	cache_entry_index = (int) ( ( sector_data_index / sector_cache->number_of_shards ) % sector_cache->number_of_cache_entries );
+
+	shard = &( sector_cache->shards[ sector_data_index % sector_cache->number_of_shards ] );
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     shard->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab shard mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libfvde_sector_cache_shard_get_cached_sector_data(
+	          shard,
+	          cache_entry_index,
+	          sector_data_offset,
+	          &sector_data,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cached sector data.",
+		 function );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     shard->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release shard mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Sets the sector data at a specific offset from encrypted data
+ * The data is decrypted with the encryption context of the shard if the volume
+ * is encrypted. The sector data is not replaced if it was cached in the meantime
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_sector_cache_set_sector_data(
+     libfvde_sector_cache_t *sector_cache,
+     libfvde_volume_data_handle_t *volume_data_handle,
+     off64_t sector_data_offset,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libfvde_sector_cache_shard_t *shard = NULL;
+	libfvde_sector_data_t *sector_data  = NULL;
+	static char *function               = "libfvde_sector_cache_set_sector_data";
+	uint64_t sector_data_index          = 0;
+	uint64_t sector_number              = 0;
+	int cache_entry_index               = 0;
+	int result                          = 0;
+
+	if( sector_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( sector_cache->shards == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid sector cache - missing shards.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( sector_cache->sector_data_size == 0 )
+	 || ( sector_cache->bytes_per_sector == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sector cache - sector data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( volume_data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( sector_data_offset < 0 )
+	 || ( ( sector_data_offset % sector_cache->sector_data_size ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sector data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size != sector_cache->sector_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	sector_data_index = (uint64_t) sector_data_offset / sector_cache->sector_data_size;
+	cache_entry_index = (int) ( ( sector_data_index / sector_cache->number_of_shards ) % sector_cache->number_of_cache_entries );
+
+	shard = &( sector_cache->shards[ sector_data_index % sector_cache->number_of_shards ] );
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     shard->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab shard mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libfvde_sector_cache_shard_get_cached_sector_data(
+	          shard,
+	          cache_entry_index,
+	          sector_data_offset,
+	          &sector_data,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cached sector data.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		/* The sector data is managed by the cache
+		 */
+		sector_data = NULL;
+	}
+	else
+	{
+		if( ( volume_data_handle->is_encrypted != 0 )
+		 && ( shard->encryption_context == NULL ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid sector cache - missing shard encryption context.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfvde_sector_data_pool_get_sector_data(
+		     shard->sector_data_pool,
+		     &sector_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sector data from pool.",
+			 function );
+
+			goto on_error;
+		}
+		if( volume_data_handle->is_encrypted == 0 )
+		{
+			if( memory_copy(
+			     sector_data->data,
+			     data,
+			     data_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy data to sector data.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			sector_number = (uint64_t) sector_data_offset / sector_cache->bytes_per_sector;
+
+			if( libfvde_encryption_context_crypt_sectors(
+			     shard->encryption_context,
+			     LIBFVDE_ENCRYPTION_CRYPT_MODE_DECRYPT,
+			     data,
+			     data_size,
+			     sector_data->data,
+			     sector_data->data_size,
+			     sector_number,
+			     sector_cache->bytes_per_sector,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+				 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+				 "%s: unable to decrypt sectors: %" PRIu64 " data.",
+				 function,
+				 sector_number );
+
+				goto on_error;
+			}
+		}
+		if( libfcache_cache_set_value_by_index(
+		     shard->cache,
+		     cache_entry_index,
+		     0,
+		     sector_data_offset,
+		     0,
+		     (intptr_t *) sector_data,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfvde_sector_data_free,
+		     LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set sector data in cache entry: %d.",
+			 function,
+			 cache_entry_index );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     shard->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release shard mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( sector_data != NULL )
+	{
+		libfvde_sector_data_free(
+		 &sector_data,
+		 NULL );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	libcthreads_mutex_release(
+	 shard->mutex,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Fills the sector cache with the sector data of a specific range
+ * The file IO pool entry, file offset and range flags are those of the segment that contains
+ * the range and the range must not exceed the segment, which must be aligned to the sector
+ * data size. Consecutive sector data that is not cached is read with a single read and
+ * decrypted into the caches of the shards, instead of a read per sector data
+ * The data is read into the fill data of the shard of the first sector data of the range,
+ * which is reused by subsequent fills
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_sector_cache_fill(
+     libfvde_sector_cache_t *sector_cache,
+     libfvde_volume_data_handle_t *volume_data_handle,
+     libbfio_pool_t *file_io_pool,
+     int file_io_pool_entry,
+     off64_t file_offset,
+     uint32_t range_flags,
+     off64_t offset,
+     size_t size,
+     libcerror_error_t **error )
+{
+	libfvde_sector_cache_shard_t *shard = NULL;
+	static char *function               = "libfvde_sector_cache_fill";
+	off64_t sector_data_offset          = 0;
+	size_t data_offset                  = 0;
+	size_t fill_data_offset             = 0;
+	size_t fill_offset                  = 0;
+	size_t fill_size                    = 0;
+	size_t maximum_fill_size            = 0;
+	ssize_t read_count                  = 0;
+	int result                          = 0;
+
+	if( sector_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( sector_cache->sector_data_size == 0 )
+	 || ( sector_cache->sector_data_size > (size_t) LIBFVDE_MAXIMUM_CACHE_UNIT_SIZE )
+	 || ( sector_cache->bytes_per_sector == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sector cache - sector data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( volume_data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	data_offset        = (size_t) ( offset % sector_cache->sector_data_size );
+	sector_data_offset = offset - (off64_t) data_offset;
+
+	if( file_offset < (off64_t) data_offset )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( range_flags & LIBFVDE_RANGE_FLAG_IS_SPARSE ) != 0 )
+	{
+		return( 1 );
+	}
+	file_offset -= (off64_t) data_offset;
+	size        += data_offset;
+
+	maximum_fill_size = LIBFVDE_MAXIMUM_SECTOR_CACHE_FILL_SIZE - ( LIBFVDE_MAXIMUM_SECTOR_CACHE_FILL_SIZE % sector_cache->sector_data_size );
+
+	/* The fill mutex is not the shard mutex since setting the sector data grabs the shard mutexes
+	 */
+	shard = &( sector_cache->shards[ ( (uint64_t) sector_data_offset / sector_cache->sector_data_size ) % sector_cache->number_of_shards ] );
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     shard->fill_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab shard fill mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+
+	while( fill_offset < size )
+	{
+		result = libfvde_sector_cache_has_sector_data(
+		          sector_cache,
+		          sector_data_offset + (off64_t) fill_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if sector data is cached.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			fill_offset += sector_cache->sector_data_size;
+
+			continue;
+		}
+		/* Determine the consecutive sector data that is not cached
+		 */
+		fill_size = sector_cache->sector_data_size;
+
+		while( ( ( fill_offset + fill_size ) < size )
+		    && ( fill_size < maximum_fill_size ) )
+		{
+			result = libfvde_sector_cache_has_sector_data(
+			          sector_cache,
+			          sector_data_offset + (off64_t) ( fill_offset + fill_size ),
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine if sector data is cached.",
+				 function );
+
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				break;
+			}
+			fill_size += sector_cache->sector_data_size;
+		}
+		if( fill_size > shard->fill_data_size )
+		{
+			if( shard->fill_data != NULL )
+			{
+				memory_free(
+				 shard->fill_data );
+
+				shard->fill_data      = NULL;
+				shard->fill_data_size = 0;
+			}
+			shard->fill_data = (uint8_t *) memory_allocate(
+			                                sizeof( uint8_t ) * fill_size );
+
+			if( shard->fill_data == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create fill data.",
+				 function );
+
+				goto on_error;
+			}
+			shard->fill_data_size = fill_size;
+		}
+		/* The data is read without decryption since it is decrypted by the shards
+		 */
+		read_count = libfvde_volume_data_handle_read_buffer_with_encryption_context(
+		              volume_data_handle,
+		              file_io_pool,
+		              file_io_pool_entry,
+		              file_offset + (off64_t) fill_offset,
+		              (uint64_t) ( sector_data_offset + (off64_t) fill_offset ) / sector_cache->bytes_per_sector,
+		              range_flags,
+		              NULL,
+		              shard->fill_data,
+		              fill_size,
+		              error );
+
+		if( read_count != (ssize_t) fill_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read sector data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 sector_data_offset + (off64_t) fill_offset,
+			 sector_data_offset + (off64_t) fill_offset );
+
+			goto on_error;
+		}
+		for( fill_data_offset = 0;
+		     fill_data_offset < fill_size;
+		     fill_data_offset += sector_cache->sector_data_size )
+		{
+			if( libfvde_sector_cache_set_sector_data(
+			     sector_cache,
+			     volume_data_handle,
+			     sector_data_offset + (off64_t) ( fill_offset + fill_data_offset ),
+			     &( shard->fill_data[ fill_data_offset ] ),
+			     sector_cache->sector_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set sector data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 sector_data_offset + (off64_t) ( fill_offset + fill_data_offset ),
+				 sector_data_offset + (off64_t) ( fill_offset + fill_data_offset ) );
+
+				goto on_error;
+			}
+		}
+		fill_offset += fill_size;
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     shard->fill_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release shard fill mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	libcthreads_mutex_release(
+	 shard->fill_mutex,
+	 NULL );
+#endif
+	return( -1 );
+}
+
@@ -0,0 +1,207 @@
+/*
+ * Sector cache functions
+ *
+ * Copyright (C) 2011-2024, Omar Choudary <choudary.omar@gmail.com>
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFVDE_SECTOR_CACHE_H )
+#define _LIBFVDE_SECTOR_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfvde_encryption_context.h"
+#include "libfvde_libbfio.h"
+#include "libfvde_libcerror.h"
+#include "libfvde_libcthreads.h"
+#include "libfvde_libfcache.h"
+#include "libfvde_sector_data.h"
+#include "libfvde_sector_data_pool.h"
+#include "libfvde_volume_data_handle.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfvde_sector_cache_shard libfvde_sector_cache_shard_t;
+typedef struct libfvde_sector_cache libfvde_sector_cache_t;
+
+struct libfvde_sector_cache_shard
+{
+	/* The cache
+	 */
+	libfcache_cache_t *cache;
+
+	/* The sector data pool, the cached sector data is released into
+	 */
+	libfvde_sector_data_pool_t *sector_data_pool;
+
+	/* The encryption context, which is exclusive to the shard
+	 */
+	libfvde_encryption_context_t *encryption_context;
+
+	/* The fill data, which is reused by the fills that start in the shard
+	 */
+	uint8_t *fill_data;
+
+	/* The fill data size
+	 */
+	size_t fill_data_size;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The fill mutex, which guards the fill data
+	 */
+	libcthreads_mutex_t *fill_mutex;
+
+	/* The direct read encryption context, which is taken by a direct read
+	 * so that the direct read does not hold the mutex while reading and decrypting
+	 */
+	libfvde_encryption_context_t *direct_encryption_context;
+
+	/* Value to indicate the direct read encryption context is taken
+	 */
+	uint8_t direct_encryption_context_is_taken;
+#endif
+};
+
+struct libfvde_sector_cache
+{
+	/* The sector data size, which is the size of a cache unit
+	 */
+	size_t sector_data_size;
+
+	/* The bytes per sector
+	 */
+	size_t bytes_per_sector;
+
+	/* The number of shards
+	 */
+	int number_of_shards;
+
+	/* The number of cache entries per shard
+	 */
+	int number_of_cache_entries;
+
+	/* The shards
+	 */
+	libfvde_sector_cache_shard_t *shards;
+};
+
+int libfvde_sector_cache_initialize(
+     libfvde_sector_cache_t **sector_cache,
+     int number_of_shards,
+     int number_of_cache_entries,
+     size_t sector_data_size,
+     size_t bytes_per_sector,
+     libcerror_error_t **error );
+
+int libfvde_sector_cache_free(
+     libfvde_sector_cache_t **sector_cache,
+     libcerror_error_t **error );
+
+int libfvde_sector_cache_set_keys(
+     libfvde_sector_cache_t *sector_cache,
+     uint32_t encryption_method,
+     const uint8_t *key,
+     size_t key_size,
+     const uint8_t *tweak_key,
+     size_t tweak_key_size,
+     libcerror_error_t **error );
+
+int libfvde_sector_cache_shard_get_cached_sector_data(
+     libfvde_sector_cache_shard_t *shard,
+     int cache_entry_index,
+     off64_t sector_data_offset,
+     libfvde_sector_data_t **sector_data,
+     libcerror_error_t **error );
+
+ssize_t libfvde_sector_cache_read_buffer_at_offset(
+         libfvde_sector_cache_t *sector_cache,
+         libfvde_volume_data_handle_t *volume_data_handle,
+         libbfio_pool_t *file_io_pool,
+         int file_io_pool_entry,
+         off64_t file_offset,
+         uint32_t range_flags,
+         off64_t offset,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+
+int libfvde_sector_cache_take_direct_encryption_context(
+     libfvde_sector_cache_t *sector_cache,
+     int shard_index,
+     int *taken_shard_index,
+     libfvde_encryption_context_t **encryption_context,
+     libcerror_error_t **error );
+
+int libfvde_sector_cache_return_direct_encryption_context(
+     libfvde_sector_cache_t *sector_cache,
+     int taken_shard_index,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT ) */
+
+ssize_t libfvde_sector_cache_read_buffer_direct(
+         libfvde_sector_cache_t *sector_cache,
+         libfvde_volume_data_handle_t *volume_data_handle,
+         libbfio_pool_t *file_io_pool,
+         int file_io_pool_entry,
+         off64_t file_offset,
+         uint32_t range_flags,
+         off64_t offset,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
+int libfvde_sector_cache_has_sector_data(
+     libfvde_sector_cache_t *sector_cache,
+     off64_t sector_data_offset,
+     libcerror_error_t **error );
+
+int libfvde_sector_cache_set_sector_data(
+     libfvde_sector_cache_t *sector_cache,
+     libfvde_volume_data_handle_t *volume_data_handle,
+     off64_t sector_data_offset,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libfvde_sector_cache_fill(
+     libfvde_sector_cache_t *sector_cache,
+     libfvde_volume_data_handle_t *volume_data_handle,
+     libbfio_pool_t *file_io_pool,
+     int file_io_pool_entry,
+     off64_t file_offset,
+     uint32_t range_flags,
+     off64_t offset,
+     size_t size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFVDE_SECTOR_CACHE_H ) */
+
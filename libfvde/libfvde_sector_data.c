@@ -31,6 +31,7 @@
 #include "libfvde_libcerror.h"
 #include "libfvde_libcnotify.h"
 #include "libfvde_sector_data.h"
+#include "libfvde_sector_data_pool.h"
 
 /* Creates sector data
  * Make sure the value sector_data is referencing, is set to NULL
@@ -140,6 +141,7 @@ on_error:
 }
 
 /* Frees sector data
+ * Sector data that was retrieved from a sector data pool is released into the pool
  * Returns 1 if successful or -1 on error
  */
 int libfvde_sector_data_free(
@@ -162,6 +164,24 @@ int libfvde_sector_data_free(
 	}
 	if( *sector_data != NULL )
 	{
+		if( ( *sector_data )->pool != NULL )
+		{
+			if( libfvde_sector_data_pool_release_sector_data(
+			     ( *sector_data )->pool,
+			     sector_data,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to release sector data into pool.",
+				 function );
+
+				return( -1 );
+			}
+			return( 1 );
+		}
 		if( ( *sector_data )->data != NULL )
 		{
 			if( memory_set(
@@ -190,6 +210,7 @@ int libfvde_sector_data_free(
 }
 
 /* Reads sector data
+ * Encrypted sector data is read into the sector data and decrypted in-place
  * Returns 1 if successful or -1 on error
  */
 int libfvde_sector_data_read(
@@ -202,9 +223,8 @@ int libfvde_sector_data_read(
      uint8_t is_encrypted,
      libcerror_error_t **error )
 {
-	uint8_t *encrypted_data = NULL;
-	static char *function   = "libfvde_sector_data_read";
-	ssize_t read_count      = 0;
+	static char *function = "libfvde_sector_data_read";
+	ssize_t read_count    = 0;
 
 	if( sector_data == NULL )
 	{
@@ -238,43 +258,29 @@ int libfvde_sector_data_read(
 		 file_offset );
 	}
 #endif
-	if( is_encrypted != 0 )
+	read_count = libbfio_pool_read_buffer_at_offset(
+		      file_io_pool,
+		      file_io_pool_entry,
+		      sector_data->data,
+		      sector_data->data_size,
+		      file_offset,
+		      error );
+
+	if( read_count != (ssize_t) sector_data->data_size )
 	{
-		encrypted_data = (uint8_t *) memory_allocate(
-		                              sizeof( uint8_t ) * sector_data->data_size );
-
-		if( encrypted_data == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create encrypted data.",
-			 function );
-
-			goto on_error;
-		}
-		read_count = libbfio_pool_read_buffer_at_offset(
-			      file_io_pool,
-			      file_io_pool_entry,
-			      encrypted_data,
-			      sector_data->data_size,
-			      file_offset,
-			      error );
-
-		if( read_count != (ssize_t) sector_data->data_size )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read encrypted data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-			 function,
-			 file_offset,
-			 file_offset );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read sector data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
 
-			goto on_error;
-		}
+		return( -1 );
+	}
+	if( is_encrypted != 0 )
+	{
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
@@ -282,7 +288,7 @@ int libfvde_sector_data_read(
 			 "%s: encrypted data:\n",
 			 function );
 			libcnotify_print_data(
-			 encrypted_data,
+			 sector_data->data,
 			 sector_data->data_size,
 			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
 
@@ -299,7 +305,7 @@ int libfvde_sector_data_read(
 		if( libfvde_encryption_context_crypt(
 		     encryption_context,
 		     LIBFVDE_ENCRYPTION_CRYPT_MODE_DECRYPT,
-		     encrypted_data,
+		     sector_data->data,
 		     sector_data->data_size,
 		     sector_data->data,
 		     sector_data->data_size,
@@ -313,35 +319,7 @@ int libfvde_sector_data_read(
 			 "%s: unable to decrypt data.",
 			 function );
 
-			goto on_error;
-		}
-		memory_free(
-		 encrypted_data );
-
-		encrypted_data = NULL;
-	}
-	else
-	{
-		read_count = libbfio_pool_read_buffer_at_offset(
-			      file_io_pool,
-			      file_io_pool_entry,
-			      sector_data->data,
-			      sector_data->data_size,
-			      file_offset,
-			      error );
-
-		if( read_count != (ssize_t) sector_data->data_size )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read sector data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-			 function,
-			 file_offset,
-			 file_offset );
-
-			goto on_error;
+			return( -1 );
 		}
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -357,13 +335,4 @@ int libfvde_sector_data_read(
 	}
 #endif
 	return( 1 );
-
-on_error:
-	if( encrypted_data != NULL )
-	{
-		memory_free(
-		 encrypted_data );
-	}
-	return( -1 );
 }
-
@@ -45,6 +45,10 @@ struct libfvde_sector_data
 	/* The data size
 	 */
 	size_t data_size;
+
+	/* The sector data pool the sector data is released into on free
+	 */
+	struct libfvde_sector_data_pool *pool;
 };
 
 int libfvde_sector_data_initialize(
@@ -0,0 +1,392 @@
+/*
+ * Sector data pool functions
+ *
+ * Copyright (C) 2011-2024, Omar Choudary <choudary.omar@gmail.com>
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfvde_libcerror.h"
+#include "libfvde_sector_data.h"
+#include "libfvde_sector_data_pool.h"
+
+/* Creates a sector data pool
+ * Make sure the value sector_data_pool is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_sector_data_pool_initialize(
+     libfvde_sector_data_pool_t **sector_data_pool,
+     size_t data_size,
+     int maximum_number_of_free_sector_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_sector_data_pool_initialize";
+	size_t array_size     = 0;
+
+	if( sector_data_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector data pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sector_data_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid sector data pool value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_free_sector_data <= 0 )
+	 || ( (size_t) maximum_number_of_free_sector_data > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfvde_sector_data_t * ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of free sector data value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*sector_data_pool = memory_allocate_structure(
+	                     libfvde_sector_data_pool_t );
+
+	if( *sector_data_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sector data pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *sector_data_pool,
+	     0,
+	     sizeof( libfvde_sector_data_pool_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear sector data pool.",
+		 function );
+
+		memory_free(
+		 *sector_data_pool );
+
+		*sector_data_pool = NULL;
+
+		return( -1 );
+	}
+	array_size = sizeof( libfvde_sector_data_t * ) * maximum_number_of_free_sector_data;
+
+	( *sector_data_pool )->free_sector_data = (libfvde_sector_data_t **) memory_allocate(
+	                                                                     array_size );
+
+	if( ( *sector_data_pool )->free_sector_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create free sector data array.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *sector_data_pool )->free_sector_data,
+	     0,
+	     array_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear free sector data array.",
+		 function );
+
+		goto on_error;
+	}
+	( *sector_data_pool )->data_size                          = data_size;
+	( *sector_data_pool )->maximum_number_of_free_sector_data = maximum_number_of_free_sector_data;
+
+	return( 1 );
+
+on_error:
+	if( *sector_data_pool != NULL )
+	{
+		if( ( *sector_data_pool )->free_sector_data != NULL )
+		{
+			memory_free(
+			 ( *sector_data_pool )->free_sector_data );
+		}
+		memory_free(
+		 *sector_data_pool );
+
+		*sector_data_pool = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a sector data pool
+ * Sector data that is still in use must be released or freed before the pool is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_sector_data_pool_free(
+     libfvde_sector_data_pool_t **sector_data_pool,
+     libcerror_error_t **error )
+{
+	libfvde_sector_data_t *sector_data = NULL;
+	static char *function              = "libfvde_sector_data_pool_free";
+	int result                         = 1;
+	int sector_data_index              = 0;
+
+	if( sector_data_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector data pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sector_data_pool != NULL )
+	{
+		for( sector_data_index = 0;
+		     sector_data_index < ( *sector_data_pool )->number_of_free_sector_data;
+		     sector_data_index++ )
+		{
+			sector_data = ( *sector_data_pool )->free_sector_data[ sector_data_index ];
+
+			if( sector_data == NULL )
+			{
+				continue;
+			}
+			sector_data->pool = NULL;
+
+			if( libfvde_sector_data_free(
+			     &sector_data,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free sector data: %d.",
+				 function,
+				 sector_data_index );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 ( *sector_data_pool )->free_sector_data );
+
+		memory_free(
+		 *sector_data_pool );
+
+		*sector_data_pool = NULL;
+	}
+	return( result );
+}
+
+/* Retrieves sector data from the pool
+ * Sector data available for reuse is returned if possible, otherwise new sector data is created
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_sector_data_pool_get_sector_data(
+     libfvde_sector_data_pool_t *sector_data_pool,
+     libfvde_sector_data_t **sector_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_sector_data_pool_get_sector_data";
+
+	if( sector_data_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector data pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( sector_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector data.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sector_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid sector data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( sector_data_pool->number_of_free_sector_data > 0 )
+	{
+		sector_data_pool->number_of_free_sector_data -= 1;
+
+		*sector_data = sector_data_pool->free_sector_data[ sector_data_pool->number_of_free_sector_data ];
+
+		sector_data_pool->free_sector_data[ sector_data_pool->number_of_free_sector_data ] = NULL;
+
+		return( 1 );
+	}
+	if( libfvde_sector_data_initialize(
+	     sector_data,
+	     sector_data_pool->data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create sector data.",
+		 function );
+
+		return( -1 );
+	}
+	( *sector_data )->pool = sector_data_pool;
+
+	return( 1 );
+}
+
+/* Releases sector data back into the pool
+ * The sector data is cleared and kept for reuse if the pool has room for it, otherwise it is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_sector_data_pool_release_sector_data(
+     libfvde_sector_data_pool_t *sector_data_pool,
+     libfvde_sector_data_t **sector_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_sector_data_pool_release_sector_data";
+
+	if( sector_data_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector data pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( sector_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector data.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sector_data == NULL )
+	{
+		return( 1 );
+	}
+	if( ( ( *sector_data )->data_size != sector_data_pool->data_size )
+	 || ( sector_data_pool->number_of_free_sector_data >= sector_data_pool->maximum_number_of_free_sector_data ) )
+	{
+		( *sector_data )->pool = NULL;
+
+		if( libfvde_sector_data_free(
+		     sector_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sector data.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( memory_set(
+	     ( *sector_data )->data,
+	     0,
+	     ( *sector_data )->data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear sector data.",
+		 function );
+
+		return( -1 );
+	}
+	( *sector_data )->pool = sector_data_pool;
+
+	sector_data_pool->free_sector_data[ sector_data_pool->number_of_free_sector_data ] = *sector_data;
+
+	sector_data_pool->number_of_free_sector_data += 1;
+
+	*sector_data = NULL;
+
+	return( 1 );
+}
+
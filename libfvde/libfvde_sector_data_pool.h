@@ -0,0 +1,82 @@
+/*
+ * Sector data pool functions
+ *
+ * Copyright (C) 2011-2024, Omar Choudary <choudary.omar@gmail.com>
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFVDE_SECTOR_DATA_POOL_H )
+#define _LIBFVDE_SECTOR_DATA_POOL_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfvde_libcerror.h"
+#include "libfvde_sector_data.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfvde_sector_data_pool libfvde_sector_data_pool_t;
+
+struct libfvde_sector_data_pool
+{
+	/* The sector data size
+	 */
+	size_t data_size;
+
+	/* The sector data available for reuse
+	 */
+	libfvde_sector_data_t **free_sector_data;
+
+	/* The number of sector data available for reuse
+	 */
+	int number_of_free_sector_data;
+
+	/* The maximum number of sector data available for reuse
+	 */
+	int maximum_number_of_free_sector_data;
+};
+
+int libfvde_sector_data_pool_initialize(
+     libfvde_sector_data_pool_t **sector_data_pool,
+     size_t data_size,
+     int maximum_number_of_free_sector_data,
+     libcerror_error_t **error );
+
+int libfvde_sector_data_pool_free(
+     libfvde_sector_data_pool_t **sector_data_pool,
+     libcerror_error_t **error );
+
+int libfvde_sector_data_pool_get_sector_data(
+     libfvde_sector_data_pool_t *sector_data_pool,
+     libfvde_sector_data_t **sector_data,
+     libcerror_error_t **error );
+
+int libfvde_sector_data_pool_release_sector_data(
+     libfvde_sector_data_pool_t *sector_data_pool,
+     libfvde_sector_data_t **sector_data,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFVDE_SECTOR_DATA_POOL_H ) */
+
@@ -38,6 +38,7 @@
 typedef struct libfvde_encryption_context_plist {}	libfvde_encryption_context_plist_t;
 typedef struct libfvde_logical_volume {}		libfvde_logical_volume_t;
 typedef struct libfvde_physical_volume {}		libfvde_physical_volume_t;
+typedef struct libfvde_read_queue {}			libfvde_read_queue_t;
 typedef struct libfvde_volume {}			libfvde_volume_t;
 typedef struct libfvde_volume_group {}			libfvde_volume_group_t;
 
@@ -45,6 +46,7 @@ typedef struct libfvde_volume_group {}			libfvde_volume_group_t;
 typedef intptr_t libfvde_encryption_context_plist_t;
 typedef intptr_t libfvde_logical_volume_t;
 typedef intptr_t libfvde_physical_volume_t;
+typedef intptr_t libfvde_read_queue_t;
 typedef intptr_t libfvde_volume_t;
 typedef intptr_t libfvde_volume_group_t;
 
@@ -29,6 +29,7 @@
 #include "libfvde_codepage.h"
 #include "libfvde_debug.h"
 #include "libfvde_definitions.h"
+#include "libfvde_direct_file_io_handle.h"
 #include "libfvde_encrypted_metadata.h"
 #include "libfvde_encryption_context_plist.h"
 #include "libfvde_io_handle.h"
@@ -38,7 +39,9 @@
 #include "libfvde_libcthreads.h"
 #include "libfvde_logical_volume.h"
 #include "libfvde_logical_volume_descriptor.h"
+#include "libfvde_mapped_file_io_handle.h"
 #include "libfvde_metadata.h"
+#include "libfvde_metadata_snapshot.h"
 #include "libfvde_password.h"
 #include "libfvde_volume.h"
 #include "libfvde_volume_group.h"
@@ -285,6 +288,22 @@ int libfvde_volume_free(
 				result = -1;
 			}
 		}
+		if( internal_volume->metadata_snapshot_file_io_handle != NULL )
+		{
+			if( libbfio_handle_free(
+			     &( internal_volume->metadata_snapshot_file_io_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free metadata snapshot file IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( libfvde_io_handle_free(
 		     &( internal_volume->io_handle ),
 		     error ) != 1 )
@@ -892,12 +911,7 @@ int libfvde_volume_open_physical_volume_files(
      int number_of_filenames,
      libcerror_error_t **error )
 {
-        libbfio_pool_t *file_io_pool               = NULL;
-	libfvde_internal_volume_t *internal_volume = NULL;
-	static char *function                      = "libfvde_volume_open_physical_volume_files";
-	int number_of_physical_volumes             = 0;
-	int physical_volume_index                  = 0;
-	int result                                 = 0;
+	static char *function = "libfvde_volume_open_physical_volume_files";
 
 	if( volume == NULL )
 	{
@@ -910,8 +924,154 @@ int libfvde_volume_open_physical_volume_files(
 
 		return( -1 );
 	}
-	internal_volume = (libfvde_internal_volume_t *) volume;
+	if( libfvde_internal_volume_open_physical_volume_files(
+	     (libfvde_internal_volume_t *) volume,
+	     filenames,
+	     number_of_filenames,
+	     LIBFVDE_FILE_IO_MODE_DEFAULT,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open physical volume files.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Opens the physical volume files as memory-mapped files
+ * Reads of the physical volume data are served from the mapping, so that data that is
+ * not cached does not require a system call per read. This is intended for physical
+ * volume files on local storage, where the page cache also reads ahead on access.
+ * This function assumes the physical volume files are in same order as defined by the metadata
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_volume_open_physical_volume_files_mapped(
+     libfvde_volume_t *volume,
+     char * const filenames[],
+     int number_of_filenames,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_volume_open_physical_volume_files_mapped";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvde_internal_volume_open_physical_volume_files(
+	     (libfvde_internal_volume_t *) volume,
+	     filenames,
+	     number_of_filenames,
+	     LIBFVDE_FILE_IO_MODE_MAPPED,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open physical volume files.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Opens the physical volume files for direct IO
+ * The physical volume data is read in aligned blocks of the volume block size and,
+ * where supported, bypasses the page cache. This is intended for bulk acquisition of
+ * large volumes, where caching the data read would evict other data from the page cache.
+ * This function assumes the physical volume files are in same order as defined by the metadata
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_volume_open_physical_volume_files_direct(
+     libfvde_volume_t *volume,
+     char * const filenames[],
+     int number_of_filenames,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_volume_open_physical_volume_files_direct";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvde_internal_volume_open_physical_volume_files(
+	     (libfvde_internal_volume_t *) volume,
+	     filenames,
+	     number_of_filenames,
+	     LIBFVDE_FILE_IO_MODE_DIRECT,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open physical volume files.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Opens the physical volume files
+ * The file IO mode determines how the physical volume files are opened
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_internal_volume_open_physical_volume_files(
+     libfvde_internal_volume_t *internal_volume,
+     char * const filenames[],
+     int number_of_filenames,
+     int file_io_mode,
+     libcerror_error_t **error )
+{
+        libbfio_pool_t *file_io_pool   = NULL;
+	static char *function          = "libfvde_internal_volume_open_physical_volume_files";
+	int number_of_physical_volumes = 0;
+	int physical_volume_index      = 0;
+	int result                     = 0;
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( filenames == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filenames.",
+		 function );
 
+		return( -1 );
+	}
 	if( internal_volume->physical_volume_file_io_pool != NULL )
 	{
 		libcerror_error_set(
@@ -1016,6 +1176,7 @@ int libfvde_volume_open_physical_volume_files(
 		     file_io_pool,
 		     physical_volume_index,
 		     filenames[ physical_volume_index ],
+		     file_io_mode,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -1105,12 +1266,7 @@ int libfvde_volume_open_physical_volume_files_wide(
      int number_of_filenames,
      libcerror_error_t **error )
 {
-        libbfio_pool_t *file_io_pool               = NULL;
-	libfvde_internal_volume_t *internal_volume = NULL;
-	static char *function                      = "libfvde_volume_open_physical_volume_files_wide";
-	int number_of_physical_volumes             = 0;
-	int physical_volume_index                  = 0;
-	int result                                 = 0;
+	static char *function = "libfvde_volume_open_physical_volume_files_wide";
 
 	if( volume == NULL )
 	{
@@ -1123,8 +1279,108 @@ int libfvde_volume_open_physical_volume_files_wide(
 
 		return( -1 );
 	}
-	internal_volume = (libfvde_internal_volume_t *) volume;
+	if( libfvde_internal_volume_open_physical_volume_files_wide(
+	     (libfvde_internal_volume_t *) volume,
+	     filenames,
+	     number_of_filenames,
+	     LIBFVDE_FILE_IO_MODE_DEFAULT,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open physical volume files.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Opens the physical volume files for direct IO
+ * The filenames are converted to narrow strings using the codepage of the system,
+ * otherwise this function behaves as libfvde_volume_open_physical_volume_files_direct
+ * This function assumes the physical volume files are in same order as defined by the metadata
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_volume_open_physical_volume_files_direct_wide(
+     libfvde_volume_t *volume,
+     wchar_t * const filenames[],
+     int number_of_filenames,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_volume_open_physical_volume_files_direct_wide";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvde_internal_volume_open_physical_volume_files_wide(
+	     (libfvde_internal_volume_t *) volume,
+	     filenames,
+	     number_of_filenames,
+	     LIBFVDE_FILE_IO_MODE_DIRECT,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open physical volume files.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Opens the physical volume files
+ * The file IO mode determines how the physical volume files are opened
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_internal_volume_open_physical_volume_files_wide(
+     libfvde_internal_volume_t *internal_volume,
+     wchar_t * const filenames[],
+     int number_of_filenames,
+     int file_io_mode,
+     libcerror_error_t **error )
+{
+        libbfio_pool_t *file_io_pool   = NULL;
+	static char *function          = "libfvde_internal_volume_open_physical_volume_files_wide";
+	int number_of_physical_volumes = 0;
+	int physical_volume_index      = 0;
+	int result                     = 0;
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( filenames == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filenames.",
+		 function );
 
+		return( -1 );
+	}
 	if( internal_volume->physical_volume_file_io_pool != NULL )
 	{
 		libcerror_error_set(
@@ -1229,6 +1485,7 @@ int libfvde_volume_open_physical_volume_files_wide(
 		     file_io_pool,
 		     physical_volume_index,
 		     filenames[ physical_volume_index ],
+		     file_io_mode,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -1397,6 +1654,7 @@ int libfvde_volume_open_physical_volume_files_file_io_pool(
 }
 
 /* Opens a specific physical volume file
+ * The file IO mode determines how the physical volume file is opened
  * Returns 1 if successful or -1 on error
  */
 int libfvde_internal_volume_open_physical_volume_file(
@@ -1404,6 +1662,7 @@ int libfvde_internal_volume_open_physical_volume_file(
      libbfio_pool_t *file_io_pool,
      int physical_volume_index,
      const char *filename,
+     int file_io_mode,
      libcerror_error_t **error )
 {
 	libbfio_handle_t *file_io_handle = NULL;
@@ -1432,62 +1691,102 @@ int libfvde_internal_volume_open_physical_volume_file(
 
 		return( -1 );
 	}
-	if( libbfio_file_initialize(
-	     &file_io_handle,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file IO handle.",
-		 function );
-
-		goto on_error;
-	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libbfio_handle_set_track_offsets_read(
-	     file_io_handle,
-	     1,
-	     error ) != 1 )
-	{
-                libcerror_error_set(
-                 error,
-                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-                 "%s: unable to set track offsets read in file IO handle.",
-                 function );
-
-                goto on_error;
-	}
-#endif
 	filename_length = narrow_string_length(
 	                   filename );
 
-	if( libbfio_file_set_name(
-	     file_io_handle,
-	     filename,
-	     filename_length + 1,
-	     error ) != 1 )
+	if( file_io_mode == LIBFVDE_FILE_IO_MODE_MAPPED )
 	{
-                libcerror_error_set(
-                 error,
-                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-                 "%s: unable to set filename in file IO handle.",
-                 function );
+		if( libfvde_mapped_file_initialize(
+		     &file_io_handle,
+		     filename,
+		     filename_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create memory-mapped file IO handle.",
+			 function );
 
-                goto on_error;
+			goto on_error;
+		}
 	}
-	if( libfvde_internal_volume_open_physical_volume_file_io_handle(
-	     internal_volume,
-	     file_io_pool,
-	     physical_volume_index,
-	     file_io_handle,
-	     error ) != 1 )
+	else if( file_io_mode == LIBFVDE_FILE_IO_MODE_DIRECT )
 	{
-		libcerror_error_set(
-		 error,
+		if( libfvde_direct_file_initialize(
+		     &file_io_handle,
+		     filename,
+		     filename_length,
+		     (size_t) internal_volume->io_handle->block_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create direct IO file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		if( libbfio_file_initialize(
+		     &file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		if( libbfio_file_set_name(
+		     file_io_handle,
+		     filename,
+		     filename_length + 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set filename in file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libbfio_handle_set_track_offsets_read(
+	     file_io_handle,
+	     1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set track offsets read in file IO handle.",
+                 function );
+
+                goto on_error;
+	}
+#endif
+	if( libfvde_internal_volume_open_physical_volume_file_io_handle(
+	     internal_volume,
+	     file_io_pool,
+	     physical_volume_index,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_OPEN_FAILED,
 		 "%s: unable to open physical volume file: %s.",
@@ -1518,6 +1817,7 @@ int libfvde_internal_volume_open_physical_volume_file_wide(
      libbfio_pool_t *file_io_pool,
      int physical_volume_index,
      const wchar_t *filename,
+     int file_io_mode,
      libcerror_error_t **error )
 {
 	libbfio_handle_t *file_io_handle = NULL;
@@ -1546,18 +1846,69 @@ int libfvde_internal_volume_open_physical_volume_file_wide(
 
 		return( -1 );
 	}
-	if( libbfio_file_initialize(
-	     &file_io_handle,
-	     error ) != 1 )
+	filename_length = wide_string_length(
+	                   filename );
+
+	if( file_io_mode == LIBFVDE_FILE_IO_MODE_MAPPED )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported file IO mode - memory-mapped files require a narrow filename.",
 		 function );
 
-                goto on_error;
+		goto on_error;
+	}
+	else if( file_io_mode == LIBFVDE_FILE_IO_MODE_DIRECT )
+	{
+		if( libfvde_direct_file_initialize_wide(
+		     &file_io_handle,
+		     filename,
+		     filename_length,
+		     (size_t) internal_volume->io_handle->block_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create direct IO file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		if( libbfio_file_initialize(
+		     &file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		if( libbfio_file_set_name_wide(
+		     file_io_handle,
+		     filename,
+		     filename_length + 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set filename in file IO handle.",
+			 function );
+
+			goto on_error;
+		}
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libbfio_handle_set_track_offsets_read(
@@ -1575,24 +1926,6 @@ int libfvde_internal_volume_open_physical_volume_file_wide(
                 goto on_error;
 	}
 #endif
-	filename_length = wide_string_length(
-	                   filename );
-
-	if( libbfio_file_set_name_wide(
-	     file_io_handle,
-	     filename,
-	     filename_length + 1,
-	     error ) != 1 )
-	{
-                libcerror_error_set(
-                 error,
-                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-                 "%s: unable to set filename in file IO handle.",
-                 function );
-
-                goto on_error;
-	}
 	if( libfvde_internal_volume_open_physical_volume_file_io_handle(
 	     internal_volume,
 	     file_io_pool,
@@ -1954,6 +2287,24 @@ int libfvde_volume_close(
 			result = -1;
 		}
 	}
+	if( internal_volume->metadata_snapshot_encrypted_metadata != NULL )
+	{
+		if( libfvde_encrypted_metadata_free(
+		     &( internal_volume->metadata_snapshot_encrypted_metadata ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free metadata snapshot encrypted metadata.",
+			 function );
+
+			result = -1;
+		}
+	}
+	internal_volume->metadata_snapshot_was_read = 0;
+
 	if( internal_volume->legacy_logical_volume != NULL )
 	{
 		if( libfvde_logical_volume_free(
@@ -2134,84 +2485,134 @@ int libfvde_internal_volume_open_read(
 
 		goto on_error;
 	}
-	internal_volume->io_handle->serial_number    = internal_volume->volume_header->serial_number;
-	internal_volume->io_handle->bytes_per_sector = internal_volume->volume_header->bytes_per_sector;
-	internal_volume->io_handle->block_size       = internal_volume->volume_header->block_size;
-	internal_volume->io_handle->metadata_size    = internal_volume->volume_header->metadata_size;
+	internal_volume->io_handle->serial_number                = internal_volume->volume_header->serial_number;
+	internal_volume->io_handle->bytes_per_sector             = internal_volume->volume_header->bytes_per_sector;
+	internal_volume->io_handle->block_size                   = internal_volume->volume_header->block_size;
+	internal_volume->io_handle->metadata_size                = internal_volume->volume_header->metadata_size;
+	internal_volume->io_handle->maximum_cache_size           = internal_volume->maximum_cache_size;
+	internal_volume->io_handle->cache_unit_size              = internal_volume->cache_unit_size;
+	internal_volume->io_handle->number_of_decryption_threads = internal_volume->number_of_decryption_threads;
 
-	for( metadata_index = 0;
-	     metadata_index < 4;
-	     metadata_index++ )
+	if( internal_volume->metadata_snapshot_file_io_handle != NULL )
 	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "Reading metadata: %d\n",
-			 metadata_index + 1 );
-		}
-#endif
-		if( libfvde_metadata_initialize(
-		     &metadata,
-		     error ) != 1 )
+		if( libfvde_internal_volume_open_read_metadata_snapshot(
+		     internal_volume,
+		     file_io_handle,
+		     error ) == -1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create metadata: %d.",
-			 function,
-			 metadata_index + 1 );
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read metadata snapshot.",
+			 function );
 
 			goto on_error;
 		}
-		metadata_offset = (off64_t) internal_volume->volume_header->metadata_offsets[ metadata_index ];
-
-		if( libfvde_metadata_read_file_io_handle(
-		     metadata,
-		     internal_volume->io_handle,
+	}
+	if( internal_volume->metadata_snapshot_was_read != 0 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "Read metadata from metadata snapshot.\n" );
+		}
+#endif
+	}
+	else if( internal_volume->fast_open != 0 )
+	{
+		if( libfvde_internal_volume_open_read_newest_metadata(
+		     internal_volume,
 		     file_io_handle,
-		     metadata_offset,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
 			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read metadata: %d at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-			 function,
-			 metadata_index + 1,
-			 metadata_offset,
-			 metadata_offset );
+			 "%s: unable to read newest metadata.",
+			 function );
 
 			goto on_error;
 		}
-		if( internal_volume->metadata == NULL )
-		{
-			internal_volume->metadata = metadata;
-			metadata                  = NULL;
-		}
-		else if( metadata->transaction_identifier > internal_volume->metadata->transaction_identifier )
-		{
-			safe_metadata             = internal_volume->metadata;
-			internal_volume->metadata = metadata;
-			metadata                  = safe_metadata;
-		}
-		if( metadata != NULL )
+	}
+	else
+	{
+		for( metadata_index = 0;
+		     metadata_index < 4;
+		     metadata_index++ )
 		{
-			if( libfvde_metadata_free(
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "Reading metadata: %d\n",
+				 metadata_index + 1 );
+			}
+#endif
+			if( libfvde_metadata_initialize(
 			     &metadata,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free metadata.",
-				 function );
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create metadata: %d.",
+				 function,
+				 metadata_index + 1 );
+
+				goto on_error;
+			}
+			metadata_offset = (off64_t) internal_volume->volume_header->metadata_offsets[ metadata_index ];
+
+			if( libfvde_metadata_read_file_io_handle(
+			     metadata,
+			     internal_volume->io_handle,
+			     file_io_handle,
+			     metadata_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read metadata: %d at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 metadata_index + 1,
+				 metadata_offset,
+				 metadata_offset );
 
 				goto on_error;
 			}
+			if( internal_volume->metadata == NULL )
+			{
+				internal_volume->metadata = metadata;
+				metadata                  = NULL;
+			}
+			else if( metadata->transaction_identifier > internal_volume->metadata->transaction_identifier )
+			{
+				safe_metadata             = internal_volume->metadata;
+				internal_volume->metadata = metadata;
+				metadata                  = safe_metadata;
+			}
+			if( metadata != NULL )
+			{
+				if( libfvde_metadata_free(
+				     &metadata,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free metadata.",
+					 function );
+
+					goto on_error;
+				}
+			}
 		}
 	}
 	if( libfvde_metadata_get_number_of_physical_volume_descriptors(
@@ -2490,6 +2891,14 @@ on_error:
 		 &( internal_volume->legacy_file_io_pool ),
 		 NULL );
 	}
+	if( internal_volume->metadata_snapshot_encrypted_metadata != NULL )
+	{
+		libfvde_encrypted_metadata_free(
+		 &( internal_volume->metadata_snapshot_encrypted_metadata ),
+		 NULL );
+	}
+	internal_volume->metadata_snapshot_was_read = 0;
+
 	if( internal_volume->metadata != NULL )
 	{
 		libfvde_metadata_free(
@@ -2511,22 +2920,24 @@ on_error:
 	return( -1 );
 }
 
-/* Opens the physical volume files for reading
+/* Reads the metadata with the highest transaction identifier
+ * The transaction identifiers are read from the metadata block headers first so that
+ * only the newest copy is parsed, the older copies are only read if the newer copy is corrupt
  * Returns 1 if successful or -1 on error
  */
-int libfvde_internal_volume_open_read_physical_volume_files(
+int libfvde_internal_volume_open_read_newest_metadata(
      libfvde_internal_volume_t *internal_volume,
-     libbfio_pool_t *file_io_pool,
+     libbfio_handle_t *file_io_handle,
      libcerror_error_t **error )
 {
-	libbfio_handle_t *file_io_handle                                 = NULL;
-	libfvde_physical_volume_descriptor_t *physical_volume_descriptor = NULL;
-	libfvde_volume_header_t *volume_header                           = NULL;
-	static char *function                                            = "libfvde_internal_volume_open_read";
-	int file_io_handle_is_open                                       = 0;
-	int file_io_pool_entry                                           = 0;
-	int number_of_file_io_handles                                    = 0;
-	int number_of_physical_volumes                                   = 0;
+	uint64_t transaction_identifiers[ 4 ];
+	uint8_t is_candidate[ 4 ];
+
+	static char *function     = "libfvde_internal_volume_open_read_newest_metadata";
+	off64_t metadata_offset   = 0;
+	int metadata_index        = 0;
+	int newest_metadata_index = 0;
+	int result                = 0;
 
 	if( internal_volume == NULL )
 	{
@@ -2550,18 +2961,203 @@ int libfvde_internal_volume_open_read_physical_volume_files(
 
 		return( -1 );
 	}
-	if( internal_volume->metadata == NULL )
+	if( internal_volume->metadata != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid volume - missing metadata.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - metadata value already set.",
 		 function );
 
 		return( -1 );
 	}
-/* TODO remove, for backwards compatibility
+	for( metadata_index = 0;
+	     metadata_index < 4;
+	     metadata_index++ )
+	{
+		metadata_offset = (off64_t) internal_volume->volume_header->metadata_offsets[ metadata_index ];
+
+		result = libfvde_metadata_read_transaction_identifier_file_io_handle(
+		          file_io_handle,
+		          metadata_offset,
+		          &( transaction_identifiers[ metadata_index ] ),
+		          error );
+
+		if( result == -1 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
+		is_candidate[ metadata_index ] = (uint8_t) ( result == 1 );
+	}
+	while( internal_volume->metadata == NULL )
+	{
+		newest_metadata_index = -1;
+
+		for( metadata_index = 0;
+		     metadata_index < 4;
+		     metadata_index++ )
+		{
+			if( ( is_candidate[ metadata_index ] != 0 )
+			 && ( ( newest_metadata_index == -1 )
+			  || ( transaction_identifiers[ metadata_index ] > transaction_identifiers[ newest_metadata_index ] ) ) )
+			{
+				newest_metadata_index = metadata_index;
+			}
+		}
+		if( newest_metadata_index == -1 )
+		{
+			break;
+		}
+		is_candidate[ newest_metadata_index ] = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "Reading metadata: %d\n",
+			 newest_metadata_index + 1 );
+		}
+#endif
+		if( libfvde_metadata_initialize(
+		     &( internal_volume->metadata ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create metadata: %d.",
+			 function,
+			 newest_metadata_index + 1 );
+
+			return( -1 );
+		}
+		metadata_offset = (off64_t) internal_volume->volume_header->metadata_offsets[ newest_metadata_index ];
+
+		if( libfvde_metadata_read_file_io_handle(
+		     internal_volume->metadata,
+		     internal_volume->io_handle,
+		     file_io_handle,
+		     metadata_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read metadata: %d at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 newest_metadata_index + 1,
+			 metadata_offset,
+			 metadata_offset );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+#endif
+			libcerror_error_free(
+			 error );
+
+			if( libfvde_metadata_free(
+			     &( internal_volume->metadata ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free metadata.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	if( internal_volume->metadata == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read a valid metadata copy.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Opens the physical volume files for reading
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_internal_volume_open_read_physical_volume_files(
+     libfvde_internal_volume_t *internal_volume,
+     libbfio_pool_t *file_io_pool,
+     libcerror_error_t **error )
+{
+	uint64_t encrypted_metadata_transaction_identifiers[ 2 ];
+	uint8_t encrypted_metadata_keys[ 2 ][ 32 ];
+	uint8_t encrypted_metadata_is_candidate[ 2 ];
+
+	libbfio_handle_t *file_io_handle                                 = NULL;
+	libfvde_physical_volume_descriptor_t *physical_volume_descriptor = NULL;
+	libfvde_volume_header_t *volume_header                           = NULL;
+	static char *function                                            = "libfvde_internal_volume_open_read";
+	off64_t encrypted_metadata_offset                                = 0;
+	uint16_t encrypted_metadata_volume_index                         = 0;
+	int encrypted_metadata_index                                     = 0;
+	int file_io_handle_is_open                                       = 0;
+	int file_io_pool_entry                                           = 0;
+	int number_of_file_io_handles                                    = 0;
+	int number_of_physical_volumes                                   = 0;
+	int result                                                       = 0;
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->volume_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing volume header.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->metadata == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing metadata.",
+		 function );
+
+		return( -1 );
+	}
+/* TODO remove, for backwards compatibility
  */
 	if( internal_volume->encrypted_metadata1 != NULL )
 	{
@@ -2628,6 +3224,9 @@ int libfvde_internal_volume_open_read_physical_volume_files(
 
 		goto on_error;
 	}
+	encrypted_metadata_is_candidate[ 0 ] = 0;
+	encrypted_metadata_is_candidate[ 1 ] = 0;
+
 	for( file_io_pool_entry = 0;
 	     file_io_pool_entry < number_of_file_io_handles;
 	     file_io_pool_entry++ )
@@ -2767,92 +3366,180 @@ int libfvde_internal_volume_open_read_physical_volume_files(
 		}
 /* TODO determine physical volume index and check with pool
  */
-		if( file_io_pool_entry == internal_volume->metadata->encrypted_metadata1_volume_index )
+		if( internal_volume->metadata_snapshot_encrypted_metadata != NULL )
 		{
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
+			/* The encrypted metadata was read from the metadata snapshot
+			 */
+		}
+		else if( internal_volume->fast_open != 0 )
+		{
+			/* Only the first block of the encrypted metadata copies is read here
+			 * the newest copy is read after all physical volumes have been opened
+			 */
+			for( encrypted_metadata_index = 0;
+			     encrypted_metadata_index < 2;
+			     encrypted_metadata_index++ )
 			{
-				libcnotify_printf(
-				 "Reading encrypted metadata 1:\n" );
-			}
+				if( encrypted_metadata_index == 0 )
+				{
+					encrypted_metadata_volume_index = internal_volume->metadata->encrypted_metadata1_volume_index;
+					encrypted_metadata_offset       = (off64_t) internal_volume->metadata->encrypted_metadata1_offset;
+				}
+				else
+				{
+					encrypted_metadata_volume_index = internal_volume->metadata->encrypted_metadata2_volume_index;
+					encrypted_metadata_offset       = (off64_t) internal_volume->metadata->encrypted_metadata2_offset;
+				}
+				if( file_io_pool_entry != (int) encrypted_metadata_volume_index )
+				{
+					continue;
+				}
+				result = libfvde_encrypted_metadata_read_transaction_identifier_file_io_handle(
+				          internal_volume->io_handle,
+				          file_io_handle,
+				          encrypted_metadata_offset,
+				          volume_header->key_data,
+				          128,
+				          volume_header->physical_volume_identifier,
+				          128,
+				          &( encrypted_metadata_transaction_identifiers[ encrypted_metadata_index ] ),
+				          error );
+
+				if( result == -1 )
+				{
+#if defined( HAVE_DEBUG_OUTPUT )
+					if( libcnotify_verbose != 0 )
+					{
+						libcnotify_print_error_backtrace(
+						 *error );
+					}
 #endif
-			if( libfvde_encrypted_metadata_initialize(
-			     &( internal_volume->encrypted_metadata1 ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create encrypted metadata 1.",
-				 function );
+					libcerror_error_free(
+					 error );
+				}
+				else if( result != 0 )
+				{
+					if( memory_copy(
+					     &( encrypted_metadata_keys[ encrypted_metadata_index ][ 0 ] ),
+					     volume_header->key_data,
+					     16 ) == NULL )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_MEMORY,
+						 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+						 "%s: unable to copy key data.",
+						 function );
 
-				goto on_error;
-			}
-			if( libfvde_encrypted_metadata_read_from_file_io_handle(
-			     internal_volume->encrypted_metadata1,
-			     internal_volume->io_handle,
-			     file_io_handle,
-			     (off64_t) internal_volume->metadata->encrypted_metadata1_offset,
-			     internal_volume->metadata->encrypted_metadata_size,
-			     volume_header->key_data,
-			     128,
-			     volume_header->physical_volume_identifier,
-			     128,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read encrypted metadata 1.",
-				 function );
+						goto on_error;
+					}
+					if( memory_copy(
+					     &( encrypted_metadata_keys[ encrypted_metadata_index ][ 16 ] ),
+					     volume_header->physical_volume_identifier,
+					     16 ) == NULL )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_MEMORY,
+						 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+						 "%s: unable to copy physical volume identifier.",
+						 function );
 
-				goto on_error;
+						goto on_error;
+					}
+					encrypted_metadata_is_candidate[ encrypted_metadata_index ] = 1;
+				}
 			}
 		}
-		if( file_io_pool_entry == internal_volume->metadata->encrypted_metadata2_volume_index )
+		else
 		{
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
+			if( file_io_pool_entry == internal_volume->metadata->encrypted_metadata1_volume_index )
 			{
-				libcnotify_printf(
-				 "Reading encrypted metadata 2:\n" );
-			}
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "Reading encrypted metadata 1:\n" );
+				}
 #endif
-			if( libfvde_encrypted_metadata_initialize(
-			     &( internal_volume->encrypted_metadata2 ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create encrypted metadata 2.",
-				 function );
+				if( libfvde_encrypted_metadata_initialize(
+				     &( internal_volume->encrypted_metadata1 ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create encrypted metadata 1.",
+					 function );
 
-				goto on_error;
+					goto on_error;
+				}
+				if( libfvde_encrypted_metadata_read_from_file_io_handle(
+				     internal_volume->encrypted_metadata1,
+				     internal_volume->io_handle,
+				     file_io_handle,
+				     (off64_t) internal_volume->metadata->encrypted_metadata1_offset,
+				     internal_volume->metadata->encrypted_metadata_size,
+				     volume_header->key_data,
+				     128,
+				     volume_header->physical_volume_identifier,
+				     128,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read encrypted metadata 1.",
+					 function );
+
+					goto on_error;
+				}
 			}
-			if( libfvde_encrypted_metadata_read_from_file_io_handle(
-			     internal_volume->encrypted_metadata2,
-			     internal_volume->io_handle,
-			     file_io_handle,
-			     (off64_t) internal_volume->metadata->encrypted_metadata2_offset,
-			     internal_volume->metadata->encrypted_metadata_size,
-			     volume_header->key_data,
-			     128,
-			     volume_header->physical_volume_identifier,
-			     128,
-			     error ) != 1 )
+			if( file_io_pool_entry == internal_volume->metadata->encrypted_metadata2_volume_index )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read encrypted metadata 2.",
-				 function );
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "Reading encrypted metadata 2:\n" );
+				}
+#endif
+				if( libfvde_encrypted_metadata_initialize(
+				     &( internal_volume->encrypted_metadata2 ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create encrypted metadata 2.",
+					 function );
 
-				goto on_error;
+					goto on_error;
+				}
+				if( libfvde_encrypted_metadata_read_from_file_io_handle(
+				     internal_volume->encrypted_metadata2,
+				     internal_volume->io_handle,
+				     file_io_handle,
+				     (off64_t) internal_volume->metadata->encrypted_metadata2_offset,
+				     internal_volume->metadata->encrypted_metadata_size,
+				     volume_header->key_data,
+				     128,
+				     volume_header->physical_volume_identifier,
+				     128,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read encrypted metadata 2.",
+					 function );
+
+					goto on_error;
+				}
 			}
 		}
 		if( libfvde_volume_header_free(
@@ -2869,6 +3556,146 @@ int libfvde_internal_volume_open_read_physical_volume_files(
 			goto on_error;
 		}
 	}
+	if( internal_volume->metadata_snapshot_encrypted_metadata != NULL )
+	{
+		internal_volume->encrypted_metadata1                  = internal_volume->metadata_snapshot_encrypted_metadata;
+		internal_volume->metadata_snapshot_encrypted_metadata = NULL;
+	}
+	else if( internal_volume->fast_open != 0 )
+	{
+		/* The newest copy is stored as encrypted metadata 1, the other copy is only read
+		 * if the newest copy is corrupt
+		 */
+		while( internal_volume->encrypted_metadata1 == NULL )
+		{
+			if( ( encrypted_metadata_is_candidate[ 1 ] != 0 )
+			 && ( ( encrypted_metadata_is_candidate[ 0 ] == 0 )
+			  || ( encrypted_metadata_transaction_identifiers[ 1 ] > encrypted_metadata_transaction_identifiers[ 0 ] ) ) )
+			{
+				encrypted_metadata_index        = 1;
+				encrypted_metadata_volume_index = internal_volume->metadata->encrypted_metadata2_volume_index;
+				encrypted_metadata_offset       = (off64_t) internal_volume->metadata->encrypted_metadata2_offset;
+			}
+			else if( encrypted_metadata_is_candidate[ 0 ] != 0 )
+			{
+				encrypted_metadata_index        = 0;
+				encrypted_metadata_volume_index = internal_volume->metadata->encrypted_metadata1_volume_index;
+				encrypted_metadata_offset       = (off64_t) internal_volume->metadata->encrypted_metadata1_offset;
+			}
+			else
+			{
+				break;
+			}
+			encrypted_metadata_is_candidate[ encrypted_metadata_index ] = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "Reading encrypted metadata %d:\n",
+				 encrypted_metadata_index + 1 );
+			}
+#endif
+			if( libbfio_pool_get_handle(
+			     file_io_pool,
+			     (int) encrypted_metadata_volume_index,
+			     &file_io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve file IO handle: %" PRIu16 " from pool.",
+				 function,
+				 encrypted_metadata_volume_index );
+
+				goto on_error;
+			}
+			if( libfvde_encrypted_metadata_initialize(
+			     &( internal_volume->encrypted_metadata1 ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create encrypted metadata.",
+				 function );
+
+				goto on_error;
+			}
+			if( libfvde_encrypted_metadata_read_from_file_io_handle(
+			     internal_volume->encrypted_metadata1,
+			     internal_volume->io_handle,
+			     file_io_handle,
+			     encrypted_metadata_offset,
+			     internal_volume->metadata->encrypted_metadata_size,
+			     &( encrypted_metadata_keys[ encrypted_metadata_index ][ 0 ] ),
+			     128,
+			     &( encrypted_metadata_keys[ encrypted_metadata_index ][ 16 ] ),
+			     128,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read encrypted metadata %d.",
+				 function,
+				 encrypted_metadata_index + 1 );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+#endif
+				libcerror_error_free(
+				 error );
+
+				if( libfvde_encrypted_metadata_free(
+				     &( internal_volume->encrypted_metadata1 ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free encrypted metadata.",
+					 function );
+
+					goto on_error;
+				}
+			}
+		}
+		if( memory_set(
+		     encrypted_metadata_keys,
+		     0,
+		     sizeof( encrypted_metadata_keys ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear encrypted metadata keys.",
+			 function );
+
+			goto on_error;
+		}
+		if( internal_volume->encrypted_metadata1 == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read a valid encrypted metadata copy.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	if( internal_volume->encrypted_root_plist != NULL )
 	{
 		if( libfvde_encryption_context_plist_decrypt(
@@ -2887,9 +3714,41 @@ int libfvde_internal_volume_open_read_physical_volume_files(
 			goto on_error;
 		}
 	}
+	if( ( internal_volume->metadata_snapshot_file_io_handle != NULL )
+	 && ( internal_volume->metadata_snapshot_was_read == 0 ) )
+	{
+		/* Failing to write the metadata snapshot does not prevent the volume from being used
+		 */
+		if( libfvde_internal_volume_write_metadata_snapshot(
+		     internal_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write metadata snapshot.",
+			 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
+	}
 	return( 1 );
 
 on_error:
+	memory_set(
+	 encrypted_metadata_keys,
+	 0,
+	 sizeof( encrypted_metadata_keys ) );
+
 	if( internal_volume->encrypted_metadata2 != NULL )
 	{
 		libfvde_encrypted_metadata_free(
@@ -2911,20 +3770,28 @@ on_error:
 	return( -1 );
 }
 
-/* Reads the EncryptedRoot.plist file
- * This function needs to be used before one of the open or unlock functions
- * Returns 1 if successful or -1 on error
+/* Reads the metadata and encrypted metadata from the metadata snapshot file
+ * The metadata snapshot is only used if it matches the volume group identifier, the physical volume
+ * identifier and the transaction identifier of the newest metadata copy in the volume
+ * Returns 1 if successful, 0 if the metadata snapshot was not used or -1 on error
  */
-int libfvde_volume_read_encrypted_root_plist(
-     libfvde_volume_t *volume,
-     const char *filename,
+int libfvde_internal_volume_open_read_metadata_snapshot(
+     libfvde_internal_volume_t *internal_volume,
+     libbfio_handle_t *file_io_handle,
      libcerror_error_t **error )
 {
-	libbfio_handle_t *file_io_handle = NULL;
-	static char *function            = "libfvde_volume_read_encrypted_root_plist";
-	size_t filename_length           = 0;
+	libfvde_encrypted_metadata_t *encrypted_metadata = NULL;
+	libfvde_metadata_t *metadata                     = NULL;
+	static char *function                            = "libfvde_internal_volume_open_read_metadata_snapshot";
+	uint64_t newest_transaction_identifier           = 0;
+	uint64_t transaction_identifier                  = 0;
+	off64_t metadata_offset                          = 0;
+	uint8_t snapshot_file_is_open                    = 0;
+	int metadata_index                               = 0;
+	int newest_metadata_index                        = -1;
+	int result                                       = 0;
 
-	if( volume == NULL )
+	if( internal_volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -2935,102 +3802,1115 @@ int libfvde_volume_read_encrypted_root_plist(
 
 		return( -1 );
 	}
-	filename_length = narrow_string_length(
-	                   filename );
+	if( internal_volume->volume_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing volume header.",
+		 function );
 
-	if( filename_length == 0 )
+		return( -1 );
+	}
+	if( internal_volume->metadata != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filename.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - metadata value already set.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libbfio_file_initialize(
-	     &file_io_handle,
-	     error ) != 1 )
+	if( internal_volume->metadata_snapshot_file_io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing metadata snapshot file IO handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libbfio_file_set_name(
-	     file_io_handle,
-	     filename,
-	     filename_length,
-	     error ) != 1 )
+	if( internal_volume->metadata_snapshot_encrypted_metadata != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set filename in file IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - metadata snapshot encrypted metadata value already set.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libfvde_volume_read_encrypted_root_plist_file_io_handle(
-	     volume,
-	     file_io_handle,
+	/* Only the metadata block headers are read to determine the newest transaction identifier
+	 */
+	for( metadata_index = 0;
+	     metadata_index < 4;
+	     metadata_index++ )
+	{
+		metadata_offset = (off64_t) internal_volume->volume_header->metadata_offsets[ metadata_index ];
+
+		result = libfvde_metadata_read_transaction_identifier_file_io_handle(
+		          file_io_handle,
+		          metadata_offset,
+		          &transaction_identifier,
+		          error );
+
+		if( result == -1 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
+		else if( result != 0 )
+		{
+			if( ( newest_metadata_index == -1 )
+			 || ( transaction_identifier > newest_transaction_identifier ) )
+			{
+				newest_metadata_index         = metadata_index;
+				newest_transaction_identifier = transaction_identifier;
+			}
+		}
+	}
+	if( newest_metadata_index == -1 )
+	{
+		return( 0 );
+	}
+	/* A missing metadata snapshot file is not considered an error
+	 */
+	if( libbfio_handle_open(
+	     internal_volume->metadata_snapshot_file_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     error ) != 1 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_error_backtrace(
+			 *error );
+		}
+#endif
+		libcerror_error_free(
+		 error );
+
+		return( 0 );
+	}
+	snapshot_file_is_open = 1;
+
+	if( libfvde_metadata_initialize(
+	     &metadata,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read encrypted root plist file: %s.",
-		 function,
-		 filename );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create metadata.",
+		 function );
 
 		goto on_error;
 	}
-	if( libbfio_handle_free(
-	     &file_io_handle,
+	if( libfvde_encrypted_metadata_initialize(
+	     &encrypted_metadata,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free file IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create encrypted metadata.",
 		 function );
 
 		goto on_error;
 	}
-	return( 1 );
+	result = libfvde_metadata_snapshot_read_file_io_handle(
+	          metadata,
+	          encrypted_metadata,
+	          internal_volume->volume_header->volume_group_identifier,
+	          internal_volume->volume_header->physical_volume_identifier,
+	          newest_transaction_identifier,
+	          internal_volume->metadata_snapshot_file_io_handle,
+	          error );
 
-on_error:
-	if( file_io_handle != NULL )
+	if( result == -1 )
 	{
-		libbfio_handle_free(
-		 &file_io_handle,
-		 NULL );
-	}
-	return( -1 );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read metadata snapshot.",
+		 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_error_backtrace(
+			 *error );
+		}
+#endif
+		libcerror_error_free(
+		 error );
+
+		result = 0;
+	}
+	snapshot_file_is_open = 0;
+
+	if( libbfio_handle_close(
+	     internal_volume->metadata_snapshot_file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close metadata snapshot file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( result == 0 )
+	{
+		if( libfvde_encrypted_metadata_free(
+		     &encrypted_metadata,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free encrypted metadata.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfvde_metadata_free(
+		     &metadata,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free metadata.",
+			 function );
+
+			goto on_error;
+		}
+		return( 0 );
+	}
+	internal_volume->metadata                             = metadata;
+	internal_volume->metadata_snapshot_encrypted_metadata = encrypted_metadata;
+	internal_volume->metadata_snapshot_was_read           = 1;
+
+	return( 1 );
+
+on_error:
+	if( encrypted_metadata != NULL )
+	{
+		libfvde_encrypted_metadata_free(
+		 &encrypted_metadata,
+		 NULL );
+	}
+	if( metadata != NULL )
+	{
+		libfvde_metadata_free(
+		 &metadata,
+		 NULL );
+	}
+	if( snapshot_file_is_open != 0 )
+	{
+		libbfio_handle_close(
+		 internal_volume->metadata_snapshot_file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Writes the metadata and encrypted metadata to the metadata snapshot file
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_internal_volume_write_metadata_snapshot(
+     libfvde_internal_volume_t *internal_volume,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_internal_volume_write_metadata_snapshot";
+	int result            = 0;
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->volume_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing volume header.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->metadata_snapshot_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing metadata snapshot file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_open(
+	     internal_volume->metadata_snapshot_file_io_handle,
+	     LIBBFIO_OPEN_WRITE_TRUNCATE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open metadata snapshot file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfvde_metadata_snapshot_write_file_io_handle(
+	          internal_volume->metadata,
+	          internal_volume->encrypted_metadata1,
+	          internal_volume->volume_header->volume_group_identifier,
+	          internal_volume->metadata_snapshot_file_io_handle,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write metadata snapshot.",
+		 function );
+	}
+	if( libbfio_handle_close(
+	     internal_volume->metadata_snapshot_file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close metadata snapshot file IO handle.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Reads the EncryptedRoot.plist file
+ * This function needs to be used before one of the open or unlock functions
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_volume_read_encrypted_root_plist(
+     libfvde_volume_t *volume,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libfvde_volume_read_encrypted_root_plist";
+	size_t filename_length           = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	filename_length = narrow_string_length(
+	                   filename );
+
+	if( filename_length == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfvde_volume_read_encrypted_root_plist_file_io_handle(
+	     volume,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read encrypted root plist file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Reads the EncryptedRoot.plist file
+ * This function needs to be used before one of the open or unlock functions
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_volume_read_encrypted_root_plist_wide(
+     libfvde_volume_t *volume,
+     const wchar_t *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libfvde_volume_read_encrypted_root_plist_wide";
+	size_t filename_length           = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	filename_length = wide_string_length(
+	                   filename );
+
+	if( filename_length == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfvde_volume_read_encrypted_root_plist_file_io_handle(
+	     volume,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read encrypted root plist file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Reads the EncryptedRoot.plist file using a Basic File IO (bfio) handle
+ * This function needs to be used before one of the open or unlock functions
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_volume_read_encrypted_root_plist_file_io_handle(
+     libfvde_volume_t *volume,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libfvde_internal_volume_t *internal_volume = NULL;
+	static char *function                      = "libfvde_volume_read_encrypted_root_plist_file_io_handle";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfvde_internal_volume_t *) volume;
+
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_volume->encrypted_root_plist != NULL )
+	{
+		if( libfvde_encryption_context_plist_free(
+		     &( internal_volume->encrypted_root_plist ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free encrypted root plist.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libfvde_encryption_context_plist_initialize(
+	     &( internal_volume->encrypted_root_plist ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create encrypted root plist.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfvde_encryption_context_plist_read_file_io_handle(
+	     internal_volume->encrypted_root_plist,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to read encrypted root plist.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( internal_volume->encrypted_root_plist != NULL )
+	{
+		libfvde_encryption_context_plist_free(
+		 &( internal_volume->encrypted_root_plist ),
+		 NULL );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_volume->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves the volume group
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_volume_get_volume_group(
+     libfvde_volume_t *volume,
+     libfvde_volume_group_t **volume_group,
+     libcerror_error_t **error )
+{
+	libfvde_internal_volume_t *internal_volume = NULL;
+	static char *function                      = "libfvde_volume_get_volume_group";
+	int result                                 = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfvde_internal_volume_t *) volume;
+
+	if( internal_volume->volume_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing volume header.",
+		 function );
+
+		return( -1 );
+	}
+	if( volume_group == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume group.",
+		 function );
+
+		return( -1 );
+	}
+	if( *volume_group != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume group value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfvde_volume_group_initialize(
+	      volume_group,
+	      internal_volume->io_handle,
+	      internal_volume->physical_volume_file_io_pool,
+	      internal_volume->volume_header,
+	      internal_volume->metadata,
+	      internal_volume->encrypted_metadata1,
+	      internal_volume->encrypted_root_plist,
+	      error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create volume group.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Sets the maximum cache size of the logical volumes in bytes
+ * A value of 0 represents the default cache size
+ * The value applies to logical volumes retrieved after this function is used
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_volume_set_maximum_cache_size(
+     libfvde_volume_t *volume,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error )
+{
+	libfvde_internal_volume_t *internal_volume = NULL;
+	static char *function                      = "libfvde_volume_set_maximum_cache_size";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfvde_internal_volume_t *) volume;
+
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_volume->maximum_cache_size = maximum_cache_size;
+
+	internal_volume->io_handle->maximum_cache_size = maximum_cache_size;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the cache unit size of the logical volumes in bytes
+ * The cache unit size must be a power of 2 of 512 or more, where a value of 0
+ * represents the number of bytes per sector
+ * The value applies to logical volumes retrieved after this function is used
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_volume_set_cache_unit_size(
+     libfvde_volume_t *volume,
+     uint32_t cache_unit_size,
+     libcerror_error_t **error )
+{
+	libfvde_internal_volume_t *internal_volume = NULL;
+	static char *function                      = "libfvde_volume_set_cache_unit_size";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfvde_internal_volume_t *) volume;
+
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( cache_unit_size != 0 )
+	 && ( ( cache_unit_size < 512 )
+	  ||  ( cache_unit_size > LIBFVDE_MAXIMUM_CACHE_UNIT_SIZE )
+	  ||  ( ( cache_unit_size & ( cache_unit_size - 1 ) ) != 0 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported cache unit size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_volume->cache_unit_size = cache_unit_size;
+
+	internal_volume->io_handle->cache_unit_size = cache_unit_size;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the number of decryption threads of the logical volumes
+ * Large reads are decrypted concurrently by the decryption threads, where a value of 0
+ * represents decryption on the calling thread
+ * The value applies to logical volumes unlocked after this function is used
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_volume_set_number_of_decryption_threads(
+     libfvde_volume_t *volume,
+     int number_of_decryption_threads,
+     libcerror_error_t **error )
+{
+	libfvde_internal_volume_t *internal_volume = NULL;
+	static char *function                      = "libfvde_volume_set_number_of_decryption_threads";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfvde_internal_volume_t *) volume;
+
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_decryption_threads < 0 )
+	 || ( number_of_decryption_threads > LIBFVDE_MAXIMUM_NUMBER_OF_DECRYPTION_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of decryption threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_volume->number_of_decryption_threads = number_of_decryption_threads;
+
+	internal_volume->io_handle->number_of_decryption_threads = number_of_decryption_threads;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the fast open mode
+ * In fast open mode only the metadata and encrypted metadata copies with the highest
+ * transaction identifier are parsed, the other copies are only read as a fallback
+ * The value applies to volumes opened after this function is used
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_volume_set_fast_open(
+     libfvde_volume_t *volume,
+     uint8_t fast_open,
+     libcerror_error_t **error )
+{
+	libfvde_internal_volume_t *internal_volume = NULL;
+	static char *function                      = "libfvde_volume_set_fast_open";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfvde_internal_volume_t *) volume;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( fast_open != 0 )
+	{
+		internal_volume->fast_open = 1;
+	}
+	else
+	{
+		internal_volume->fast_open = 0;
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
 }
 
-#if defined( HAVE_WIDE_CHARACTER_TYPE )
-
-/* Reads the EncryptedRoot.plist file
- * This function needs to be used before one of the open or unlock functions
+/* Sets the metadata snapshot file
+ * The metadata snapshot file is used to store the parsed metadata so that it does not need
+ * to be read from the volume when the volume is opened again, if the metadata snapshot does
+ * not match the volume it is overwritten
+ * This function needs to be used before one of the open functions
  * Returns 1 if successful or -1 on error
  */
-int libfvde_volume_read_encrypted_root_plist_wide(
+int libfvde_volume_set_metadata_snapshot_file(
      libfvde_volume_t *volume,
-     const wchar_t *filename,
+     const char *filename,
      libcerror_error_t **error )
 {
-	libbfio_handle_t *file_io_handle = NULL;
-	static char *function            = "libfvde_volume_read_encrypted_root_plist_wide";
-	size_t filename_length           = 0;
+	libbfio_handle_t *file_io_handle           = NULL;
+	libfvde_internal_volume_t *internal_volume = NULL;
+	static char *function                      = "libfvde_volume_set_metadata_snapshot_file";
+	size_t filename_length                     = 0;
 
 	if( volume == NULL )
 	{
@@ -3043,7 +4923,20 @@ int libfvde_volume_read_encrypted_root_plist_wide(
 
 		return( -1 );
 	}
-	filename_length = wide_string_length(
+	internal_volume = (libfvde_internal_volume_t *) volume;
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	filename_length = narrow_string_length(
 	                   filename );
 
 	if( filename_length == 0 )
@@ -3055,7 +4948,7 @@ int libfvde_volume_read_encrypted_root_plist_wide(
 		 "%s: invalid filename.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	if( libbfio_file_initialize(
 	     &file_io_handle,
@@ -3070,7 +4963,7 @@ int libfvde_volume_read_encrypted_root_plist_wide(
 
 		goto on_error;
 	}
-	if( libbfio_file_set_name_wide(
+	if( libbfio_file_set_name(
 	     file_io_handle,
 	     filename,
 	     filename_length,
@@ -3085,84 +4978,6 @@ int libfvde_volume_read_encrypted_root_plist_wide(
 
 		goto on_error;
 	}
-	if( libfvde_volume_read_encrypted_root_plist_file_io_handle(
-	     volume,
-	     file_io_handle,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read encrypted root plist file: %s.",
-		 function,
-		 filename );
-
-		goto on_error;
-	}
-	if( libbfio_handle_free(
-	     &file_io_handle,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free file IO handle.",
-		 function );
-
-		goto on_error;
-	}
-	return( 1 );
-
-on_error:
-	if( file_io_handle != NULL )
-	{
-		libbfio_handle_free(
-		 &file_io_handle,
-		 NULL );
-	}
-	return( -1 );
-}
-
-#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
-
-/* Reads the EncryptedRoot.plist file using a Basic File IO (bfio) handle
- * This function needs to be used before one of the open or unlock functions
- * Returns 1 if successful or -1 on error
- */
-int libfvde_volume_read_encrypted_root_plist_file_io_handle(
-     libfvde_volume_t *volume,
-     libbfio_handle_t *file_io_handle,
-     libcerror_error_t **error )
-{
-	libfvde_internal_volume_t *internal_volume = NULL;
-	static char *function                      = "libfvde_volume_read_encrypted_root_plist_file_io_handle";
-
-	if( volume == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid volume.",
-		 function );
-
-		return( -1 );
-	}
-	internal_volume = (libfvde_internal_volume_t *) volume;
-
-	if( internal_volume->io_handle == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid volume - missing IO handle.",
-		 function );
-
-		return( -1 );
-	}
 #if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_volume->read_write_lock,
@@ -3175,52 +4990,32 @@ int libfvde_volume_read_encrypted_root_plist_file_io_handle(
 		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 #endif
-	if( internal_volume->encrypted_root_plist != NULL )
+	if( internal_volume->metadata_snapshot_file_io_handle != NULL )
 	{
-		if( libfvde_encryption_context_plist_free(
-		     &( internal_volume->encrypted_root_plist ),
+		if( libbfio_handle_free(
+		     &( internal_volume->metadata_snapshot_file_io_handle ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free encrypted root plist.",
+			 "%s: unable to free metadata snapshot file IO handle.",
 			 function );
 
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+			libcthreads_read_write_lock_release_for_write(
+			 internal_volume->read_write_lock,
+			 NULL );
+#endif
 			goto on_error;
 		}
 	}
-	if( libfvde_encryption_context_plist_initialize(
-	     &( internal_volume->encrypted_root_plist ),
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create encrypted root plist.",
-		 function );
-
-		goto on_error;
-	}
-	if( libfvde_encryption_context_plist_read_file_io_handle(
-	     internal_volume->encrypted_root_plist,
-	     file_io_handle,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_GENERIC,
-		 "%s: unable to read encrypted root plist.",
-		 function );
+	internal_volume->metadata_snapshot_file_io_handle = file_io_handle;
 
-		goto on_error;
-	}
 #if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
 	     internal_volume->read_write_lock,
@@ -3239,31 +5034,33 @@ int libfvde_volume_read_encrypted_root_plist_file_io_handle(
 	return( 1 );
 
 on_error:
-	if( internal_volume->encrypted_root_plist != NULL )
+	if( file_io_handle != NULL )
 	{
-		libfvde_encryption_context_plist_free(
-		 &( internal_volume->encrypted_root_plist ),
+		libbfio_handle_free(
+		 &file_io_handle,
 		 NULL );
 	}
-#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
-	libcthreads_read_write_lock_release_for_write(
-	 internal_volume->read_write_lock,
-	 NULL );
-#endif
 	return( -1 );
 }
 
-/* Retrieves the volume group
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Sets the metadata snapshot file
+ * The metadata snapshot file is used to store the parsed metadata so that it does not need
+ * to be read from the volume when the volume is opened again, if the metadata snapshot does
+ * not match the volume it is overwritten
+ * This function needs to be used before one of the open functions
  * Returns 1 if successful or -1 on error
  */
-int libfvde_volume_get_volume_group(
+int libfvde_volume_set_metadata_snapshot_file_wide(
      libfvde_volume_t *volume,
-     libfvde_volume_group_t **volume_group,
+     const wchar_t *filename,
      libcerror_error_t **error )
 {
+	libbfio_handle_t *file_io_handle           = NULL;
 	libfvde_internal_volume_t *internal_volume = NULL;
-	static char *function                      = "libfvde_volume_get_volume_group";
-	int result                                 = 1;
+	static char *function                      = "libfvde_volume_set_metadata_snapshot_file_wide";
+	size_t filename_length                     = 0;
 
 	if( volume == NULL )
 	{
@@ -3278,75 +5075,99 @@ int libfvde_volume_get_volume_group(
 	}
 	internal_volume = (libfvde_internal_volume_t *) volume;
 
-	if( internal_volume->volume_header == NULL )
+	if( filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid volume - missing volume header.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
 		 function );
 
 		return( -1 );
 	}
-	if( volume_group == NULL )
+	filename_length = wide_string_length(
+	                   filename );
+
+	if( filename_length == 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid volume group.",
+		 "%s: invalid filename.",
 		 function );
 
 		return( -1 );
 	}
-	if( *volume_group != NULL )
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid volume group value already set.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_volume->read_write_lock,
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     filename_length,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 "%s: unable to set filename in file IO handle.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#endif
-	if( libfvde_volume_group_initialize(
-	      volume_group,
-	      internal_volume->io_handle,
-	      internal_volume->physical_volume_file_io_pool,
-	      internal_volume->volume_header,
-	      internal_volume->metadata,
-	      internal_volume->encrypted_metadata1,
-	      internal_volume->encrypted_root_plist,
-	      error ) != 1 )
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create volume group.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
-		result = -1;
+		goto on_error;
+	}
+#endif
+	if( internal_volume->metadata_snapshot_file_io_handle != NULL )
+	{
+		if( libbfio_handle_free(
+		     &( internal_volume->metadata_snapshot_file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free metadata snapshot file IO handle.",
+			 function );
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+			libcthreads_read_write_lock_release_for_write(
+			 internal_volume->read_write_lock,
+			 NULL );
+#endif
+			goto on_error;
+		}
 	}
+	internal_volume->metadata_snapshot_file_io_handle = file_io_handle;
+
 #if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
+	if( libcthreads_read_write_lock_release_for_write(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3354,15 +5175,26 @@ int libfvde_volume_get_volume_group(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	return( result );
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
 }
 
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
 /* The following functions have been deprecated and will be removed
  */
 
@@ -99,6 +99,34 @@ struct libfvde_internal_volume
 	 */
 	int maximum_number_of_open_handles;
 
+	/* The maximum cache size of the logical volumes
+	 */
+	size64_t maximum_cache_size;
+
+	/* The cache unit size of the logical volumes
+	 */
+	uint32_t cache_unit_size;
+
+	/* The number of decryption threads of the logical volumes
+	 */
+	int number_of_decryption_threads;
+
+	/* Value to indicate only the newest metadata copies should be read
+	 */
+	uint8_t fast_open;
+
+	/* The metadata snapshot file IO handle
+	 */
+	libbfio_handle_t *metadata_snapshot_file_io_handle;
+
+	/* The encrypted metadata read from the metadata snapshot
+	 */
+	libfvde_encrypted_metadata_t *metadata_snapshot_encrypted_metadata;
+
+	/* Value to indicate the metadata was read from the metadata snapshot
+	 */
+	uint8_t metadata_snapshot_was_read;
+
 	/* The file IO pool for backwards compatibility
 	 */
 	libbfio_pool_t *legacy_file_io_pool;
@@ -185,6 +213,27 @@ int libfvde_volume_open_physical_volume_files(
      int number_of_filenames,
      libcerror_error_t **error );
 
+LIBFVDE_EXTERN \
+int libfvde_volume_open_physical_volume_files_mapped(
+     libfvde_volume_t *volume,
+     char * const filenames[],
+     int number_of_filenames,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_volume_open_physical_volume_files_direct(
+     libfvde_volume_t *volume,
+     char * const filenames[],
+     int number_of_filenames,
+     libcerror_error_t **error );
+
+int libfvde_internal_volume_open_physical_volume_files(
+     libfvde_internal_volume_t *internal_volume,
+     char * const filenames[],
+     int number_of_filenames,
+     int file_io_mode,
+     libcerror_error_t **error );
+
 #if defined( HAVE_WIDE_CHARACTER_TYPE )
 
 LIBFVDE_EXTERN \
@@ -194,6 +243,20 @@ int libfvde_volume_open_physical_volume_files_wide(
      int number_of_filenames,
      libcerror_error_t **error );
 
+LIBFVDE_EXTERN \
+int libfvde_volume_open_physical_volume_files_direct_wide(
+     libfvde_volume_t *volume,
+     wchar_t * const filenames[],
+     int number_of_filenames,
+     libcerror_error_t **error );
+
+int libfvde_internal_volume_open_physical_volume_files_wide(
+     libfvde_internal_volume_t *internal_volume,
+     wchar_t * const filenames[],
+     int number_of_filenames,
+     int file_io_mode,
+     libcerror_error_t **error );
+
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
 LIBFVDE_EXTERN \
@@ -207,6 +270,7 @@ int libfvde_internal_volume_open_physical_volume_file(
      libbfio_pool_t *file_io_pool,
      int physical_volume_index,
      const char *filename,
+     int file_io_mode,
      libcerror_error_t **error );
 
 #if defined( HAVE_WIDE_CHARACTER_TYPE )
@@ -216,6 +280,7 @@ int libfvde_internal_volume_open_physical_volume_file_wide(
      libbfio_pool_t *file_io_pool,
      int physical_volume_index,
      const wchar_t *filename,
+     int file_io_mode,
      libcerror_error_t **error );
 
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
@@ -237,11 +302,25 @@ int libfvde_internal_volume_open_read(
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error );
 
+int libfvde_internal_volume_open_read_newest_metadata(
+     libfvde_internal_volume_t *internal_volume,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
 int libfvde_internal_volume_open_read_physical_volume_files(
      libfvde_internal_volume_t *internal_volume,
      libbfio_pool_t *file_io_pool,
      libcerror_error_t **error );
 
+int libfvde_internal_volume_open_read_metadata_snapshot(
+     libfvde_internal_volume_t *internal_volume,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libfvde_internal_volume_write_metadata_snapshot(
+     libfvde_internal_volume_t *internal_volume,
+     libcerror_error_t **error );
+
 LIBFVDE_EXTERN \
 int libfvde_volume_read_encrypted_root_plist(
      libfvde_volume_t *volume,
@@ -270,6 +349,46 @@ int libfvde_volume_get_volume_group(
      libfvde_volume_group_t **volume_group,
      libcerror_error_t **error );
 
+LIBFVDE_EXTERN \
+int libfvde_volume_set_maximum_cache_size(
+     libfvde_volume_t *volume,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_volume_set_cache_unit_size(
+     libfvde_volume_t *volume,
+     uint32_t cache_unit_size,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_volume_set_number_of_decryption_threads(
+     libfvde_volume_t *volume,
+     int number_of_decryption_threads,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_volume_set_fast_open(
+     libfvde_volume_t *volume,
+     uint8_t fast_open,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_volume_set_metadata_snapshot_file(
+     libfvde_volume_t *volume,
+     const char *filename,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBFVDE_EXTERN \
+int libfvde_volume_set_metadata_snapshot_file_wide(
+     libfvde_volume_t *volume,
+     const wchar_t *filename,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
 /* The following functions have been deprecated and will be removed
  */
 
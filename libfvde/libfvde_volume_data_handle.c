@@ -24,13 +24,16 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfvde_decryption_thread_pool.h"
 #include "libfvde_definitions.h"
 #include "libfvde_encryption_context.h"
 #include "libfvde_io_handle.h"
 #include "libfvde_libbfio.h"
 #include "libfvde_libcerror.h"
+#include "libfvde_libcnotify.h"
 #include "libfvde_libfdata.h"
 #include "libfvde_sector_data.h"
+#include "libfvde_sector_data_pool.h"
 #include "libfvde_volume_data_handle.h"
 #include "libfvde_unused.h"
 
@@ -112,8 +115,9 @@ int libfvde_volume_data_handle_initialize(
 
 		return( -1 );
 	}
-	( *volume_data_handle )->io_handle             = io_handle;
-	( *volume_data_handle )->logical_volume_offset = logical_volume_offset;
+	( *volume_data_handle )->io_handle                     = io_handle;
+	( *volume_data_handle )->logical_volume_offset         = logical_volume_offset;
+	( *volume_data_handle )->maximum_number_of_sector_data = LIBFVDE_MAXIMUM_CACHE_ENTRIES_SECTORS;
 
 	return( 1 );
 
@@ -167,6 +171,38 @@ int libfvde_volume_data_handle_free(
 				result = -1;
 			}
 		}
+		if( ( *volume_data_handle )->decryption_thread_pool != NULL )
+		{
+			if( libfvde_decryption_thread_pool_free(
+			     &( ( *volume_data_handle )->decryption_thread_pool ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free decryption thread pool.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *volume_data_handle )->sector_data_pool != NULL )
+		{
+			if( libfvde_sector_data_pool_free(
+			     &( ( *volume_data_handle )->sector_data_pool ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free sector data pool.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 *volume_data_handle );
 
@@ -175,8 +211,90 @@ int libfvde_volume_data_handle_free(
 	return( result );
 }
 
+/* Retrieves sector data from the sector data pool
+ * The sector data pool is created on first use
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_volume_data_handle_get_sector_data(
+     libfvde_volume_data_handle_t *volume_data_handle,
+     size_t data_size,
+     libfvde_sector_data_t **sector_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_volume_data_handle_get_sector_data";
+
+	if( volume_data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) LIBFVDE_MAXIMUM_CACHE_UNIT_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( volume_data_handle->sector_data_pool == NULL )
+	{
+		if( libfvde_sector_data_pool_initialize(
+		     &( volume_data_handle->sector_data_pool ),
+		     data_size,
+		     volume_data_handle->maximum_number_of_sector_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create sector data pool.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( volume_data_handle->sector_data_pool->data_size != data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid volume data handle - sector data pool data size does not match data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvde_sector_data_pool_get_sector_data(
+	     volume_data_handle->sector_data_pool,
+	     sector_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sector data from pool.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Reads a sector
  * Callback function for the volume vector
+ * The element data size is the cache unit size, which is a multitude of the bytes per sector
  * Returns 1 if successful or -1 on error
  */
 int libfvde_volume_data_handle_read_sector(
@@ -187,15 +305,16 @@ int libfvde_volume_data_handle_read_sector(
      int element_index,
      int element_data_file_index,
      off64_t element_data_offset,
-     size64_t element_data_size LIBFVDE_ATTRIBUTE_UNUSED,
+     size64_t element_data_size,
      uint32_t element_data_flags,
      uint8_t read_flags LIBFVDE_ATTRIBUTE_UNUSED,
      libcerror_error_t **error )
 {
 	libfvde_sector_data_t *sector_data = NULL;
 	static char *function              = "libfvde_volume_data_handle_read_sector";
+	uint64_t sector_number             = 0;
+	ssize_t read_count                 = 0;
 
-	LIBFVDE_UNREFERENCED_PARAMETER( element_data_size );
 	LIBFVDE_UNREFERENCED_PARAMETER( read_flags );
 
 	if( volume_data_handle == NULL )
@@ -220,58 +339,68 @@ int libfvde_volume_data_handle_read_sector(
 
 		return( -1 );
 	}
-	if( libfvde_sector_data_initialize(
+	if( volume_data_handle->io_handle->bytes_per_sector == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume data handle - invalid IO handle - missing bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( element_data_size == 0 )
+	 || ( element_data_size > (size64_t) LIBFVDE_MAXIMUM_CACHE_UNIT_SIZE )
+	 || ( ( element_data_size % volume_data_handle->io_handle->bytes_per_sector ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid element data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvde_volume_data_handle_get_sector_data(
+	     volume_data_handle,
+	     (size_t) element_data_size,
 	     &sector_data,
-	     (size_t) volume_data_handle->io_handle->bytes_per_sector,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create sector data.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sector data.",
 		 function );
 
 		goto on_error;
 	}
-	if( ( element_data_flags & LIBFVDE_RANGE_FLAG_IS_SPARSE ) != 0 )
-	{
-		if( memory_set(
-		     sector_data->data,
-		     0,
-		     sector_data->data_size ) == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-			 "%s: unable to clear sector data.",
-			 function );
+	sector_number = (uint64_t) element_index * ( element_data_size / volume_data_handle->io_handle->bytes_per_sector );
 
-			goto on_error;
-		}
-	}
-	else
+	read_count = libfvde_volume_data_handle_read_buffer(
+	              volume_data_handle,
+	              file_io_pool,
+	              element_data_file_index,
+	              element_data_offset,
+	              sector_number,
+	              element_data_flags,
+	              sector_data->data,
+	              sector_data->data_size,
+	              error );
+
+	if( read_count != (ssize_t) sector_data->data_size )
 	{
-		if( libfvde_sector_data_read(
-		     sector_data,
-		     volume_data_handle->encryption_context,
-		     file_io_pool,
-		     element_data_file_index,
-		     element_data_offset,
-		     (uint64_t) element_index,
-		     volume_data_handle->is_encrypted,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read sector data.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read sector data.",
+		 function );
 
-			goto on_error;
-		}
+		goto on_error;
 	}
 	if( libfdata_vector_set_element_value_by_index(
 	     vector,
@@ -304,3 +433,279 @@ on_error:
 	return( -1 );
 }
 
+/* Reads the data of consecutive sectors into a buffer using a specific encryption context
+ * The buffer size must be a multitude of the bytes per sector and the sectors must be
+ * stored consecutively in the file IO pool entry. Encrypted data is decrypted in-place
+ * with the encryption context, or left encrypted if the encryption context is NULL.
+ * Since the encryption context is provided by the caller this function can be called
+ * concurrently, provided that every thread uses its own encryption context
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfvde_volume_data_handle_read_buffer_with_encryption_context(
+         libfvde_volume_data_handle_t *volume_data_handle,
+         libbfio_pool_t *file_io_pool,
+         int file_io_pool_entry,
+         off64_t file_offset,
+         uint64_t sector_number,
+         uint32_t range_flags,
+         libfvde_encryption_context_t *encryption_context,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	static char *function   = "libfvde_volume_data_handle_read_buffer_with_encryption_context";
+	size_t bytes_per_sector = 0;
+	ssize_t read_count      = 0;
+
+	if( volume_data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( volume_data_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume data handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	bytes_per_sector = (size_t) volume_data_handle->io_handle->bytes_per_sector;
+
+	if( bytes_per_sector == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid volume data handle - invalid IO handle - bytes per sector value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_size % bytes_per_sector ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value not a multitude of bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( range_flags & LIBFVDE_RANGE_FLAG_IS_SPARSE ) != 0 )
+	{
+		if( memory_set(
+		     buffer,
+		     0,
+		     buffer_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear buffer.",
+			 function );
+
+			return( -1 );
+		}
+		return( (ssize_t) buffer_size );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: reading %" PRIzd " bytes of sector data at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+		 function,
+		 buffer_size,
+		 file_offset,
+		 file_offset );
+	}
+#endif
+	read_count = libbfio_pool_read_buffer_at_offset(
+	              file_io_pool,
+	              file_io_pool_entry,
+	              buffer,
+	              buffer_size,
+	              file_offset,
+	              error );
+
+	if( read_count != (ssize_t) buffer_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read sector data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		return( -1 );
+	}
+	if( ( volume_data_handle->is_encrypted != 0 )
+	 && ( encryption_context != NULL ) )
+	{
+		if( libfvde_encryption_context_crypt_sectors(
+		     encryption_context,
+		     LIBFVDE_ENCRYPTION_CRYPT_MODE_DECRYPT,
+		     buffer,
+		     buffer_size,
+		     buffer,
+		     buffer_size,
+		     sector_number,
+		     bytes_per_sector,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+			 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+			 "%s: unable to decrypt sectors: %" PRIu64 " data.",
+			 function,
+			 sector_number );
+
+			return( -1 );
+		}
+	}
+	return( (ssize_t) buffer_size );
+}
+
+/* Reads the data of consecutive sectors into a buffer
+ * The buffer size must be a multitude of the bytes per sector and the sectors must be
+ * stored consecutively in the file IO pool entry. Encrypted data is decrypted in-place,
+ * concurrently by the decryption thread pool if available and the buffer is large enough
+ * This function is not multi-thread safe since it uses the encryption context of the volume data handle
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfvde_volume_data_handle_read_buffer(
+         libfvde_volume_data_handle_t *volume_data_handle,
+         libbfio_pool_t *file_io_pool,
+         int file_io_pool_entry,
+         off64_t file_offset,
+         uint64_t sector_number,
+         uint32_t range_flags,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	libfvde_encryption_context_t *encryption_context = NULL;
+	static char *function                            = "libfvde_volume_data_handle_read_buffer";
+	ssize_t read_count                               = 0;
+	uint8_t use_decryption_thread_pool               = 0;
+
+	if( volume_data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( volume_data_handle->is_encrypted != 0 )
+	{
+		if( volume_data_handle->encryption_context == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid volume data handle - missing encryption context.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( volume_data_handle->decryption_thread_pool != NULL )
+		 && ( ( range_flags & LIBFVDE_RANGE_FLAG_IS_SPARSE ) == 0 )
+		 && ( buffer_size >= ( 2 * LIBFVDE_MINIMUM_DECRYPTION_BATCH_SIZE ) ) )
+		{
+			use_decryption_thread_pool = 1;
+		}
+		else
+		{
+			encryption_context = volume_data_handle->encryption_context;
+		}
+	}
+	read_count = libfvde_volume_data_handle_read_buffer_with_encryption_context(
+	              volume_data_handle,
+	              file_io_pool,
+	              file_io_pool_entry,
+	              file_offset,
+	              sector_number,
+	              range_flags,
+	              encryption_context,
+	              buffer,
+	              buffer_size,
+	              error );
+
+	if( read_count != (ssize_t) buffer_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read sector data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		return( -1 );
+	}
+	if( use_decryption_thread_pool != 0 )
+	{
+		if( libfvde_decryption_thread_pool_decrypt(
+		     volume_data_handle->decryption_thread_pool,
+		     buffer,
+		     buffer_size,
+		     sector_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+			 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+			 "%s: unable to decrypt sector: %" PRIu64 " data.",
+			 function,
+			 sector_number );
+
+			return( -1 );
+		}
+	}
+	return( read_count );
+}
+
@@ -26,11 +26,14 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfvde_decryption_thread_pool.h"
 #include "libfvde_encryption_context.h"
 #include "libfvde_io_handle.h"
 #include "libfvde_libbfio.h"
 #include "libfvde_libcerror.h"
 #include "libfvde_libfdata.h"
+#include "libfvde_sector_data.h"
+#include "libfvde_sector_data_pool.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -52,6 +55,19 @@ struct libfvde_volume_data_handle
 	 */
 	libfvde_encryption_context_t *encryption_context;
 
+	/* The decryption thread pool
+	 */
+	libfvde_decryption_thread_pool_t *decryption_thread_pool;
+
+	/* The sector data pool
+	 */
+	libfvde_sector_data_pool_t *sector_data_pool;
+
+	/* The maximum number of sector data in the sector data pool,
+	 * which is the number of entries of the sectors cache
+	 */
+	int maximum_number_of_sector_data;
+
 	/* Value to indicate the logical volume is encrypted
 	 */
 	uint8_t is_encrypted;
@@ -67,6 +83,12 @@ int libfvde_volume_data_handle_free(
      libfvde_volume_data_handle_t **volume_data_handle,
      libcerror_error_t **error );
 
+int libfvde_volume_data_handle_get_sector_data(
+     libfvde_volume_data_handle_t *volume_data_handle,
+     size_t data_size,
+     libfvde_sector_data_t **sector_data,
+     libcerror_error_t **error );
+
 int libfvde_volume_data_handle_read_sector(
      libfvde_volume_data_handle_t *volume_data_handle,
      libbfio_pool_t *file_io_pool,
@@ -80,6 +102,29 @@ int libfvde_volume_data_handle_read_sector(
      uint8_t read_flags,
      libcerror_error_t **error );
 
+ssize_t libfvde_volume_data_handle_read_buffer_with_encryption_context(
+         libfvde_volume_data_handle_t *volume_data_handle,
+         libbfio_pool_t *file_io_pool,
+         int file_io_pool_entry,
+         off64_t file_offset,
+         uint64_t sector_number,
+         uint32_t range_flags,
+         libfvde_encryption_context_t *encryption_context,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
+ssize_t libfvde_volume_data_handle_read_buffer(
+         libfvde_volume_data_handle_t *volume_data_handle,
+         libbfio_pool_t *file_io_pool,
+         int file_io_pool_entry,
+         off64_t file_offset,
+         uint64_t sector_number,
+         uint32_t range_flags,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -64,7 +64,8 @@ PyMethodDef pyfvde_logical_volume_object_methods[] = {
 	  METH_VARARGS | METH_KEYWORDS,
 	  "seek_offset(offset, whence) -> None\n"
 	  "\n"
-	  "Seeks an offset within the data." },
+	  "Seeks an offset within the data. Where supported whence can also be os.SEEK_DATA\n"
+	  "or os.SEEK_HOLE to seek the next data or sparse (hole) range." },
 
 	{ "get_offset",
 	  (PyCFunction) pyfvde_logical_volume_get_offset,
@@ -85,7 +86,8 @@ PyMethodDef pyfvde_logical_volume_object_methods[] = {
 	  METH_VARARGS | METH_KEYWORDS,
 	  "seek(offset, whence) -> None\n"
 	  "\n"
-	  "Seeks an offset within the data." },
+	  "Seeks an offset within the data. Where supported whence can also be os.SEEK_DATA\n"
+	  "or os.SEEK_HOLE to seek the next data or sparse (hole) range." },
 
 	{ "tell",
 	  (PyCFunction) pyfvde_logical_volume_get_offset,
@@ -115,6 +117,22 @@ PyMethodDef pyfvde_logical_volume_object_methods[] = {
 	  "\n"
 	  "Retrieves the volume size." },
 
+	{ "get_number_of_extents",
+	  (PyCFunction) pyfvde_logical_volume_get_number_of_extents,
+	  METH_NOARGS,
+	  "get_number_of_extents() -> Integer\n"
+	  "\n"
+	  "Retrieves the number of extents." },
+
+	{ "get_extent",
+	  (PyCFunction) pyfvde_logical_volume_get_extent,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "get_extent(extent_index) -> Tuple( Integer, Integer, Integer, Integer, Integer )\n"
+	  "\n"
+	  "Retrieves a specific extent as a tuple of the offset, size, physical volume index,\n"
+	  "physical volume offset and flags. The physical volume index and offset are 0 for\n"
+	  "sparse extents." },
+
 	{ "is_locked",
 	  (PyCFunction) pyfvde_logical_volume_is_locked,
 	  METH_NOARGS,
@@ -143,6 +161,20 @@ PyMethodDef pyfvde_logical_volume_object_methods[] = {
 	  "\n"
 	  "Sets the recovery password." },
 
+	{ "set_cache_size",
+	  (PyCFunction) pyfvde_logical_volume_set_cache_size,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "set_cache_size(size) -> None\n"
+	  "\n"
+	  "Sets the maximum cache size in bytes, where 0 represents the default." },
+
+	{ "set_cache_unit_size",
+	  (PyCFunction) pyfvde_logical_volume_set_cache_unit_size,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "set_cache_unit_size(size) -> None\n"
+	  "\n"
+	  "Sets the cache unit size in bytes, where 0 represents the bytes per sector." },
+
 	/* Sentinel */
 	{ NULL, NULL, 0, NULL }
 };
@@ -167,6 +199,12 @@ PyGetSetDef pyfvde_logical_volume_object_get_set_definitions[] = {
 	  "The volume size.",
 	  NULL },
 
+	{ "number_of_extents",
+	  (getter) pyfvde_logical_volume_get_number_of_extents,
+	  (setter) 0,
+	  "The number of extents.",
+	  NULL },
+
 	/* Sentinel */
 	{ NULL, NULL, NULL, NULL, NULL }
 };
@@ -1262,6 +1300,204 @@ PyObject *pyfvde_logical_volume_get_size(
 	return( integer_object );
 }
 
+/* Retrieves the number of extents
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfvde_logical_volume_get_number_of_extents(
+           pyfvde_logical_volume_t *pyfvde_logical_volume,
+           PyObject *arguments PYFVDE_ATTRIBUTE_UNUSED )
+{
+	PyObject *integer_object = NULL;
+	libcerror_error_t *error = NULL;
+	static char *function    = "pyfvde_logical_volume_get_number_of_extents";
+	int number_of_extents    = 0;
+	int result               = 0;
+
+	PYFVDE_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfvde_logical_volume == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libfvde_logical_volume_get_number_of_extents(
+	          pyfvde_logical_volume->logical_volume,
+	          &number_of_extents,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyfvde_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve number of extents.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+#if PY_MAJOR_VERSION >= 3
+	integer_object = PyLong_FromLong(
+	                  (long) number_of_extents );
+#else
+	integer_object = PyInt_FromLong(
+	                  (long) number_of_extents );
+#endif
+	return( integer_object );
+}
+
+/* Retrieves a specific extent
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfvde_logical_volume_get_extent(
+           pyfvde_logical_volume_t *pyfvde_logical_volume,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *integer_object       = NULL;
+	PyObject *tuple_object         = NULL;
+	libcerror_error_t *error       = NULL;
+	static char *function          = "pyfvde_logical_volume_get_extent";
+	static char *keyword_list[]    = { "extent_index", NULL };
+	size64_t extent_size           = 0;
+	off64_t extent_offset          = 0;
+	off64_t physical_volume_offset = 0;
+	uint32_t extent_flags          = 0;
+	int extent_index               = 0;
+	int physical_volume_index      = 0;
+	int result                     = 0;
+
+	if( pyfvde_logical_volume == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "i",
+	     keyword_list,
+	     &extent_index ) == 0 )
+	{
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libfvde_logical_volume_get_extent_by_index(
+	          pyfvde_logical_volume->logical_volume,
+	          extent_index,
+	          &extent_offset,
+	          &extent_size,
+	          &physical_volume_index,
+	          &physical_volume_offset,
+	          &extent_flags,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyfvde_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve extent: %d.",
+		 function,
+		 extent_index );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	tuple_object = PyTuple_New(
+	                5 );
+
+	integer_object = pyfvde_integer_signed_new_from_64bit(
+	                  (int64_t) extent_offset );
+
+	/* Note that PyTuple_SetItem steals the reference to the object
+	 */
+	if( PyTuple_SetItem(
+	     tuple_object,
+	     0,
+	     integer_object ) != 0 )
+	{
+		goto on_error;
+	}
+	integer_object = pyfvde_integer_unsigned_new_from_64bit(
+	                  (uint64_t) extent_size );
+
+	if( PyTuple_SetItem(
+	     tuple_object,
+	     1,
+	     integer_object ) != 0 )
+	{
+		goto on_error;
+	}
+#if PY_MAJOR_VERSION >= 3
+	integer_object = PyLong_FromLong(
+	                  (long) physical_volume_index );
+#else
+	integer_object = PyInt_FromLong(
+	                  (long) physical_volume_index );
+#endif
+	if( PyTuple_SetItem(
+	     tuple_object,
+	     2,
+	     integer_object ) != 0 )
+	{
+		goto on_error;
+	}
+	integer_object = pyfvde_integer_signed_new_from_64bit(
+	                  (int64_t) physical_volume_offset );
+
+	if( PyTuple_SetItem(
+	     tuple_object,
+	     3,
+	     integer_object ) != 0 )
+	{
+		goto on_error;
+	}
+	integer_object = pyfvde_integer_unsigned_new_from_64bit(
+	                  (uint64_t) extent_flags );
+
+	if( PyTuple_SetItem(
+	     tuple_object,
+	     4,
+	     integer_object ) != 0 )
+	{
+		goto on_error;
+	}
+	return( tuple_object );
+
+on_error:
+	if( integer_object != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) integer_object );
+	}
+	if( tuple_object != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) tuple_object );
+	}
+	return( NULL );
+}
+
 /* Determines if the logical volume is 
  * Returns a Python object if successful or NULL on error
  */
@@ -1552,3 +1788,123 @@ PyObject *pyfvde_logical_volume_set_recovery_password(
 	return( Py_None );
 }
 
+/* Sets the maximum cache size
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfvde_logical_volume_set_cache_size(
+           pyfvde_logical_volume_t *pyfvde_logical_volume,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	libcerror_error_t *error    = NULL;
+	static char *function       = "pyfvde_logical_volume_set_cache_size";
+	static char *keyword_list[] = { "size", NULL };
+	unsigned PY_LONG_LONG value = 0;
+	int result                  = 0;
+
+	if( pyfvde_logical_volume == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "K",
+	     keyword_list,
+	     &value ) == 0 )
+	{
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libfvde_logical_volume_set_cache_size(
+	          pyfvde_logical_volume->logical_volume,
+	          (size64_t) value,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyfvde_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to set maximum cache size.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 Py_None );
+
+	return( Py_None );
+}
+
+/* Sets the cache unit size
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfvde_logical_volume_set_cache_unit_size(
+           pyfvde_logical_volume_t *pyfvde_logical_volume,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	libcerror_error_t *error    = NULL;
+	static char *function       = "pyfvde_logical_volume_set_cache_unit_size";
+	static char *keyword_list[] = { "size", NULL };
+	unsigned int value          = 0;
+	int result                  = 0;
+
+	if( pyfvde_logical_volume == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "I",
+	     keyword_list,
+	     &value ) == 0 )
+	{
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libfvde_logical_volume_set_cache_unit_size(
+	          pyfvde_logical_volume->logical_volume,
+	          (uint32_t) value,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyfvde_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to set cache unit size.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 Py_None );
+
+	return( Py_None );
+}
+
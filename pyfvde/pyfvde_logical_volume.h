@@ -97,6 +97,15 @@ PyObject *pyfvde_logical_volume_get_size(
            pyfvde_logical_volume_t *pyfvde_logical_volume,
            PyObject *arguments );
 
+PyObject *pyfvde_logical_volume_get_number_of_extents(
+           pyfvde_logical_volume_t *pyfvde_logical_volume,
+           PyObject *arguments );
+
+PyObject *pyfvde_logical_volume_get_extent(
+           pyfvde_logical_volume_t *pyfvde_logical_volume,
+           PyObject *arguments,
+           PyObject *keywords );
+
 PyObject *pyfvde_logical_volume_is_locked(
            pyfvde_logical_volume_t *pyfvde_logical_volume,
            PyObject *arguments );
@@ -116,6 +125,16 @@ PyObject *pyfvde_logical_volume_set_recovery_password(
            PyObject *arguments,
            PyObject *keywords );
 
+PyObject *pyfvde_logical_volume_set_cache_size(
+           pyfvde_logical_volume_t *pyfvde_logical_volume,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyfvde_logical_volume_set_cache_unit_size(
+           pyfvde_logical_volume_t *pyfvde_logical_volume,
+           PyObject *arguments,
+           PyObject *keywords );
+
 #if defined( __cplusplus )
 }
 #endif
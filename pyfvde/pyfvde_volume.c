@@ -208,6 +208,20 @@ PyMethodDef pyfvde_volume_object_methods[] = {
 	  "\n"
 	  "Reads the EncryptedRoot.plist from a file." },
 
+	{ "set_maximum_cache_size",
+	  (PyCFunction) pyfvde_volume_set_maximum_cache_size,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "set_maximum_cache_size(size) -> None\n"
+	  "\n"
+	  "Sets the maximum cache size of the logical volumes in bytes, where 0 represents the default." },
+
+	{ "set_cache_unit_size",
+	  (PyCFunction) pyfvde_volume_set_cache_unit_size,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "set_cache_unit_size(size) -> None\n"
+	  "\n"
+	  "Sets the cache unit size of the logical volumes in bytes, where 0 represents the bytes per sector." },
+
 	/* Functions to access the volume group */
 
 	{ "get_volume_group",
@@ -2943,3 +2957,123 @@ on_error:
 	return( NULL );
 }
 
+/* Sets the maximum cache size
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfvde_volume_set_maximum_cache_size(
+           pyfvde_volume_t *pyfvde_volume,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	libcerror_error_t *error    = NULL;
+	static char *function       = "pyfvde_volume_set_maximum_cache_size";
+	static char *keyword_list[] = { "size", NULL };
+	unsigned PY_LONG_LONG value = 0;
+	int result                  = 0;
+
+	if( pyfvde_volume == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid volume.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "K",
+	     keyword_list,
+	     &value ) == 0 )
+	{
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libfvde_volume_set_maximum_cache_size(
+	          pyfvde_volume->volume,
+	          (size64_t) value,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyfvde_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to set maximum cache size.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 Py_None );
+
+	return( Py_None );
+}
+
+/* Sets the cache unit size
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfvde_volume_set_cache_unit_size(
+           pyfvde_volume_t *pyfvde_volume,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	libcerror_error_t *error    = NULL;
+	static char *function       = "pyfvde_volume_set_cache_unit_size";
+	static char *keyword_list[] = { "size", NULL };
+	unsigned int value          = 0;
+	int result                  = 0;
+
+	if( pyfvde_volume == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid volume.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "I",
+	     keyword_list,
+	     &value ) == 0 )
+	{
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libfvde_volume_set_cache_unit_size(
+	          pyfvde_volume->volume,
+	          (uint32_t) value,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyfvde_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to set cache unit size.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 Py_None );
+
+	return( Py_None );
+}
+
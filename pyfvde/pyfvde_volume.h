@@ -146,6 +146,16 @@ PyObject *pyfvde_volume_get_volume_group(
            pyfvde_volume_t *pyfvde_volume,
            PyObject *arguments );
 
+PyObject *pyfvde_volume_set_maximum_cache_size(
+           pyfvde_volume_t *pyfvde_volume,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyfvde_volume_set_cache_unit_size(
+           pyfvde_volume_t *pyfvde_volume,
+           PyObject *arguments,
+           PyObject *keywords );
+
 #if defined( __cplusplus )
 }
 #endif
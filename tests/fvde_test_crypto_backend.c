@@ -0,0 +1,311 @@
+/*
+ * Library crypto backend functions test program
+ *
+ * Copyright (C) 2011-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fvde_test_libcerror.h"
+#include "fvde_test_libfvde.h"
+#include "fvde_test_macros.h"
+#include "fvde_test_unused.h"
+
+#include "../libfvde/libfvde_crypto_backend.h"
+
+/* Tests the libfvde_get_crypto_backend function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_get_crypto_backend(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int crypto_backend       = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfvde_get_crypto_backend(
+	          &crypto_backend,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_NOT_EQUAL_INT(
+	 "crypto_backend",
+	 crypto_backend,
+	 LIBFVDE_CRYPTO_BACKEND_DEFAULT );
+
+	/* Test error cases
+	 */
+	result = libfvde_get_crypto_backend(
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_set_crypto_backend function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_set_crypto_backend(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int crypto_backend       = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfvde_set_crypto_backend(
+	          LIBFVDE_CRYPTO_BACKEND_LIBCAES,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_get_crypto_backend(
+	          &crypto_backend,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "crypto_backend",
+	 crypto_backend,
+	 LIBFVDE_CRYPTO_BACKEND_LIBCAES );
+
+	result = libfvde_set_crypto_backend(
+	          LIBFVDE_CRYPTO_BACKEND_DEFAULT,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_set_crypto_backend(
+	          -1,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_set_crypto_backend(
+	          99,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	libfvde_set_crypto_backend(
+	 LIBFVDE_CRYPTO_BACKEND_DEFAULT,
+	 NULL );
+
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT )
+
+/* Tests the libfvde_crypto_backend_is_supported function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_crypto_backend_is_supported(
+     void )
+{
+	int result = 0;
+
+	/* Test regular cases
+	 */
+	result = libfvde_crypto_backend_is_supported(
+	          LIBFVDE_CRYPTO_BACKEND_LIBCAES );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libfvde_crypto_backend_is_supported(
+	          LIBFVDE_CRYPTO_BACKEND_DEFAULT );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfvde_crypto_backend_is_supported(
+	          99 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libfvde_crypto_backend_get_from_environment function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_crypto_backend_get_from_environment(
+     void )
+{
+	int result = 0;
+
+	/* Test error cases
+	 */
+	result = libfvde_crypto_backend_get_from_environment(
+	          NULL );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FVDE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FVDE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FVDE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FVDE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FVDE_TEST_UNREFERENCED_PARAMETER( argc )
+	FVDE_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FVDE_TEST_RUN(
+	 "libfvde_get_crypto_backend",
+	 fvde_test_get_crypto_backend );
+
+	FVDE_TEST_RUN(
+	 "libfvde_set_crypto_backend",
+	 fvde_test_set_crypto_backend );
+
+#if defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT )
+
+	FVDE_TEST_RUN(
+	 "libfvde_crypto_backend_is_supported",
+	 fvde_test_crypto_backend_is_supported );
+
+	FVDE_TEST_RUN(
+	 "libfvde_crypto_backend_get_from_environment",
+	 fvde_test_crypto_backend_get_from_environment );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,911 @@
+/*
+ * Library decryption_thread_pool type test program
+ *
+ * Copyright (C) 2011-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fvde_test_libcerror.h"
+#include "fvde_test_libfvde.h"
+#include "fvde_test_macros.h"
+#include "fvde_test_memory.h"
+#include "fvde_test_unused.h"
+
+#include "../libfvde/libfvde_decryption_thread_pool.h"
+#include "../libfvde/libfvde_definitions.h"
+#include "../libfvde/libfvde_encryption_context.h"
+
+#define FVDE_TEST_DECRYPTION_THREAD_POOL_DATA_SIZE	( 4 * LIBFVDE_MINIMUM_DECRYPTION_BATCH_SIZE + 512 )
+
+uint8_t fvde_test_decryption_thread_pool_key[ 16 ] = {
+	0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f };
+
+uint8_t fvde_test_decryption_thread_pool_tweak_key[ 16 ] = {
+	0xf0, 0xe1, 0xd2, 0xc3, 0xb4, 0xa5, 0x96, 0x87, 0x78, 0x69, 0x5a, 0x4b, 0x3c, 0x2d, 0x1e, 0x0f };
+
+#if defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT )
+
+/* Tests the libfvde_decryption_thread_pool_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_decryption_thread_pool_initialize(
+     void )
+{
+	libcerror_error_t *error                                 = NULL;
+	libfvde_decryption_thread_pool_t *decryption_thread_pool = NULL;
+	int result                                               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfvde_decryption_thread_pool_initialize(
+	          &decryption_thread_pool,
+	          4,
+	          512,
+	          LIBFVDE_ENCRYPTION_METHOD_AES_128_XTS,
+	          fvde_test_decryption_thread_pool_key,
+	          128,
+	          fvde_test_decryption_thread_pool_tweak_key,
+	          128,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "decryption_thread_pool",
+	 decryption_thread_pool );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_decryption_thread_pool_free(
+	          &decryption_thread_pool,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "decryption_thread_pool",
+	 decryption_thread_pool );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_decryption_thread_pool_initialize(
+	          NULL,
+	          4,
+	          512,
+	          LIBFVDE_ENCRYPTION_METHOD_AES_128_XTS,
+	          fvde_test_decryption_thread_pool_key,
+	          128,
+	          fvde_test_decryption_thread_pool_tweak_key,
+	          128,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	decryption_thread_pool = (libfvde_decryption_thread_pool_t *) 0x12345678UL;
+
+	result = libfvde_decryption_thread_pool_initialize(
+	          &decryption_thread_pool,
+	          4,
+	          512,
+	          LIBFVDE_ENCRYPTION_METHOD_AES_128_XTS,
+	          fvde_test_decryption_thread_pool_key,
+	          128,
+	          fvde_test_decryption_thread_pool_tweak_key,
+	          128,
+	          &error );
+
+	decryption_thread_pool = NULL;
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_decryption_thread_pool_initialize(
+	          &decryption_thread_pool,
+	          0,
+	          512,
+	          LIBFVDE_ENCRYPTION_METHOD_AES_128_XTS,
+	          fvde_test_decryption_thread_pool_key,
+	          128,
+	          fvde_test_decryption_thread_pool_tweak_key,
+	          128,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_decryption_thread_pool_initialize(
+	          &decryption_thread_pool,
+	          LIBFVDE_MAXIMUM_NUMBER_OF_DECRYPTION_THREADS + 1,
+	          512,
+	          LIBFVDE_ENCRYPTION_METHOD_AES_128_XTS,
+	          fvde_test_decryption_thread_pool_key,
+	          128,
+	          fvde_test_decryption_thread_pool_tweak_key,
+	          128,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_decryption_thread_pool_initialize(
+	          &decryption_thread_pool,
+	          4,
+	          0,
+	          LIBFVDE_ENCRYPTION_METHOD_AES_128_XTS,
+	          fvde_test_decryption_thread_pool_key,
+	          128,
+	          fvde_test_decryption_thread_pool_tweak_key,
+	          128,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( decryption_thread_pool != NULL )
+	{
+		libfvde_decryption_thread_pool_free(
+		 &decryption_thread_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_decryption_thread_pool_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_decryption_thread_pool_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfvde_decryption_thread_pool_free(
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_decryption_thread_pool_decrypt function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_decryption_thread_pool_decrypt(
+     void )
+{
+	uint8_t *data                                            = NULL;
+	uint8_t *expected_data                                   = NULL;
+	libcerror_error_t *error                                 = NULL;
+	libfvde_decryption_thread_pool_t *decryption_thread_pool = NULL;
+	libfvde_encryption_context_t *encryption_context         = NULL;
+	size_t data_offset                                       = 0;
+	uint64_t sector_number                                   = 0;
+	int result                                               = 0;
+
+	/* Initialize test
+	 */
+	data = (uint8_t *) memory_allocate(
+	                    FVDE_TEST_DECRYPTION_THREAD_POOL_DATA_SIZE );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	expected_data = (uint8_t *) memory_allocate(
+	                             FVDE_TEST_DECRYPTION_THREAD_POOL_DATA_SIZE );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "expected_data",
+	 expected_data );
+
+	for( data_offset = 0;
+	     data_offset < FVDE_TEST_DECRYPTION_THREAD_POOL_DATA_SIZE;
+	     data_offset++ )
+	{
+		data[ data_offset ]          = (uint8_t) ( data_offset % 251 );
+		expected_data[ data_offset ] = (uint8_t) ( data_offset % 251 );
+	}
+	result = libfvde_encryption_context_initialize(
+	          &encryption_context,
+	          LIBFVDE_ENCRYPTION_METHOD_AES_128_XTS,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_encryption_context_set_keys(
+	          encryption_context,
+	          fvde_test_decryption_thread_pool_key,
+	          128,
+	          fvde_test_decryption_thread_pool_tweak_key,
+	          128,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	sector_number = 1000;
+
+	for( data_offset = 0;
+	     data_offset < FVDE_TEST_DECRYPTION_THREAD_POOL_DATA_SIZE;
+	     data_offset += 512 )
+	{
+		result = libfvde_encryption_context_crypt(
+		          encryption_context,
+		          LIBFVDE_ENCRYPTION_CRYPT_MODE_DECRYPT,
+		          &( expected_data[ data_offset ] ),
+		          512,
+		          &( expected_data[ data_offset ] ),
+		          512,
+		          sector_number,
+		          &error );
+
+		FVDE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FVDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		sector_number++;
+	}
+	result = libfvde_encryption_context_free(
+	          &encryption_context,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_decryption_thread_pool_initialize(
+	          &decryption_thread_pool,
+	          4,
+	          512,
+	          LIBFVDE_ENCRYPTION_METHOD_AES_128_XTS,
+	          fvde_test_decryption_thread_pool_key,
+	          128,
+	          fvde_test_decryption_thread_pool_tweak_key,
+	          128,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "decryption_thread_pool",
+	 decryption_thread_pool );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_decryption_thread_pool_decrypt(
+	          decryption_thread_pool,
+	          data,
+	          FVDE_TEST_DECRYPTION_THREAD_POOL_DATA_SIZE,
+	          1000,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          expected_data,
+	          FVDE_TEST_DECRYPTION_THREAD_POOL_DATA_SIZE );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfvde_decryption_thread_pool_decrypt(
+	          NULL,
+	          data,
+	          FVDE_TEST_DECRYPTION_THREAD_POOL_DATA_SIZE,
+	          1000,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_decryption_thread_pool_decrypt(
+	          decryption_thread_pool,
+	          NULL,
+	          FVDE_TEST_DECRYPTION_THREAD_POOL_DATA_SIZE,
+	          1000,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_decryption_thread_pool_decrypt(
+	          decryption_thread_pool,
+	          data,
+	          (size_t) SSIZE_MAX + 1,
+	          1000,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_decryption_thread_pool_decrypt(
+	          decryption_thread_pool,
+	          data,
+	          511,
+	          1000,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the decryption of one of the batches fails
+	 */
+	encryption_context = decryption_thread_pool->batches[ 1 ].encryption_context;
+
+	decryption_thread_pool->batches[ 1 ].encryption_context = NULL;
+
+	result = libfvde_decryption_thread_pool_decrypt(
+	          decryption_thread_pool,
+	          data,
+	          FVDE_TEST_DECRYPTION_THREAD_POOL_DATA_SIZE,
+	          1000,
+	          &error );
+
+	decryption_thread_pool->batches[ 1 ].encryption_context = encryption_context;
+
+	encryption_context = NULL;
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+
+	/* The other batches have completed before the decrypt returns
+	 */
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_pending_batches",
+	 decryption_thread_pool->number_of_pending_batches,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "thread_pool",
+	 decryption_thread_pool->thread_pool );
+
+	/* Test error case where a thread was unable to account for its batch
+	 */
+	decryption_thread_pool->synchronization_failed = 1;
+
+	result = libfvde_decryption_thread_pool_decrypt(
+	          decryption_thread_pool,
+	          data,
+	          FVDE_TEST_DECRYPTION_THREAD_POOL_DATA_SIZE,
+	          1000,
+	          &error );
+
+	decryption_thread_pool->synchronization_failed = 0;
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* The thread pool was joined so that all pushed batches have completed
+	 */
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_pending_batches",
+	 decryption_thread_pool->number_of_pending_batches,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "thread_pool",
+	 decryption_thread_pool->thread_pool );
+
+	/* Test the remaining decrypt calls no longer use the thread pool
+	 */
+	result = libfvde_decryption_thread_pool_decrypt(
+	          decryption_thread_pool,
+	          data,
+	          FVDE_TEST_DECRYPTION_THREAD_POOL_DATA_SIZE,
+	          1000,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT ) */
+
+	/* Clean up
+	 */
+	result = libfvde_decryption_thread_pool_free(
+	          &decryption_thread_pool,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "decryption_thread_pool",
+	 decryption_thread_pool );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 expected_data );
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( decryption_thread_pool != NULL )
+	{
+		libfvde_decryption_thread_pool_free(
+		 &decryption_thread_pool,
+		 NULL );
+	}
+	if( encryption_context != NULL )
+	{
+		libfvde_encryption_context_free(
+		 &encryption_context,
+		 NULL );
+	}
+	if( expected_data != NULL )
+	{
+		memory_free(
+		 expected_data );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+
+/* Tests the libfvde_decryption_thread_pool_callback_function function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_decryption_thread_pool_callback_function(
+     void )
+{
+	uint8_t data[ 512 ];
+
+	libcerror_error_t *error                                 = NULL;
+	libcthreads_mutex_t *mutex                               = NULL;
+	libfvde_decryption_thread_pool_t *decryption_thread_pool = NULL;
+	libfvde_decryption_batch_t decryption_batch;
+	int result                                               = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 data,
+	 0,
+	 512 );
+
+	result = libfvde_decryption_thread_pool_initialize(
+	          &decryption_thread_pool,
+	          2,
+	          512,
+	          LIBFVDE_ENCRYPTION_METHOD_AES_128_XTS,
+	          fvde_test_decryption_thread_pool_key,
+	          128,
+	          fvde_test_decryption_thread_pool_tweak_key,
+	          128,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "decryption_thread_pool",
+	 decryption_thread_pool );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	decryption_batch.decryption_thread_pool = decryption_thread_pool;
+	decryption_batch.encryption_context     = decryption_thread_pool->batches[ 0 ].encryption_context;
+	decryption_batch.data                   = data;
+	decryption_batch.data_size              = 512;
+	decryption_batch.sector_number          = 0;
+
+	/* Test regular cases
+	 */
+	decryption_thread_pool->number_of_pending_batches = 2;
+	decryption_thread_pool->decryption_failed         = 0;
+
+	result = libfvde_decryption_thread_pool_callback_function(
+	          &decryption_batch,
+	          (void *) decryption_thread_pool );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_pending_batches",
+	 decryption_thread_pool->number_of_pending_batches,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "decryption_failed",
+	 (int) decryption_thread_pool->decryption_failed,
+	 0 );
+
+	/* Test a failing batch is still accounted for
+	 */
+	decryption_batch.data_size = 511;
+
+	result = libfvde_decryption_thread_pool_callback_function(
+	          &decryption_batch,
+	          (void *) decryption_thread_pool );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_pending_batches",
+	 decryption_thread_pool->number_of_pending_batches,
+	 0 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "decryption_failed",
+	 (int) decryption_thread_pool->decryption_failed,
+	 1 );
+
+	/* Test a batch is not accounted for if the mutex cannot be grabbed
+	 */
+	mutex = decryption_thread_pool->mutex;
+
+	decryption_thread_pool->mutex                     = NULL;
+	decryption_thread_pool->number_of_pending_batches = 1;
+	decryption_thread_pool->decryption_failed         = 0;
+	decryption_batch.data_size                        = 512;
+
+	result = libfvde_decryption_thread_pool_callback_function(
+	          &decryption_batch,
+	          (void *) decryption_thread_pool );
+
+	decryption_thread_pool->mutex = mutex;
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_pending_batches",
+	 decryption_thread_pool->number_of_pending_batches,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "synchronization_failed",
+	 (int) decryption_thread_pool->synchronization_failed,
+	 1 );
+
+	decryption_thread_pool->number_of_pending_batches = 0;
+	decryption_thread_pool->synchronization_failed    = 0;
+
+	/* Test error cases
+	 */
+	result = libfvde_decryption_thread_pool_callback_function(
+	          &decryption_batch,
+	          NULL );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	/* Clean up
+	 */
+	result = libfvde_decryption_thread_pool_free(
+	          &decryption_thread_pool,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "decryption_thread_pool",
+	 decryption_thread_pool );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( decryption_thread_pool != NULL )
+	{
+		if( mutex != NULL )
+		{
+			decryption_thread_pool->mutex = mutex;
+		}
+		libfvde_decryption_thread_pool_free(
+		 &decryption_thread_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FVDE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FVDE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FVDE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FVDE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FVDE_TEST_UNREFERENCED_PARAMETER( argc )
+	FVDE_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT )
+
+	FVDE_TEST_RUN(
+	 "libfvde_decryption_thread_pool_initialize",
+	 fvde_test_decryption_thread_pool_initialize );
+
+	FVDE_TEST_RUN(
+	 "libfvde_decryption_thread_pool_free",
+	 fvde_test_decryption_thread_pool_free );
+
+	FVDE_TEST_RUN(
+	 "libfvde_decryption_thread_pool_decrypt",
+	 fvde_test_decryption_thread_pool_decrypt );
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+
+	FVDE_TEST_RUN(
+	 "libfvde_decryption_thread_pool_callback_function",
+	 fvde_test_decryption_thread_pool_callback_function );
+
+#endif
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
+}
+
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -34,9 +35,13 @@
 #include "fvde_test_memory.h"
 #include "fvde_test_unused.h"
 
+#include "../libfvde/libfvde_decryption_thread_pool.h"
+#include "../libfvde/libfvde_definitions.h"
 #include "../libfvde/libfvde_encrypted_metadata.h"
+#include "../libfvde/libfvde_encryption_context.h"
 #include "../libfvde/libfvde_io_handle.h"
 #include "../libfvde/libfvde_logical_volume_descriptor.h"
+#include "../libfvde/libfvde_segment_descriptor.h"
 
 uint8_t fvde_test_encrypted_metadata_block_data_0x0010[ 368 ] = {
 	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xc7, 0xb0, 0xe0, 0xff, 0xff, 0xff, 0xff,
@@ -2284,7 +2289,6 @@ int fvde_test_encrypted_metadata_read_type_0x001a(
 	libcerror_error_t *error                                       = NULL;
 	libfvde_encrypted_metadata_t *encrypted_metadata               = NULL;
 	libfvde_logical_volume_descriptor_t *logical_volume_descriptor = NULL;
-	int entry_index                                                = 0;
 	int result                                                     = 0;
 
 	/* Initialize test
@@ -2325,10 +2329,9 @@ int fvde_test_encrypted_metadata_read_type_0x001a(
 
 	logical_volume_descriptor->object_identifier = 10;
 
-	result = libcdata_array_append_entry(
-	          encrypted_metadata->logical_volume_descriptors,
-	          &entry_index,
-	          (intptr_t *) logical_volume_descriptor,
+	result = libfvde_encrypted_metadata_append_logical_volume_descriptor(
+	          encrypted_metadata,
+	          &logical_volume_descriptor,
 	          &error );
 
 	FVDE_TEST_ASSERT_EQUAL_INT(
@@ -2336,12 +2339,14 @@ int fvde_test_encrypted_metadata_read_type_0x001a(
 	 result,
 	 1 );
 
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "logical_volume_descriptor",
+	 logical_volume_descriptor );
+
 	FVDE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	logical_volume_descriptor = NULL;
-
 	/* Test regular cases
 	 */
 	result = libfvde_encrypted_metadata_read_type_0x001a(
@@ -4194,20 +4199,88 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfvde_encrypted_metadata_read_from_file_io_handle function
+/* Tests the libfvde_encrypted_metadata_decrypt_blocks function
  * Returns 1 if successful or 0 if not
  */
-int fvde_test_encrypted_metadata_read_from_file_io_handle(
+int fvde_test_encrypted_metadata_decrypt_blocks(
      void )
 {
-	libcerror_error_t *error                         = NULL;
-	libfvde_encrypted_metadata_t *encrypted_metadata = NULL;
-	int result                                       = 0;
+	uint8_t key[ 16 ];
+	uint8_t tweak_key[ 16 ];
+
+	libcerror_error_t *error                                 = NULL;
+	libfvde_decryption_thread_pool_t *decryption_thread_pool = NULL;
+	libfvde_encryption_context_t *encryption_context         = NULL;
+	uint8_t *data                                            = NULL;
+	uint8_t *expected_data                                   = NULL;
+	size_t data_offset                                       = 0;
+	uint64_t block_number                                    = 0;
+	int test_number                                          = 0;
+	int result                                               = 0;
 
 	/* Initialize test
 	 */
-	result = libfvde_encrypted_metadata_initialize(
-	          &encrypted_metadata,
+	for( data_offset = 0;
+	     data_offset < 16;
+	     data_offset++ )
+	{
+		key[ data_offset ]       = (uint8_t) data_offset;
+		tweak_key[ data_offset ] = (uint8_t) ( 0xff - data_offset );
+	}
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * 16 * 8192 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	expected_data = (uint8_t *) memory_allocate(
+	                             sizeof( uint8_t ) * 16 * 8192 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "expected_data",
+	 expected_data );
+
+	result = libfvde_encryption_context_initialize(
+	          &encryption_context,
+	          LIBFVDE_ENCRYPTION_METHOD_AES_128_XTS,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_encryption_context_set_keys(
+	          encryption_context,
+	          key,
+	          128,
+	          tweak_key,
+	          128,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_decryption_thread_pool_initialize(
+	          &decryption_thread_pool,
+	          4,
+	          8192,
+	          LIBFVDE_ENCRYPTION_METHOD_AES_128_XTS,
+	          key,
+	          128,
+	          tweak_key,
+	          128,
 	          &error );
 
 	FVDE_TEST_ASSERT_EQUAL_INT(
@@ -4216,24 +4289,170 @@ int fvde_test_encrypted_metadata_read_from_file_io_handle(
 	 1 );
 
 	FVDE_TEST_ASSERT_IS_NOT_NULL(
-	 "encrypted_metadata",
-	 encrypted_metadata );
+	 "decryption_thread_pool",
+	 decryption_thread_pool );
 
 	FVDE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
+	/* Determine the expected data by decrypting the blocks one by one
 	 */
-	result = libfvde_encrypted_metadata_read_from_file_io_handle(
-	          NULL,
-	          NULL,
+	for( data_offset = 0;
+	     data_offset < ( 16 * 8192 );
+	     data_offset += 8192 )
+	{
+		memory_set(
+		 &( data[ data_offset ] ),
+		 (int) ( 0x10 + block_number ),
+		 8192 );
+
+		result = libfvde_encryption_context_crypt(
+		          encryption_context,
+		          LIBFVDE_ENCRYPTION_CRYPT_MODE_DECRYPT,
+		          &( data[ data_offset ] ),
+		          8192,
+		          &( expected_data[ data_offset ] ),
+		          8192,
+		          block_number,
+		          &error );
+
+		FVDE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FVDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		block_number++;
+	}
+	/* Test regular cases with and without the decryption thread pool
+	 */
+	for( test_number = 0;
+	     test_number < 2;
+	     test_number++ )
+	{
+		block_number = 0;
+
+		for( data_offset = 0;
+		     data_offset < ( 16 * 8192 );
+		     data_offset += 8192 )
+		{
+			memory_set(
+			 &( data[ data_offset ] ),
+			 (int) ( 0x10 + block_number ),
+			 8192 );
+
+			block_number++;
+		}
+		if( test_number == 0 )
+		{
+			result = libfvde_encrypted_metadata_decrypt_blocks(
+			          encryption_context,
+			          NULL,
+			          data,
+			          16 * 8192,
+			          0,
+			          &error );
+		}
+		else
+		{
+			result = libfvde_encrypted_metadata_decrypt_blocks(
+			          encryption_context,
+			          decryption_thread_pool,
+			          data,
+			          16 * 8192,
+			          0,
+			          &error );
+		}
+
+		FVDE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FVDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          data,
+		          expected_data,
+		          16 * 8192 );
+
+		FVDE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test regular case where the blocks do not start at block number 0
+	 */
+	block_number = 8;
+
+	for( data_offset = 8 * 8192;
+	     data_offset < ( 16 * 8192 );
+	     data_offset += 8192 )
+	{
+		memory_set(
+		 &( data[ data_offset ] ),
+		 (int) ( 0x10 + block_number ),
+		 8192 );
+
+		block_number++;
+	}
+	result = libfvde_encrypted_metadata_decrypt_blocks(
+	          encryption_context,
+	          decryption_thread_pool,
+	          &( data[ 8 * 8192 ] ),
+	          8 * 8192,
+	          8,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          &( data[ 8 * 8192 ] ),
+	          &( expected_data[ 8 * 8192 ] ),
+	          8 * 8192 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfvde_encrypted_metadata_decrypt_blocks(
+	          encryption_context,
 	          NULL,
+	          data,
 	          0,
 	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_encrypted_metadata_decrypt_blocks(
 	          NULL,
-	          0,
 	          NULL,
+	          data,
+	          16 * 8192,
 	          0,
 	          &error );
 
@@ -4249,15 +4468,31 @@ int fvde_test_encrypted_metadata_read_from_file_io_handle(
 	libcerror_error_free(
 	 &error );
 
-	result = libfvde_encrypted_metadata_read_from_file_io_handle(
-	          encrypted_metadata,
-	          NULL,
+	result = libfvde_encrypted_metadata_decrypt_blocks(
+	          encryption_context,
 	          NULL,
-	          0,
-	          0,
 	          NULL,
+	          16 * 8192,
 	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_encrypted_metadata_decrypt_blocks(
+	          encryption_context,
 	          NULL,
+	          data,
+	          8191,
 	          0,
 	          &error );
 
@@ -4275,8 +4510,8 @@ int fvde_test_encrypted_metadata_read_from_file_io_handle(
 
 	/* Clean up
 	 */
-	result = libfvde_encrypted_metadata_free(
-	          &encrypted_metadata,
+	result = libfvde_encryption_context_free(
+	          &encryption_context,
 	          &error );
 
 	FVDE_TEST_ASSERT_EQUAL_INT(
@@ -4285,13 +4520,32 @@ int fvde_test_encrypted_metadata_read_from_file_io_handle(
 	 1 );
 
 	FVDE_TEST_ASSERT_IS_NULL(
-	 "encrypted_metadata",
-	 encrypted_metadata );
+	 "error",
+	 error );
+
+	result = libfvde_decryption_thread_pool_free(
+	          &decryption_thread_pool,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	FVDE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
+	memory_free(
+	 expected_data );
+
+	expected_data = NULL;
+
+	memory_free(
+	 data );
+
+	data = NULL;
+
 	return( 1 );
 
 on_error:
@@ -4300,69 +4554,931 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( encrypted_metadata != NULL )
+	if( encryption_context != NULL )
 	{
-		libfvde_encrypted_metadata_free(
-		 &encrypted_metadata,
+		libfvde_encryption_context_free(
+		 &encryption_context,
+		 NULL );
+	}
+	if( decryption_thread_pool != NULL )
+	{
+		libfvde_decryption_thread_pool_free(
+		 &decryption_thread_pool,
 		 NULL );
 	}
+	if( expected_data != NULL )
+	{
+		memory_free(
+		 expected_data );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
 	return( 0 );
 }
 
-#endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
-
-/* The main program
+/* Tests the libfvde_encrypted_metadata_read_from_file_io_handle function
+ * Returns 1 if successful or 0 if not
  */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-int wmain(
-     int argc FVDE_TEST_ATTRIBUTE_UNUSED,
-     wchar_t * const argv[] FVDE_TEST_ATTRIBUTE_UNUSED )
-#else
-int main(
-     int argc FVDE_TEST_ATTRIBUTE_UNUSED,
-     char * const argv[] FVDE_TEST_ATTRIBUTE_UNUSED )
-#endif
+int fvde_test_encrypted_metadata_read_from_file_io_handle(
+     void )
 {
-	FVDE_TEST_UNREFERENCED_PARAMETER( argc )
-	FVDE_TEST_UNREFERENCED_PARAMETER( argv )
+	libcerror_error_t *error                         = NULL;
+	libfvde_encrypted_metadata_t *encrypted_metadata = NULL;
+	libfvde_io_handle_t *io_handle                   = NULL;
+	int result                                       = 0;
 
-#if defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT )
+	/* Initialize test
+	 */
+	result = libfvde_encrypted_metadata_initialize(
+	          &encrypted_metadata,
+	          &error );
 
-	FVDE_TEST_RUN(
-	 "libfvde_encrypted_metadata_initialize",
-	 fvde_test_encrypted_metadata_initialize );
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	FVDE_TEST_RUN(
-	 "libfvde_encrypted_metadata_free",
-	 fvde_test_encrypted_metadata_free );
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "encrypted_metadata",
+	 encrypted_metadata );
 
-	FVDE_TEST_RUN(
-	 "libfvde_encrypted_metadata_read_type_0x0010",
-	 fvde_test_encrypted_metadata_read_type_0x0010 );
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	FVDE_TEST_RUN(
-	 "libfvde_encrypted_metadata_read_type_0x0011",
-	 fvde_test_encrypted_metadata_read_type_0x0011 );
+	result = libfvde_io_handle_initialize(
+	          &io_handle,
+	          &error );
 
-	FVDE_TEST_RUN(
-	 "libfvde_encrypted_metadata_read_type_0x0012",
-	 fvde_test_encrypted_metadata_read_type_0x0012 );
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	FVDE_TEST_RUN(
-	 "libfvde_encrypted_metadata_read_type_0x0013",
-	 fvde_test_encrypted_metadata_read_type_0x0013 );
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
 
-	FVDE_TEST_RUN(
-	 "libfvde_encrypted_metadata_read_type_0x0014",
-	 fvde_test_encrypted_metadata_read_type_0x0014 );
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	FVDE_TEST_RUN(
-	 "libfvde_encrypted_metadata_read_type_0x0016",
-	 fvde_test_encrypted_metadata_read_type_0x0016 );
+	/* Test error cases
+	 */
+	result = libfvde_encrypted_metadata_read_from_file_io_handle(
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          0,
+	          NULL,
+	          0,
+	          NULL,
+	          0,
+	          &error );
 
-	FVDE_TEST_RUN(
-	 "libfvde_encrypted_metadata_read_type_0x0017",
-	 fvde_test_encrypted_metadata_read_type_0x0017 );
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_encrypted_metadata_read_from_file_io_handle(
+	          encrypted_metadata,
+	          NULL,
+	          NULL,
+	          0,
+	          0,
+	          NULL,
+	          0,
+	          NULL,
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_encrypted_metadata_read_from_file_io_handle(
+	          encrypted_metadata,
+	          io_handle,
+	          NULL,
+	          0,
+	          0,
+	          NULL,
+	          0,
+	          NULL,
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_encrypted_metadata_read_from_file_io_handle(
+	          encrypted_metadata,
+	          io_handle,
+	          NULL,
+	          0,
+	          (uint64_t) INT64_MAX + 1,
+	          NULL,
+	          0,
+	          NULL,
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_encrypted_metadata_free(
+	          &encrypted_metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "encrypted_metadata",
+	 encrypted_metadata );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libfvde_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	if( encrypted_metadata != NULL )
+	{
+		libfvde_encrypted_metadata_free(
+		 &encrypted_metadata,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_encrypted_metadata_append_logical_volume_descriptor function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_encrypted_metadata_append_logical_volume_descriptor(
+     void )
+{
+	uint64_t object_identifiers[ 4 ]                               = { 30, 10, 20, 10 };
+	libcerror_error_t *error                                       = NULL;
+	libfvde_encrypted_metadata_t *encrypted_metadata               = NULL;
+	libfvde_logical_volume_descriptor_t *logical_volume_descriptor = NULL;
+	int logical_volume_descriptor_index                            = 0;
+	int number_of_logical_volume_descriptors                       = 0;
+	int result                                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_encrypted_metadata_initialize(
+	          &encrypted_metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "encrypted_metadata",
+	 encrypted_metadata );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( logical_volume_descriptor_index = 0;
+	     logical_volume_descriptor_index < 4;
+	     logical_volume_descriptor_index++ )
+	{
+		result = libfvde_logical_volume_descriptor_initialize(
+		          &logical_volume_descriptor,
+		          &error );
+
+		FVDE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FVDE_TEST_ASSERT_IS_NOT_NULL(
+		 "logical_volume_descriptor",
+		 logical_volume_descriptor );
+
+		FVDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		logical_volume_descriptor->object_identifier = object_identifiers[ logical_volume_descriptor_index ];
+
+		result = libfvde_encrypted_metadata_append_logical_volume_descriptor(
+		          encrypted_metadata,
+		          &logical_volume_descriptor,
+		          &error );
+
+		FVDE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FVDE_TEST_ASSERT_IS_NULL(
+		 "logical_volume_descriptor",
+		 logical_volume_descriptor );
+
+		FVDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libfvde_encrypted_metadata_get_number_of_logical_volume_descriptors(
+	          encrypted_metadata,
+	          &number_of_logical_volume_descriptors,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_logical_volume_descriptors",
+	 number_of_logical_volume_descriptors,
+	 4 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_encrypted_metadata_append_logical_volume_descriptor(
+	          NULL,
+	          &logical_volume_descriptor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_encrypted_metadata_append_logical_volume_descriptor(
+	          encrypted_metadata,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_encrypted_metadata_append_logical_volume_descriptor(
+	          encrypted_metadata,
+	          &logical_volume_descriptor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_encrypted_metadata_free(
+	          &encrypted_metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "encrypted_metadata",
+	 encrypted_metadata );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( logical_volume_descriptor != NULL )
+	{
+		libfvde_logical_volume_descriptor_free(
+		 &logical_volume_descriptor,
+		 NULL );
+	}
+	if( encrypted_metadata != NULL )
+	{
+		libfvde_encrypted_metadata_free(
+		 &encrypted_metadata,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_encrypted_metadata_insert_segment_descriptor function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_encrypted_metadata_insert_segment_descriptor(
+     void )
+{
+	uint64_t logical_block_numbers[ 4 ]              = { 10, 30, 20, 20 };
+	libcdata_array_t *segment_descriptors            = NULL;
+	libcerror_error_t *error                         = NULL;
+	libfvde_segment_descriptor_t *segment_descriptor = NULL;
+	int expected_results[ 4 ]                        = { 1, 1, 1, 0 };
+	int number_of_segment_descriptors                = 0;
+	int result                                       = 0;
+	int segment_descriptor_index                     = 0;
+
+	/* Initialize test
+	 */
+	result = libcdata_array_initialize(
+	          &segment_descriptors,
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "segment_descriptors",
+	 segment_descriptors );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( segment_descriptor_index = 0;
+	     segment_descriptor_index < 4;
+	     segment_descriptor_index++ )
+	{
+		result = libfvde_segment_descriptor_initialize(
+		          &segment_descriptor,
+		          &error );
+
+		FVDE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FVDE_TEST_ASSERT_IS_NOT_NULL(
+		 "segment_descriptor",
+		 segment_descriptor );
+
+		FVDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		segment_descriptor->logical_block_number = logical_block_numbers[ segment_descriptor_index ];
+
+		result = libfvde_encrypted_metadata_insert_segment_descriptor(
+		          segment_descriptors,
+		          segment_descriptor,
+		          &error );
+
+		FVDE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 expected_results[ segment_descriptor_index ] );
+
+		FVDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( result == 1 )
+		{
+			segment_descriptor = NULL;
+		}
+		else
+		{
+			result = libfvde_segment_descriptor_free(
+			          &segment_descriptor,
+			          &error );
+
+			FVDE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FVDE_TEST_ASSERT_IS_NULL(
+			 "segment_descriptor",
+			 segment_descriptor );
+
+			FVDE_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+	}
+	result = libcdata_array_get_number_of_entries(
+	          segment_descriptors,
+	          &number_of_segment_descriptors,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_segment_descriptors",
+	 number_of_segment_descriptors,
+	 3 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( segment_descriptor_index = 0;
+	     segment_descriptor_index < 3;
+	     segment_descriptor_index++ )
+	{
+		result = libcdata_array_get_entry_by_index(
+		          segment_descriptors,
+		          segment_descriptor_index,
+		          (intptr_t **) &segment_descriptor,
+		          &error );
+
+		FVDE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FVDE_TEST_ASSERT_IS_NOT_NULL(
+		 "segment_descriptor",
+		 segment_descriptor );
+
+		FVDE_TEST_ASSERT_EQUAL_UINT64(
+		 "segment_descriptor->logical_block_number",
+		 segment_descriptor->logical_block_number,
+		 (uint64_t) ( 10 * ( segment_descriptor_index + 1 ) ) );
+
+		FVDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	segment_descriptor = NULL;
+
+	/* Test error cases
+	 */
+	result = libfvde_encrypted_metadata_insert_segment_descriptor(
+	          segment_descriptors,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_array_free(
+	          &segment_descriptors,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libfvde_segment_descriptor_free,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "segment_descriptors",
+	 segment_descriptors );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( segment_descriptor != NULL )
+	{
+		libfvde_segment_descriptor_free(
+		 &segment_descriptor,
+		 NULL );
+	}
+	if( segment_descriptors != NULL )
+	{
+		libcdata_array_free(
+		 &segment_descriptors,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libfvde_segment_descriptor_free,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_encrypted_metadata_get_logical_volume_descriptor_by_object_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_encrypted_metadata_get_logical_volume_descriptor_by_object_identifier(
+     void )
+{
+	uint64_t object_identifiers[ 4 ]                               = { 30, 10, 20, 10 };
+	libcerror_error_t *error                                       = NULL;
+	libfvde_encrypted_metadata_t *encrypted_metadata               = NULL;
+	libfvde_logical_volume_descriptor_t *logical_volume_descriptor = NULL;
+	int logical_volume_descriptor_index                            = 0;
+	int result                                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_encrypted_metadata_initialize(
+	          &encrypted_metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "encrypted_metadata",
+	 encrypted_metadata );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( logical_volume_descriptor_index = 0;
+	     logical_volume_descriptor_index < 4;
+	     logical_volume_descriptor_index++ )
+	{
+		result = libfvde_logical_volume_descriptor_initialize(
+		          &logical_volume_descriptor,
+		          &error );
+
+		FVDE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FVDE_TEST_ASSERT_IS_NOT_NULL(
+		 "logical_volume_descriptor",
+		 logical_volume_descriptor );
+
+		FVDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		logical_volume_descriptor->object_identifier = object_identifiers[ logical_volume_descriptor_index ];
+
+		logical_volume_descriptor->size              = (size64_t) logical_volume_descriptor_index;
+
+		result = libfvde_encrypted_metadata_append_logical_volume_descriptor(
+		          encrypted_metadata,
+		          &logical_volume_descriptor,
+		          &error );
+
+		FVDE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FVDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test regular cases
+	 */
+	result = libfvde_encrypted_metadata_get_logical_volume_descriptor_by_object_identifier(
+	          encrypted_metadata,
+	          20,
+	          &logical_volume_descriptor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "logical_volume_descriptor",
+	 logical_volume_descriptor );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT64(
+	 "logical_volume_descriptor->size",
+	 (uint64_t) logical_volume_descriptor->size,
+	 (uint64_t) 2 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_encrypted_metadata_get_logical_volume_descriptor_by_object_identifier(
+	          encrypted_metadata,
+	          30,
+	          &logical_volume_descriptor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "logical_volume_descriptor",
+	 logical_volume_descriptor );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT64(
+	 "logical_volume_descriptor->size",
+	 (uint64_t) logical_volume_descriptor->size,
+	 (uint64_t) 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The most recent logical volume descriptor with the same object identifier is returned
+	 */
+	result = libfvde_encrypted_metadata_get_logical_volume_descriptor_by_object_identifier(
+	          encrypted_metadata,
+	          10,
+	          &logical_volume_descriptor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "logical_volume_descriptor",
+	 logical_volume_descriptor );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT64(
+	 "logical_volume_descriptor->size",
+	 (uint64_t) logical_volume_descriptor->size,
+	 (uint64_t) 3 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	logical_volume_descriptor = NULL;
+
+	result = libfvde_encrypted_metadata_get_logical_volume_descriptor_by_object_identifier(
+	          encrypted_metadata,
+	          15,
+	          &logical_volume_descriptor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "logical_volume_descriptor",
+	 logical_volume_descriptor );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_encrypted_metadata_get_logical_volume_descriptor_by_object_identifier(
+	          NULL,
+	          10,
+	          &logical_volume_descriptor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_encrypted_metadata_get_logical_volume_descriptor_by_object_identifier(
+	          encrypted_metadata,
+	          10,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_encrypted_metadata_free(
+	          &encrypted_metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "encrypted_metadata",
+	 encrypted_metadata );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( encrypted_metadata != NULL )
+	{
+		libfvde_encrypted_metadata_free(
+		 &encrypted_metadata,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FVDE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FVDE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FVDE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FVDE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FVDE_TEST_UNREFERENCED_PARAMETER( argc )
+	FVDE_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT )
+
+	FVDE_TEST_RUN(
+	 "libfvde_encrypted_metadata_initialize",
+	 fvde_test_encrypted_metadata_initialize );
+
+	FVDE_TEST_RUN(
+	 "libfvde_encrypted_metadata_free",
+	 fvde_test_encrypted_metadata_free );
+
+	FVDE_TEST_RUN(
+	 "libfvde_encrypted_metadata_read_type_0x0010",
+	 fvde_test_encrypted_metadata_read_type_0x0010 );
+
+	FVDE_TEST_RUN(
+	 "libfvde_encrypted_metadata_read_type_0x0011",
+	 fvde_test_encrypted_metadata_read_type_0x0011 );
+
+	FVDE_TEST_RUN(
+	 "libfvde_encrypted_metadata_read_type_0x0012",
+	 fvde_test_encrypted_metadata_read_type_0x0012 );
+
+	FVDE_TEST_RUN(
+	 "libfvde_encrypted_metadata_read_type_0x0013",
+	 fvde_test_encrypted_metadata_read_type_0x0013 );
+
+	FVDE_TEST_RUN(
+	 "libfvde_encrypted_metadata_read_type_0x0014",
+	 fvde_test_encrypted_metadata_read_type_0x0014 );
+
+	FVDE_TEST_RUN(
+	 "libfvde_encrypted_metadata_read_type_0x0016",
+	 fvde_test_encrypted_metadata_read_type_0x0016 );
+
+	FVDE_TEST_RUN(
+	 "libfvde_encrypted_metadata_read_type_0x0017",
+	 fvde_test_encrypted_metadata_read_type_0x0017 );
 
 	FVDE_TEST_RUN(
 	 "libfvde_encrypted_metadata_read_type_0x0018",
@@ -4422,17 +5538,31 @@ int main(
 	 "libfvde_encrypted_metadata_read_type_0x0505",
 	 fvde_test_encrypted_metadata_read_type_0x0505 );
 
+	FVDE_TEST_RUN(
+	 "libfvde_encrypted_metadata_decrypt_blocks",
+	 fvde_test_encrypted_metadata_decrypt_blocks );
+
 	FVDE_TEST_RUN(
 	 "libfvde_encrypted_metadata_read_from_file_io_handle",
 	 fvde_test_encrypted_metadata_read_from_file_io_handle );
 
 	/* TODO: add tests for libfvde_encrypted_metadata_get_volume_master_key */
 
+	FVDE_TEST_RUN(
+	 "libfvde_encrypted_metadata_append_logical_volume_descriptor",
+	 fvde_test_encrypted_metadata_append_logical_volume_descriptor );
+
+	FVDE_TEST_RUN(
+	 "libfvde_encrypted_metadata_insert_segment_descriptor",
+	 fvde_test_encrypted_metadata_insert_segment_descriptor );
+
 	/* TODO: add tests for libfvde_encrypted_metadata_get_number_of_logical_volume_descriptors */
 
 	/* TODO: add tests for libfvde_encrypted_metadata_get_logical_volume_descriptor_by_index */
 
-	/* TODO: add tests for libfvde_encrypted_metadata_get_logical_volume_descriptor_by_object_identifier */
+	FVDE_TEST_RUN(
+	 "libfvde_encrypted_metadata_get_logical_volume_descriptor_by_object_identifier",
+	 fvde_test_encrypted_metadata_get_logical_volume_descriptor_by_object_identifier );
 
 	/* TODO: add tests for libfvde_encrypted_metadata_get_last_logical_volume_descriptor */
 
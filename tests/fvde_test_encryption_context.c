@@ -33,9 +33,36 @@
 #include "fvde_test_memory.h"
 #include "fvde_test_unused.h"
 
+#include "../libfvde/libfvde_crypto_backend.h"
 #include "../libfvde/libfvde_definitions.h"
 #include "../libfvde/libfvde_encryption_context.h"
 
+/* Test vector 2 of IEEE P1619, extended to 2 sectors of 128 bytes
+ */
+uint8_t fvde_test_encryption_context_key[ 16 ] = {
+	0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11 };
+
+uint8_t fvde_test_encryption_context_tweak_key[ 16 ] = {
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22 };
+
+uint8_t fvde_test_encryption_context_encrypted_data[ 256 ] = {
+	0xc4, 0x54, 0x18, 0x5e, 0x6a, 0x16, 0x93, 0x6e, 0x39, 0x33, 0x40, 0x38, 0xac, 0xef, 0x83, 0x8b,
+	0xfb, 0x18, 0x6f, 0xff, 0x74, 0x80, 0xad, 0xc4, 0x28, 0x93, 0x82, 0xec, 0xd6, 0xd3, 0x94, 0xf0,
+	0x64, 0xf5, 0x7c, 0x21, 0x47, 0x51, 0x2b, 0x2e, 0x14, 0xc5, 0x12, 0x58, 0x20, 0x40, 0x23, 0x68,
+	0x5d, 0xd9, 0x90, 0x54, 0xd1, 0xcf, 0x51, 0x5f, 0xc9, 0xbb, 0x1e, 0xa2, 0xee, 0xb1, 0x37, 0xd0,
+	0x62, 0x02, 0x11, 0x8c, 0x0a, 0x18, 0x1b, 0x18, 0xec, 0x8f, 0x77, 0x29, 0xf8, 0x17, 0x8f, 0x7b,
+	0xd3, 0xc7, 0x81, 0x85, 0x2e, 0x68, 0xa4, 0x66, 0x44, 0xea, 0x71, 0x19, 0x27, 0x13, 0x6e, 0x7c,
+	0x53, 0xf9, 0xf2, 0xc5, 0x4a, 0x94, 0xd6, 0x0c, 0xc1, 0x58, 0x4a, 0x78, 0x44, 0x77, 0xe5, 0x20,
+	0xb6, 0x16, 0xed, 0x14, 0x7c, 0x99, 0xf3, 0x8c, 0x23, 0xd2, 0x89, 0xd7, 0xea, 0xf4, 0xdd, 0x8e,
+	0xda, 0xe1, 0xd6, 0xe7, 0xc0, 0xf4, 0xf4, 0xd2, 0xfe, 0x3b, 0xcf, 0x24, 0xd1, 0xf7, 0x94, 0x5b,
+	0x1d, 0xce, 0x56, 0x2a, 0x2d, 0x72, 0xc5, 0x5b, 0x50, 0x2b, 0x3b, 0x7b, 0xcd, 0xf3, 0x72, 0xeb,
+	0xef, 0x9c, 0x44, 0x56, 0xed, 0xb4, 0xe6, 0x2a, 0x1c, 0x32, 0x5d, 0xb8, 0xb6, 0x6d, 0xe6, 0x91,
+	0xf0, 0xa5, 0x2b, 0x64, 0xc5, 0xb5, 0xd9, 0xa2, 0x32, 0x05, 0x1d, 0x49, 0xf5, 0x3b, 0xc0, 0x10,
+	0x56, 0x50, 0x88, 0x30, 0xec, 0xdd, 0x57, 0x78, 0x5a, 0xfb, 0x9a, 0xb1, 0x37, 0xa8, 0x07, 0x07,
+	0x58, 0xf0, 0x38, 0xbe, 0x0f, 0x18, 0x4c, 0x32, 0x64, 0x63, 0x83, 0x95, 0x2e, 0x3f, 0xaa, 0x6c,
+	0xc6, 0x37, 0x8a, 0xc2, 0xdb, 0xb5, 0xb5, 0x70, 0xfc, 0xdb, 0xb3, 0x7d, 0x0d, 0xf1, 0xf8, 0x52,
+	0x13, 0x50, 0xd5, 0xdb, 0x5d, 0x74, 0x20, 0x12, 0x39, 0x71, 0x21, 0x4c, 0xf1, 0x6f, 0xdc, 0x81 };
+
 #if defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT )
 
 /* Tests the libfvde_encryption_context_initialize function
@@ -293,6 +320,313 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfvde_encryption_context_crypt_sectors function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_encryption_context_crypt_sectors(
+     void )
+{
+	uint8_t data[ 256 ];
+
+	libcerror_error_t *error                         = NULL;
+	libfvde_encryption_context_t *encryption_context = NULL;
+	size_t data_index                                = 0;
+	int crypto_backend                               = 0;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_encryption_context_initialize(
+	          &encryption_context,
+	          LIBFVDE_ENCRYPTION_METHOD_AES_128_XTS,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "encryption_context",
+	 encryption_context );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases with every supported crypto backend
+	 */
+	for( crypto_backend = LIBFVDE_CRYPTO_BACKEND_LIBCAES;
+	     crypto_backend <= LIBFVDE_CRYPTO_BACKEND_AESNI;
+	     crypto_backend++ )
+	{
+		if( libfvde_crypto_backend_is_supported(
+		     crypto_backend ) == 0 )
+		{
+			continue;
+		}
+		result = libfvde_set_crypto_backend(
+		          crypto_backend,
+		          &error );
+
+		FVDE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FVDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfvde_encryption_context_set_keys(
+		          encryption_context,
+		          fvde_test_encryption_context_key,
+		          16,
+		          fvde_test_encryption_context_tweak_key,
+		          16,
+		          &error );
+
+		FVDE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FVDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FVDE_TEST_ASSERT_EQUAL_INT(
+		 "encryption_context->crypto_backend",
+		 encryption_context->crypto_backend,
+		 crypto_backend );
+
+		result = libfvde_encryption_context_crypt_sectors(
+		          encryption_context,
+		          LIBFVDE_ENCRYPTION_CRYPT_MODE_DECRYPT,
+		          fvde_test_encryption_context_encrypted_data,
+		          256,
+		          data,
+		          256,
+		          (uint64_t) 0x3333333333ULL,
+		          128,
+		          &error );
+
+		FVDE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FVDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( data_index = 0;
+		     data_index < 256;
+		     data_index++ )
+		{
+			if( data[ data_index ] != 0x44 )
+			{
+				break;
+			}
+		}
+		FVDE_TEST_ASSERT_EQUAL_SIZE(
+		 "data_index",
+		 data_index,
+		 (size_t) 256 );
+	}
+	result = libfvde_set_crypto_backend(
+	          LIBFVDE_CRYPTO_BACKEND_DEFAULT,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_encryption_context_crypt_sectors(
+	          NULL,
+	          LIBFVDE_ENCRYPTION_CRYPT_MODE_DECRYPT,
+	          fvde_test_encryption_context_encrypted_data,
+	          256,
+	          data,
+	          256,
+	          (uint64_t) 0x3333333333ULL,
+	          128,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_encryption_context_crypt_sectors(
+	          encryption_context,
+	          LIBFVDE_ENCRYPTION_CRYPT_MODE_DECRYPT,
+	          NULL,
+	          256,
+	          data,
+	          256,
+	          (uint64_t) 0x3333333333ULL,
+	          128,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_encryption_context_crypt_sectors(
+	          encryption_context,
+	          LIBFVDE_ENCRYPTION_CRYPT_MODE_DECRYPT,
+	          fvde_test_encryption_context_encrypted_data,
+	          256,
+	          NULL,
+	          256,
+	          (uint64_t) 0x3333333333ULL,
+	          128,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_encryption_context_crypt_sectors(
+	          encryption_context,
+	          LIBFVDE_ENCRYPTION_CRYPT_MODE_DECRYPT,
+	          fvde_test_encryption_context_encrypted_data,
+	          256,
+	          data,
+	          128,
+	          (uint64_t) 0x3333333333ULL,
+	          128,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_encryption_context_crypt_sectors(
+	          encryption_context,
+	          LIBFVDE_ENCRYPTION_CRYPT_MODE_DECRYPT,
+	          fvde_test_encryption_context_encrypted_data,
+	          256,
+	          data,
+	          256,
+	          (uint64_t) 0x3333333333ULL,
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_encryption_context_crypt_sectors(
+	          encryption_context,
+	          LIBFVDE_ENCRYPTION_CRYPT_MODE_DECRYPT,
+	          fvde_test_encryption_context_encrypted_data,
+	          256,
+	          data,
+	          256,
+	          (uint64_t) 0x3333333333ULL,
+	          96,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_encryption_context_free(
+	          &encryption_context,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "encryption_context",
+	 encryption_context );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( encryption_context != NULL )
+	{
+		libfvde_encryption_context_free(
+		 &encryption_context,
+		 NULL );
+	}
+	libfvde_set_crypto_backend(
+	 LIBFVDE_CRYPTO_BACKEND_DEFAULT,
+	 NULL );
+
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
 
 /* The main program
@@ -324,6 +658,10 @@ int main(
 
 	/* TODO: add tests for libfvde_encryption_context_crypt */
 
+	FVDE_TEST_RUN(
+	 "libfvde_encryption_context_crypt_sectors",
+	 fvde_test_encryption_context_crypt_sectors );
+
 	/* TODO: add tests for libfvde_encryption_aes_key_unwrap */
 
 #endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
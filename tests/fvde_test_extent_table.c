@@ -0,0 +1,1507 @@
+/*
+ * Library extent_table type test program
+ *
+ * Copyright (C) 2011-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fvde_test_libcerror.h"
+#include "fvde_test_libfvde.h"
+#include "fvde_test_macros.h"
+#include "fvde_test_memory.h"
+#include "fvde_test_unused.h"
+
+#include "../libfvde/libfvde_definitions.h"
+#include "../libfvde/libfvde_extent_table.h"
+#include "../libfvde/libfvde_libfdata.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT )
+
+/* Creates an extent table with test extents
+ * Returns 1 if successful or -1 on error
+ */
+int fvde_test_extent_table_initialize_with_extents(
+     libfvde_extent_table_t **extent_table,
+     libcerror_error_t **error )
+{
+	if( libfvde_extent_table_initialize(
+	     extent_table,
+	     4096,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	/* Blocks 0 - 15 consist of 2 physically adjacent extents
+	 */
+	if( libfvde_extent_table_append_extent(
+	     *extent_table,
+	     0,
+	     100,
+	     8,
+	     0,
+	     LIBFVDE_RANGE_FLAG_IS_ENCRYPTED,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfvde_extent_table_append_extent(
+	     *extent_table,
+	     8,
+	     108,
+	     8,
+	     0,
+	     LIBFVDE_RANGE_FLAG_IS_ENCRYPTED,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	/* Blocks 16 - 23 are stored on another physical volume
+	 */
+	if( libfvde_extent_table_append_extent(
+	     *extent_table,
+	     16,
+	     116,
+	     8,
+	     1,
+	     LIBFVDE_RANGE_FLAG_IS_ENCRYPTED,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	/* Blocks 24 - 31 are sparse
+	 */
+	if( libfvde_extent_table_append_extent(
+	     *extent_table,
+	     24,
+	     0,
+	     8,
+	     0,
+	     LIBFVDE_RANGE_FLAG_IS_SPARSE,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	/* Blocks 32 - 39 are not part of an extent
+	 */
+	if( libfvde_extent_table_append_extent(
+	     *extent_table,
+	     40,
+	     300,
+	     8,
+	     0,
+	     LIBFVDE_RANGE_FLAG_IS_ENCRYPTED,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	libfvde_extent_table_free(
+	 extent_table,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Tests the libfvde_extent_table_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_extent_table_initialize(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libfvde_extent_table_t *extent_table = NULL;
+	int result                           = 0;
+
+	/* Test regular cases
+	 */
+	result = libfvde_extent_table_initialize(
+	          &extent_table,
+	          4096,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "extent_table",
+	 extent_table );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_extent_table_free(
+	          &extent_table,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "extent_table",
+	 extent_table );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_extent_table_initialize(
+	          NULL,
+	          4096,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	extent_table = (libfvde_extent_table_t *) 0x12345678UL;
+
+	result = libfvde_extent_table_initialize(
+	          &extent_table,
+	          4096,
+	          &error );
+
+	extent_table = NULL;
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_extent_table_initialize(
+	          &extent_table,
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extent_table != NULL )
+	{
+		libfvde_extent_table_free(
+		 &extent_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_extent_table_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_extent_table_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfvde_extent_table_free(
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_extent_table_append_extent function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_extent_table_append_extent(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libfvde_extent_table_t *extent_table = NULL;
+	int number_of_extents                = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_extent_table_initialize(
+	          &extent_table,
+	          4096,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "extent_table",
+	 extent_table );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_extent_table_append_extent(
+	          extent_table,
+	          0,
+	          100,
+	          8,
+	          0,
+	          LIBFVDE_RANGE_FLAG_IS_ENCRYPTED,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a physically adjacent extent is coalesced
+	 */
+	result = libfvde_extent_table_append_extent(
+	          extent_table,
+	          8,
+	          108,
+	          8,
+	          0,
+	          LIBFVDE_RANGE_FLAG_IS_ENCRYPTED,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_extent_table_get_number_of_extents(
+	          extent_table,
+	          &number_of_extents,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_extents",
+	 number_of_extents,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+
+	FVDE_TEST_ASSERT_EQUAL_UINT64(
+	 "extent_table->extents[ 0 ].number_of_blocks",
+	 extent_table->extents[ 0 ].number_of_blocks,
+	 (uint64_t) 16 );
+
+	/* Test that a physically non-adjacent extent is not coalesced
+	 */
+	result = libfvde_extent_table_append_extent(
+	          extent_table,
+	          16,
+	          200,
+	          8,
+	          0,
+	          LIBFVDE_RANGE_FLAG_IS_ENCRYPTED,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that logically adjacent sparse extents are coalesced
+	 */
+	result = libfvde_extent_table_append_extent(
+	          extent_table,
+	          24,
+	          0,
+	          8,
+	          0,
+	          LIBFVDE_RANGE_FLAG_IS_SPARSE,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_extent_table_append_extent(
+	          extent_table,
+	          32,
+	          0,
+	          8,
+	          0,
+	          LIBFVDE_RANGE_FLAG_IS_SPARSE,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_extent_table_get_number_of_extents(
+	          extent_table,
+	          &number_of_extents,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_extents",
+	 number_of_extents,
+	 3 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_extent_table_append_extent(
+	          NULL,
+	          40,
+	          300,
+	          8,
+	          0,
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_extent_table_append_extent(
+	          extent_table,
+	          40,
+	          300,
+	          0,
+	          0,
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test overlapping extent
+	 */
+	result = libfvde_extent_table_append_extent(
+	          extent_table,
+	          36,
+	          300,
+	          8,
+	          0,
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_extent_table_free(
+	          &extent_table,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "extent_table",
+	 extent_table );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extent_table != NULL )
+	{
+		libfvde_extent_table_free(
+		 &extent_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_extent_table_get_number_of_extents function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_extent_table_get_number_of_extents(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libfvde_extent_table_t *extent_table = NULL;
+	int number_of_extents                = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = fvde_test_extent_table_initialize_with_extents(
+	          &extent_table,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "extent_table",
+	 extent_table );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_extent_table_get_number_of_extents(
+	          extent_table,
+	          &number_of_extents,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_extents",
+	 number_of_extents,
+	 4 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_extent_table_get_number_of_extents(
+	          NULL,
+	          &number_of_extents,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_extent_table_get_number_of_extents(
+	          extent_table,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_extent_table_free(
+	          &extent_table,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "extent_table",
+	 extent_table );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extent_table != NULL )
+	{
+		libfvde_extent_table_free(
+		 &extent_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_extent_table_get_extent_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_extent_table_get_extent_by_index(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libfvde_extent_t *extent             = NULL;
+	libfvde_extent_table_t *extent_table = NULL;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = fvde_test_extent_table_initialize_with_extents(
+	          &extent_table,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "extent_table",
+	 extent_table );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_extent_table_get_extent_by_index(
+	          extent_table,
+	          1,
+	          &extent,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "extent",
+	 extent );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT64(
+	 "extent->logical_block_number",
+	 extent->logical_block_number,
+	 (uint64_t) 16 );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT64(
+	 "extent->physical_block_number",
+	 extent->physical_block_number,
+	 (uint64_t) 116 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "extent->physical_volume_index",
+	 (int) extent->physical_volume_index,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_extent_table_get_extent_by_index(
+	          NULL,
+	          1,
+	          &extent,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_extent_table_get_extent_by_index(
+	          extent_table,
+	          -1,
+	          &extent,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_extent_table_get_extent_by_index(
+	          extent_table,
+	          4,
+	          &extent,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_extent_table_get_extent_by_index(
+	          extent_table,
+	          1,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_extent_table_free(
+	          &extent_table,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "extent_table",
+	 extent_table );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extent_table != NULL )
+	{
+		libfvde_extent_table_free(
+		 &extent_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_extent_table_get_extent_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_extent_table_get_extent_at_offset(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libfvde_extent_t *extent             = NULL;
+	libfvde_extent_table_t *extent_table = NULL;
+	int extent_index                     = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = fvde_test_extent_table_initialize_with_extents(
+	          &extent_table,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "extent_table",
+	 extent_table );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_extent_table_get_extent_at_offset(
+	          extent_table,
+	          0,
+	          &extent_index,
+	          &extent,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "extent_index",
+	 extent_index,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_extent_table_get_extent_at_offset(
+	          extent_table,
+	          ( 16 * 4096 ) - 1,
+	          &extent_index,
+	          &extent,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "extent_index",
+	 extent_index,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_extent_table_get_extent_at_offset(
+	          extent_table,
+	          ( 24 * 4096 ) + 512,
+	          &extent_index,
+	          &extent,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "extent_index",
+	 extent_index,
+	 2 );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT32(
+	 "extent->range_flags",
+	 extent->range_flags,
+	 LIBFVDE_RANGE_FLAG_IS_SPARSE );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_extent_table_get_extent_at_offset(
+	          extent_table,
+	          47 * 4096,
+	          &extent_index,
+	          &extent,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "extent_index",
+	 extent_index,
+	 3 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test offset that is not part of an extent
+	 */
+	result = libfvde_extent_table_get_extent_at_offset(
+	          extent_table,
+	          32 * 4096,
+	          &extent_index,
+	          &extent,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_extent_table_get_extent_at_offset(
+	          extent_table,
+	          48 * 4096,
+	          &extent_index,
+	          &extent,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_extent_table_get_extent_at_offset(
+	          NULL,
+	          0,
+	          &extent_index,
+	          &extent,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_extent_table_get_extent_at_offset(
+	          extent_table,
+	          -1,
+	          &extent_index,
+	          &extent,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_extent_table_get_extent_at_offset(
+	          extent_table,
+	          0,
+	          NULL,
+	          &extent,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_extent_table_get_extent_at_offset(
+	          extent_table,
+	          0,
+	          &extent_index,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_extent_table_free(
+	          &extent_table,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "extent_table",
+	 extent_table );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extent_table != NULL )
+	{
+		libfvde_extent_table_free(
+		 &extent_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_extent_table_get_next_range_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_extent_table_get_next_range_offset(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libfvde_extent_table_t *extent_table = NULL;
+	off64_t range_offset                 = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = fvde_test_extent_table_initialize_with_extents(
+	          &extent_table,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "extent_table",
+	 extent_table );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_extent_table_get_next_range_offset(
+	          extent_table,
+	          0,
+	          0,
+	          &range_offset,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT64(
+	 "range_offset",
+	 (int64_t) range_offset,
+	 (int64_t) 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_extent_table_get_next_range_offset(
+	          extent_table,
+	          0,
+	          1,
+	          &range_offset,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT64(
+	 "range_offset",
+	 (int64_t) range_offset,
+	 (int64_t) 24 * 4096 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_extent_table_get_next_range_offset(
+	          extent_table,
+	          ( 24 * 4096 ) + 512,
+	          1,
+	          &range_offset,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT64(
+	 "range_offset",
+	 (int64_t) range_offset,
+	 (int64_t) ( 24 * 4096 ) + 512 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_extent_table_get_next_range_offset(
+	          extent_table,
+	          ( 24 * 4096 ) + 512,
+	          0,
+	          &range_offset,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT64(
+	 "range_offset",
+	 (int64_t) range_offset,
+	 (int64_t) 40 * 4096 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test offset that is not part of an extent
+	 */
+	result = libfvde_extent_table_get_next_range_offset(
+	          extent_table,
+	          33 * 4096,
+	          0,
+	          &range_offset,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT64(
+	 "range_offset",
+	 (int64_t) range_offset,
+	 (int64_t) 40 * 4096 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_extent_table_get_next_range_offset(
+	          extent_table,
+	          33 * 4096,
+	          1,
+	          &range_offset,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT64(
+	 "range_offset",
+	 (int64_t) range_offset,
+	 (int64_t) 33 * 4096 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test offsets beyond the last extent
+	 */
+	result = libfvde_extent_table_get_next_range_offset(
+	          extent_table,
+	          40 * 4096,
+	          1,
+	          &range_offset,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT64(
+	 "range_offset",
+	 (int64_t) range_offset,
+	 (int64_t) 48 * 4096 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_extent_table_get_next_range_offset(
+	          extent_table,
+	          48 * 4096,
+	          0,
+	          &range_offset,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_extent_table_get_next_range_offset(
+	          extent_table,
+	          48 * 4096,
+	          1,
+	          &range_offset,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT64(
+	 "range_offset",
+	 (int64_t) range_offset,
+	 (int64_t) 48 * 4096 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_extent_table_get_next_range_offset(
+	          NULL,
+	          0,
+	          0,
+	          &range_offset,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_extent_table_get_next_range_offset(
+	          extent_table,
+	          -1,
+	          0,
+	          &range_offset,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_extent_table_get_next_range_offset(
+	          extent_table,
+	          0,
+	          0,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_extent_table_free(
+	          &extent_table,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "extent_table",
+	 extent_table );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extent_table != NULL )
+	{
+		libfvde_extent_table_free(
+		 &extent_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FVDE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FVDE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FVDE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FVDE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FVDE_TEST_UNREFERENCED_PARAMETER( argc )
+	FVDE_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT )
+
+	FVDE_TEST_RUN(
+	 "libfvde_extent_table_initialize",
+	 fvde_test_extent_table_initialize );
+
+	FVDE_TEST_RUN(
+	 "libfvde_extent_table_free",
+	 fvde_test_extent_table_free );
+
+	FVDE_TEST_RUN(
+	 "libfvde_extent_table_append_extent",
+	 fvde_test_extent_table_append_extent );
+
+	FVDE_TEST_RUN(
+	 "libfvde_extent_table_get_number_of_extents",
+	 fvde_test_extent_table_get_number_of_extents );
+
+	FVDE_TEST_RUN(
+	 "libfvde_extent_table_get_extent_by_index",
+	 fvde_test_extent_table_get_extent_by_index );
+
+	FVDE_TEST_RUN(
+	 "libfvde_extent_table_get_extent_at_offset",
+	 fvde_test_extent_table_get_extent_at_offset );
+
+	FVDE_TEST_RUN(
+	 "libfvde_extent_table_get_next_range_offset",
+	 fvde_test_extent_table_get_next_range_offset );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
+}
+
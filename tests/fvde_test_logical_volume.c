@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -39,7 +40,10 @@
 #include "fvde_test_memory.h"
 #include "fvde_test_unused.h"
 
+#include "../libfvde/libfvde_definitions.h"
+#include "../libfvde/libfvde_extent_table.h"
 #include "../libfvde/libfvde_io_handle.h"
+#include "../libfvde/libfvde_libfdata.h"
 #include "../libfvde/libfvde_logical_volume.h"
 #include "../libfvde/libfvde_logical_volume_descriptor.h"
 
@@ -437,6 +441,1498 @@ on_error:
 
 #if defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT )
 
+/* Tests the libfvde_internal_logical_volume_open_read_data_on_demand function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_internal_logical_volume_open_read_data_on_demand(
+     void )
+{
+	libcerror_error_t *error                                       = NULL;
+	libfvde_io_handle_t *io_handle                                 = NULL;
+	libfvde_logical_volume_t *logical_volume                       = NULL;
+	libfvde_logical_volume_descriptor_t *logical_volume_descriptor = NULL;
+	int result                                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_logical_volume_descriptor_initialize(
+	          &logical_volume_descriptor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "logical_volume_descriptor",
+	 logical_volume_descriptor );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_logical_volume_initialize(
+	          &logical_volume,
+	          io_handle,
+	          NULL,
+	          logical_volume_descriptor,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "logical_volume",
+	 logical_volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_internal_logical_volume_open_read_data_on_demand(
+	          (libfvde_internal_logical_volume_t *) logical_volume,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The logical volume data is not read if the logical volume was not opened
+	 */
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "logical_volume->volume_data_handle",
+	 ( (libfvde_internal_logical_volume_t *) logical_volume )->volume_data_handle );
+
+	/* Test error cases
+	 */
+	result = libfvde_internal_logical_volume_open_read_data_on_demand(
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_internal_logical_volume_open_read(
+	          (libfvde_internal_logical_volume_t *) logical_volume,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_logical_volume_free(
+	          &logical_volume,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "logical_volume",
+	 logical_volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_logical_volume_descriptor_free(
+	          &logical_volume_descriptor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( logical_volume != NULL )
+	{
+		libfvde_logical_volume_free(
+		 &logical_volume,
+		 NULL );
+	}
+	if( logical_volume_descriptor != NULL )
+	{
+		libfvde_logical_volume_descriptor_free(
+		 &logical_volume_descriptor,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfvde_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_logical_volume_get_number_of_extents and libfvde_logical_volume_get_extent_by_index functions
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_logical_volume_get_extent_by_index(
+     void )
+{
+	libcerror_error_t *error                                       = NULL;
+	libfvde_io_handle_t *io_handle                                 = NULL;
+	libfvde_logical_volume_t *logical_volume                       = NULL;
+	libfvde_logical_volume_descriptor_t *logical_volume_descriptor = NULL;
+	size64_t extent_size                                           = 0;
+	off64_t extent_offset                                          = 0;
+	off64_t physical_volume_offset                                 = 0;
+	uint32_t extent_flags                                          = 0;
+	int number_of_extents                                          = 0;
+	int physical_volume_index                                      = 0;
+	int result                                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_logical_volume_descriptor_initialize(
+	          &logical_volume_descriptor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "logical_volume_descriptor",
+	 logical_volume_descriptor );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_logical_volume_initialize(
+	          &logical_volume,
+	          io_handle,
+	          NULL,
+	          logical_volume_descriptor,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "logical_volume",
+	 logical_volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test logical volume without extent table
+	 */
+	result = libfvde_logical_volume_get_number_of_extents(
+	          logical_volume,
+	          &number_of_extents,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_extents",
+	 number_of_extents,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_logical_volume_get_extent_by_index(
+	          logical_volume,
+	          0,
+	          &extent_offset,
+	          &extent_size,
+	          &physical_volume_index,
+	          &physical_volume_offset,
+	          &extent_flags,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Initialize extent table
+	 */
+	( (libfvde_internal_logical_volume_t *) logical_volume )->volume_size = ( 24 * 4096 ) + 1024;
+
+	result = libfvde_extent_table_initialize(
+	          &( ( (libfvde_internal_logical_volume_t *) logical_volume )->extent_table ),
+	          4096,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_extent_table_append_extent(
+	          ( (libfvde_internal_logical_volume_t *) logical_volume )->extent_table,
+	          0,
+	          100,
+	          8,
+	          0,
+	          LIBFVDE_RANGE_FLAG_IS_ENCRYPTED,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_extent_table_append_extent(
+	          ( (libfvde_internal_logical_volume_t *) logical_volume )->extent_table,
+	          8,
+	          0,
+	          8,
+	          0,
+	          LIBFVDE_RANGE_FLAG_IS_SPARSE,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_extent_table_append_extent(
+	          ( (libfvde_internal_logical_volume_t *) logical_volume )->extent_table,
+	          16,
+	          300,
+	          8,
+	          1,
+	          LIBFVDE_RANGE_FLAG_IS_ENCRYPTED,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_extent_table_append_extent(
+	          ( (libfvde_internal_logical_volume_t *) logical_volume )->extent_table,
+	          24,
+	          0,
+	          1,
+	          0,
+	          LIBFVDE_RANGE_FLAG_IS_SPARSE,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_logical_volume_get_number_of_extents(
+	          logical_volume,
+	          &number_of_extents,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_extents",
+	 number_of_extents,
+	 4 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_logical_volume_get_extent_by_index(
+	          logical_volume,
+	          2,
+	          &extent_offset,
+	          &extent_size,
+	          &physical_volume_index,
+	          &physical_volume_offset,
+	          &extent_flags,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT64(
+	 "extent_offset",
+	 extent_offset,
+	 (int64_t) ( 16 * 4096 ) );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT64(
+	 "extent_size",
+	 extent_size,
+	 (uint64_t) ( 8 * 4096 ) );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "physical_volume_index",
+	 physical_volume_index,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT64(
+	 "physical_volume_offset",
+	 physical_volume_offset,
+	 (int64_t) ( 300 * 4096 ) );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT32(
+	 "extent_flags",
+	 extent_flags,
+	 (uint32_t) LIBFVDE_EXTENT_FLAG_IS_ENCRYPTED );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the trailing sparse extent is trimmed to the volume size
+	 */
+	result = libfvde_logical_volume_get_extent_by_index(
+	          logical_volume,
+	          3,
+	          &extent_offset,
+	          &extent_size,
+	          &physical_volume_index,
+	          &physical_volume_offset,
+	          &extent_flags,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT64(
+	 "extent_size",
+	 extent_size,
+	 (uint64_t) 1024 );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT32(
+	 "extent_flags",
+	 extent_flags,
+	 (uint32_t) LIBFVDE_EXTENT_FLAG_IS_SPARSE );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_logical_volume_get_number_of_extents(
+	          NULL,
+	          &number_of_extents,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_logical_volume_get_number_of_extents(
+	          logical_volume,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_logical_volume_get_extent_by_index(
+	          NULL,
+	          0,
+	          &extent_offset,
+	          &extent_size,
+	          &physical_volume_index,
+	          &physical_volume_offset,
+	          &extent_flags,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_logical_volume_get_extent_by_index(
+	          logical_volume,
+	          -1,
+	          &extent_offset,
+	          &extent_size,
+	          &physical_volume_index,
+	          &physical_volume_offset,
+	          &extent_flags,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_logical_volume_get_extent_by_index(
+	          logical_volume,
+	          4,
+	          &extent_offset,
+	          &extent_size,
+	          &physical_volume_index,
+	          &physical_volume_offset,
+	          &extent_flags,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_logical_volume_get_extent_by_index(
+	          logical_volume,
+	          0,
+	          NULL,
+	          &extent_size,
+	          &physical_volume_index,
+	          &physical_volume_offset,
+	          &extent_flags,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_logical_volume_get_extent_by_index(
+	          logical_volume,
+	          0,
+	          &extent_offset,
+	          NULL,
+	          &physical_volume_index,
+	          &physical_volume_offset,
+	          &extent_flags,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_logical_volume_get_extent_by_index(
+	          logical_volume,
+	          0,
+	          &extent_offset,
+	          &extent_size,
+	          NULL,
+	          &physical_volume_offset,
+	          &extent_flags,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_logical_volume_get_extent_by_index(
+	          logical_volume,
+	          0,
+	          &extent_offset,
+	          &extent_size,
+	          &physical_volume_index,
+	          NULL,
+	          &extent_flags,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_logical_volume_get_extent_by_index(
+	          logical_volume,
+	          0,
+	          &extent_offset,
+	          &extent_size,
+	          &physical_volume_index,
+	          &physical_volume_offset,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_logical_volume_free(
+	          &logical_volume,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "logical_volume",
+	 logical_volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_logical_volume_descriptor_free(
+	          &logical_volume_descriptor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( logical_volume != NULL )
+	{
+		libfvde_logical_volume_free(
+		 &logical_volume,
+		 NULL );
+	}
+	if( logical_volume_descriptor != NULL )
+	{
+		libfvde_logical_volume_descriptor_free(
+		 &logical_volume_descriptor,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfvde_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_internal_logical_volume_read_ahead_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_internal_logical_volume_read_ahead_at_offset(
+     void )
+{
+	libfvde_internal_logical_volume_t internal_logical_volume;
+	libfvde_io_handle_t io_handle;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = memory_set(
+	          &internal_logical_volume,
+	          0,
+	          sizeof( libfvde_internal_logical_volume_t ) ) != NULL;
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = memory_set(
+	          &io_handle,
+	          0,
+	          sizeof( libfvde_io_handle_t ) ) != NULL;
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libfvde_internal_logical_volume_read_ahead_at_offset(
+	          NULL,
+	          NULL,
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where IO handle is missing
+	 */
+	result = libfvde_internal_logical_volume_read_ahead_at_offset(
+	          &internal_logical_volume,
+	          NULL,
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where bytes per sector is 0
+	 */
+	internal_logical_volume.io_handle = &io_handle;
+
+	result = libfvde_internal_logical_volume_read_ahead_at_offset(
+	          &internal_logical_volume,
+	          NULL,
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where sector data size is 0
+	 */
+	io_handle.bytes_per_sector = 512;
+
+	result = libfvde_internal_logical_volume_read_ahead_at_offset(
+	          &internal_logical_volume,
+	          NULL,
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where maximum read-ahead size is 0
+	 */
+	internal_logical_volume.sector_data_size = 512;
+
+	result = libfvde_internal_logical_volume_read_ahead_at_offset(
+	          &internal_logical_volume,
+	          NULL,
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where offset is out of bounds
+	 */
+	internal_logical_volume.maximum_read_ahead_size = LIBFVDE_MINIMUM_READ_AHEAD_SIZE;
+
+	result = libfvde_internal_logical_volume_read_ahead_at_offset(
+	          &internal_logical_volume,
+	          NULL,
+	          -1,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test offset beyond the volume size
+	 */
+	result = libfvde_internal_logical_volume_read_ahead_at_offset(
+	          &internal_logical_volume,
+	          NULL,
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_internal_logical_volume_pread_buffer_from_file_io_pool function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_internal_logical_volume_pread_buffer_from_file_io_pool(
+     void )
+{
+	uint8_t buffer[ 512 ];
+	libfvde_internal_logical_volume_t internal_logical_volume;
+	libfvde_io_handle_t io_handle;
+
+	libcerror_error_t *error = NULL;
+	ssize_t read_count       = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = memory_set(
+	          &internal_logical_volume,
+	          0,
+	          sizeof( libfvde_internal_logical_volume_t ) ) != NULL;
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = memory_set(
+	          &io_handle,
+	          0,
+	          sizeof( libfvde_io_handle_t ) ) != NULL;
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test error cases
+	 */
+	read_count = libfvde_internal_logical_volume_pread_buffer_from_file_io_pool(
+	              NULL,
+	              NULL,
+	              buffer,
+	              512,
+	              0,
+	              &error );
+
+	FVDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where IO handle is missing
+	 */
+	read_count = libfvde_internal_logical_volume_pread_buffer_from_file_io_pool(
+	              &internal_logical_volume,
+	              NULL,
+	              buffer,
+	              512,
+	              0,
+	              &error );
+
+	FVDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where bytes per sector is 0
+	 */
+	internal_logical_volume.io_handle = &io_handle;
+
+	read_count = libfvde_internal_logical_volume_pread_buffer_from_file_io_pool(
+	              &internal_logical_volume,
+	              NULL,
+	              buffer,
+	              512,
+	              0,
+	              &error );
+
+	FVDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where logical volume descriptor is missing
+	 */
+	io_handle.bytes_per_sector = 512;
+
+	read_count = libfvde_internal_logical_volume_pread_buffer_from_file_io_pool(
+	              &internal_logical_volume,
+	              NULL,
+	              buffer,
+	              512,
+	              0,
+	              &error );
+
+	FVDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_read_range_compare function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_read_range_compare(
+     void )
+{
+	libfvde_read_range_t first_read_range;
+	libfvde_read_range_t second_read_range;
+
+	int result = 0;
+
+	first_read_range.offset  = 512;
+	second_read_range.offset = 4096;
+
+	/* Test regular cases
+	 */
+	result = libfvde_read_range_compare(
+	          &first_read_range,
+	          &second_read_range );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	result = libfvde_read_range_compare(
+	          &second_read_range,
+	          &first_read_range );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfvde_read_range_compare(
+	          &first_read_range,
+	          &first_read_range );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libfvde_internal_logical_volume_read_buffers_at_offsets_from_file_io_pool function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_internal_logical_volume_read_buffers_at_offsets_from_file_io_pool(
+     void )
+{
+	uint8_t buffer[ 512 ];
+	libfvde_internal_logical_volume_t internal_logical_volume;
+	libfvde_io_handle_t io_handle;
+	libfvde_logical_volume_descriptor_t logical_volume_descriptor;
+
+	libcerror_error_t *error = NULL;
+	void *buffers[ 2 ]       = { buffer, NULL };
+	size_t buffer_sizes[ 2 ] = { 512, 512 };
+	off64_t offsets[ 2 ]     = { 0, 0 };
+	ssize_t read_counts[ 2 ] = { 0, 0 };
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = memory_set(
+	          &internal_logical_volume,
+	          0,
+	          sizeof( libfvde_internal_logical_volume_t ) ) != NULL;
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = memory_set(
+	          &io_handle,
+	          0,
+	          sizeof( libfvde_io_handle_t ) ) != NULL;
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = memory_set(
+	          &logical_volume_descriptor,
+	          0,
+	          sizeof( libfvde_logical_volume_descriptor_t ) ) != NULL;
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libfvde_internal_logical_volume_read_buffers_at_offsets_from_file_io_pool(
+	          NULL,
+	          NULL,
+	          buffers,
+	          buffer_sizes,
+	          offsets,
+	          read_counts,
+	          1,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where IO handle is missing
+	 */
+	result = libfvde_internal_logical_volume_read_buffers_at_offsets_from_file_io_pool(
+	          &internal_logical_volume,
+	          NULL,
+	          buffers,
+	          buffer_sizes,
+	          offsets,
+	          read_counts,
+	          1,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where bytes per sector is 0
+	 */
+	internal_logical_volume.io_handle = &io_handle;
+
+	result = libfvde_internal_logical_volume_read_buffers_at_offsets_from_file_io_pool(
+	          &internal_logical_volume,
+	          NULL,
+	          buffers,
+	          buffer_sizes,
+	          offsets,
+	          read_counts,
+	          1,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where logical volume descriptor is missing
+	 */
+	io_handle.bytes_per_sector = 512;
+
+	result = libfvde_internal_logical_volume_read_buffers_at_offsets_from_file_io_pool(
+	          &internal_logical_volume,
+	          NULL,
+	          buffers,
+	          buffer_sizes,
+	          offsets,
+	          read_counts,
+	          1,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	internal_logical_volume.logical_volume_descriptor = &logical_volume_descriptor;
+
+	result = libfvde_internal_logical_volume_read_buffers_at_offsets_from_file_io_pool(
+	          &internal_logical_volume,
+	          NULL,
+	          NULL,
+	          buffer_sizes,
+	          offsets,
+	          read_counts,
+	          1,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_internal_logical_volume_read_buffers_at_offsets_from_file_io_pool(
+	          &internal_logical_volume,
+	          NULL,
+	          buffers,
+	          NULL,
+	          offsets,
+	          read_counts,
+	          1,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_internal_logical_volume_read_buffers_at_offsets_from_file_io_pool(
+	          &internal_logical_volume,
+	          NULL,
+	          buffers,
+	          buffer_sizes,
+	          NULL,
+	          read_counts,
+	          1,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_internal_logical_volume_read_buffers_at_offsets_from_file_io_pool(
+	          &internal_logical_volume,
+	          NULL,
+	          buffers,
+	          buffer_sizes,
+	          offsets,
+	          NULL,
+	          1,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_internal_logical_volume_read_buffers_at_offsets_from_file_io_pool(
+	          &internal_logical_volume,
+	          NULL,
+	          buffers,
+	          buffer_sizes,
+	          offsets,
+	          read_counts,
+	          -1,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where a buffer is missing
+	 */
+	result = libfvde_internal_logical_volume_read_buffers_at_offsets_from_file_io_pool(
+	          &internal_logical_volume,
+	          NULL,
+	          buffers,
+	          buffer_sizes,
+	          offsets,
+	          read_counts,
+	          2,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test reads beyond the end of the volume
+	 */
+	result = libfvde_internal_logical_volume_read_buffers_at_offsets_from_file_io_pool(
+	          &internal_logical_volume,
+	          NULL,
+	          buffers,
+	          buffer_sizes,
+	          offsets,
+	          read_counts,
+	          1,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_counts[ 0 ]",
+	 read_counts[ 0 ],
+	 (ssize_t) 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* Tests the libfvde_internal_logical_volume_read_buffer_from_file_io_pool function
  * Returns 1 if successful or 0 if not
  */
@@ -802,12 +2298,36 @@ int main(
 
 	/* TODO: add tests for libfvde_internal_logical_volume_open_read */
 
+	FVDE_TEST_RUN(
+	 "libfvde_internal_logical_volume_open_read_data_on_demand",
+	 fvde_test_internal_logical_volume_open_read_data_on_demand );
+
 	/* TODO: add tests for libfvde_internal_logical_volume_open_read_keys_from_encrypted_metadata */
 
 #endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
 
 #if defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT )
 
+	FVDE_TEST_RUN(
+	 "libfvde_logical_volume_get_extent_by_index",
+	 fvde_test_logical_volume_get_extent_by_index );
+
+	FVDE_TEST_RUN(
+	 "libfvde_internal_logical_volume_read_ahead_at_offset",
+	 fvde_test_internal_logical_volume_read_ahead_at_offset );
+
+	FVDE_TEST_RUN(
+	 "libfvde_internal_logical_volume_pread_buffer_from_file_io_pool",
+	 fvde_test_internal_logical_volume_pread_buffer_from_file_io_pool );
+
+	FVDE_TEST_RUN(
+	 "libfvde_read_range_compare",
+	 fvde_test_read_range_compare );
+
+	FVDE_TEST_RUN(
+	 "libfvde_internal_logical_volume_read_buffers_at_offsets_from_file_io_pool",
+	 fvde_test_internal_logical_volume_read_buffers_at_offsets_from_file_io_pool );
+
 /* TODO
 		FVDE_TEST_RUN_WITH_ARGS(
 		 "libfvde_internal_logical_volume_read_buffer_from_file_io_pool",
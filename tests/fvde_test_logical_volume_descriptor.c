@@ -27,6 +27,7 @@
 #include <stdlib.h>
 #endif
 
+#include "fvde_test_libcdata.h"
 #include "fvde_test_libcerror.h"
 #include "fvde_test_libfvde.h"
 #include "fvde_test_macros.h"
@@ -270,6 +271,195 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfvde_logical_volume_descriptor_compare function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_logical_volume_descriptor_compare(
+     void )
+{
+	libcerror_error_t *error                                              = NULL;
+	libfvde_logical_volume_descriptor_t *first_logical_volume_descriptor  = NULL;
+	libfvde_logical_volume_descriptor_t *second_logical_volume_descriptor = NULL;
+	int result                                                            = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_logical_volume_descriptor_initialize(
+	          &first_logical_volume_descriptor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "first_logical_volume_descriptor",
+	 first_logical_volume_descriptor );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_logical_volume_descriptor_initialize(
+	          &second_logical_volume_descriptor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "second_logical_volume_descriptor",
+	 second_logical_volume_descriptor );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	first_logical_volume_descriptor->object_identifier  = 10;
+	second_logical_volume_descriptor->object_identifier = 20;
+
+	/* Test regular cases
+	 */
+	result = libfvde_logical_volume_descriptor_compare(
+	          first_logical_volume_descriptor,
+	          second_logical_volume_descriptor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBCDATA_COMPARE_LESS );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_logical_volume_descriptor_compare(
+	          second_logical_volume_descriptor,
+	          first_logical_volume_descriptor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBCDATA_COMPARE_GREATER );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_logical_volume_descriptor_compare(
+	          first_logical_volume_descriptor,
+	          first_logical_volume_descriptor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBCDATA_COMPARE_EQUAL );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_logical_volume_descriptor_compare(
+	          NULL,
+	          second_logical_volume_descriptor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_logical_volume_descriptor_compare(
+	          first_logical_volume_descriptor,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_logical_volume_descriptor_free(
+	          &second_logical_volume_descriptor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "second_logical_volume_descriptor",
+	 second_logical_volume_descriptor );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_logical_volume_descriptor_free(
+	          &first_logical_volume_descriptor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "first_logical_volume_descriptor",
+	 first_logical_volume_descriptor );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( second_logical_volume_descriptor != NULL )
+	{
+		libfvde_logical_volume_descriptor_free(
+		 &second_logical_volume_descriptor,
+		 NULL );
+	}
+	if( first_logical_volume_descriptor != NULL )
+	{
+		libfvde_logical_volume_descriptor_free(
+		 &first_logical_volume_descriptor,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
 
 /* The main program
@@ -297,6 +487,10 @@ int main(
 	 "libfvde_logical_volume_descriptor_free",
 	 fvde_test_logical_volume_descriptor_free );
 
+	FVDE_TEST_RUN(
+	 "libfvde_logical_volume_descriptor_compare",
+	 fvde_test_logical_volume_descriptor_compare );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
@@ -0,0 +1,1295 @@
+/*
+ * Library mapped_file_io_handle type test program
+ *
+ * Copyright (C) 2011-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fvde_test_libbfio.h"
+#include "fvde_test_libcerror.h"
+#include "fvde_test_libfvde.h"
+#include "fvde_test_macros.h"
+#include "fvde_test_memory.h"
+#include "fvde_test_unused.h"
+
+#include "../libfvde/libfvde_mapped_file_io_handle.h"
+
+#define FVDE_TEST_MAPPED_FILE_IO_HANDLE_FILENAME	"fvde_test_mapped_file_io_handle.tmp"
+
+#if defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT )
+
+/* Tests the libfvde_mapped_file_io_handle_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_mapped_file_io_handle_initialize(
+     void )
+{
+	libcerror_error_t *error                        = NULL;
+	libfvde_mapped_file_io_handle_t *file_io_handle = NULL;
+	int result                                      = 0;
+
+#if defined( HAVE_FVDE_TEST_MEMORY )
+	int number_of_malloc_fail_tests                 = 1;
+	int number_of_memset_fail_tests                 = 1;
+	int test_number                                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfvde_mapped_file_io_handle_initialize(
+	          &file_io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_mapped_file_io_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_mapped_file_io_handle_initialize(
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	file_io_handle = (libfvde_mapped_file_io_handle_t *) 0x12345678UL;
+
+	result = libfvde_mapped_file_io_handle_initialize(
+	          &file_io_handle,
+	          &error );
+
+	file_io_handle = NULL;
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FVDE_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfvde_mapped_file_io_handle_initialize with malloc failing
+		 */
+		fvde_test_malloc_attempts_before_fail = test_number;
+
+		result = libfvde_mapped_file_io_handle_initialize(
+		          &file_io_handle,
+		          &error );
+
+		if( fvde_test_malloc_attempts_before_fail != -1 )
+		{
+			fvde_test_malloc_attempts_before_fail = -1;
+
+			if( file_io_handle != NULL )
+			{
+				libfvde_mapped_file_io_handle_free(
+				 &file_io_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			FVDE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FVDE_TEST_ASSERT_IS_NULL(
+			 "file_io_handle",
+			 file_io_handle );
+
+			FVDE_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfvde_mapped_file_io_handle_initialize with memset failing
+		 */
+		fvde_test_memset_attempts_before_fail = test_number;
+
+		result = libfvde_mapped_file_io_handle_initialize(
+		          &file_io_handle,
+		          &error );
+
+		if( fvde_test_memset_attempts_before_fail != -1 )
+		{
+			fvde_test_memset_attempts_before_fail = -1;
+
+			if( file_io_handle != NULL )
+			{
+				libfvde_mapped_file_io_handle_free(
+				 &file_io_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			FVDE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FVDE_TEST_ASSERT_IS_NULL(
+			 "file_io_handle",
+			 file_io_handle );
+
+			FVDE_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FVDE_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libfvde_mapped_file_io_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_mapped_file_io_handle_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_mapped_file_io_handle_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfvde_mapped_file_io_handle_free(
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_mapped_file_io_handle_set_name function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_mapped_file_io_handle_set_name(
+     void )
+{
+	libcerror_error_t *error                                    = NULL;
+	libfvde_mapped_file_io_handle_t *destination_file_io_handle = NULL;
+	libfvde_mapped_file_io_handle_t *file_io_handle             = NULL;
+	int result                                                  = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_mapped_file_io_handle_initialize(
+	          &file_io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_mapped_file_io_handle_set_name(
+	          file_io_handle,
+	          "test",
+	          4,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_SIZE(
+	 "file_io_handle->name_size",
+	 file_io_handle->name_size,
+	 (size_t) 5 );
+
+	result = libfvde_mapped_file_io_handle_clone(
+	          &destination_file_io_handle,
+	          file_io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "destination_file_io_handle",
+	 destination_file_io_handle );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          destination_file_io_handle->name,
+	          "test",
+	          5 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfvde_mapped_file_io_handle_free(
+	          &destination_file_io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_mapped_file_io_handle_set_name(
+	          NULL,
+	          "test",
+	          4,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_mapped_file_io_handle_set_name(
+	          file_io_handle,
+	          NULL,
+	          4,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_mapped_file_io_handle_set_name(
+	          file_io_handle,
+	          "test",
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_mapped_file_io_handle_clone(
+	          NULL,
+	          file_io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_mapped_file_io_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( destination_file_io_handle != NULL )
+	{
+		libfvde_mapped_file_io_handle_free(
+		 &destination_file_io_handle,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libfvde_mapped_file_io_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_MMAP ) && defined( HAVE_MUNMAP )
+
+/* Tests the libfvde_mapped_file_io_handle_open, libfvde_mapped_file_io_handle_read_buffer,
+ * libfvde_mapped_file_io_handle_seek_offset and libfvde_mapped_file_io_handle_close functions
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_mapped_file_io_handle_read_buffer(
+     void )
+{
+	uint8_t buffer[ 256 ];
+	uint8_t data[ 8192 ];
+
+	libcerror_error_t *error                        = NULL;
+	libfvde_mapped_file_io_handle_t *file_io_handle = NULL;
+	FILE *file_stream                               = NULL;
+	size64_t size                                   = 0;
+	size_t data_index                               = 0;
+	ssize_t read_count                              = 0;
+	off64_t offset                                  = 0;
+	int result                                      = 0;
+
+	/* Initialize test
+	 */
+	for( data_index = 0;
+	     data_index < 8192;
+	     data_index++ )
+	{
+		data[ data_index ] = (uint8_t) ( data_index % 251 );
+	}
+	file_stream = file_stream_open(
+	               FVDE_TEST_MAPPED_FILE_IO_HANDLE_FILENAME,
+	               FILE_STREAM_BINARY_OPEN_WRITE );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "file_stream",
+	 file_stream );
+
+	read_count = (ssize_t) file_stream_write(
+	                        file_stream,
+	                        data,
+	                        8192 );
+
+	result = file_stream_close(
+	          file_stream );
+
+	FVDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 8192 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfvde_mapped_file_io_handle_initialize(
+	          &file_io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_mapped_file_io_handle_set_name(
+	          file_io_handle,
+	          FVDE_TEST_MAPPED_FILE_IO_HANDLE_FILENAME,
+	          narrow_string_length( FVDE_TEST_MAPPED_FILE_IO_HANDLE_FILENAME ),
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_mapped_file_io_handle_exists(
+	          file_io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_mapped_file_io_handle_open(
+	          file_io_handle,
+	          LIBBFIO_ACCESS_FLAG_READ,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_mapped_file_io_handle_is_open(
+	          file_io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_mapped_file_io_handle_get_size(
+	          file_io_handle,
+	          &size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 size,
+	 (uint64_t) 8192 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	offset = libfvde_mapped_file_io_handle_seek_offset(
+	          file_io_handle,
+	          4000,
+	          SEEK_SET,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 4000 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libfvde_mapped_file_io_handle_read_buffer(
+	              file_io_handle,
+	              buffer,
+	              256,
+	              &error );
+
+	FVDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 256 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( data[ 4000 ] ),
+	          256 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test read at the end of the file
+	 */
+	offset = libfvde_mapped_file_io_handle_seek_offset(
+	          file_io_handle,
+	          -100,
+	          SEEK_END,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 8092 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libfvde_mapped_file_io_handle_read_buffer(
+	              file_io_handle,
+	              buffer,
+	              256,
+	              &error );
+
+	FVDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 100 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libfvde_mapped_file_io_handle_read_buffer(
+	              file_io_handle,
+	              buffer,
+	              256,
+	              &error );
+
+	FVDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	offset = libfvde_mapped_file_io_handle_seek_offset(
+	          file_io_handle,
+	          -1,
+	          SEEK_SET,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfvde_mapped_file_io_handle_read_buffer(
+	              file_io_handle,
+	              NULL,
+	              256,
+	              &error );
+
+	FVDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfvde_mapped_file_io_handle_write_buffer(
+	              file_io_handle,
+	              buffer,
+	              256,
+	              &error );
+
+	FVDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_mapped_file_io_handle_open(
+	          file_io_handle,
+	          LIBBFIO_ACCESS_FLAG_READ,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_mapped_file_io_handle_close(
+	          file_io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_mapped_file_io_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	remove(
+	 FVDE_TEST_MAPPED_FILE_IO_HANDLE_FILENAME );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libfvde_mapped_file_io_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	remove(
+	 FVDE_TEST_MAPPED_FILE_IO_HANDLE_FILENAME );
+
+	return( 0 );
+}
+
+/* Tests the libfvde_mapped_file_io_handle_open function with an empty file and a non-regular file
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_mapped_file_io_handle_open_file_type(
+     void )
+{
+	uint8_t buffer[ 16 ];
+
+	libcerror_error_t *error                        = NULL;
+	libfvde_mapped_file_io_handle_t *file_io_handle = NULL;
+	FILE *file_stream                               = NULL;
+	size64_t size                                   = 0;
+	ssize_t read_count                              = 0;
+	int result                                      = 0;
+
+	/* Initialize test
+	 */
+	file_stream = file_stream_open(
+	               FVDE_TEST_MAPPED_FILE_IO_HANDLE_FILENAME,
+	               FILE_STREAM_BINARY_OPEN_WRITE );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "file_stream",
+	 file_stream );
+
+	result = file_stream_close(
+	          file_stream );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfvde_mapped_file_io_handle_initialize(
+	          &file_io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open of an empty file
+	 */
+	result = libfvde_mapped_file_io_handle_set_name(
+	          file_io_handle,
+	          FVDE_TEST_MAPPED_FILE_IO_HANDLE_FILENAME,
+	          narrow_string_length( FVDE_TEST_MAPPED_FILE_IO_HANDLE_FILENAME ),
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_mapped_file_io_handle_open(
+	          file_io_handle,
+	          LIBBFIO_ACCESS_FLAG_READ,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_mapped_file_io_handle_get_size(
+	          file_io_handle,
+	          &size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 size,
+	 (uint64_t) 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libfvde_mapped_file_io_handle_read_buffer(
+	              file_io_handle,
+	              buffer,
+	              16,
+	              &error );
+
+	FVDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_mapped_file_io_handle_close(
+	          file_io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error case where the file is neither a regular file nor a block device
+	 */
+	result = libfvde_mapped_file_io_handle_set_name(
+	          file_io_handle,
+	          "/dev/null",
+	          9,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_mapped_file_io_handle_open(
+	          file_io_handle,
+	          LIBBFIO_ACCESS_FLAG_READ,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_mapped_file_io_handle_is_open(
+	          file_io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libfvde_mapped_file_io_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	remove(
+	 FVDE_TEST_MAPPED_FILE_IO_HANDLE_FILENAME );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libfvde_mapped_file_io_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	remove(
+	 FVDE_TEST_MAPPED_FILE_IO_HANDLE_FILENAME );
+
+	return( 0 );
+}
+
+#endif /* defined( HAVE_MMAP ) && defined( HAVE_MUNMAP ) */
+
+/* Tests the libfvde_mapped_file_io_handle_open function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_mapped_file_io_handle_open(
+     void )
+{
+	libcerror_error_t *error                        = NULL;
+	libfvde_mapped_file_io_handle_t *file_io_handle = NULL;
+	int result                                      = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_mapped_file_io_handle_initialize(
+	          &file_io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_mapped_file_io_handle_open(
+	          NULL,
+	          LIBBFIO_ACCESS_FLAG_READ,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the name is missing
+	 */
+	result = libfvde_mapped_file_io_handle_open(
+	          file_io_handle,
+	          LIBBFIO_ACCESS_FLAG_READ,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_mapped_file_io_handle_set_name(
+	          file_io_handle,
+	          "fvde_test_mapped_file_io_handle.nonexistent",
+	          43,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error case where write access is requested
+	 */
+	result = libfvde_mapped_file_io_handle_open(
+	          file_io_handle,
+	          LIBBFIO_ACCESS_FLAG_READ | LIBBFIO_ACCESS_FLAG_WRITE,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the file does not exist
+	 */
+	result = libfvde_mapped_file_io_handle_open(
+	          file_io_handle,
+	          LIBBFIO_ACCESS_FLAG_READ,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_mapped_file_io_handle_is_open(
+	          file_io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libfvde_mapped_file_io_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libfvde_mapped_file_io_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FVDE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FVDE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FVDE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FVDE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FVDE_TEST_UNREFERENCED_PARAMETER( argc )
+	FVDE_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT )
+
+	FVDE_TEST_RUN(
+	 "libfvde_mapped_file_io_handle_initialize",
+	 fvde_test_mapped_file_io_handle_initialize );
+
+	FVDE_TEST_RUN(
+	 "libfvde_mapped_file_io_handle_free",
+	 fvde_test_mapped_file_io_handle_free );
+
+	FVDE_TEST_RUN(
+	 "libfvde_mapped_file_io_handle_set_name",
+	 fvde_test_mapped_file_io_handle_set_name );
+
+	FVDE_TEST_RUN(
+	 "libfvde_mapped_file_io_handle_open",
+	 fvde_test_mapped_file_io_handle_open );
+
+#if defined( HAVE_MMAP ) && defined( HAVE_MUNMAP )
+
+	FVDE_TEST_RUN(
+	 "libfvde_mapped_file_io_handle_read_buffer",
+	 fvde_test_mapped_file_io_handle_read_buffer );
+
+	FVDE_TEST_RUN(
+	 "libfvde_mapped_file_io_handle_open_file_type",
+	 fvde_test_mapped_file_io_handle_open_file_type );
+
+#endif /* defined( HAVE_MMAP ) && defined( HAVE_MUNMAP ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
+}
+
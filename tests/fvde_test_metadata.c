@@ -27,6 +27,8 @@
 #include <stdlib.h>
 #endif
 
+#include "fvde_test_functions.h"
+#include "fvde_test_libbfio.h"
 #include "fvde_test_libcerror.h"
 #include "fvde_test_libfvde.h"
 #include "fvde_test_macros.h"
@@ -60,6 +62,12 @@ uint8_t fvde_test_metadata_volume_group_plist_data1[ 358 ] = {
 	0x72, 0x69, 0x6e, 0x67, 0x3e, 0x3c, 0x2f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x3e, 0x3c, 0x2f, 0x64,
 	0x69, 0x63, 0x74, 0x3e, 0x0a, 0x00 };
 
+uint8_t fvde_test_metadata_block_header_data1[ 64 ] = {
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x11, 0x00, 0x01, 0x32, 0x22, 0x02,
+	0x34, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
 #if defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT )
 
 /* Tests the libfvde_metadata_initialize function
@@ -560,6 +568,185 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfvde_metadata_read_transaction_identifier_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_metadata_read_transaction_identifier_file_io_handle(
+     void )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	uint64_t transaction_identifier  = 0;
+	int result                       = 0;
+
+	/* Initialize file IO handle
+	 */
+	result = fvde_test_open_file_io_handle(
+	          &file_io_handle,
+	          fvde_test_metadata_block_header_data1,
+	          64,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_metadata_read_transaction_identifier_file_io_handle(
+	          file_io_handle,
+	          0,
+	          &transaction_identifier,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT64(
+	 "transaction_identifier",
+	 transaction_identifier,
+	 (uint64_t) 0x1234UL );
+
+	/* Test error cases
+	 */
+	result = libfvde_metadata_read_transaction_identifier_file_io_handle(
+	          file_io_handle,
+	          0,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_metadata_read_transaction_identifier_file_io_handle(
+	          file_io_handle,
+	          8,
+	          &transaction_identifier,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up file IO handle
+	 */
+	result = fvde_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test block that is not a metadata block
+	 */
+	fvde_test_metadata_block_header_data1[ 10 ] = 0x10;
+
+	result = fvde_test_open_file_io_handle(
+	          &file_io_handle,
+	          fvde_test_metadata_block_header_data1,
+	          64,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_metadata_read_transaction_identifier_file_io_handle(
+	          file_io_handle,
+	          0,
+	          &transaction_identifier,
+	          &error );
+
+	fvde_test_metadata_block_header_data1[ 10 ] = 0x11;
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up file IO handle
+	 */
+	result = fvde_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
 
 /* The main program
@@ -597,6 +784,10 @@ int main(
 	 "libfvde_metadata_read_file_io_handle",
 	 fvde_test_metadata_read_file_io_handle );
 
+	FVDE_TEST_RUN(
+	 "libfvde_metadata_read_transaction_identifier_file_io_handle",
+	 fvde_test_metadata_read_transaction_identifier_file_io_handle );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
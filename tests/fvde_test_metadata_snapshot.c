@@ -0,0 +1,2675 @@
+/*
+ * Library metadata snapshot functions test program
+ *
+ * Copyright (C) 2011-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fvde_test_functions.h"
+#include "fvde_test_libbfio.h"
+#include "fvde_test_libcdata.h"
+#include "fvde_test_libcerror.h"
+#include "fvde_test_libfvde.h"
+#include "fvde_test_macros.h"
+#include "fvde_test_memory.h"
+#include "fvde_test_unused.h"
+
+#include "../libfvde/libfvde_encrypted_metadata.h"
+#include "../libfvde/libfvde_logical_volume_descriptor.h"
+#include "../libfvde/libfvde_metadata.h"
+#include "../libfvde/libfvde_metadata_snapshot.h"
+#include "../libfvde/libfvde_physical_volume_descriptor.h"
+#include "../libfvde/libfvde_segment_descriptor.h"
+#include "../libfvde/libfvde_volume.h"
+#include "../libfvde/libfvde_volume_header.h"
+
+uint8_t fvde_test_metadata_snapshot_volume_group_identifier[ 16 ] = {
+	0x7a, 0x1f, 0x4c, 0x3d, 0x9e, 0x02, 0x45, 0x8b, 0xb1, 0x6c, 0x27, 0x90, 0xd4, 0x5e, 0x13, 0xa8 };
+
+uint8_t fvde_test_metadata_snapshot_physical_volume_identifier[ 16 ] = {
+	0x2c, 0x8e, 0x51, 0x07, 0xf3, 0x6a, 0x4d, 0x19, 0x8a, 0x3b, 0xe4, 0x70, 0x5d, 0xc2, 0x96, 0x01 };
+
+uint8_t fvde_test_metadata_snapshot_metadata_block_header_data[ 64 ] = {
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x11, 0x00, 0x01, 0x32, 0x22, 0x02,
+	0x34, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT )
+
+/* Opens a file IO handle for reading and writing snapshot test data
+ * Returns 1 if successful or -1 on error
+ */
+int fvde_test_metadata_snapshot_open_file_io_handle(
+     libbfio_handle_t **file_io_handle,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "fvde_test_metadata_snapshot_open_file_io_handle";
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_memory_range_initialize(
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_memory_range_set(
+	     *file_io_handle,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set memory range of file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_open(
+	     *file_io_handle,
+	     LIBBFIO_OPEN_READ_WRITE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Sets the test values in the metadata and encrypted metadata
+ * Returns 1 if successful or -1 on error
+ */
+int fvde_test_metadata_snapshot_set_values(
+     libfvde_metadata_t *metadata,
+     libfvde_encrypted_metadata_t *encrypted_metadata,
+     libcerror_error_t **error )
+{
+	libfvde_logical_volume_descriptor_t *logical_volume_descriptor   = NULL;
+	libfvde_physical_volume_descriptor_t *physical_volume_descriptor = NULL;
+	libfvde_segment_descriptor_t *segment_descriptor                 = NULL;
+	int entry_index                                                  = 0;
+	int segment_descriptor_index                                     = 0;
+
+	metadata->transaction_identifier           = 0x1234;
+	metadata->physical_volume_index            = 0;
+	metadata->encrypted_metadata_size          = 0x00100000UL;
+	metadata->encrypted_metadata1_offset       = 0x00200000UL;
+	metadata->encrypted_metadata1_volume_index = 0;
+	metadata->encrypted_metadata2_offset       = 0x00300000UL;
+	metadata->encrypted_metadata2_volume_index = 0;
+
+	metadata->volume_group_name = (uint8_t *) memory_allocate(
+	                                           sizeof( uint8_t ) * 5 );
+
+	if( metadata->volume_group_name == NULL )
+	{
+		goto on_error;
+	}
+	if( memory_copy(
+	     metadata->volume_group_name,
+	     "test",
+	     5 ) == NULL )
+	{
+		goto on_error;
+	}
+	metadata->volume_group_name_size = 5;
+
+	if( libfvde_physical_volume_descriptor_initialize(
+	     &physical_volume_descriptor,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( memory_copy(
+	     physical_volume_descriptor->identifier,
+	     fvde_test_metadata_snapshot_physical_volume_identifier,
+	     16 ) == NULL )
+	{
+		goto on_error;
+	}
+	if( libcdata_array_append_entry(
+	     metadata->physical_volume_descriptors,
+	     &entry_index,
+	     (intptr_t *) physical_volume_descriptor,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	physical_volume_descriptor = NULL;
+
+	encrypted_metadata->encryption_context_plist_data = (uint8_t *) memory_allocate(
+	                                                                 sizeof( uint8_t ) * 14 );
+
+	if( encrypted_metadata->encryption_context_plist_data == NULL )
+	{
+		goto on_error;
+	}
+	if( memory_copy(
+	     encrypted_metadata->encryption_context_plist_data,
+	     "<dict></dict>",
+	     14 ) == NULL )
+	{
+		goto on_error;
+	}
+	encrypted_metadata->encryption_context_plist_data_size = 14;
+
+	if( libfvde_logical_volume_descriptor_initialize(
+	     &logical_volume_descriptor,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	logical_volume_descriptor->object_identifier          = 0x0000001aUL;
+	logical_volume_descriptor->size                       = 0x00800000UL;
+	logical_volume_descriptor->object_identifier_0x0305   = 0x00000305UL;
+	logical_volume_descriptor->object_identifier_0x0505   = 0x00000505UL;
+	logical_volume_descriptor->base_physical_block_number = 0x00000100UL;
+
+	if( memory_set(
+	     logical_volume_descriptor->identifier,
+	     0xa5,
+	     16 ) == NULL )
+	{
+		goto on_error;
+	}
+	if( memory_set(
+	     logical_volume_descriptor->family_identifier,
+	     0x5a,
+	     16 ) == NULL )
+	{
+		goto on_error;
+	}
+	logical_volume_descriptor->name = (uint8_t *) memory_allocate(
+	                                               sizeof( uint8_t ) * 7 );
+
+	if( logical_volume_descriptor->name == NULL )
+	{
+		goto on_error;
+	}
+	if( memory_copy(
+	     logical_volume_descriptor->name,
+	     "volume",
+	     7 ) == NULL )
+	{
+		goto on_error;
+	}
+	logical_volume_descriptor->name_size = 7;
+
+	for( segment_descriptor_index = 0;
+	     segment_descriptor_index < 2;
+	     segment_descriptor_index++ )
+	{
+		if( libfvde_segment_descriptor_initialize(
+		     &segment_descriptor,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		segment_descriptor->logical_block_number  = (uint64_t) segment_descriptor_index * 0x400;
+		segment_descriptor->number_of_blocks      = 0x400;
+		segment_descriptor->physical_block_number = 0x100 + ( (uint64_t) segment_descriptor_index * 0x800 );
+		segment_descriptor->physical_volume_index = 0;
+
+		if( libcdata_array_append_entry(
+		     logical_volume_descriptor->segment_descriptors,
+		     &entry_index,
+		     (intptr_t *) segment_descriptor,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		segment_descriptor = NULL;
+	}
+	if( libcdata_array_append_entry(
+	     encrypted_metadata->logical_volume_descriptors,
+	     &entry_index,
+	     (intptr_t *) logical_volume_descriptor,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( segment_descriptor != NULL )
+	{
+		libfvde_segment_descriptor_free(
+		 &segment_descriptor,
+		 NULL );
+	}
+	if( logical_volume_descriptor != NULL )
+	{
+		libfvde_logical_volume_descriptor_free(
+		 &logical_volume_descriptor,
+		 NULL );
+	}
+	if( physical_volume_descriptor != NULL )
+	{
+		libfvde_physical_volume_descriptor_free(
+		 &physical_volume_descriptor,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests the libfvde_metadata_snapshot_write_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_metadata_snapshot_write_data(
+     void )
+{
+	libcerror_error_t *error                         = NULL;
+	libfvde_encrypted_metadata_t *encrypted_metadata = NULL;
+	libfvde_metadata_t *metadata                     = NULL;
+	uint8_t *snapshot_data                           = NULL;
+	size_t snapshot_data_size                        = 0;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_metadata_initialize(
+	          &metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_encrypted_metadata_initialize(
+	          &encrypted_metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fvde_test_metadata_snapshot_set_values(
+	          metadata,
+	          encrypted_metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_metadata_snapshot_write_data(
+	          metadata,
+	          encrypted_metadata,
+	          fvde_test_metadata_snapshot_volume_group_identifier,
+	          &snapshot_data,
+	          &snapshot_data_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "snapshot_data",
+	 snapshot_data );
+
+	/* 48 + 46 + 5 + 16 + 14 + 80 + 7 + ( 2 * 26 )
+	 */
+	FVDE_TEST_ASSERT_EQUAL_SIZE(
+	 "snapshot_data_size",
+	 snapshot_data_size,
+	 (size_t) 268 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          snapshot_data,
+	          "fvdesnap",
+	          8 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfvde_metadata_snapshot_write_data(
+	          metadata,
+	          encrypted_metadata,
+	          fvde_test_metadata_snapshot_volume_group_identifier,
+	          &snapshot_data,
+	          &snapshot_data_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	memory_free(
+	 snapshot_data );
+
+	snapshot_data = NULL;
+
+	result = libfvde_metadata_snapshot_write_data(
+	          NULL,
+	          encrypted_metadata,
+	          fvde_test_metadata_snapshot_volume_group_identifier,
+	          &snapshot_data,
+	          &snapshot_data_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_metadata_snapshot_write_data(
+	          metadata,
+	          NULL,
+	          fvde_test_metadata_snapshot_volume_group_identifier,
+	          &snapshot_data,
+	          &snapshot_data_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_metadata_snapshot_write_data(
+	          metadata,
+	          encrypted_metadata,
+	          NULL,
+	          &snapshot_data,
+	          &snapshot_data_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_metadata_snapshot_write_data(
+	          metadata,
+	          encrypted_metadata,
+	          fvde_test_metadata_snapshot_volume_group_identifier,
+	          NULL,
+	          &snapshot_data_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_metadata_snapshot_write_data(
+	          metadata,
+	          encrypted_metadata,
+	          fvde_test_metadata_snapshot_volume_group_identifier,
+	          &snapshot_data,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_encrypted_metadata_free(
+	          &encrypted_metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "encrypted_metadata",
+	 encrypted_metadata );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_metadata_free(
+	          &metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "metadata",
+	 metadata );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( snapshot_data != NULL )
+	{
+		memory_free(
+		 snapshot_data );
+	}
+	if( encrypted_metadata != NULL )
+	{
+		libfvde_encrypted_metadata_free(
+		 &encrypted_metadata,
+		 NULL );
+	}
+	if( metadata != NULL )
+	{
+		libfvde_metadata_free(
+		 &metadata,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_metadata_snapshot_read_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_metadata_snapshot_read_data(
+     void )
+{
+	libcerror_error_t *error                                       = NULL;
+	libfvde_encrypted_metadata_t *encrypted_metadata               = NULL;
+	libfvde_encrypted_metadata_t *snapshot_encrypted_metadata      = NULL;
+	libfvde_logical_volume_descriptor_t *logical_volume_descriptor = NULL;
+	libfvde_metadata_t *metadata                                   = NULL;
+	libfvde_metadata_t *snapshot_metadata                          = NULL;
+	libfvde_segment_descriptor_t *segment_descriptor               = NULL;
+	uint8_t *snapshot_data                                         = NULL;
+	size_t snapshot_data_size                                      = 0;
+	int number_of_entries                                          = 0;
+	int result                                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_metadata_initialize(
+	          &metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_encrypted_metadata_initialize(
+	          &encrypted_metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fvde_test_metadata_snapshot_set_values(
+	          metadata,
+	          encrypted_metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_metadata_snapshot_write_data(
+	          metadata,
+	          encrypted_metadata,
+	          fvde_test_metadata_snapshot_volume_group_identifier,
+	          &snapshot_data,
+	          &snapshot_data_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_metadata_initialize(
+	          &snapshot_metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_encrypted_metadata_initialize(
+	          &snapshot_encrypted_metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_metadata_snapshot_read_data(
+	          snapshot_metadata,
+	          snapshot_encrypted_metadata,
+	          fvde_test_metadata_snapshot_volume_group_identifier,
+	          fvde_test_metadata_snapshot_physical_volume_identifier,
+	          0x1234,
+	          snapshot_data,
+	          snapshot_data_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT64(
+	 "snapshot_metadata->transaction_identifier",
+	 snapshot_metadata->transaction_identifier,
+	 (uint64_t) 0x1234 );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT64(
+	 "snapshot_metadata->encrypted_metadata_size",
+	 snapshot_metadata->encrypted_metadata_size,
+	 metadata->encrypted_metadata_size );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT64(
+	 "snapshot_metadata->encrypted_metadata1_offset",
+	 snapshot_metadata->encrypted_metadata1_offset,
+	 metadata->encrypted_metadata1_offset );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT64(
+	 "snapshot_metadata->encrypted_metadata2_offset",
+	 snapshot_metadata->encrypted_metadata2_offset,
+	 metadata->encrypted_metadata2_offset );
+
+	FVDE_TEST_ASSERT_EQUAL_SIZE(
+	 "snapshot_metadata->volume_group_name_size",
+	 snapshot_metadata->volume_group_name_size,
+	 (size_t) 5 );
+
+	result = memory_compare(
+	          snapshot_metadata->volume_group_name,
+	          "test",
+	          5 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfvde_metadata_get_number_of_physical_volume_descriptors(
+	          snapshot_metadata,
+	          &number_of_entries,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_SIZE(
+	 "snapshot_encrypted_metadata->encryption_context_plist_data_size",
+	 snapshot_encrypted_metadata->encryption_context_plist_data_size,
+	 (size_t) 14 );
+
+	result = memory_compare(
+	          snapshot_encrypted_metadata->encryption_context_plist_data,
+	          "<dict></dict>",
+	          14 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfvde_encrypted_metadata_get_logical_volume_descriptor_by_index(
+	          snapshot_encrypted_metadata,
+	          0,
+	          &logical_volume_descriptor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "logical_volume_descriptor",
+	 logical_volume_descriptor );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT64(
+	 "logical_volume_descriptor->object_identifier",
+	 logical_volume_descriptor->object_identifier,
+	 (uint64_t) 0x0000001aUL );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT64(
+	 "logical_volume_descriptor->size",
+	 logical_volume_descriptor->size,
+	 (uint64_t) 0x00800000UL );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT64(
+	 "logical_volume_descriptor->base_physical_block_number",
+	 logical_volume_descriptor->base_physical_block_number,
+	 (uint64_t) 0x00000100UL );
+
+	FVDE_TEST_ASSERT_EQUAL_SIZE(
+	 "logical_volume_descriptor->name_size",
+	 logical_volume_descriptor->name_size,
+	 (size_t) 7 );
+
+	result = libfvde_logical_volume_descriptor_get_number_of_segment_descriptors(
+	          logical_volume_descriptor,
+	          &number_of_entries,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 2 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_logical_volume_descriptor_get_segment_descriptor_by_index(
+	          logical_volume_descriptor,
+	          1,
+	          &segment_descriptor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "segment_descriptor",
+	 segment_descriptor );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT64(
+	 "segment_descriptor->logical_block_number",
+	 segment_descriptor->logical_block_number,
+	 (uint64_t) 0x400 );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT64(
+	 "segment_descriptor->physical_block_number",
+	 segment_descriptor->physical_block_number,
+	 (uint64_t) 0x900 );
+
+	result = libfvde_encrypted_metadata_free(
+	          &snapshot_encrypted_metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_metadata_free(
+	          &snapshot_metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_metadata_initialize(
+	          &snapshot_metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_encrypted_metadata_initialize(
+	          &snapshot_encrypted_metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test snapshot does not match the volume group identifier
+	 */
+	result = libfvde_metadata_snapshot_read_data(
+	          snapshot_metadata,
+	          snapshot_encrypted_metadata,
+	          fvde_test_metadata_snapshot_physical_volume_identifier,
+	          fvde_test_metadata_snapshot_physical_volume_identifier,
+	          0x1234,
+	          snapshot_data,
+	          snapshot_data_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test snapshot does not match the transaction identifier
+	 */
+	result = libfvde_metadata_snapshot_read_data(
+	          snapshot_metadata,
+	          snapshot_encrypted_metadata,
+	          fvde_test_metadata_snapshot_volume_group_identifier,
+	          fvde_test_metadata_snapshot_physical_volume_identifier,
+	          0x1235,
+	          snapshot_data,
+	          snapshot_data_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_metadata_snapshot_read_data(
+	          NULL,
+	          snapshot_encrypted_metadata,
+	          fvde_test_metadata_snapshot_volume_group_identifier,
+	          fvde_test_metadata_snapshot_physical_volume_identifier,
+	          0x1234,
+	          snapshot_data,
+	          snapshot_data_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_metadata_snapshot_read_data(
+	          snapshot_metadata,
+	          NULL,
+	          fvde_test_metadata_snapshot_volume_group_identifier,
+	          fvde_test_metadata_snapshot_physical_volume_identifier,
+	          0x1234,
+	          snapshot_data,
+	          snapshot_data_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_metadata_snapshot_read_data(
+	          snapshot_metadata,
+	          snapshot_encrypted_metadata,
+	          NULL,
+	          fvde_test_metadata_snapshot_physical_volume_identifier,
+	          0x1234,
+	          snapshot_data,
+	          snapshot_data_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_metadata_snapshot_read_data(
+	          snapshot_metadata,
+	          snapshot_encrypted_metadata,
+	          fvde_test_metadata_snapshot_volume_group_identifier,
+	          NULL,
+	          0x1234,
+	          snapshot_data,
+	          snapshot_data_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_metadata_snapshot_read_data(
+	          snapshot_metadata,
+	          snapshot_encrypted_metadata,
+	          fvde_test_metadata_snapshot_volume_group_identifier,
+	          fvde_test_metadata_snapshot_physical_volume_identifier,
+	          0x1234,
+	          NULL,
+	          snapshot_data_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_metadata_snapshot_read_data(
+	          snapshot_metadata,
+	          snapshot_encrypted_metadata,
+	          fvde_test_metadata_snapshot_volume_group_identifier,
+	          fvde_test_metadata_snapshot_physical_volume_identifier,
+	          0x1234,
+	          snapshot_data,
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_metadata_snapshot_read_data(
+	          snapshot_metadata,
+	          snapshot_encrypted_metadata,
+	          fvde_test_metadata_snapshot_volume_group_identifier,
+	          fvde_test_metadata_snapshot_physical_volume_identifier,
+	          0x1234,
+	          snapshot_data,
+	          snapshot_data_size - 1,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where signature is invalid
+	 */
+	snapshot_data[ 0 ] = (uint8_t) 'x';
+
+	result = libfvde_metadata_snapshot_read_data(
+	          snapshot_metadata,
+	          snapshot_encrypted_metadata,
+	          fvde_test_metadata_snapshot_volume_group_identifier,
+	          fvde_test_metadata_snapshot_physical_volume_identifier,
+	          0x1234,
+	          snapshot_data,
+	          snapshot_data_size,
+	          &error );
+
+	snapshot_data[ 0 ] = (uint8_t) 'f';
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where checksum does not match
+	 */
+	snapshot_data[ snapshot_data_size - 1 ] ^= 0xff;
+
+	result = libfvde_metadata_snapshot_read_data(
+	          snapshot_metadata,
+	          snapshot_encrypted_metadata,
+	          fvde_test_metadata_snapshot_volume_group_identifier,
+	          fvde_test_metadata_snapshot_physical_volume_identifier,
+	          0x1234,
+	          snapshot_data,
+	          snapshot_data_size,
+	          &error );
+
+	snapshot_data[ snapshot_data_size - 1 ] ^= 0xff;
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test snapshot does not match the physical volume identifier
+	 * this test is last since the physical volume descriptors are read before the match is determined
+	 */
+	result = libfvde_metadata_snapshot_read_data(
+	          snapshot_metadata,
+	          snapshot_encrypted_metadata,
+	          fvde_test_metadata_snapshot_volume_group_identifier,
+	          fvde_test_metadata_snapshot_volume_group_identifier,
+	          0x1234,
+	          snapshot_data,
+	          snapshot_data_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libfvde_encrypted_metadata_free(
+	          &snapshot_encrypted_metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_metadata_free(
+	          &snapshot_metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 snapshot_data );
+
+	snapshot_data = NULL;
+
+	result = libfvde_encrypted_metadata_free(
+	          &encrypted_metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_metadata_free(
+	          &metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( snapshot_encrypted_metadata != NULL )
+	{
+		libfvde_encrypted_metadata_free(
+		 &snapshot_encrypted_metadata,
+		 NULL );
+	}
+	if( snapshot_metadata != NULL )
+	{
+		libfvde_metadata_free(
+		 &snapshot_metadata,
+		 NULL );
+	}
+	if( snapshot_data != NULL )
+	{
+		memory_free(
+		 snapshot_data );
+	}
+	if( encrypted_metadata != NULL )
+	{
+		libfvde_encrypted_metadata_free(
+		 &encrypted_metadata,
+		 NULL );
+	}
+	if( metadata != NULL )
+	{
+		libfvde_metadata_free(
+		 &metadata,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_metadata_snapshot_write_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_metadata_snapshot_write_file_io_handle(
+     void )
+{
+	uint8_t snapshot_data[ 268 ];
+
+	libbfio_handle_t *file_io_handle                 = NULL;
+	libcerror_error_t *error                         = NULL;
+	libfvde_encrypted_metadata_t *encrypted_metadata = NULL;
+	libfvde_metadata_t *metadata                     = NULL;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_metadata_initialize(
+	          &metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_encrypted_metadata_initialize(
+	          &encrypted_metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fvde_test_metadata_snapshot_set_values(
+	          metadata,
+	          encrypted_metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_set(
+	 snapshot_data,
+	 0,
+	 268 );
+
+	result = fvde_test_metadata_snapshot_open_file_io_handle(
+	          &file_io_handle,
+	          snapshot_data,
+	          268,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_metadata_snapshot_write_file_io_handle(
+	          metadata,
+	          encrypted_metadata,
+	          fvde_test_metadata_snapshot_volume_group_identifier,
+	          file_io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          snapshot_data,
+	          "fvdesnap",
+	          8 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfvde_metadata_snapshot_write_file_io_handle(
+	          NULL,
+	          encrypted_metadata,
+	          fvde_test_metadata_snapshot_volume_group_identifier,
+	          file_io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_metadata_snapshot_write_file_io_handle(
+	          metadata,
+	          NULL,
+	          fvde_test_metadata_snapshot_volume_group_identifier,
+	          file_io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_metadata_snapshot_write_file_io_handle(
+	          metadata,
+	          encrypted_metadata,
+	          NULL,
+	          file_io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_metadata_snapshot_write_file_io_handle(
+	          metadata,
+	          encrypted_metadata,
+	          fvde_test_metadata_snapshot_volume_group_identifier,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = fvde_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_encrypted_metadata_free(
+	          &encrypted_metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "encrypted_metadata",
+	 encrypted_metadata );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_metadata_free(
+	          &metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "metadata",
+	 metadata );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( encrypted_metadata != NULL )
+	{
+		libfvde_encrypted_metadata_free(
+		 &encrypted_metadata,
+		 NULL );
+	}
+	if( metadata != NULL )
+	{
+		libfvde_metadata_free(
+		 &metadata,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_metadata_snapshot_read_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_metadata_snapshot_read_file_io_handle(
+     void )
+{
+	uint8_t snapshot_data[ 268 ];
+
+	libbfio_handle_t *file_io_handle                          = NULL;
+	libcerror_error_t *error                                  = NULL;
+	libfvde_encrypted_metadata_t *encrypted_metadata          = NULL;
+	libfvde_encrypted_metadata_t *snapshot_encrypted_metadata = NULL;
+	libfvde_metadata_t *metadata                              = NULL;
+	libfvde_metadata_t *snapshot_metadata                     = NULL;
+	int number_of_entries                                     = 0;
+	int result                                                = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_metadata_initialize(
+	          &metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_encrypted_metadata_initialize(
+	          &encrypted_metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fvde_test_metadata_snapshot_set_values(
+	          metadata,
+	          encrypted_metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_set(
+	 snapshot_data,
+	 0,
+	 268 );
+
+	result = fvde_test_metadata_snapshot_open_file_io_handle(
+	          &file_io_handle,
+	          snapshot_data,
+	          268,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_metadata_snapshot_write_file_io_handle(
+	          metadata,
+	          encrypted_metadata,
+	          fvde_test_metadata_snapshot_volume_group_identifier,
+	          file_io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_metadata_initialize(
+	          &snapshot_metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_encrypted_metadata_initialize(
+	          &snapshot_encrypted_metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_metadata_snapshot_read_file_io_handle(
+	          snapshot_metadata,
+	          snapshot_encrypted_metadata,
+	          fvde_test_metadata_snapshot_volume_group_identifier,
+	          fvde_test_metadata_snapshot_physical_volume_identifier,
+	          0x1234,
+	          file_io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT64(
+	 "snapshot_metadata->transaction_identifier",
+	 snapshot_metadata->transaction_identifier,
+	 (uint64_t) 0x1234 );
+
+	FVDE_TEST_ASSERT_EQUAL_SIZE(
+	 "snapshot_metadata->volume_group_name_size",
+	 snapshot_metadata->volume_group_name_size,
+	 (size_t) 5 );
+
+	result = memory_compare(
+	          snapshot_metadata->volume_group_name,
+	          "test",
+	          5 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfvde_encrypted_metadata_get_number_of_logical_volume_descriptors(
+	          snapshot_encrypted_metadata,
+	          &number_of_entries,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_encrypted_metadata_free(
+	          &snapshot_encrypted_metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_metadata_free(
+	          &snapshot_metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_metadata_initialize(
+	          &snapshot_metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_encrypted_metadata_initialize(
+	          &snapshot_encrypted_metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test snapshot does not match the transaction identifier
+	 */
+	result = libfvde_metadata_snapshot_read_file_io_handle(
+	          snapshot_metadata,
+	          snapshot_encrypted_metadata,
+	          fvde_test_metadata_snapshot_volume_group_identifier,
+	          fvde_test_metadata_snapshot_physical_volume_identifier,
+	          0x1235,
+	          file_io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fvde_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_metadata_snapshot_read_file_io_handle(
+	          snapshot_metadata,
+	          snapshot_encrypted_metadata,
+	          fvde_test_metadata_snapshot_volume_group_identifier,
+	          fvde_test_metadata_snapshot_physical_volume_identifier,
+	          0x1234,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the snapshot file is smaller than the header
+	 */
+	result = fvde_test_open_file_io_handle(
+	          &file_io_handle,
+	          snapshot_data,
+	          32,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_metadata_snapshot_read_file_io_handle(
+	          snapshot_metadata,
+	          snapshot_encrypted_metadata,
+	          fvde_test_metadata_snapshot_volume_group_identifier,
+	          fvde_test_metadata_snapshot_physical_volume_identifier,
+	          0x1234,
+	          file_io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "snapshot_metadata->volume_group_name",
+	 snapshot_metadata->volume_group_name );
+
+	result = fvde_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error case where the snapshot file is truncated
+	 */
+	result = fvde_test_open_file_io_handle(
+	          &file_io_handle,
+	          snapshot_data,
+	          267,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_metadata_snapshot_read_file_io_handle(
+	          snapshot_metadata,
+	          snapshot_encrypted_metadata,
+	          fvde_test_metadata_snapshot_volume_group_identifier,
+	          fvde_test_metadata_snapshot_physical_volume_identifier,
+	          0x1234,
+	          file_io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "snapshot_metadata->volume_group_name",
+	 snapshot_metadata->volume_group_name );
+
+	result = fvde_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error case where the snapshot file is corrupted
+	 */
+	snapshot_data[ 100 ] ^= 0xff;
+
+	result = fvde_test_open_file_io_handle(
+	          &file_io_handle,
+	          snapshot_data,
+	          268,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_metadata_snapshot_read_file_io_handle(
+	          snapshot_metadata,
+	          snapshot_encrypted_metadata,
+	          fvde_test_metadata_snapshot_volume_group_identifier,
+	          fvde_test_metadata_snapshot_physical_volume_identifier,
+	          0x1234,
+	          file_io_handle,
+	          &error );
+
+	snapshot_data[ 100 ] ^= 0xff;
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "snapshot_metadata->volume_group_name",
+	 snapshot_metadata->volume_group_name );
+
+	result = fvde_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libfvde_encrypted_metadata_free(
+	          &snapshot_encrypted_metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "snapshot_encrypted_metadata",
+	 snapshot_encrypted_metadata );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_metadata_free(
+	          &snapshot_metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "snapshot_metadata",
+	 snapshot_metadata );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_encrypted_metadata_free(
+	          &encrypted_metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "encrypted_metadata",
+	 encrypted_metadata );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_metadata_free(
+	          &metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "metadata",
+	 metadata );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( snapshot_encrypted_metadata != NULL )
+	{
+		libfvde_encrypted_metadata_free(
+		 &snapshot_encrypted_metadata,
+		 NULL );
+	}
+	if( snapshot_metadata != NULL )
+	{
+		libfvde_metadata_free(
+		 &snapshot_metadata,
+		 NULL );
+	}
+	if( encrypted_metadata != NULL )
+	{
+		libfvde_encrypted_metadata_free(
+		 &encrypted_metadata,
+		 NULL );
+	}
+	if( metadata != NULL )
+	{
+		libfvde_metadata_free(
+		 &metadata,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_internal_volume_open_read_metadata_snapshot function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_internal_volume_open_read_metadata_snapshot(
+     void )
+{
+	libbfio_handle_t *file_io_handle                 = NULL;
+	libcerror_error_t *error                         = NULL;
+	libfvde_encrypted_metadata_t *encrypted_metadata = NULL;
+	libfvde_internal_volume_t *internal_volume       = NULL;
+	libfvde_metadata_t *metadata                     = NULL;
+	libfvde_volume_t *volume                         = NULL;
+	libfvde_volume_header_t *volume_header           = NULL;
+	uint8_t *snapshot_data                           = NULL;
+	size_t snapshot_data_size                        = 0;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_metadata_initialize(
+	          &metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_encrypted_metadata_initialize(
+	          &encrypted_metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fvde_test_metadata_snapshot_set_values(
+	          metadata,
+	          encrypted_metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_metadata_snapshot_write_data(
+	          metadata,
+	          encrypted_metadata,
+	          fvde_test_metadata_snapshot_volume_group_identifier,
+	          &snapshot_data,
+	          &snapshot_data_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_encrypted_metadata_free(
+	          &encrypted_metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_metadata_free(
+	          &metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_volume_initialize(
+	          &volume,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_volume = (libfvde_internal_volume_t *) volume;
+
+	result = libfvde_volume_header_initialize(
+	          &volume_header,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_header",
+	 volume_header );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_copy(
+	 volume_header->volume_group_identifier,
+	 fvde_test_metadata_snapshot_volume_group_identifier,
+	 16 );
+
+	memory_copy(
+	 volume_header->physical_volume_identifier,
+	 fvde_test_metadata_snapshot_physical_volume_identifier,
+	 16 );
+
+	internal_volume->volume_header = volume_header;
+
+	/* The metadata block header at offset 0 contains transaction identifier 0x1234
+	 */
+	result = fvde_test_open_file_io_handle(
+	          &file_io_handle,
+	          fvde_test_metadata_snapshot_metadata_block_header_data,
+	          64,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_initialize(
+	          &( internal_volume->metadata_snapshot_file_io_handle ),
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test fallback where the snapshot file is truncated
+	 */
+	result = libbfio_memory_range_set(
+	          internal_volume->metadata_snapshot_file_io_handle,
+	          snapshot_data,
+	          snapshot_data_size - 1,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_internal_volume_open_read_metadata_snapshot(
+	          internal_volume,
+	          file_io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "internal_volume->metadata",
+	 internal_volume->metadata );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "internal_volume->metadata_snapshot_encrypted_metadata",
+	 internal_volume->metadata_snapshot_encrypted_metadata );
+
+	/* Test fallback where the snapshot file is corrupted
+	 */
+	result = libbfio_memory_range_set(
+	          internal_volume->metadata_snapshot_file_io_handle,
+	          snapshot_data,
+	          snapshot_data_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	snapshot_data[ 100 ] ^= 0xff;
+
+	result = libfvde_internal_volume_open_read_metadata_snapshot(
+	          internal_volume,
+	          file_io_handle,
+	          &error );
+
+	snapshot_data[ 100 ] ^= 0xff;
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "internal_volume->metadata",
+	 internal_volume->metadata );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "internal_volume->metadata_snapshot_encrypted_metadata",
+	 internal_volume->metadata_snapshot_encrypted_metadata );
+
+	/* Test regular cases
+	 */
+	result = libfvde_internal_volume_open_read_metadata_snapshot(
+	          internal_volume,
+	          file_io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "internal_volume->metadata",
+	 internal_volume->metadata );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "internal_volume->metadata_snapshot_encrypted_metadata",
+	 internal_volume->metadata_snapshot_encrypted_metadata );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "internal_volume->metadata_snapshot_was_read",
+	 (int) internal_volume->metadata_snapshot_was_read,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libfvde_internal_volume_open_read_metadata_snapshot(
+	          NULL,
+	          file_io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_internal_volume_open_read_metadata_snapshot(
+	          internal_volume,
+	          file_io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_encrypted_metadata_free(
+	          &( internal_volume->metadata_snapshot_encrypted_metadata ),
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_metadata_free(
+	          &( internal_volume->metadata ),
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_volume->volume_header = NULL;
+
+	result = libfvde_volume_header_free(
+	          &volume_header,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_volume_free(
+	          &volume,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fvde_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 snapshot_data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( internal_volume != NULL )
+	{
+		if( internal_volume->metadata_snapshot_encrypted_metadata != NULL )
+		{
+			libfvde_encrypted_metadata_free(
+			 &( internal_volume->metadata_snapshot_encrypted_metadata ),
+			 NULL );
+		}
+		if( internal_volume->metadata != NULL )
+		{
+			libfvde_metadata_free(
+			 &( internal_volume->metadata ),
+			 NULL );
+		}
+		internal_volume->volume_header = NULL;
+	}
+	if( volume_header != NULL )
+	{
+		libfvde_volume_header_free(
+		 &volume_header,
+		 NULL );
+	}
+	if( volume != NULL )
+	{
+		libfvde_volume_free(
+		 &volume,
+		 NULL );
+	}
+	if( snapshot_data != NULL )
+	{
+		memory_free(
+		 snapshot_data );
+	}
+	if( encrypted_metadata != NULL )
+	{
+		libfvde_encrypted_metadata_free(
+		 &encrypted_metadata,
+		 NULL );
+	}
+	if( metadata != NULL )
+	{
+		libfvde_metadata_free(
+		 &metadata,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FVDE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FVDE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FVDE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FVDE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FVDE_TEST_UNREFERENCED_PARAMETER( argc )
+	FVDE_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT )
+
+	FVDE_TEST_RUN(
+	 "libfvde_metadata_snapshot_write_data",
+	 fvde_test_metadata_snapshot_write_data );
+
+	FVDE_TEST_RUN(
+	 "libfvde_metadata_snapshot_read_data",
+	 fvde_test_metadata_snapshot_read_data );
+
+	FVDE_TEST_RUN(
+	 "libfvde_metadata_snapshot_write_file_io_handle",
+	 fvde_test_metadata_snapshot_write_file_io_handle );
+
+	FVDE_TEST_RUN(
+	 "libfvde_metadata_snapshot_read_file_io_handle",
+	 fvde_test_metadata_snapshot_read_file_io_handle );
+
+	FVDE_TEST_RUN(
+	 "libfvde_internal_volume_open_read_metadata_snapshot",
+	 fvde_test_internal_volume_open_read_metadata_snapshot );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
+}
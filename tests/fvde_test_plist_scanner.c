@@ -0,0 +1,1209 @@
+/*
+ * Library plist_scanner functions test program
+ *
+ * Copyright (C) 2011-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fvde_test_libcerror.h"
+#include "fvde_test_libfvde.h"
+#include "fvde_test_macros.h"
+#include "fvde_test_memory.h"
+#include "fvde_test_unused.h"
+
+#include "../libfvde/libfvde_plist_scanner.h"
+
+uint8_t fvde_test_plist_scanner_data1[ 561 ] =
+	"<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+	"<!DOCTYPE plist PUBLIC \"-//Apple//DTD PLIST 1.0//EN\" \"http://www.apple.com/DTDs/PropertyList-1.0.dtd\">\n"
+	"<plist version=\"1.0\">\n"
+	"<dict ID=\"0\">\n"
+	"\t<key>com.apple.corestorage.lv.name</key>\n"
+	"\t<string ID=\"1\">Macintosh HD</string>\n"
+	"\t<key>com.apple.corestorage.lv.size</key>\n"
+	"\t<integer size=\"64\" ID=\"2\">0xa000000</integer>\n"
+	"\t<key>com.apple.corestorage.lv.uuid</key>\n"
+	"\t<string ID=\"3\">7577A486-E1FE-4F44-9Bd5-3CEEC5F8D5B2</string>\n"
+	"\t<key>Sizes</key>\n"
+	"\t<array><integer>4096</integer><integer/><integer> 512 </integer></array>\n"
+	"</dict>\n"
+	"</plist>\n";
+
+uint8_t fvde_test_plist_scanner_data2[ 109 ] =
+	"<dict>\n"
+	"\t<key>name</key>\n"
+	"\t<string ID=\"1\">Macintosh HD</string>\n"
+	"\t<key>copy</key>\n"
+	"\t<string IDREF=\"1\"/>\n"
+	"</dict>\n";
+
+#if defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT )
+
+/* Tests the libfvde_plist_scanner_get_root_element function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_plist_scanner_get_root_element(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libfvde_plist_scanner_element_t element;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfvde_plist_scanner_get_root_element(
+	          fvde_test_plist_scanner_data1,
+	          560,
+	          &element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_SIZE(
+	 "element.name_length",
+	 element.name_length,
+	 (size_t) 4 );
+
+	result = libfvde_plist_scanner_has_plist_root_element(
+	          fvde_test_plist_scanner_data1,
+	          560,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_plist_scanner_has_plist_root_element(
+	          fvde_test_plist_scanner_data2,
+	          108,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test XML plist data that is left to the DOM parser
+	 */
+	result = libfvde_plist_scanner_get_root_element(
+	          fvde_test_plist_scanner_data2,
+	          108,
+	          &element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_plist_scanner_get_root_element(
+	          (uint8_t *) "<dict><key>name</key><string>&amp;</string></dict>",
+	          50,
+	          &element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_plist_scanner_get_root_element(
+	          (uint8_t *) "<dict><key>name</string></dict>",
+	          31,
+	          &element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_plist_scanner_get_root_element(
+	          fvde_test_plist_scanner_data1,
+	          200,
+	          &element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_plist_scanner_get_root_element(
+	          NULL,
+	          560,
+	          &element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_plist_scanner_get_root_element(
+	          fvde_test_plist_scanner_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          &element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_plist_scanner_get_root_element(
+	          fvde_test_plist_scanner_data1,
+	          560,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_plist_scanner_element_get_sub_element_by_key function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_plist_scanner_element_get_sub_element_by_key(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libfvde_plist_scanner_element_t element;
+	libfvde_plist_scanner_element_t sub_element;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_plist_scanner_get_root_element(
+	          fvde_test_plist_scanner_data1,
+	          560,
+	          &element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_plist_scanner_element_get_sub_element_by_key(
+	          &element,
+	          (uint8_t *) "com.apple.corestorage.lv.name",
+	          29,
+	          &sub_element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_SIZE(
+	 "sub_element.content_data_size",
+	 sub_element.content_data_size,
+	 (size_t) 12 );
+
+	result = libfvde_plist_scanner_element_get_sub_element_by_key(
+	          &element,
+	          (uint8_t *) "com.apple.corestorage.lv.bogus",
+	          30,
+	          &sub_element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_plist_scanner_element_get_sub_element_by_key(
+	          NULL,
+	          (uint8_t *) "com.apple.corestorage.lv.name",
+	          29,
+	          &sub_element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_plist_scanner_element_get_sub_element_by_key(
+	          &element,
+	          NULL,
+	          29,
+	          &sub_element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_plist_scanner_element_get_sub_element_by_key(
+	          &element,
+	          (uint8_t *) "com.apple.corestorage.lv.name",
+	          29,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_plist_scanner_element_get_number_of_sub_elements and
+ * libfvde_plist_scanner_element_get_sub_element_by_index functions
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_plist_scanner_element_get_sub_element_by_index(
+     void )
+{
+	libcerror_error_t *error   = NULL;
+	libfvde_plist_scanner_element_t array_element;
+	libfvde_plist_scanner_element_t element;
+	libfvde_plist_scanner_element_t sub_element;
+	uint64_t value_64bit       = 0;
+	int number_of_sub_elements = 0;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_plist_scanner_get_root_element(
+	          fvde_test_plist_scanner_data1,
+	          560,
+	          &element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_plist_scanner_element_get_sub_element_by_key(
+	          &element,
+	          (uint8_t *) "Sizes",
+	          5,
+	          &array_element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_plist_scanner_element_get_number_of_sub_elements(
+	          &array_element,
+	          &number_of_sub_elements,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sub_elements",
+	 number_of_sub_elements,
+	 3 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_plist_scanner_element_get_sub_element_by_index(
+	          &array_element,
+	          2,
+	          &sub_element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_plist_scanner_element_get_value_integer(
+	          &sub_element,
+	          &value_64bit,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 512 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_plist_scanner_element_get_number_of_sub_elements(
+	          &element,
+	          &number_of_sub_elements,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_plist_scanner_element_get_number_of_sub_elements(
+	          &array_element,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_plist_scanner_element_get_sub_element_by_index(
+	          &array_element,
+	          -1,
+	          &sub_element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_plist_scanner_element_get_sub_element_by_index(
+	          &array_element,
+	          3,
+	          &sub_element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libfvde_plist_scanner_element_get_value_integer with an empty integer element
+	 */
+	result = libfvde_plist_scanner_element_get_sub_element_by_index(
+	          &array_element,
+	          1,
+	          &sub_element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_plist_scanner_element_get_value_integer(
+	          &sub_element,
+	          &value_64bit,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_plist_scanner_element_get_value_string function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_plist_scanner_element_get_value_string(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libfvde_plist_scanner_element_t element;
+	libfvde_plist_scanner_element_t sub_element;
+	uint8_t *string          = NULL;
+	size_t string_size       = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_plist_scanner_get_root_element(
+	          fvde_test_plist_scanner_data1,
+	          560,
+	          &element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_plist_scanner_element_get_sub_element_by_key(
+	          &element,
+	          (uint8_t *) "com.apple.corestorage.lv.name",
+	          29,
+	          &sub_element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_plist_scanner_element_get_value_string(
+	          &sub_element,
+	          &string,
+	          &string_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "string",
+	 string );
+
+	FVDE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 13 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          string,
+	          "Macintosh HD",
+	          13 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfvde_plist_scanner_element_get_value_string(
+	          &sub_element,
+	          &string,
+	          &string_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	memory_free(
+	 string );
+
+	string = NULL;
+
+	result = libfvde_plist_scanner_element_get_value_string(
+	          NULL,
+	          &string,
+	          &string_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_plist_scanner_element_get_value_string(
+	          &element,
+	          &string,
+	          &string_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_plist_scanner_element_get_value_string(
+	          &sub_element,
+	          NULL,
+	          &string_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_plist_scanner_element_get_value_string(
+	          &sub_element,
+	          &string,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FVDE_TEST_MEMORY )
+
+	/* Test libfvde_plist_scanner_element_get_value_string with malloc failing
+	 */
+	fvde_test_malloc_attempts_before_fail = 0;
+
+	result = libfvde_plist_scanner_element_get_value_string(
+	          &sub_element,
+	          &string,
+	          &string_size,
+	          &error );
+
+	if( fvde_test_malloc_attempts_before_fail != -1 )
+	{
+		fvde_test_malloc_attempts_before_fail = -1;
+
+		if( string != NULL )
+		{
+			memory_free(
+			 string );
+
+			string = NULL;
+		}
+	}
+	else
+	{
+		FVDE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FVDE_TEST_ASSERT_IS_NULL(
+		 "string",
+		 string );
+
+		FVDE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_FVDE_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( string != NULL )
+	{
+		memory_free(
+		 string );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_plist_scanner_element_get_value_integer function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_plist_scanner_element_get_value_integer(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libfvde_plist_scanner_element_t element;
+	libfvde_plist_scanner_element_t sub_element;
+	uint64_t value_64bit     = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_plist_scanner_get_root_element(
+	          fvde_test_plist_scanner_data1,
+	          560,
+	          &element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_plist_scanner_element_get_sub_element_by_key(
+	          &element,
+	          (uint8_t *) "com.apple.corestorage.lv.size",
+	          29,
+	          &sub_element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_plist_scanner_element_get_value_integer(
+	          &sub_element,
+	          &value_64bit,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 0xa000000UL );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_plist_scanner_element_get_value_integer(
+	          NULL,
+	          &value_64bit,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_plist_scanner_element_get_value_integer(
+	          &element,
+	          &value_64bit,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_plist_scanner_element_get_value_integer(
+	          &sub_element,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_plist_scanner_element_value_uuid_string_copy_to_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_plist_scanner_element_value_uuid_string_copy_to_byte_stream(
+     void )
+{
+	uint8_t expected_uuid[ 16 ] = {
+		0x75, 0x77, 0xa4, 0x86, 0xe1, 0xfe, 0x4f, 0x44, 0x9b, 0xd5, 0x3c, 0xee, 0xc5, 0xf8, 0xd5, 0xb2 };
+
+	uint8_t uuid[ 16 ];
+
+	libcerror_error_t *error = NULL;
+	libfvde_plist_scanner_element_t element;
+	libfvde_plist_scanner_element_t sub_element;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_plist_scanner_get_root_element(
+	          fvde_test_plist_scanner_data1,
+	          560,
+	          &element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_plist_scanner_element_get_sub_element_by_key(
+	          &element,
+	          (uint8_t *) "com.apple.corestorage.lv.uuid",
+	          29,
+	          &sub_element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_plist_scanner_element_value_uuid_string_copy_to_byte_stream(
+	          &sub_element,
+	          uuid,
+	          16,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uuid,
+	          expected_uuid,
+	          16 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfvde_plist_scanner_element_value_uuid_string_copy_to_byte_stream(
+	          NULL,
+	          uuid,
+	          16,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_plist_scanner_element_value_uuid_string_copy_to_byte_stream(
+	          &sub_element,
+	          NULL,
+	          16,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_plist_scanner_element_value_uuid_string_copy_to_byte_stream(
+	          &sub_element,
+	          uuid,
+	          8,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libfvde_plist_scanner_element_value_uuid_string_copy_to_byte_stream with an unsupported string
+	 */
+	result = libfvde_plist_scanner_element_get_sub_element_by_key(
+	          &element,
+	          (uint8_t *) "com.apple.corestorage.lv.name",
+	          29,
+	          &sub_element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_plist_scanner_element_value_uuid_string_copy_to_byte_stream(
+	          &sub_element,
+	          uuid,
+	          16,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FVDE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FVDE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FVDE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FVDE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FVDE_TEST_UNREFERENCED_PARAMETER( argc )
+	FVDE_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT )
+
+	FVDE_TEST_RUN(
+	 "libfvde_plist_scanner_get_root_element",
+	 fvde_test_plist_scanner_get_root_element );
+
+	FVDE_TEST_RUN(
+	 "libfvde_plist_scanner_element_get_sub_element_by_key",
+	 fvde_test_plist_scanner_element_get_sub_element_by_key );
+
+	FVDE_TEST_RUN(
+	 "libfvde_plist_scanner_element_get_sub_element_by_index",
+	 fvde_test_plist_scanner_element_get_sub_element_by_index );
+
+	FVDE_TEST_RUN(
+	 "libfvde_plist_scanner_element_get_value_string",
+	 fvde_test_plist_scanner_element_get_value_string );
+
+	FVDE_TEST_RUN(
+	 "libfvde_plist_scanner_element_get_value_integer",
+	 fvde_test_plist_scanner_element_get_value_integer );
+
+	FVDE_TEST_RUN(
+	 "libfvde_plist_scanner_element_value_uuid_string_copy_to_byte_stream",
+	 fvde_test_plist_scanner_element_value_uuid_string_copy_to_byte_stream );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1432 @@
+/*
+ * Library read_queue type test program
+ *
+ * Copyright (C) 2011-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fvde_test_libcerror.h"
+#include "fvde_test_libfvde.h"
+#include "fvde_test_macros.h"
+#include "fvde_test_memory.h"
+#include "fvde_test_unused.h"
+
+#include "../libfvde/libfvde_definitions.h"
+#include "../libfvde/libfvde_logical_volume.h"
+#include "../libfvde/libfvde_read_queue.h"
+
+typedef struct fvde_test_read_queue_callback_data fvde_test_read_queue_callback_data_t;
+
+/* The data passed to the completion callback functions used by the tests
+ */
+struct fvde_test_read_queue_callback_data
+{
+	/* The read queue
+	 */
+	libfvde_read_queue_t *read_queue;
+
+	/* The number of outstanding reads when the callback function was called
+	 */
+	int number_of_outstanding_reads;
+};
+
+/* Completion callback function used by the tests
+ */
+void fvde_test_read_queue_callback_function(
+      intptr_t *user_data,
+      ssize_t read_count FVDE_TEST_ATTRIBUTE_UNUSED )
+{
+	FVDE_TEST_UNREFERENCED_PARAMETER( read_count )
+
+	if( user_data != NULL )
+	{
+		*( (int *) user_data ) += 1;
+	}
+}
+
+/* Completion callback function used by the tests that retrieves the number of outstanding reads
+ */
+void fvde_test_read_queue_outstanding_reads_callback_function(
+      intptr_t *user_data,
+      ssize_t read_count FVDE_TEST_ATTRIBUTE_UNUSED )
+{
+	fvde_test_read_queue_callback_data_t *callback_data = NULL;
+
+	FVDE_TEST_UNREFERENCED_PARAMETER( read_count )
+
+	callback_data = (fvde_test_read_queue_callback_data_t *) user_data;
+
+	if( callback_data != NULL )
+	{
+		if( libfvde_read_queue_get_number_of_outstanding_reads(
+		     callback_data->read_queue,
+		     &( callback_data->number_of_outstanding_reads ),
+		     NULL ) != 1 )
+		{
+			callback_data->number_of_outstanding_reads = -1;
+		}
+	}
+}
+
+/* Tests the libfvde_read_queue_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_read_queue_initialize(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libfvde_read_queue_t *read_queue = NULL;
+	int result                       = 0;
+
+	/* Test regular cases
+	 */
+	result = libfvde_read_queue_initialize(
+	          &read_queue,
+	          4,
+	          64,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "read_queue",
+	 read_queue );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_read_queue_free(
+	          &read_queue,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "read_queue",
+	 read_queue );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_read_queue_initialize(
+	          NULL,
+	          4,
+	          64,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_queue = (libfvde_read_queue_t *) 0x12345678UL;
+
+	result = libfvde_read_queue_initialize(
+	          &read_queue,
+	          4,
+	          64,
+	          &error );
+
+	read_queue = NULL;
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_read_queue_initialize(
+	          &read_queue,
+	          0,
+	          64,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_read_queue_initialize(
+	          &read_queue,
+	          LIBFVDE_MAXIMUM_NUMBER_OF_READ_QUEUE_THREADS + 1,
+	          64,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_read_queue_initialize(
+	          &read_queue,
+	          4,
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_read_queue_initialize(
+	          &read_queue,
+	          4,
+	          LIBFVDE_MAXIMUM_NUMBER_OF_QUEUED_READS + 1,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_queue != NULL )
+	{
+		libfvde_read_queue_free(
+		 &read_queue,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_read_queue_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_read_queue_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfvde_read_queue_free(
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_read_queue_poll function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_read_queue_poll(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libfvde_read_queue_t *read_queue = NULL;
+	intptr_t *user_data              = NULL;
+	ssize_t read_count               = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_read_queue_initialize(
+	          &read_queue,
+	          2,
+	          8,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_read_queue_poll(
+	          read_queue,
+	          &user_data,
+	          &read_count,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_read_queue_poll(
+	          NULL,
+	          &user_data,
+	          &read_count,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_read_queue_poll(
+	          read_queue,
+	          NULL,
+	          &read_count,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_read_queue_poll(
+	          read_queue,
+	          &user_data,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_read_queue_free(
+	          &read_queue,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "read_queue",
+	 read_queue );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_queue != NULL )
+	{
+		libfvde_read_queue_free(
+		 &read_queue,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_read_queue_wait function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_read_queue_wait(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libfvde_read_queue_t *read_queue = NULL;
+	intptr_t *user_data              = NULL;
+	ssize_t read_count               = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_read_queue_initialize(
+	          &read_queue,
+	          2,
+	          8,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_read_queue_wait(
+	          read_queue,
+	          &user_data,
+	          &read_count,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_read_queue_wait(
+	          NULL,
+	          &user_data,
+	          &read_count,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_read_queue_wait(
+	          read_queue,
+	          NULL,
+	          &read_count,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_read_queue_wait(
+	          read_queue,
+	          &user_data,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_read_queue_free(
+	          &read_queue,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "read_queue",
+	 read_queue );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_queue != NULL )
+	{
+		libfvde_read_queue_free(
+		 &read_queue,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_read_queue_get_number_of_outstanding_reads function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_read_queue_get_number_of_outstanding_reads(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libfvde_read_queue_t *read_queue = NULL;
+	int number_of_outstanding_reads  = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_read_queue_initialize(
+	          &read_queue,
+	          2,
+	          8,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_read_queue_get_number_of_outstanding_reads(
+	          read_queue,
+	          &number_of_outstanding_reads,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_outstanding_reads",
+	 number_of_outstanding_reads,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_read_queue_get_number_of_outstanding_reads(
+	          NULL,
+	          &number_of_outstanding_reads,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_read_queue_get_number_of_outstanding_reads(
+	          read_queue,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_read_queue_free(
+	          &read_queue,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "read_queue",
+	 read_queue );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_queue != NULL )
+	{
+		libfvde_read_queue_free(
+		 &read_queue,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT )
+
+/* Tests the libfvde_internal_read_queue_complete_read_request function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_internal_read_queue_complete_read_request(
+     void )
+{
+	fvde_test_read_queue_callback_data_t callback_data;
+
+	libcerror_error_t *error                           = NULL;
+	libfvde_internal_read_queue_t *internal_read_queue = NULL;
+	libfvde_read_queue_t *read_queue                   = NULL;
+	libfvde_read_request_t *read_request               = NULL;
+	intptr_t *user_data                                = NULL;
+	ssize_t read_count                                 = 0;
+	int result                                         = 0;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	libcthreads_mutex_t *mutex                         = NULL;
+#endif
+
+	/* Initialize test
+	 */
+	result = libfvde_read_queue_initialize(
+	          &read_queue,
+	          2,
+	          1,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_read_queue = (libfvde_internal_read_queue_t *) read_queue;
+
+	callback_data.read_queue                  = read_queue;
+	callback_data.number_of_outstanding_reads = -1;
+
+	/* Test completing a read with a callback function when the maximum number of outstanding reads was reached
+	 */
+	read_request = memory_allocate_structure(
+	                libfvde_read_request_t );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "read_request",
+	 read_request );
+
+	memory_set(
+	 read_request,
+	 0,
+	 sizeof( libfvde_read_request_t ) );
+
+	read_request->callback_function = &fvde_test_read_queue_outstanding_reads_callback_function;
+	read_request->user_data         = (intptr_t *) &callback_data;
+	read_request->read_count        = 512;
+
+	internal_read_queue->number_of_outstanding_reads = 1;
+	internal_read_queue->number_of_pending_reads     = 1;
+
+	result = libfvde_internal_read_queue_complete_read_request(
+	          internal_read_queue,
+	          read_request,
+	          &error );
+
+	read_request = NULL;
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The read is no longer outstanding when the callback function is called
+	 * hence the callback function could submit a new read
+	 */
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "callback_data.number_of_outstanding_reads",
+	 callback_data.number_of_outstanding_reads,
+	 0 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "internal_read_queue->number_of_outstanding_reads",
+	 internal_read_queue->number_of_outstanding_reads,
+	 0 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "internal_read_queue->number_of_pending_reads",
+	 internal_read_queue->number_of_pending_reads,
+	 0 );
+
+	/* Test completing a read without a callback function
+	 */
+	read_request = memory_allocate_structure(
+	                libfvde_read_request_t );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "read_request",
+	 read_request );
+
+	memory_set(
+	 read_request,
+	 0,
+	 sizeof( libfvde_read_request_t ) );
+
+	read_request->user_data  = (intptr_t *) &callback_data;
+	read_request->read_count = 512;
+
+	internal_read_queue->number_of_outstanding_reads = 1;
+	internal_read_queue->number_of_pending_reads     = 1;
+
+	result = libfvde_internal_read_queue_complete_read_request(
+	          internal_read_queue,
+	          read_request,
+	          &error );
+
+	read_request = NULL;
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The read remains outstanding until it is returned as completed read
+	 */
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "internal_read_queue->number_of_outstanding_reads",
+	 internal_read_queue->number_of_outstanding_reads,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "internal_read_queue->number_of_pending_reads",
+	 internal_read_queue->number_of_pending_reads,
+	 0 );
+
+	result = libfvde_read_queue_poll(
+	          read_queue,
+	          &user_data,
+	          &read_count,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 512 );
+
+	FVDE_TEST_ASSERT_EQUAL_INTPTR(
+	 "user_data",
+	 (intptr_t) user_data,
+	 (intptr_t) &callback_data );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "internal_read_queue->number_of_outstanding_reads",
+	 internal_read_queue->number_of_outstanding_reads,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfvde_internal_read_queue_complete_read_request(
+	          NULL,
+	          read_request,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_internal_read_queue_complete_read_request(
+	          internal_read_queue,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+
+	/* Test the counters are not changed if the mutex cannot be grabbed
+	 */
+	read_request = memory_allocate_structure(
+	                libfvde_read_request_t );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "read_request",
+	 read_request );
+
+	memory_set(
+	 read_request,
+	 0,
+	 sizeof( libfvde_read_request_t ) );
+
+	read_request->user_data  = (intptr_t *) &callback_data;
+	read_request->read_count = 512;
+
+	internal_read_queue->number_of_outstanding_reads = 1;
+	internal_read_queue->number_of_pending_reads     = 1;
+
+	mutex = internal_read_queue->mutex;
+
+	internal_read_queue->mutex = NULL;
+
+	result = libfvde_internal_read_queue_complete_read_request(
+	          internal_read_queue,
+	          read_request,
+	          &error );
+
+	internal_read_queue->mutex = mutex;
+
+	read_request = NULL;
+	mutex        = NULL;
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "internal_read_queue->number_of_outstanding_reads",
+	 internal_read_queue->number_of_outstanding_reads,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "internal_read_queue->number_of_pending_reads",
+	 internal_read_queue->number_of_pending_reads,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "internal_read_queue->synchronization_failed",
+	 (int) internal_read_queue->synchronization_failed,
+	 1 );
+
+	/* Test wait returns an error instead of waiting for the read that was not accounted for
+	 */
+	result = libfvde_read_queue_wait(
+	          read_queue,
+	          &user_data,
+	          &read_count,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test free returns an error instead of waiting for the read that was not accounted for
+	 */
+	result = libfvde_read_queue_free(
+	          &read_queue,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "read_queue",
+	 read_queue );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#else
+	/* Clean up
+	 */
+	result = libfvde_read_queue_free(
+	          &read_queue,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "read_queue",
+	 read_queue );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_request != NULL )
+	{
+		memory_free(
+		 read_request );
+	}
+	if( read_queue != NULL )
+	{
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+		if( mutex != NULL )
+		{
+			internal_read_queue->mutex = mutex;
+		}
+#endif
+		libfvde_read_queue_free(
+		 &read_queue,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_read_queue_submit_read function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_read_queue_submit_read(
+     void )
+{
+	uint8_t buffer[ 512 ];
+	libfvde_internal_logical_volume_t internal_logical_volume;
+
+	libcerror_error_t *error         = NULL;
+	libfvde_read_queue_t *read_queue = NULL;
+	intptr_t *user_data              = NULL;
+	ssize_t read_count               = 0;
+	int number_of_callbacks          = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = memory_set(
+	          &internal_logical_volume,
+	          0,
+	          sizeof( libfvde_internal_logical_volume_t ) ) != NULL;
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfvde_read_queue_initialize(
+	          &read_queue,
+	          2,
+	          1,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test submitting a read that completes with a read error
+	 * since the logical volume is not initialized
+	 */
+	result = libfvde_read_queue_submit_read(
+	          read_queue,
+	          (libfvde_logical_volume_t *) &internal_logical_volume,
+	          buffer,
+	          512,
+	          0,
+	          NULL,
+	          (intptr_t *) buffer,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test submitting a read when the maximum number of outstanding reads was reached
+	 */
+	result = libfvde_read_queue_submit_read(
+	          read_queue,
+	          (libfvde_logical_volume_t *) &internal_logical_volume,
+	          buffer,
+	          512,
+	          0,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_read_queue_wait(
+	          read_queue,
+	          &user_data,
+	          &read_count,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INTPTR(
+	 "user_data",
+	 (intptr_t) user_data,
+	 (intptr_t) buffer );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test submitting a read with a callback function
+	 */
+	result = libfvde_read_queue_submit_read(
+	          read_queue,
+	          (libfvde_logical_volume_t *) &internal_logical_volume,
+	          buffer,
+	          512,
+	          0,
+	          &fvde_test_read_queue_callback_function,
+	          (intptr_t *) &number_of_callbacks,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Reads with a callback function are not returned as completed reads
+	 */
+	result = libfvde_read_queue_wait(
+	          read_queue,
+	          &user_data,
+	          &read_count,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_callbacks",
+	 number_of_callbacks,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_read_queue_submit_read(
+	          NULL,
+	          (libfvde_logical_volume_t *) &internal_logical_volume,
+	          buffer,
+	          512,
+	          0,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_read_queue_submit_read(
+	          read_queue,
+	          NULL,
+	          buffer,
+	          512,
+	          0,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_read_queue_submit_read(
+	          read_queue,
+	          (libfvde_logical_volume_t *) &internal_logical_volume,
+	          NULL,
+	          512,
+	          0,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_read_queue_submit_read(
+	          read_queue,
+	          (libfvde_logical_volume_t *) &internal_logical_volume,
+	          buffer,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_read_queue_submit_read(
+	          read_queue,
+	          (libfvde_logical_volume_t *) &internal_logical_volume,
+	          buffer,
+	          512,
+	          -1,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_read_queue_free(
+	          &read_queue,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "read_queue",
+	 read_queue );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_queue != NULL )
+	{
+		libfvde_read_queue_free(
+		 &read_queue,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FVDE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FVDE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FVDE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FVDE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FVDE_TEST_UNREFERENCED_PARAMETER( argc )
+	FVDE_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FVDE_TEST_RUN(
+	 "libfvde_read_queue_initialize",
+	 fvde_test_read_queue_initialize );
+
+	FVDE_TEST_RUN(
+	 "libfvde_read_queue_free",
+	 fvde_test_read_queue_free );
+
+#if defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT )
+
+	FVDE_TEST_RUN(
+	 "libfvde_internal_read_queue_complete_read_request",
+	 fvde_test_internal_read_queue_complete_read_request );
+
+	FVDE_TEST_RUN(
+	 "libfvde_read_queue_submit_read",
+	 fvde_test_read_queue_submit_read );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
+
+	FVDE_TEST_RUN(
+	 "libfvde_read_queue_poll",
+	 fvde_test_read_queue_poll );
+
+	FVDE_TEST_RUN(
+	 "libfvde_read_queue_wait",
+	 fvde_test_read_queue_wait );
+
+	FVDE_TEST_RUN(
+	 "libfvde_read_queue_get_number_of_outstanding_reads",
+	 fvde_test_read_queue_get_number_of_outstanding_reads );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,2135 @@
+/*
+ * Library sector_cache type test program
+ *
+ * Copyright (C) 2011-2024, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fvde_test_libcerror.h"
+#include "fvde_test_libfvde.h"
+#include "fvde_test_macros.h"
+#include "fvde_test_memory.h"
+#include "fvde_test_unused.h"
+
+#include "../libfvde/libfvde_definitions.h"
+#include "../libfvde/libfvde_sector_cache.h"
+#include "../libfvde/libfvde_volume_data_handle.h"
+
+uint8_t fvde_test_sector_cache_key[ 16 ] = {
+	0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f };
+
+uint8_t fvde_test_sector_cache_tweak_key[ 16 ] = {
+	0xf0, 0xe1, 0xd2, 0xc3, 0xb4, 0xa5, 0x96, 0x87, 0x78, 0x69, 0x5a, 0x4b, 0x3c, 0x2d, 0x1e, 0x0f };
+
+#if defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT )
+
+/* Tests the libfvde_sector_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_sector_cache_initialize(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libfvde_sector_cache_t *sector_cache = NULL;
+	int result                           = 0;
+
+	/* Test regular cases
+	 */
+	result = libfvde_sector_cache_initialize(
+	          &sector_cache,
+	          16,
+	          64,
+	          4096,
+	          512,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "sector_cache",
+	 sector_cache );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_sector_cache_free(
+	          &sector_cache,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "sector_cache",
+	 sector_cache );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_sector_cache_initialize(
+	          NULL,
+	          16,
+	          64,
+	          4096,
+	          512,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	sector_cache = (libfvde_sector_cache_t *) 0x12345678UL;
+
+	result = libfvde_sector_cache_initialize(
+	          &sector_cache,
+	          16,
+	          64,
+	          4096,
+	          512,
+	          &error );
+
+	sector_cache = NULL;
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_sector_cache_initialize(
+	          &sector_cache,
+	          0,
+	          64,
+	          4096,
+	          512,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_sector_cache_initialize(
+	          &sector_cache,
+	          LIBFVDE_MAXIMUM_NUMBER_OF_SECTOR_CACHE_SHARDS + 1,
+	          64,
+	          4096,
+	          512,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_sector_cache_initialize(
+	          &sector_cache,
+	          16,
+	          0,
+	          4096,
+	          512,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_sector_cache_initialize(
+	          &sector_cache,
+	          16,
+	          64,
+	          0,
+	          512,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_sector_cache_initialize(
+	          &sector_cache,
+	          16,
+	          64,
+	          4000,
+	          512,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_sector_cache_initialize(
+	          &sector_cache,
+	          16,
+	          64,
+	          4096,
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sector_cache != NULL )
+	{
+		libfvde_sector_cache_free(
+		 &sector_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_sector_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_sector_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfvde_sector_cache_free(
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_sector_cache_set_keys function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_sector_cache_set_keys(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libfvde_sector_cache_t *sector_cache = NULL;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_sector_cache_initialize(
+	          &sector_cache,
+	          16,
+	          64,
+	          4096,
+	          512,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "sector_cache",
+	 sector_cache );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_sector_cache_set_keys(
+	          sector_cache,
+	          LIBFVDE_ENCRYPTION_METHOD_AES_128_XTS,
+	          fvde_test_sector_cache_key,
+	          128,
+	          fvde_test_sector_cache_tweak_key,
+	          128,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_sector_cache_set_keys(
+	          NULL,
+	          LIBFVDE_ENCRYPTION_METHOD_AES_128_XTS,
+	          fvde_test_sector_cache_key,
+	          128,
+	          fvde_test_sector_cache_tweak_key,
+	          128,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_sector_cache_free(
+	          &sector_cache,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "sector_cache",
+	 sector_cache );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sector_cache != NULL )
+	{
+		libfvde_sector_cache_free(
+		 &sector_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_sector_cache_read_buffer_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_sector_cache_read_buffer_at_offset(
+     void )
+{
+	uint8_t buffer[ 512 ];
+	libfvde_volume_data_handle_t volume_data_handle;
+
+	libcerror_error_t *error             = NULL;
+	libfvde_sector_cache_t *sector_cache = NULL;
+	ssize_t read_count                   = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = memory_set(
+	          &volume_data_handle,
+	          0,
+	          sizeof( libfvde_volume_data_handle_t ) ) != NULL;
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfvde_sector_cache_initialize(
+	          &sector_cache,
+	          16,
+	          64,
+	          4096,
+	          512,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "sector_cache",
+	 sector_cache );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libfvde_sector_cache_read_buffer_at_offset(
+	              NULL,
+	              &volume_data_handle,
+	              NULL,
+	              0,
+	              4096,
+	              0,
+	              0,
+	              buffer,
+	              512,
+	              &error );
+
+	FVDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfvde_sector_cache_read_buffer_at_offset(
+	              sector_cache,
+	              NULL,
+	              NULL,
+	              0,
+	              4096,
+	              0,
+	              0,
+	              buffer,
+	              512,
+	              &error );
+
+	FVDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfvde_sector_cache_read_buffer_at_offset(
+	              sector_cache,
+	              &volume_data_handle,
+	              NULL,
+	              0,
+	              4096,
+	              0,
+	              -1,
+	              buffer,
+	              512,
+	              &error );
+
+	FVDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfvde_sector_cache_read_buffer_at_offset(
+	              sector_cache,
+	              &volume_data_handle,
+	              NULL,
+	              0,
+	              4096,
+	              0,
+	              0,
+	              NULL,
+	              512,
+	              &error );
+
+	FVDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfvde_sector_cache_read_buffer_at_offset(
+	              sector_cache,
+	              &volume_data_handle,
+	              NULL,
+	              0,
+	              4096,
+	              0,
+	              0,
+	              buffer,
+	              (size_t) SSIZE_MAX + 1,
+	              &error );
+
+	FVDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the file offset is smaller than the offset in the sector data
+	 */
+	read_count = libfvde_sector_cache_read_buffer_at_offset(
+	              sector_cache,
+	              &volume_data_handle,
+	              NULL,
+	              0,
+	              0,
+	              0,
+	              100,
+	              buffer,
+	              512,
+	              &error );
+
+	FVDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the volume is encrypted and the keys were not set
+	 */
+	volume_data_handle.is_encrypted = 1;
+
+	read_count = libfvde_sector_cache_read_buffer_at_offset(
+	              sector_cache,
+	              &volume_data_handle,
+	              NULL,
+	              0,
+	              4096,
+	              0,
+	              0,
+	              buffer,
+	              512,
+	              &error );
+
+	FVDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	volume_data_handle.is_encrypted = 0;
+
+	/* Clean up
+	 */
+	result = libfvde_sector_cache_free(
+	          &sector_cache,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "sector_cache",
+	 sector_cache );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sector_cache != NULL )
+	{
+		libfvde_sector_cache_free(
+		 &sector_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_sector_cache_read_buffer_direct function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_sector_cache_read_buffer_direct(
+     void )
+{
+	uint8_t buffer[ 512 ];
+	libfvde_volume_data_handle_t volume_data_handle;
+
+	libcerror_error_t *error             = NULL;
+	libfvde_sector_cache_t *sector_cache = NULL;
+	ssize_t read_count                   = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = memory_set(
+	          &volume_data_handle,
+	          0,
+	          sizeof( libfvde_volume_data_handle_t ) ) != NULL;
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfvde_sector_cache_initialize(
+	          &sector_cache,
+	          16,
+	          64,
+	          4096,
+	          512,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "sector_cache",
+	 sector_cache );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libfvde_sector_cache_read_buffer_direct(
+	              NULL,
+	              &volume_data_handle,
+	              NULL,
+	              0,
+	              4096,
+	              0,
+	              0,
+	              buffer,
+	              512,
+	              &error );
+
+	FVDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfvde_sector_cache_read_buffer_direct(
+	              sector_cache,
+	              NULL,
+	              NULL,
+	              0,
+	              4096,
+	              0,
+	              0,
+	              buffer,
+	              512,
+	              &error );
+
+	FVDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfvde_sector_cache_read_buffer_direct(
+	              sector_cache,
+	              &volume_data_handle,
+	              NULL,
+	              0,
+	              4096,
+	              0,
+	              -1,
+	              buffer,
+	              512,
+	              &error );
+
+	FVDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfvde_sector_cache_read_buffer_direct(
+	              sector_cache,
+	              &volume_data_handle,
+	              NULL,
+	              0,
+	              4096,
+	              0,
+	              0,
+	              NULL,
+	              512,
+	              &error );
+
+	FVDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfvde_sector_cache_read_buffer_direct(
+	              sector_cache,
+	              &volume_data_handle,
+	              NULL,
+	              0,
+	              4096,
+	              0,
+	              0,
+	              buffer,
+	              (size_t) SSIZE_MAX + 1,
+	              &error );
+
+	FVDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the offset is not sector aligned
+	 */
+	read_count = libfvde_sector_cache_read_buffer_direct(
+	              sector_cache,
+	              &volume_data_handle,
+	              NULL,
+	              0,
+	              4096,
+	              0,
+	              100,
+	              buffer,
+	              512,
+	              &error );
+
+	FVDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the volume is encrypted and the keys were not set
+	 */
+	volume_data_handle.is_encrypted = 1;
+
+	read_count = libfvde_sector_cache_read_buffer_direct(
+	              sector_cache,
+	              &volume_data_handle,
+	              NULL,
+	              0,
+	              4096,
+	              0,
+	              0,
+	              buffer,
+	              512,
+	              &error );
+
+	FVDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_sector_cache_set_keys(
+	          sector_cache,
+	          LIBFVDE_ENCRYPTION_METHOD_AES_128_XTS,
+	          fvde_test_sector_cache_key,
+	          128,
+	          fvde_test_sector_cache_tweak_key,
+	          128,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error case where the read fails
+	 */
+	read_count = libfvde_sector_cache_read_buffer_direct(
+	              sector_cache,
+	              &volume_data_handle,
+	              NULL,
+	              0,
+	              4096,
+	              0,
+	              0,
+	              buffer,
+	              512,
+	              &error );
+
+	FVDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	/* The direct read encryption context is returned after the failed read
+	 */
+	FVDE_TEST_ASSERT_EQUAL_UINT8(
+	 "direct_encryption_context_is_taken",
+	 sector_cache->shards[ 0 ].direct_encryption_context_is_taken,
+	 0 );
+#endif
+
+	volume_data_handle.is_encrypted = 0;
+
+	/* Clean up
+	 */
+	result = libfvde_sector_cache_free(
+	          &sector_cache,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "sector_cache",
+	 sector_cache );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sector_cache != NULL )
+	{
+		libfvde_sector_cache_free(
+		 &sector_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+
+/* Tests the libfvde_sector_cache_take_direct_encryption_context and libfvde_sector_cache_return_direct_encryption_context functions
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_sector_cache_take_direct_encryption_context(
+     void )
+{
+	libcerror_error_t *error                         = NULL;
+	libfvde_encryption_context_t *encryption_context = NULL;
+	libfvde_sector_cache_t *sector_cache             = NULL;
+	int result                                       = 0;
+	int taken_shard_index                            = -1;
+
+	/* Initialize test
+	 */
+	result = libfvde_sector_cache_initialize(
+	          &sector_cache,
+	          2,
+	          64,
+	          4096,
+	          512,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "sector_cache",
+	 sector_cache );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test take without keys set
+	 */
+	result = libfvde_sector_cache_take_direct_encryption_context(
+	          sector_cache,
+	          1,
+	          &taken_shard_index,
+	          &encryption_context,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "encryption_context",
+	 encryption_context );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_sector_cache_set_keys(
+	          sector_cache,
+	          LIBFVDE_ENCRYPTION_METHOD_AES_128_XTS,
+	          fvde_test_sector_cache_key,
+	          128,
+	          fvde_test_sector_cache_tweak_key,
+	          128,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_sector_cache_take_direct_encryption_context(
+	          sector_cache,
+	          1,
+	          &taken_shard_index,
+	          &encryption_context,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "taken_shard_index",
+	 taken_shard_index,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "encryption_context",
+	 ( encryption_context == sector_cache->shards[ 1 ].direct_encryption_context ),
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test take of a context of another shard when the context of the shard is taken
+	 */
+	encryption_context = NULL;
+
+	result = libfvde_sector_cache_take_direct_encryption_context(
+	          sector_cache,
+	          1,
+	          &taken_shard_index,
+	          &encryption_context,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "taken_shard_index",
+	 taken_shard_index,
+	 0 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "encryption_context",
+	 ( encryption_context == sector_cache->shards[ 0 ].direct_encryption_context ),
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test take when all contexts are taken
+	 */
+	encryption_context = NULL;
+
+	result = libfvde_sector_cache_take_direct_encryption_context(
+	          sector_cache,
+	          0,
+	          &taken_shard_index,
+	          &encryption_context,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "encryption_context",
+	 encryption_context );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error case where the keys are set while a context is taken
+	 */
+	result = libfvde_sector_cache_set_keys(
+	          sector_cache,
+	          LIBFVDE_ENCRYPTION_METHOD_AES_128_XTS,
+	          fvde_test_sector_cache_key,
+	          128,
+	          fvde_test_sector_cache_tweak_key,
+	          128,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_sector_cache_return_direct_encryption_context(
+	          sector_cache,
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_sector_cache_return_direct_encryption_context(
+	          sector_cache,
+	          1,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test take of the context of the shard after it was returned
+	 */
+	result = libfvde_sector_cache_take_direct_encryption_context(
+	          sector_cache,
+	          1,
+	          &taken_shard_index,
+	          &encryption_context,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "taken_shard_index",
+	 taken_shard_index,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_sector_cache_return_direct_encryption_context(
+	          sector_cache,
+	          taken_shard_index,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_sector_cache_take_direct_encryption_context(
+	          NULL,
+	          0,
+	          &taken_shard_index,
+	          &encryption_context,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_sector_cache_take_direct_encryption_context(
+	          sector_cache,
+	          2,
+	          &taken_shard_index,
+	          &encryption_context,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_sector_cache_take_direct_encryption_context(
+	          sector_cache,
+	          0,
+	          NULL,
+	          &encryption_context,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_sector_cache_take_direct_encryption_context(
+	          sector_cache,
+	          0,
+	          &taken_shard_index,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_sector_cache_return_direct_encryption_context(
+	          NULL,
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_sector_cache_return_direct_encryption_context(
+	          sector_cache,
+	          -1,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_sector_cache_free(
+	          &sector_cache,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "sector_cache",
+	 sector_cache );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sector_cache != NULL )
+	{
+		libfvde_sector_cache_free(
+		 &sector_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT ) */
+
+/* Tests the libfvde_sector_cache_set_sector_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_sector_cache_set_sector_data(
+     void )
+{
+	uint8_t buffer[ 512 ];
+	uint8_t data[ 4096 ];
+	libfvde_volume_data_handle_t volume_data_handle;
+
+	libcerror_error_t *error             = NULL;
+	libfvde_sector_cache_t *sector_cache = NULL;
+	ssize_t read_count                   = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = memory_set(
+	          &volume_data_handle,
+	          0,
+	          sizeof( libfvde_volume_data_handle_t ) ) != NULL;
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = memory_set(
+	          data,
+	          0x5a,
+	          4096 ) != NULL;
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfvde_sector_cache_initialize(
+	          &sector_cache,
+	          16,
+	          64,
+	          4096,
+	          512,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "sector_cache",
+	 sector_cache );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_sector_cache_has_sector_data(
+	          sector_cache,
+	          8192,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_sector_cache_set_sector_data(
+	          sector_cache,
+	          &volume_data_handle,
+	          8192,
+	          data,
+	          4096,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_sector_cache_has_sector_data(
+	          sector_cache,
+	          8192,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The sector data is not replaced if already cached
+	 */
+	result = libfvde_sector_cache_set_sector_data(
+	          sector_cache,
+	          &volume_data_handle,
+	          8192,
+	          data,
+	          4096,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Read the cached sector data without a file IO pool
+	 */
+	read_count = libfvde_sector_cache_read_buffer_at_offset(
+	              sector_cache,
+	              &volume_data_handle,
+	              NULL,
+	              0,
+	              8192 + 512,
+	              0,
+	              8192 + 512,
+	              buffer,
+	              512,
+	              &error );
+
+	FVDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 512 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          data,
+	          512 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfvde_sector_cache_has_sector_data(
+	          NULL,
+	          8192,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_sector_cache_has_sector_data(
+	          sector_cache,
+	          100,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_sector_cache_set_sector_data(
+	          NULL,
+	          &volume_data_handle,
+	          0,
+	          data,
+	          4096,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_sector_cache_set_sector_data(
+	          sector_cache,
+	          NULL,
+	          0,
+	          data,
+	          4096,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_sector_cache_set_sector_data(
+	          sector_cache,
+	          &volume_data_handle,
+	          100,
+	          data,
+	          4096,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_sector_cache_set_sector_data(
+	          sector_cache,
+	          &volume_data_handle,
+	          0,
+	          NULL,
+	          4096,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_sector_cache_set_sector_data(
+	          sector_cache,
+	          &volume_data_handle,
+	          0,
+	          data,
+	          512,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the volume is encrypted and the keys were not set
+	 */
+	volume_data_handle.is_encrypted = 1;
+
+	result = libfvde_sector_cache_set_sector_data(
+	          sector_cache,
+	          &volume_data_handle,
+	          0,
+	          data,
+	          4096,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	volume_data_handle.is_encrypted = 0;
+
+	/* Clean up
+	 */
+	result = libfvde_sector_cache_free(
+	          &sector_cache,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "sector_cache",
+	 sector_cache );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sector_cache != NULL )
+	{
+		libfvde_sector_cache_free(
+		 &sector_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_sector_cache_fill function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_sector_cache_fill(
+     void )
+{
+	uint8_t data[ 4096 ];
+	libfvde_volume_data_handle_t volume_data_handle;
+
+	libcerror_error_t *error             = NULL;
+	libfvde_sector_cache_t *sector_cache = NULL;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = memory_set(
+	          &volume_data_handle,
+	          0,
+	          sizeof( libfvde_volume_data_handle_t ) ) != NULL;
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = memory_set(
+	          data,
+	          0x5a,
+	          4096 ) != NULL;
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfvde_sector_cache_initialize(
+	          &sector_cache,
+	          16,
+	          64,
+	          4096,
+	          512,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "sector_cache",
+	 sector_cache );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_sector_cache_set_sector_data(
+	          sector_cache,
+	          &volume_data_handle,
+	          0,
+	          data,
+	          4096,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_sector_cache_set_sector_data(
+	          sector_cache,
+	          &volume_data_handle,
+	          4096,
+	          data,
+	          4096,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+
+	/* The sector data is cached so no data is read from the file IO pool
+	 */
+	result = libfvde_sector_cache_fill(
+	          sector_cache,
+	          &volume_data_handle,
+	          NULL,
+	          0,
+	          4096 + 100,
+	          0,
+	          100,
+	          6000,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "sector_cache->shards[ 0 ].fill_data",
+	 sector_cache->shards[ 0 ].fill_data );
+
+	/* Sparse data is not cached
+	 */
+	result = libfvde_sector_cache_fill(
+	          sector_cache,
+	          &volume_data_handle,
+	          NULL,
+	          0,
+	          16384,
+	          LIBFVDE_RANGE_FLAG_IS_SPARSE,
+	          16384,
+	          8192,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_sector_cache_has_sector_data(
+	          sector_cache,
+	          16384,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_sector_cache_fill(
+	          NULL,
+	          &volume_data_handle,
+	          NULL,
+	          0,
+	          4096,
+	          0,
+	          0,
+	          8192,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_sector_cache_fill(
+	          sector_cache,
+	          NULL,
+	          NULL,
+	          0,
+	          4096,
+	          0,
+	          0,
+	          8192,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_sector_cache_fill(
+	          sector_cache,
+	          &volume_data_handle,
+	          NULL,
+	          0,
+	          4096,
+	          0,
+	          -1,
+	          8192,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_sector_cache_fill(
+	          sector_cache,
+	          &volume_data_handle,
+	          NULL,
+	          0,
+	          4096,
+	          0,
+	          0,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the file offset is smaller than the offset in the sector data
+	 */
+	result = libfvde_sector_cache_fill(
+	          sector_cache,
+	          &volume_data_handle,
+	          NULL,
+	          0,
+	          0,
+	          0,
+	          100,
+	          8192,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_sector_cache_free(
+	          &sector_cache,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "sector_cache",
+	 sector_cache );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sector_cache != NULL )
+	{
+		libfvde_sector_cache_free(
+		 &sector_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FVDE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FVDE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FVDE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FVDE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FVDE_TEST_UNREFERENCED_PARAMETER( argc )
+	FVDE_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT )
+
+	FVDE_TEST_RUN(
+	 "libfvde_sector_cache_initialize",
+	 fvde_test_sector_cache_initialize );
+
+	FVDE_TEST_RUN(
+	 "libfvde_sector_cache_free",
+	 fvde_test_sector_cache_free );
+
+	FVDE_TEST_RUN(
+	 "libfvde_sector_cache_set_keys",
+	 fvde_test_sector_cache_set_keys );
+
+	FVDE_TEST_RUN(
+	 "libfvde_sector_cache_read_buffer_at_offset",
+	 fvde_test_sector_cache_read_buffer_at_offset );
+
+	FVDE_TEST_RUN(
+	 "libfvde_sector_cache_read_buffer_direct",
+	 fvde_test_sector_cache_read_buffer_direct );
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+
+	FVDE_TEST_RUN(
+	 "libfvde_sector_cache_take_direct_encryption_context",
+	 fvde_test_sector_cache_take_direct_encryption_context );
+
+#endif /* defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT ) */
+
+	FVDE_TEST_RUN(
+	 "libfvde_sector_cache_set_sector_data",
+	 fvde_test_sector_cache_set_sector_data );
+
+	FVDE_TEST_RUN(
+	 "libfvde_sector_cache_fill",
+	 fvde_test_sector_cache_fill );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
+}
+
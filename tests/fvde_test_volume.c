@@ -462,6 +462,365 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfvde_volume_set_maximum_cache_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_volume_set_maximum_cache_size(
+     void )
+{
+	libcerror_error_t *error  = NULL;
+	libfvde_volume_t *volume  = NULL;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_volume_initialize(
+	          &volume,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_volume_set_maximum_cache_size(
+	          volume,
+	          1024 * 1024,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_volume_set_maximum_cache_size(
+	          volume,
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_volume_set_maximum_cache_size(
+	          NULL,
+	          1024 * 1024,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_volume_free(
+	          &volume,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libfvde_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_volume_set_cache_unit_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_volume_set_cache_unit_size(
+     void )
+{
+	libcerror_error_t *error  = NULL;
+	libfvde_volume_t *volume  = NULL;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_volume_initialize(
+	          &volume,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_volume_set_cache_unit_size(
+	          volume,
+	          4096,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_volume_set_cache_unit_size(
+	          volume,
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_volume_set_cache_unit_size(
+	          NULL,
+	          4096,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_volume_set_cache_unit_size(
+	          volume,
+	          1000,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_volume_free(
+	          &volume,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libfvde_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_volume_set_fast_open function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_volume_set_fast_open(
+     void )
+{
+	libcerror_error_t *error  = NULL;
+	libfvde_volume_t *volume  = NULL;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_volume_initialize(
+	          &volume,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_volume_set_fast_open(
+	          volume,
+	          1,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_volume_set_fast_open(
+	          volume,
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_volume_set_fast_open(
+	          NULL,
+	          1,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_volume_free(
+	          &volume,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libfvde_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libfvde_volume_open function
  * Returns 1 if successful or 0 if not
  */
@@ -2384,6 +2743,166 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfvde_volume_seek_offset function on a volume that was not read from
+ * The logical volume data is set up on demand by the first seek
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_volume_seek_offset_before_read(
+     libbfio_handle_t *file_io_handle,
+     const system_character_t *password )
+{
+	libcerror_error_t *error = NULL;
+	libfvde_volume_t *volume = NULL;
+	size64_t size            = 0;
+	off64_t offset           = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = fvde_test_volume_open_source(
+	          &volume,
+	          file_io_handle,
+	          password,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	offset = libfvde_volume_seek_offset(
+	          volume,
+	          0,
+	          SEEK_END,
+	          &error );
+
+	FVDE_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	size = (size64_t) offset;
+
+#if defined( SEEK_DATA ) && defined( SEEK_HOLE )
+	result = fvde_test_volume_close_source(
+	          &volume,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fvde_test_volume_open_source(
+	          &volume,
+	          file_io_handle,
+	          password,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The end of the volume is considered a hole
+	 */
+	offset = libfvde_volume_seek_offset(
+	          volume,
+	          0,
+	          SEEK_HOLE,
+	          &error );
+
+	FVDE_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	offset = libfvde_volume_seek_offset(
+	          volume,
+	          (off64_t) size,
+	          SEEK_DATA,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#endif /* defined( SEEK_DATA ) && defined( SEEK_HOLE ) */
+
+	/* Clean up
+	 */
+	result = fvde_test_volume_close_source(
+	          &volume,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libfvde_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libfvde_volume_get_offset function
  * Returns 1 if successful or 0 if not
  */
@@ -2839,6 +3358,18 @@ int main(
 	 "libfvde_volume_free",
 	 fvde_test_volume_free );
 
+	FVDE_TEST_RUN(
+	 "libfvde_volume_set_maximum_cache_size",
+	 fvde_test_volume_set_maximum_cache_size );
+
+	FVDE_TEST_RUN(
+	 "libfvde_volume_set_cache_unit_size",
+	 fvde_test_volume_set_cache_unit_size );
+
+	FVDE_TEST_RUN(
+	 "libfvde_volume_set_fast_open",
+	 fvde_test_volume_set_fast_open );
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 	if( source != NULL )
 	{
@@ -2950,6 +3481,12 @@ int main(
 	}
 	if( result != 0 )
 	{
+		FVDE_TEST_RUN_WITH_ARGS(
+		 "libfvde_volume_seek_offset_before_read",
+		 fvde_test_volume_seek_offset_before_read,
+		 file_io_handle,
+		 option_password );
+
 		/* Initialize volume for tests
 		 */
 		result = fvde_test_volume_open_source(
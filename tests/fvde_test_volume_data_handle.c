@@ -33,7 +33,9 @@
 #include "fvde_test_memory.h"
 #include "fvde_test_unused.h"
 
+#include "../libfvde/libfvde_definitions.h"
 #include "../libfvde/libfvde_io_handle.h"
+#include "../libfvde/libfvde_sector_data.h"
 #include "../libfvde/libfvde_volume_data_handle.h"
 
 #if defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT )
@@ -344,6 +346,440 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfvde_volume_data_handle_get_sector_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_volume_data_handle_get_sector_data(
+     void )
+{
+	libcerror_error_t *error                         = NULL;
+	libfvde_io_handle_t *io_handle                   = NULL;
+	libfvde_sector_data_t *sector_data               = NULL;
+	libfvde_volume_data_handle_t *volume_data_handle = NULL;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->bytes_per_sector = 512;
+
+	result = libfvde_volume_data_handle_initialize(
+	          &volume_data_handle,
+	          io_handle,
+	          1024,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_data_handle",
+	 volume_data_handle );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	volume_data_handle->maximum_number_of_sector_data = 64;
+
+	result = libfvde_volume_data_handle_get_sector_data(
+	          volume_data_handle,
+	          512,
+	          &sector_data,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "sector_data",
+	 sector_data );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_data_handle->sector_data_pool",
+	 volume_data_handle->sector_data_pool );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "volume_data_handle->sector_data_pool->maximum_number_of_free_sector_data",
+	 volume_data_handle->sector_data_pool->maximum_number_of_free_sector_data,
+	 64 );
+
+	result = libfvde_sector_data_free(
+	          &sector_data,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_volume_data_handle_get_sector_data(
+	          NULL,
+	          512,
+	          &sector_data,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_volume_data_handle_get_sector_data(
+	          volume_data_handle,
+	          1024,
+	          &sector_data,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_volume_data_handle_free(
+	          &volume_data_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "volume_data_handle",
+	 volume_data_handle );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sector_data != NULL )
+	{
+		libfvde_sector_data_free(
+		 &sector_data,
+		 NULL );
+	}
+	if( volume_data_handle != NULL )
+	{
+		libfvde_volume_data_handle_free(
+		 &volume_data_handle,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfvde_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_volume_data_handle_read_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_volume_data_handle_read_buffer(
+     void )
+{
+	uint8_t buffer[ 1024 ];
+
+	libcerror_error_t *error                         = NULL;
+	libfvde_io_handle_t *io_handle                   = NULL;
+	libfvde_volume_data_handle_t *volume_data_handle = NULL;
+	ssize_t read_count                               = 0;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->bytes_per_sector = 512;
+
+	result = libfvde_volume_data_handle_initialize(
+	          &volume_data_handle,
+	          io_handle,
+	          1024,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_data_handle",
+	 volume_data_handle );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	read_count = libfvde_volume_data_handle_read_buffer(
+	              volume_data_handle,
+	              NULL,
+	              0,
+	              0,
+	              0,
+	              LIBFVDE_RANGE_FLAG_IS_SPARSE,
+	              buffer,
+	              1024,
+	              &error );
+
+	FVDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 1024 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT8(
+	 "buffer[ 1023 ]",
+	 buffer[ 1023 ],
+	 0 );
+
+	/* Test error cases
+	 */
+	read_count = libfvde_volume_data_handle_read_buffer(
+	              NULL,
+	              NULL,
+	              0,
+	              0,
+	              0,
+	              LIBFVDE_RANGE_FLAG_IS_SPARSE,
+	              buffer,
+	              1024,
+	              &error );
+
+	FVDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfvde_volume_data_handle_read_buffer(
+	              volume_data_handle,
+	              NULL,
+	              0,
+	              0,
+	              0,
+	              LIBFVDE_RANGE_FLAG_IS_SPARSE,
+	              NULL,
+	              1024,
+	              &error );
+
+	FVDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfvde_volume_data_handle_read_buffer(
+	              volume_data_handle,
+	              NULL,
+	              0,
+	              0,
+	              0,
+	              LIBFVDE_RANGE_FLAG_IS_SPARSE,
+	              buffer,
+	              (size_t) SSIZE_MAX + 1,
+	              &error );
+
+	FVDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfvde_volume_data_handle_read_buffer(
+	              volume_data_handle,
+	              NULL,
+	              0,
+	              0,
+	              0,
+	              LIBFVDE_RANGE_FLAG_IS_SPARSE,
+	              buffer,
+	              1000,
+	              &error );
+
+	FVDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_volume_data_handle_free(
+	          &volume_data_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "volume_data_handle",
+	 volume_data_handle );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume_data_handle != NULL )
+	{
+		libfvde_volume_data_handle_free(
+		 &volume_data_handle,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfvde_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
 
 /* The main program
@@ -371,6 +807,16 @@ int main(
 	 "libfvde_volume_data_handle_free",
 	 fvde_test_volume_data_handle_free );
 
+	/* TODO: add tests for libfvde_volume_data_handle_read_sector */
+
+	FVDE_TEST_RUN(
+	 "libfvde_volume_data_handle_get_sector_data",
+	 fvde_test_volume_data_handle_get_sector_data );
+
+	FVDE_TEST_RUN(
+	 "libfvde_volume_data_handle_read_buffer",
+	 fvde_test_volume_data_handle_read_buffer );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
@@ -483,6 +483,21 @@ class LogicalVolumeTypeTests(unittest.TestCase):
       offset = fvde_logical_volume.get_offset()
       self.assertEqual(offset, size + 16)
 
+      if size > 0 and hasattr(os, "SEEK_DATA") and hasattr(os, "SEEK_HOLE"):
+        fvde_logical_volume.seek_offset(0, os.SEEK_HOLE)
+
+        offset = fvde_logical_volume.get_offset()
+        self.assertGreaterEqual(offset, 0)
+        self.assertLessEqual(offset, size)
+
+        # TODO: change IOError into ValueError
+        with self.assertRaises(IOError):
+          fvde_logical_volume.seek_offset(size, os.SEEK_DATA)
+
+        # TODO: change IOError into ValueError
+        with self.assertRaises(IOError):
+          fvde_logical_volume.seek_offset(size, os.SEEK_HOLE)
+
       # TODO: change IOError into ValueError
       with self.assertRaises(IOError):
         fvde_logical_volume.seek_offset(-1, os.SEEK_SET)
@@ -643,6 +658,52 @@ class LogicalVolumeTypeTests(unittest.TestCase):
 
       fvde_volume.close()
 
+  def test_get_extents(self):
+    """Tests the get_number_of_extents and get_extent functions."""
+    test_source = getattr(unittest, "source", None)
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    if not os.path.isfile(test_source):
+      raise unittest.SkipTest("source not a regular file")
+
+    test_offset = getattr(unittest, "offset", None)
+
+    with DataRangeFileObject(
+        test_source, test_offset or 0, None) as file_object:
+
+      fvde_volume = pyfvde.volume()
+      fvde_volume.open_file_object(file_object)
+      fvde_volume.open_physical_volume_files_as_file_objects([file_object])
+
+      fvde_volume_group = fvde_volume.get_volume_group()
+      self.assertIsNotNone(fvde_volume_group)
+
+      if not fvde_volume_group.number_of_logical_volumes:
+        raise unittest.SkipTest("source has no logical volumes")
+
+      fvde_logical_volume = fvde_volume_group.get_logical_volume(0)
+      self.assertIsNotNone(fvde_logical_volume)
+
+      number_of_extents = fvde_logical_volume.get_number_of_extents()
+      self.assertIsNotNone(number_of_extents)
+
+      self.assertEqual(fvde_logical_volume.number_of_extents, number_of_extents)
+
+      expected_offset = 0
+      for extent_index in range(number_of_extents):
+        extent_offset, extent_size, _, _, _ = fvde_logical_volume.get_extent(
+            extent_index)
+        self.assertGreaterEqual(extent_offset, expected_offset)
+        self.assertGreater(extent_size, 0)
+
+        expected_offset = extent_offset + extent_size
+
+      with self.assertRaises(IOError):
+        fvde_logical_volume.get_extent(number_of_extents)
+
+      fvde_volume.close()
+
 
 if __name__ == "__main__":
   argument_parser = argparse.ArgumentParser()
@@ -7,7 +7,7 @@ EXIT_SUCCESS=0;
 EXIT_FAILURE=1;
 EXIT_IGNORE=77;
 
-LIBRARY_TESTS="bit_stream checksum compression deflate encrypted_metadata encryption_context encryption_context_plist error huffman_tree io_handle keyring logical_volume logical_volume_descriptor metadata metadata_block notify physical_volume physical_volume_descriptor sector_data segment_descriptor volume_data_handle volume_group volume_header";
+LIBRARY_TESTS="bit_stream checksum compression crypto_backend decryption_thread_pool deflate direct_file_io_handle encrypted_metadata encryption_context encryption_context_plist error extent_table huffman_tree io_handle keyring logical_volume logical_volume_descriptor mapped_file_io_handle metadata metadata_block metadata_snapshot notify physical_volume physical_volume_descriptor plist_scanner read_queue sector_cache sector_data sector_data_pool segment_descriptor volume_data_handle volume_group volume_header";
 LIBRARY_TESTS_WITH_INPUT="support volume";
 OPTION_SETS=("offset" "password" "recovery_password");
 